@@ -48,6 +48,13 @@ New alternative functions added:
 -> modbus_receive_raw_confirmation_0x41_LeddarVu
 -> modbus_receive_raw_confirmation_0x41_0x6A_M16
 
+Length aware alternative, no line silence wait when the length is known:
+-> modbus_receive_raw_confirmation_LT: the frame length is predicted from the function code and the header
+   (byte count, detection count, ...), for the standard and the LeddarTech custom function codes. When the
+   layout is unknown, the end of the frame is an inter-frame gap (3.5 characters in RTU, see
+   modbus_rtu_frame_gap_usec) instead of the byte timeout.
+-> modbus_receive_raw_data_gapEnd
+
 Not recommended function:
 -> modbus_receive_confirmation
 
@@ -697,4 +704,390 @@ int modbus_send_raw_data( modbus_t *ctx, uint8_t *data, int length, int crc )
     if( crc != 0 )
         lNewSize = ctx->backend->send_msg_pre( data, length ); // Compute crc and add it at the end of the data
     return ctx->backend->send( ctx, data, lNewSize );
-}
\ No newline at end of file
+}
+
+
+/* Length of the frame (header, data and CRC) when it is computable from the first msg_length bytes.
+Returns 0 if more bytes are needed (*needed is set to the number of bytes to have), or
+MSG_LENGTH_UNDEFINED if the layout of the function is unknown. */
+static int predict_confirmation_length_LT( modbus_t *ctx, const uint8_t *msg, int msg_length,
+        modbus_lt_family_t family, int *needed )
+{
+    const int header = ( int )ctx->backend->header_length;
+    const int crc = ( int )ctx->backend->checksum_length;
+    int function = msg[header];
+    int meta;
+
+    /* Exception: exception code */
+    if( function & 0x80 )
+    {
+        return header + 2 + crc;
+    }
+
+    switch( function )
+    {
+        case MODBUS_FC_WRITE_SINGLE_COIL:
+        case MODBUS_FC_WRITE_SINGLE_REGISTER:
+        case MODBUS_FC_WRITE_MULTIPLE_COILS:
+        case MODBUS_FC_WRITE_MULTIPLE_REGISTERS:
+            return header + 1 + 4 + crc;
+
+        case MODBUS_FC_READ_COILS:
+        case MODBUS_FC_READ_DISCRETE_INPUTS:
+        case MODBUS_FC_READ_HOLDING_REGISTERS:
+        case MODBUS_FC_READ_INPUT_REGISTERS:
+        case MODBUS_FC_REPORT_SLAVE_ID:
+        case MODBUS_FC_WRITE_AND_READ_REGISTERS:
+            /* Byte count */
+            meta = 1;
+            break;
+
+        case 0x41:
+        case 0x6A:
+            /* Detection count */
+            if( family == MODBUS_LT_FAMILY_LEDDARVU && function == 0x41 )
+            {
+                meta = 1;
+            }
+            else if( family == MODBUS_LT_FAMILY_M16 )
+            {
+                meta = 1;
+            }
+            else
+            {
+                return MSG_LENGTH_UNDEFINED;
+            }
+
+            break;
+
+        case 0x42:
+            /* Universal read: base address (4), byte count */
+            if( family == MODBUS_LT_FAMILY_LEDDARONE )
+            {
+                return MSG_LENGTH_UNDEFINED;
+            }
+
+            meta = 5;
+            break;
+
+        case 0x43:
+            /* Universal write: base address (4), written byte count */
+            if( family == MODBUS_LT_FAMILY_LEDDARONE )
+            {
+                return MSG_LENGTH_UNDEFINED;
+            }
+
+            return header + 1 + 5 + crc;
+
+        case 0x44:
+            /* Universal opcode: opcode, return value */
+            if( family == MODBUS_LT_FAMILY_LEDDARONE )
+            {
+                return MSG_LENGTH_UNDEFINED;
+            }
+
+            return header + 1 + 2 + crc;
+
+        default:
+            return MSG_LENGTH_UNDEFINED;
+    }
+
+    if( msg_length < header + 1 + meta )
+    {
+        *needed = header + 1 + meta;
+        return 0;
+    }
+
+    switch( function )
+    {
+        case 0x41:
+            if( family == MODBUS_LT_FAMILY_LEDDARVU )
+            {
+                return header + 2 + ( 6 * msg[header + 1] ) + 7 + crc;
+            }
+
+            return header + 2 + ( 5 * msg[header + 1] ) + 6 + crc;
+
+        case 0x6A:
+            return header + 2 + ( 6 * msg[header + 1] ) + 6 + crc;
+
+        case 0x42:
+            return header + 1 + 5 + msg[header + 5] + crc;
+
+        default:
+            return header + 2 + msg[header + 1] + crc;
+    }
+}
+
+/* Modbus RTU CRC check without side effect (check_integrity flushes on error) */
+static int crc_match_LT( const uint8_t *msg, int msg_length )
+{
+    uint16_t crc = 0xFFFF;
+    int i, j;
+
+    if( msg_length < 3 )
+    {
+        return 0;
+    }
+
+    for( i = 0; i < msg_length - 2; i++ )
+    {
+        crc ^= msg[i];
+
+        for( j = 0; j < 8; j++ )
+        {
+            crc = ( crc & 1 ) ? ( crc >> 1 ) ^ 0xA001 : ( crc >> 1 );
+        }
+    }
+
+    return msg[msg_length - 2] == ( crc & 0xFF ) && msg[msg_length - 1] == ( crc >> 8 );
+}
+
+/* Receives the raw confirmation, the end of the frame is:
+- the length predicted from the header (see predict_confirmation_length_LT), if the CRC matches at that length.
+  Some devices report a wrong byte count (the M16 server id), on a CRC mismatch the frame ends on the gap.
+- else the expected length, if length is not 0 (full length: address, function, data and CRC).
+- else frame_gap_usec of line silence (the inter-frame gap, see modbus_rtu_frame_gap_usec).
+An exception response always ends after the exception code.
+
+The function shall store the read response in rsp and return the number of
+received bytes. Otherwise, its shall return -1 and errno is set.
+
+The function doesn't check the confirmation is the expected response to the
+initial request.
+*/
+int modbus_receive_raw_confirmation_LT( modbus_t *ctx, uint8_t *rsp, modbus_lt_family_t family, int length, int frame_gap_usec )
+{
+    int rc;
+    fd_set rfds;
+    struct timeval tv;
+    int msg_length = 0;
+    int frame_length = 0;
+    int predicted = 0;
+    int on_gap = 0;
+    int length_to_read;
+    int max_length;
+
+    if( ctx == NULL || rsp == NULL || frame_gap_usec <= 0 )
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    max_length = ( int )ctx->backend->max_adu_length;
+
+    if( length > max_length )
+    {
+        length = max_length;
+    }
+
+    FD_ZERO( &rfds );
+    FD_SET( ctx->s, &rfds );
+
+    tv.tv_sec = ctx->response_timeout.tv_sec;
+    tv.tv_usec = ctx->response_timeout.tv_usec;
+    length_to_read = ctx->backend->header_length + 1;
+
+    for( ;; )
+    {
+        rc = ctx->backend->select( ctx, &rfds, &tv, length_to_read );
+
+        if( rc == -1 )
+        {
+            if( on_gap && errno == ETIMEDOUT )
+            {
+                /* Inter-frame gap: end of frame */
+                break;
+            }
+
+            _error_print( ctx, "select" );
+
+            if( ( ctx->error_recovery & MODBUS_ERROR_RECOVERY_LINK ) && errno == ETIMEDOUT )
+            {
+                int saved_errno = errno;
+                modbus_flush( ctx );
+                errno = saved_errno;
+            }
+
+            return -1;
+        }
+
+        rc = ctx->backend->recv( ctx, rsp + msg_length, length_to_read );
+
+        if( rc == 0 )
+        {
+            errno = ECONNRESET;
+            rc = -1;
+        }
+
+        if( rc == -1 )
+        {
+            _error_print( ctx, "read" );
+            return -1;
+        }
+
+        if( ctx->debug )
+        {
+            int i;
+
+            for( i = 0; i < rc; i++ )
+                printf( "<%.2X>", rsp[msg_length + i] );
+        }
+
+        msg_length += rc;
+
+        if( !on_gap && frame_length == 0 && msg_length >= ( int )ctx->backend->header_length + 1 )
+        {
+            int needed = 0;
+            frame_length = predict_confirmation_length_LT( ctx, rsp, msg_length, family, &needed );
+
+            if( frame_length > 0 )
+            {
+                /* An exception is always short, else the caller knows better */
+                predicted = ( length == 0 || ( rsp[ctx->backend->header_length] & 0x80 ) );
+
+                if( !predicted )
+                {
+                    frame_length = length;
+                }
+            }
+            else if( frame_length == 0 )
+            {
+                length_to_read = needed - msg_length;
+            }
+            else if( length != 0 )
+            {
+                frame_length = length;
+            }
+            else
+            {
+                frame_length = 0;
+                on_gap = 1;
+            }
+
+            if( frame_length > max_length )
+            {
+                errno = EMBBADDATA;
+                _error_print( ctx, "too many data" );
+                return -1;
+            }
+        }
+
+        if( frame_length > 0 && msg_length >= frame_length )
+        {
+            if( !predicted || crc_match_LT( rsp, msg_length ) )
+            {
+                break;
+            }
+
+            /* Wrong prediction, the frame ends on the gap */
+            frame_length = 0;
+            on_gap = 1;
+        }
+
+        if( msg_length >= max_length )
+        {
+            break;
+        }
+
+        if( on_gap )
+        {
+            length_to_read = max_length - msg_length;
+            tv.tv_sec = frame_gap_usec / 1000000;
+            tv.tv_usec = frame_gap_usec % 1000000;
+        }
+        else
+        {
+            if( frame_length > 0 )
+            {
+                length_to_read = frame_length - msg_length;
+            }
+
+            tv.tv_sec = ctx->byte_timeout.tv_sec;
+            tv.tv_usec = ctx->byte_timeout.tv_usec;
+        }
+    }
+
+    if( ctx->debug )
+        printf( "\n" );
+
+    return ctx->backend->check_integrity( ctx, rsp, msg_length );
+}
+
+/*
+Reads data (max max_adu_length) from handle until frame_gap_usec of line silence
+*/
+int modbus_receive_raw_data_gapEnd( modbus_t *ctx, uint8_t *rsp, int frame_gap_usec )
+{
+    int rc;
+    fd_set rfds;
+    struct timeval tv;
+    int msg_length = 0;
+    int max_length;
+
+    if( ctx == NULL || rsp == NULL || frame_gap_usec <= 0 )
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    max_length = ( int )ctx->backend->max_adu_length;
+
+    FD_ZERO( &rfds );
+    FD_SET( ctx->s, &rfds );
+
+    tv.tv_sec = ctx->response_timeout.tv_sec;
+    tv.tv_usec = ctx->response_timeout.tv_usec;
+
+    while( msg_length < max_length - 1 )
+    {
+        rc = ctx->backend->select( ctx, &rfds, &tv, max_length - 1 - msg_length );
+
+        if( rc == -1 )
+        {
+            if( msg_length > 0 && errno == ETIMEDOUT )
+            {
+                break;
+            }
+
+            return -1;
+        }
+
+        rc = ctx->backend->recv( ctx, rsp + msg_length, max_length - 1 - msg_length );
+
+        if( rc <= 0 )
+        {
+            if( rc == 0 )
+                errno = ECONNRESET;
+
+            return -1;
+        }
+
+        msg_length += rc;
+        tv.tv_sec = frame_gap_usec / 1000000;
+        tv.tv_usec = frame_gap_usec % 1000000;
+    }
+
+    return msg_length;
+}
+
+/*
+Modbus RTU inter-frame gap in microseconds: 3.5 characters (start, data, parity and stop bits).
+Above 19200 bauds, the specification fixes it to 1750 us.
+*/
+int modbus_rtu_frame_gap_usec( int baud, char parity, int data_bit, int stop_bit )
+{
+    int bits = 1 + data_bit + ( ( parity == 'N' ) ? 0 : 1 ) + stop_bit;
+
+    if( baud <= 0 )
+    {
+        return -1;
+    }
+
+    if( baud > 19200 )
+    {
+        return 1750;
+    }
+
+    return ( int )( ( 35LL * bits * 1000000LL + ( 10LL * baud ) - 1 ) / ( 10LL * baud ) );
+}
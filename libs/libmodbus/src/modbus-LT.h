@@ -14,6 +14,14 @@
 
 MODBUS_LT_BEGIN_DECLS
 
+/* Device family, selects the layout of the custom function codes */
+typedef enum
+{
+    MODBUS_LT_FAMILY_GENERIC = 0,   /* Standard codes and the universal raw opcodes (0x42, 0x43, 0x44) */
+    MODBUS_LT_FAMILY_LEDDARVU,      /* LeddarVu 8 */
+    MODBUS_LT_FAMILY_M16,           /* Evalkit, IS16, M16 */
+    MODBUS_LT_FAMILY_LEDDARONE      /* LeddarOne, 0x43 is CMD_GET_CALIB */
+} modbus_lt_family_t;
 
 int modbus_receive_raw_confirmation_timeoutEnd( modbus_t *ctx, uint8_t *rsp );
 int modbus_receive_raw_confirmation_sizeEnd( modbus_t *ctx, uint8_t *rsp, int length );
@@ -22,6 +30,10 @@ int modbus_receive_raw_confirmation_0x41_0x6A_M16( modbus_t *ctx, uint8_t *rsp )
 int modbus_receive_raw_data_timeoutEnd( modbus_t *ctx, uint8_t *rsp );
 int modbus_send_raw_data( modbus_t *ctx, uint8_t *data, int length, int crc);
 
+int modbus_receive_raw_confirmation_LT( modbus_t *ctx, uint8_t *rsp, modbus_lt_family_t family, int length, int frame_gap_usec );
+int modbus_receive_raw_data_gapEnd( modbus_t *ctx, uint8_t *rsp, int frame_gap_usec );
+int modbus_rtu_frame_gap_usec( int baud, char parity, int data_bit, int stop_bit );
+
 
 MODBUS_LT_END_DECLS
 
@@ -0,0 +1,151 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdAdaptivePoller.cpp
+///
+/// \brief  Implements the LdAdaptivePoller class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdAdaptivePoller.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace
+{
+    const uint32_t MIN_DELAY_US     = 50; ///< First back-off delay
+    const uint32_t MAX_BACKOFF_STEP = 16;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdAdaptivePoller::LdAdaptivePoller( uint32_t aMaxDelayUs )
+///
+/// \brief  Constructor
+///
+/// \param  aMaxDelayUs Maximum delay between two polls in microseconds.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdAdaptivePoller::LdAdaptivePoller( uint32_t aMaxDelayUs ) :
+    mMaxDelayUs( aMaxDelayUs ),
+    mKey( 0 ),
+    mAttempt( 0 ),
+    mLastFailedUs( 0 ),
+    mStart( std::chrono::steady_clock::now() )
+{
+    ResetLatencies();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdAdaptivePoller::Start( uint8_t aKey )
+///
+/// \brief  Start a polling sequence
+///
+/// \param  aKey    Operation key, the latency is learned per key.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdAdaptivePoller::Start( uint8_t aKey )
+{
+    mKey          = aKey;
+    mAttempt      = 0;
+    mLastFailedUs = 0;
+    mStart        = std::chrono::steady_clock::now();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint32_t LeddarConnection::LdAdaptivePoller::NextDelay( void )
+///
+/// \brief  Delay to wait before the next poll. Must be called after each unsuccessful poll.
+///
+/// \returns    The delay in microseconds.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t LeddarConnection::LdAdaptivePoller::NextDelay( void )
+{
+    ++mAttempt;
+    uint64_t lElapsed = GetElapsedUs();
+    mLastFailedUs     = lElapsed;
+
+    if( mAttempt <= IMMEDIATE_POLLS )
+    {
+        return 0;
+    }
+
+    uint32_t lTypical = mTypicalLatencyUs[mKey];
+
+    if( lTypical != 0 && lElapsed < lTypical )
+    {
+        return static_cast<uint32_t>( std::min<uint64_t>( lTypical - lElapsed, mMaxDelayUs ) );
+    }
+
+    uint32_t lStep = std::min<uint32_t>( mAttempt - IMMEDIATE_POLLS - 1, MAX_BACKOFF_STEP );
+    return std::min<uint32_t>( MIN_DELAY_US << lStep, mMaxDelayUs );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdAdaptivePoller::Wait( void )
+///
+/// \brief  Sleep for the next delay
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdAdaptivePoller::Wait( void )
+{
+    uint32_t lDelay = NextDelay();
+
+    if( lDelay == 0 )
+    {
+        std::this_thread::yield();
+    }
+    else
+    {
+        std::this_thread::sleep_for( std::chrono::microseconds( lDelay ) );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdAdaptivePoller::Done( void )
+///
+/// \brief  The polled condition is met: learn the latency of the key (moving average).
+///         The condition was met between the last unsuccessful poll and now, the middle is used so the
+///         sleep overshoot does not make the learned latency grow.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdAdaptivePoller::Done( void )
+{
+    uint64_t  lElapsed = GetElapsedUs();
+    uint32_t  lSample  = static_cast<uint32_t>( std::min<uint64_t>( mAttempt == 0 ? lElapsed : ( mLastFailedUs + lElapsed ) / 2, UINT32_MAX ) );
+    uint32_t &lTypical = mTypicalLatencyUs[mKey];
+
+    lTypical = ( lTypical == 0 ) ? std::max<uint32_t>( lSample, 1 ) : static_cast<uint32_t>( ( static_cast<uint64_t>( lTypical ) * 7 + lSample ) / 8 );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint64_t LeddarConnection::LdAdaptivePoller::GetElapsedUs( void ) const
+///
+/// \brief  Time since the start of the polling sequence
+///
+/// \returns    The elapsed time in microseconds.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t LeddarConnection::LdAdaptivePoller::GetElapsedUs( void ) const
+{
+    return static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - mStart ).count() );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdAdaptivePoller::ResetLatencies( void )
+///
+/// \brief  Forget the learned latencies
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdAdaptivePoller::ResetLatencies( void )
+{
+    memset( mTypicalLatencyUs, 0, sizeof( mTypicalLatencyUs ) );
+}
@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdAdaptivePoller.h
+///
+/// \brief  Declares the LdAdaptivePoller class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <chrono>
+#include <stdint.h>
+
+namespace LeddarConnection
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdAdaptivePoller
+    ///
+    /// \brief  Delay policy for polling loops (device ready, answer wait).
+    ///         The first polls are immediate, then the poller sleeps until the typical latency learned
+    ///         for the operation key (usually the op code) and falls back to an exponential back-off
+    ///         capped to the maximum delay.
+    ///
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdAdaptivePoller
+    {
+    public:
+        enum
+        {
+            IMMEDIATE_POLLS = 2,    ///< Polls done without waiting
+            KEY_COUNT       = 256   ///< Number of keys (one per op code)
+        };
+
+        explicit LdAdaptivePoller( uint32_t aMaxDelayUs = 10000 );
+
+        void     Start( uint8_t aKey );
+        uint32_t NextDelay( void );
+        void     Wait( void );
+        void     Done( void );
+        uint64_t GetElapsedUs( void ) const;
+
+        uint32_t GetTypicalLatency( uint8_t aKey ) const { return mTypicalLatencyUs[aKey]; }
+        void     ResetLatencies( void );
+        void     SetMaxDelay( uint32_t aMaxDelayUs ) { mMaxDelayUs = aMaxDelayUs; }
+        uint32_t GetMaxDelay( void ) const { return mMaxDelayUs; }
+
+    private:
+        uint32_t mTypicalLatencyUs[KEY_COUNT]; ///< Learned latency per key in microseconds, 0 if unknown
+        uint32_t mMaxDelayUs;
+        uint8_t  mKey;
+        uint32_t mAttempt;
+        uint64_t mLastFailedUs;     ///< Time of the last unsuccessful poll since the start
+        std::chrono::steady_clock::time_point mStart;
+    };
+}
@@ -85,8 +85,9 @@ LeddarConnection::LdConnection::~LdConnection()
 void
 LeddarConnection::LdConnection::ResizeInternalBuffers( const uint32_t &aSize )
 {
-    uint8_t *mTransferInputBufferTemp = new uint8_t[ aSize ];
-    uint8_t *mTransferOutputBufferTemp = new uint8_t[ aSize ];
+    // Value initialized: pages are touched now and not on the first receive
+    uint8_t *mTransferInputBufferTemp = new uint8_t[ aSize ]();
+    uint8_t *mTransferOutputBufferTemp = new uint8_t[ aSize ]();
     memcpy( mTransferInputBufferTemp, mTransferInputBuffer, ( aSize > mTransferBufferSize ? mTransferBufferSize : aSize ) );
     memcpy( mTransferOutputBufferTemp, mTransferOutputBuffer, ( aSize > mTransferBufferSize ? mTransferBufferSize : aSize ) );
     delete[] mTransferInputBuffer;
@@ -37,7 +37,7 @@ namespace LeddarConnection
         void                         TakeOwnerShip( bool aOwner ) { mOwner = aOwner; } //Take ownership of mConnectionInfo and mInterface
 
         virtual void                 ResizeInternalBuffers( const uint32_t &aSize );
-        uint16_t                     GetInternalBuffersSize( void ) const { return mTransferBufferSize; }
+        uint32_t                     GetInternalBuffersSize( void ) const { return mTransferBufferSize; }
 
     protected:
         explicit LdConnection( const LdConnectionInfo *aConnectionInfo, LdConnection *aInterface = nullptr );
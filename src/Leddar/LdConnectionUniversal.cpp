@@ -39,7 +39,7 @@ LdConnectionUniversal::LdConnectionUniversal( const LdConnectionInfo *aConnectio
         LdConnection            *aInterface ) :
     LdConnection( aConnectionInfo, aInterface ),
     mAlwaysReadyCheck( false ),
-    mDeviceReadyTimeout( 10 )
+    mReadyPoller( 10000 )
 {
     mIsBigEndian = LeddarUtils::LtIntUtilities::IsBigEndian();
 }
@@ -95,12 +95,15 @@ LdConnectionUniversal::Init()
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// \fn bool LdConnectionUniversal::IsDeviceReady( int32_t aTimeout, int16_t aCRCTry )
+/// \fn bool LdConnectionUniversal::IsDeviceReady( int32_t aTimeout, int16_t aCRCTry, uint8_t aOpCode )
 ///
 /// \brief  Check if the device is ready for read or write.
+///         The status is polled again immediately, then after the latency learned for the op code and
+///         with an exponential back-off capped to the device ready timeout.
 ///
 /// \param  aTimeout    The timeout.
 /// \param  aCRCTry     The CRC try.
+/// \param  aOpCode     The op code the device is processing (0 if unknown), used to learn its typical latency.
 ///
 /// \return Return true if the device is ready.
 ///
@@ -109,25 +112,37 @@ LdConnectionUniversal::Init()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 bool
 LdConnectionUniversal::IsDeviceReady( int32_t aTimeout,
-                                      int16_t  aCRCTry )
+                                      int16_t  aCRCTry,
+                                      uint8_t  aOpCode )
 {
-    while( aTimeout > 0 )
+    if( aTimeout <= 0 )
+    {
+        return false;
+    }
+
+    const uint64_t lTimeoutUs = static_cast<uint64_t>( aTimeout ) * 1000;
+    mReadyPoller.Start( aOpCode );
+
+    while( true )
     {
         try
         {
             if( ( GetStatusRegister( aCRCTry ) & 0x01 ) == 0 )
             {
+                mReadyPoller.Done();
                 return true;
             }
         }
         catch( std::exception & )
         {}
 
-        LeddarUtils::LtTimeUtils::Wait( mDeviceReadyTimeout );
-        aTimeout -= mDeviceReadyTimeout;
-    }
+        if( mReadyPoller.GetElapsedUs() >= lTimeoutUs )
+        {
+            return false;
+        }
 
-    return false;
+        mReadyPoller.Wait();
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
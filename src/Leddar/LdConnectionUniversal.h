@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "LdAdaptivePoller.h"
 #include "LdConnection.h"
 #include "LdConnectionInfo.h"
 #include "LdDefines.h"
@@ -46,19 +47,20 @@ namespace LeddarConnection
         virtual void     SetAlwaysReadyCheck( bool aValue );
         virtual void     SetWriteEnable( bool aStatus, int16_t aCrcTry = 0 );
         virtual uint8_t  GetStatusRegister( int16_t aCRCTry = 0 );
-        virtual bool     IsDeviceReady( int32_t aTimeout, int16_t aCRCTry = 0 );
+        virtual bool     IsDeviceReady( int32_t aTimeout, int16_t aCRCTry = 0, uint8_t aOpCode = 0 );
         virtual bool     IsWriteEnable( int16_t aCrcTry = 0 );
         virtual uint16_t InternalBuffers( uint8_t *( &aInputBuffer ), uint8_t *( &aOutputBuffer ) ) = 0;
+        uint32_t         GetTypicalReadyLatency( uint8_t aOpCode ) const { return mReadyPoller.GetTypicalLatency( aOpCode ); }
 
     protected:
         LdConnectionUniversal( const LdConnectionInfo *aConnectionInfo, LdConnection *aInterface );
         static std::string  GetErrorInfo( uint32_t aErrorCode );
-        void                SetDeviceReadyTimeout( uint16_t aDeviceReadyTimeout ) { mDeviceReadyTimeout = aDeviceReadyTimeout; }
+        void                SetDeviceReadyTimeout( uint16_t aDeviceReadyTimeout ) { mReadyPoller.SetMaxDelay( aDeviceReadyTimeout * 1000u ); }
         bool                mIsBigEndian;
         bool                mAlwaysReadyCheck;
 
     private:
-        uint16_t mDeviceReadyTimeout;
+        LdAdaptivePoller mReadyPoller; ///< Status polling delays, the maximum delay is the device ready timeout
     };
 }
 
@@ -22,6 +22,10 @@ const uint8_t CAN_FUNCTION_CODE_SIZE = 1;
 const uint8_t DATA_SIZE_SIZE = 1;
 const uint8_t ADDRESS_SIZE = 2;
 const uint16_t DEFAULT_BUFFER_SIZE = 2048;
+const uint8_t MAX_READ_WINDOW = 32;
+const uint8_t READ_WINDOW_RETRY = 3;
+const uint32_t READ_WINDOW_TIMEOUT_MS = 100;
+const uint32_t READ_WINDOW_MIN_TIMEOUT_MS = 10;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn LeddarConnection::LdConnectionUniversalCan::LdConnectionUniversalCan( const LdConnectionInfo *aConnectionInfo, LdConnection *aInterface )
@@ -35,13 +39,17 @@ const uint16_t DEFAULT_BUFFER_SIZE = 2048;
 /// \date   October 2018
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 LeddarConnection::LdConnectionUniversalCan::LdConnectionUniversalCan( const LdConnectionInfo *aConnectionInfo, LdConnection *aInterface ) : LdConnectionUniversal( aConnectionInfo, aInterface ),
-    mCurrentBaseAddress( -1 )
+    mCurrentBaseAddress( -1 ),
+    mAnswerPoller( 1000 ),
+    mReadWindow( 1 ),
+    mRetransmissions( 0 )
 {
     mInterfaceCan = dynamic_cast<LeddarConnection::LdInterfaceCan *>( aInterface );
 
     mTransferBufferSize = DEFAULT_BUFFER_SIZE;
     mTransferInputBuffer  = new uint8_t[mTransferBufferSize];
     mTransferOutputBuffer = new uint8_t[mTransferBufferSize];
+    mAnswerFrames.reserve( MAX_READ_WINDOW * LtComCanBus::CAN_DATA_SIZE );
     mInterface->ConnectSignal( this, LeddarCore::LdObject::NEW_DATA );
 }
 
@@ -142,6 +150,12 @@ void LeddarConnection::LdConnectionUniversalCan::Read( uint8_t aOpCode, uint32_t
         uint32_t lBytesToReceive = aDataSize;
         std::vector<uint8_t> lTempBuffer( aDataSize, 0 );
 
+        if( aOpCode == REGMAP_READ && mReadWindow > 1 && aDataSize > 4 )
+        {
+            ReadWindowed( aAddress, aDataSize, lTempBuffer.data() );
+            lBytesToReceive = 0;
+        }
+
         while( lBytesToReceive > 0 )
         {
             ResetBuffers();
@@ -173,17 +187,9 @@ void LeddarConnection::LdConnectionUniversalCan::Read( uint8_t aOpCode, uint32_t
                 throw LeddarException::LtComException( "Couldnt read register " + LeddarUtils::LtStringUtils::IntToString( aAddress, 16 ) );
             }
 
-            uint8_t lCount = 100;
-
-            while( mTransferOutputBuffer[0] == 0 ) //we havent read anything for us yet
+            if( !WaitForAnswer( aOpCode, 100 ) )
             {
-                mInterfaceCan->Read(); //Read something, not necessarily for us
-                LeddarUtils::LtTimeUtils::Wait( 1 );
-
-                if( lCount-- == 0 )
-                {
-                    throw LeddarException::LtTimeoutException( "Timeout waiting for sensor answer reading register " + LeddarUtils::LtStringUtils::IntToString( aAddress, 16 ) );
-                }
+                throw LeddarException::LtTimeoutException( "Timeout waiting for sensor answer reading register " + LeddarUtils::LtStringUtils::IntToString( aAddress, 16 ) );
             }
 
             uint8_t lReadSize = 0;
@@ -293,7 +299,7 @@ void LeddarConnection::LdConnectionUniversalCan::Write( uint8_t aOpCode, uint32_
 
             if( aPostIsReadyTimeout > 0 )
             {
-                if( !IsDeviceReady( aPostIsReadyTimeout ) )
+                if( !IsDeviceReady( aPostIsReadyTimeout, 0, aOpCode ) )
                 {
                     throw LeddarException::LtTimeoutException( "Timeout expired. Device not ready for other operation.", true );
                 }
@@ -393,7 +399,10 @@ void LeddarConnection::LdConnectionUniversalCan::Callback( LdObject *aSender, co
             throw std::runtime_error( "Sensor failed to process command:" + LeddarUtils::LtStringUtils::IntToString( lCanData.mFrame.Cmd.mCmd, 16 ) );
         }
 
+        std::lock_guard<std::mutex> lLock( mAnswerMutex );
         memcpy( mTransferOutputBuffer, lCanData.mFrame.mRawData, LtComCanBus::CAN_DATA_SIZE );
+        mAnswerFrames.insert( mAnswerFrames.end(), lCanData.mFrame.mRawData, lCanData.mFrame.mRawData + LtComCanBus::CAN_DATA_SIZE );
+        mAnswerCondition.notify_all();
     }
     else
     {
@@ -411,10 +420,247 @@ void LeddarConnection::LdConnectionUniversalCan::Callback( LdObject *aSender, co
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void LeddarConnection::LdConnectionUniversalCan::ResetBuffers( void )
 {
+    std::lock_guard<std::mutex> lLock( mAnswerMutex );
+    mAnswerFrames.clear();
     memset( mTransferInputBuffer, 0, mTransferBufferSize );
     memset( mTransferOutputBuffer, 0, mTransferBufferSize );
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarConnection::LdConnectionUniversalCan::WaitForAnswer( uint8_t aOpCode, uint32_t aTimeoutMs, size_t aCount )
+///
+/// \brief  Wait for the answers of the sensor (NEW_DATA from the interface).
+///         The bus is read by this thread, or by the thread of the master interface for multi sensor setups,
+///         between the reads the wait is on the answer condition with the delays of the adaptive poller.
+///
+/// \param  aOpCode     The op code sent, used to learn the typical answer latency.
+/// \param  aTimeoutMs  The timeout in milliseconds.
+/// \param  aCount      Number of answer frames to wait for.
+///
+/// \return True if the answers were received.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarConnection::LdConnectionUniversalCan::WaitForAnswer( uint8_t aOpCode, uint32_t aTimeoutMs, size_t aCount )
+{
+    const uint64_t lTimeoutUs = static_cast<uint64_t>( aTimeoutMs ) * 1000;
+    const size_t lAnswerBytes = aCount * LtComCanBus::CAN_DATA_SIZE;
+    mAnswerPoller.Start( aOpCode );
+
+    std::unique_lock<std::mutex> lLock( mAnswerMutex );
+
+    while( mAnswerFrames.size() < lAnswerBytes )
+    {
+        lLock.unlock();
+        bool lReceived = mInterfaceCan->Read(); //Read something, not necessarily for us
+        lLock.lock();
+
+        if( mAnswerFrames.size() >= lAnswerBytes )
+        {
+            break;
+        }
+
+        if( mAnswerPoller.GetElapsedUs() >= lTimeoutUs )
+        {
+            return false;
+        }
+
+        if( lReceived )
+        {
+            // More frames of the burst may be pending
+            continue;
+        }
+
+        uint32_t lDelay = mAnswerPoller.NextDelay();
+
+        if( lDelay != 0 )
+        {
+            mAnswerCondition.wait_for( lLock, std::chrono::microseconds( lDelay ), [this, lAnswerBytes] { return mAnswerFrames.size() >= lAnswerBytes; } );
+        }
+    }
+
+    mAnswerPoller.Done();
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdConnectionUniversalCan::ReadWindowed( uint32_t aAddress, uint32_t aDataSize, uint8_t *aData )
+///
+/// \brief  Read a memory block with several read requests in flight.
+///         Up to mReadWindow VU_CMD_READ_DATA requests (4 bytes each) are sent back to back, then the answers are
+///         collected and placed by the address they echo. Only the segments without answer are requested again.
+///
+/// \exception  LeddarException::LtTimeoutException Thrown when a segment is still missing after the retries.
+///
+/// \param  aAddress    Address of the data to read.
+/// \param  aDataSize   Size of memory to read.
+/// \param  aData       Destination buffer (aDataSize bytes).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdConnectionUniversalCan::ReadWindowed( uint32_t aAddress, uint32_t aDataSize, uint8_t *aData )
+{
+    struct sSegment
+    {
+        uint32_t mOffset;
+        uint8_t  mSize;
+        bool     mDone;
+    };
+
+    std::vector<sSegment> lSegments;
+
+    for( uint32_t lOffset = 0; lOffset < aDataSize; )
+    {
+        uint32_t lRemaining = aDataSize - lOffset;
+        uint8_t lSize = lRemaining >= 4 ? 4 : ( lRemaining >= 2 ? 2 : 1 ); // 3 bytes reads are not supported
+        lSegments.push_back( { lOffset, lSize, false } );
+        lOffset += lSize;
+    }
+
+    const uint16_t lIdRx = dynamic_cast<const LeddarConnection::LdConnectionInfoCan *>( mConnectionInfo )->GetBaseIdRx();
+    size_t lPending = lSegments.size();
+    size_t lFirstPending = 0;
+    uint8_t lRetry = 0;
+    std::vector<size_t> lWindow;
+    std::vector<uint8_t> lAnswers;
+    lWindow.reserve( mReadWindow );
+
+    while( lPending > 0 )
+    {
+        // Window of pending segments sharing the same base address
+        lWindow.clear();
+        uint32_t lBaseAddress = 0;
+
+        while( lSegments[lFirstPending].mDone )
+        {
+            ++lFirstPending;
+        }
+
+        for( size_t i = lFirstPending; i < lSegments.size() && lWindow.size() < mReadWindow; ++i )
+        {
+            uint32_t lAddress = aAddress + lSegments[i].mOffset;
+
+            if( lSegments[i].mDone )
+            {
+                continue;
+            }
+
+            if( lWindow.empty() )
+            {
+                lBaseAddress = lAddress & 0xFFFF0000;
+            }
+            else if( ( lAddress & 0xFFFF0000 ) != lBaseAddress )
+            {
+                break;
+            }
+
+            lWindow.push_back( i );
+        }
+
+        SetBaseAddress( lBaseAddress );
+        ResetBuffers();
+
+        for( size_t i = 0; i < lWindow.size(); ++i )
+        {
+            const sSegment &lSegment = lSegments[lWindow[i]];
+            LtComCanBus::sCanData lCanData = {};
+            lCanData.mFrame.Cmd.mCmd = LtComCanBus::VU_CMD_READ_DATA;
+            lCanData.mFrame.Cmd.mSubCmd = lSegment.mSize;
+            *reinterpret_cast<uint16_t *>( &lCanData.mFrame.Cmd.mArg[0] ) = static_cast<uint16_t>( ( aAddress + lSegment.mOffset ) & 0xFFFF );
+            mInterfaceCan->Write( lIdRx, std::vector<uint8_t>( lCanData.mFrame.mRawData, lCanData.mFrame.mRawData + LtComCanBus::CAN_DATA_SIZE ) );
+        }
+
+        // Answers echo the command and the 16 LSB of the address, the data starts at byte 4.
+        // Late answers of a previous window are placed if still needed, else ignored.
+        // Missing answers are requested again once the window takes much longer than usual, the wait grows on each retry.
+        uint32_t lTypicalUs = mAnswerPoller.GetTypicalLatency( LtComCanBus::VU_CMD_READ_DATA );
+        uint32_t lTimeoutMs = ( lTypicalUs == 0 ) ? READ_WINDOW_TIMEOUT_MS :
+                              std::max<uint32_t>( 4 * lTypicalUs * static_cast<uint32_t>( lWindow.size() ) / 1000, READ_WINDOW_MIN_TIMEOUT_MS );
+        lTimeoutMs = std::min( lTimeoutMs << lRetry, READ_WINDOW_TIMEOUT_MS );
+
+        const std::chrono::steady_clock::time_point lDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds( lTimeoutMs );
+        size_t lPlaced = 0;
+        size_t lProcessed = 0;
+
+        while( lPlaced < lWindow.size() )
+        {
+            int64_t lRemainingMs = std::chrono::duration_cast<std::chrono::milliseconds>( lDeadline - std::chrono::steady_clock::now() ).count();
+
+            if( lRemainingMs <= 0 || !WaitForAnswer( LtComCanBus::VU_CMD_READ_DATA, static_cast<uint32_t>( lRemainingMs ), lProcessed + 1 ) )
+            {
+                break;
+            }
+
+            {
+                std::lock_guard<std::mutex> lLock( mAnswerMutex );
+                lAnswers.assign( mAnswerFrames.begin() + lProcessed * LtComCanBus::CAN_DATA_SIZE, mAnswerFrames.end() );
+            }
+
+            for( size_t lFrame = 0; lFrame + LtComCanBus::CAN_DATA_SIZE <= lAnswers.size(); lFrame += LtComCanBus::CAN_DATA_SIZE )
+            {
+                const uint8_t *lAnswer = &lAnswers[lFrame];
+                ++lProcessed;
+
+                if( lAnswer[0] != LtComCanBus::VU_CMD_READ_DATA )
+                {
+                    continue;
+                }
+
+                uint32_t lAddress = lBaseAddress | *reinterpret_cast<const uint16_t *>( &lAnswer[2] );
+
+                for( size_t i = 0; i < lWindow.size(); ++i )
+                {
+                    sSegment &lSegment = lSegments[lWindow[i]];
+
+                    if( !lSegment.mDone && aAddress + lSegment.mOffset == lAddress )
+                    {
+                        memcpy( aData + lSegment.mOffset, &lAnswer[4], lSegment.mSize );
+                        lSegment.mDone = true;
+                        --lPending;
+                        ++lPlaced;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if( lPlaced < lWindow.size() )
+        {
+            mRetransmissions += static_cast<uint32_t>( lWindow.size() - lPlaced );
+
+            if( lPlaced == 0 && ++lRetry > READ_WINDOW_RETRY )
+            {
+                throw LeddarException::LtTimeoutException( "Timeout waiting for sensor answer reading register " + LeddarUtils::LtStringUtils::IntToString( aAddress + lSegments[lWindow[0]].mOffset, 16 ) );
+            }
+        }
+
+        if( lPlaced != 0 )
+        {
+            lRetry = 0;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdConnectionUniversalCan::SetReadWindow( uint8_t aWindow )
+///
+/// \brief  Set the number of read requests sent before waiting for the answers.
+///         1 (default) waits for each answer before sending the next request.
+///
+/// \param  aWindow The window, from 1 to 32.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdConnectionUniversalCan::SetReadWindow( uint8_t aWindow )
+{
+    if( aWindow == 0 || aWindow > MAX_READ_WINDOW )
+    {
+        throw std::invalid_argument( "Read window must be between 1 and " + LeddarUtils::LtStringUtils::IntToString( MAX_READ_WINDOW ) );
+    }
+
+    mReadWindow = aWindow;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn uint16_t LeddarConnection::LdConnectionUniversalCan::SetBaseAddress(uint32_t aFullAddress)
 ///
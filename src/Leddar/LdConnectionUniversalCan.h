@@ -12,6 +12,10 @@
 
 #include "LdConnectionUniversal.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
 namespace LeddarConnection
 {
     class LdInterfaceCan;
@@ -31,12 +35,24 @@ namespace LeddarConnection
         virtual void Reset( LeddarDefines::eResetType aType, bool aEnterBootloader ) override;
         virtual uint16_t InternalBuffers( uint8_t *( &aInputBuffer ), uint8_t *( &aOutputBuffer ) ) override;
 
+        void     SetReadWindow( uint8_t aWindow );
+        uint8_t  GetReadWindow( void ) const { return mReadWindow; }
+        uint32_t GetRetransmissionCount( void ) const { return mRetransmissions; }
+
     private:
         LdInterfaceCan *mInterfaceCan;
         uint32_t mCurrentBaseAddress;
+        std::mutex mAnswerMutex;
+        std::condition_variable mAnswerCondition;   ///< Signaled when the interface emits NEW_DATA for this connection
+        std::vector<uint8_t> mAnswerFrames;         ///< Frames received since the last ResetBuffers (CAN_DATA_SIZE bytes each)
+        LdAdaptivePoller mAnswerPoller;
+        uint8_t mReadWindow;                        ///< Number of read requests sent before waiting for the answers
+        uint32_t mRetransmissions;
 
         void Callback( LdObject *aSender, const SIGNALS aSignal, void *aCanData ) override;
         void ResetBuffers( void );
+        bool WaitForAnswer( uint8_t aOpCode, uint32_t aTimeoutMs, size_t aCount = 1 );
+        void ReadWindowed( uint32_t aAddress, uint32_t aDataSize, uint8_t *aData );
         uint16_t SetBaseAddress( uint32_t aFullAddress );
     };
 }
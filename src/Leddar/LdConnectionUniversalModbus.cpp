@@ -420,7 +420,7 @@ LdConnectionUniversalModbus::Write( uint8_t aOpCode, uint32_t aAddress, const ui
 
             if( aPostIsReadyTimeout > 0 )
             {
-                if( !IsDeviceReady( aPostIsReadyTimeout ) )
+                if( !IsDeviceReady( aPostIsReadyTimeout, 0, aOpCode ) )
                 {
                     throw LeddarException::LtTimeoutException( "(LdConnectionUniversalModbus::Write) Timeout expired. Device not ready for other operation ( timeout: " + LeddarUtils::LtStringUtils::IntToString(
                                 aPostIsReadyTimeout ) + " ).", true );
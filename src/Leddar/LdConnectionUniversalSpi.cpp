@@ -348,7 +348,7 @@ LdConnectionUniversalSpi::Write( uint8_t          aOpCode,
 
             if( aPostIsReadyTimeout > 0 )
             {
-                if( !IsDeviceReady( aPostIsReadyTimeout ) )
+                if( !IsDeviceReady( aPostIsReadyTimeout, 0, aOpCode ) )
                 {
                     throw LeddarException::LtTimeoutException( "Timeout expired. Device not ready for other operation.", true );
                 }
@@ -59,13 +59,21 @@ namespace LeddarConnection
         LdDoubleBuffer()  = default;
         ~LdDoubleBuffer() = default;
 
-        void Swap()
+        /// \returns True if the swap had to wait for a buffer lock
+        bool Swap()
         {
-            std::lock( mSetBuffer->mMutex, mGetBuffer->mMutex );
+            bool lContended = ( std::try_lock( mSetBuffer->mMutex, mGetBuffer->mMutex ) != -1 );
+
+            if( lContended )
+            {
+                std::lock( mSetBuffer->mMutex, mGetBuffer->mMutex );
+            }
+
             std::lock_guard<std::mutex> lockSet( mSetBuffer->mMutex, std::adopt_lock );
             std::lock_guard<std::mutex> lockGet( mGetBuffer->mMutex, std::adopt_lock );
 
             std::swap( mSetBuffer, mGetBuffer );
+            return lContended;
         };
 
         std::unique_lock<std::mutex> GetUniqueLock( eBuffer aBuffer, bool aDefer = false ) const
@@ -0,0 +1,212 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdEchoFilter.cpp
+///
+/// \brief  Implements the LdEchoFilter class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdEchoFilter.h"
+
+#include "LdResultEchoes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+    // Scales an unscaled threshold, rounded toward the kept values and saturated to the type of the echo field
+    template <typename T> T ScaleThreshold( float aValue, uint32_t aScale, bool aLowerBound )
+    {
+        const double lScaled = aLowerBound ? std::ceil( static_cast<double>( aValue ) * aScale ) : std::floor( static_cast<double>( aValue ) * aScale );
+
+        if( lScaled <= static_cast<double>( std::numeric_limits<T>::min() ) )
+            return std::numeric_limits<T>::min();
+
+        if( lScaled >= static_cast<double>( std::numeric_limits<T>::max() ) )
+            return std::numeric_limits<T>::max();
+
+        return static_cast<T>( lScaled );
+    }
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdEchoFilter::LdEchoFilter( void )
+///
+/// \brief  Constructor, the filter keeps all the echoes.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdEchoFilter::LdEchoFilter( void ) { Reset(); }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdEchoFilter::Reset( void )
+///
+/// \brief  Remove all the criteria, the filter keeps all the echoes.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdEchoFilter::Reset( void )
+{
+    mRequiredFlags = 0;
+    mRejectedFlags = 0;
+    mMinDistance   = -std::numeric_limits<float>::infinity();
+    mMaxDistance   = std::numeric_limits<float>::infinity();
+    mMinAmplitude  = 0;
+    mChannels.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdEchoFilter::SetFlags( uint16_t aRequired, uint16_t aRejected )
+///
+/// \brief  Keep the echoes with all the required flags and none of the rejected flags.
+///
+/// \param  aRequired   Flags that must be set (0x01 for the valid echoes).
+/// \param  aRejected   Flags that must be cleared.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdEchoFilter::SetFlags( uint16_t aRequired, uint16_t aRejected )
+{
+    if( ( aRequired & aRejected ) != 0 )
+    {
+        throw std::invalid_argument( "A flag cannot be required and rejected." );
+    }
+
+    mRequiredFlags = aRequired;
+    mRejectedFlags = aRejected;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdEchoFilter::SetDistanceRange( float aMin, float aMax )
+///
+/// \brief  Keep the echoes with a distance in [aMin, aMax]. Use infinity to remove a bound.
+///
+/// \param  aMin    Minimum distance (unscaled).
+/// \param  aMax    Maximum distance (unscaled).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdEchoFilter::SetDistanceRange( float aMin, float aMax )
+{
+    if( std::isnan( aMin ) || std::isnan( aMax ) || aMin > aMax )
+    {
+        throw std::invalid_argument( "Invalid distance range." );
+    }
+
+    mMinDistance = aMin;
+    mMaxDistance = aMax;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdEchoFilter::SetMinAmplitude( float aMin )
+///
+/// \brief  Keep the echoes with an amplitude of at least aMin.
+///
+/// \param  aMin    Minimum amplitude (unscaled), 0 to keep all the amplitudes.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdEchoFilter::SetMinAmplitude( float aMin )
+{
+    if( std::isnan( aMin ) || aMin < 0 )
+    {
+        throw std::invalid_argument( "Invalid minimum amplitude." );
+    }
+
+    mMinAmplitude = aMin;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdEchoFilter::SetChannelRoi( uint16_t aHChan, uint16_t aFirstColumn, uint16_t aLastColumn, uint16_t aFirstRow, uint16_t aLastRow )
+///
+/// \brief  Keep the echoes of the channels in a rectangle of the sensor channels (channel index = row * aHChan + column).
+///
+/// \param  aHChan          Number of horizontal channels of the sensor.
+/// \param  aFirstColumn    First kept column.
+/// \param  aLastColumn     Last kept column (included).
+/// \param  aFirstRow       First kept row.
+/// \param  aLastRow        Last kept row (included).
+///
+/// \exception  std::invalid_argument   Thrown when the rectangle is empty or outside of the horizontal channels.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdEchoFilter::SetChannelRoi( uint16_t aHChan, uint16_t aFirstColumn, uint16_t aLastColumn, uint16_t aFirstRow, uint16_t aLastRow )
+{
+    if( aHChan == 0 || aFirstColumn > aLastColumn || aLastColumn >= aHChan || aFirstRow > aLastRow )
+    {
+        throw std::invalid_argument( "Invalid channel region of interest." );
+    }
+
+    const size_t lSize = static_cast<size_t>( aHChan ) * ( static_cast<size_t>( aLastRow ) + 1 );
+
+    if( lSize > static_cast<size_t>( std::numeric_limits<uint16_t>::max() ) + 1 )
+    {
+        throw std::invalid_argument( "Invalid channel region of interest." );
+    }
+
+    mChannels.assign( lSize + 1, 0 );
+
+    for( size_t lRow = aFirstRow; lRow <= aLastRow; ++lRow )
+    {
+        for( size_t lColumn = aFirstColumn; lColumn <= aLastColumn; ++lColumn )
+        {
+            mChannels[lRow * aHChan + lColumn] = 1;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarConnection::LdEchoFilter::IsEnabled( void ) const
+///
+/// \brief  Can the filter remove echoes
+///
+/// \returns    False if all the echoes are kept.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarConnection::LdEchoFilter::IsEnabled( void ) const
+{
+    return mRequiredFlags != 0 || mRejectedFlags != 0 || mMinDistance != -std::numeric_limits<float>::infinity() ||
+           mMaxDistance != std::numeric_limits<float>::infinity() || mMinAmplitude > 0 || !mChannels.empty();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint32_t LeddarConnection::LdEchoFilter::Apply( LdEcho *aEchoes, uint32_t aCount, uint32_t aDistanceScale, uint32_t aAmplitudeScale ) const
+///
+/// \brief  Remove the echoes that do not match the criteria, the kept echoes are moved to the start of the array in their order.
+///         The thresholds are scaled once so the echoes are compared in their raw units.
+///
+/// \param [in,out] aEchoes         The echoes.
+/// \param          aCount          Number of echoes.
+/// \param          aDistanceScale  Distance scale of the echoes.
+/// \param          aAmplitudeScale Amplitude scale of the echoes.
+///
+/// \returns    The number of kept echoes.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t LeddarConnection::LdEchoFilter::Apply( LdEcho *aEchoes, uint32_t aCount, uint32_t aDistanceScale, uint32_t aAmplitudeScale ) const
+{
+    const uint16_t lRequired     = mRequiredFlags;
+    const uint16_t lRejected     = mRejectedFlags;
+    const int32_t lMinDistance   = ScaleThreshold<int32_t>( mMinDistance, aDistanceScale, true );
+    const int32_t lMaxDistance   = ScaleThreshold<int32_t>( mMaxDistance, aDistanceScale, false );
+    const uint32_t lMinAmplitude = ScaleThreshold<uint32_t>( mMinAmplitude, aAmplitudeScale, true );
+
+    // Without region of interest, all the channel indexes read the single 1, else the indexes after the region read the last 0
+    static const uint8_t sAllChannels = 1;
+    const uint8_t *lChannels          = mChannels.empty() ? &sAllChannels : mChannels.data();
+    const uint32_t lLastChannel       = mChannels.empty() ? 0 : static_cast<uint32_t>( mChannels.size() - 1 );
+
+    // Short circuit in the order of the usual rejection causes: a wrong branch is cheaper than evaluating all the criteria
+    LdEcho *lEnd = std::remove_if( aEchoes, aEchoes + aCount, [=]( const LdEcho &aEcho ) {
+        return ( aEcho.mFlag & lRequired ) != lRequired || ( aEcho.mFlag & lRejected ) != 0 || aEcho.mDistance < lMinDistance || aEcho.mDistance > lMaxDistance ||
+               aEcho.mAmplitude < lMinAmplitude || lChannels[std::min( static_cast<uint32_t>( aEcho.mChannelIndex ), lLastChannel )] == 0;
+    } );
+
+    return static_cast<uint32_t>( lEnd - aEchoes );
+}
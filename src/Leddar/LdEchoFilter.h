@@ -0,0 +1,58 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdEchoFilter.h
+///
+/// \brief  Declares the LdEchoFilter class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+namespace LeddarConnection
+{
+    struct LdEcho;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdEchoFilter
+    ///
+    /// \brief  Echo selection applied to the decoded echoes before the cartesian conversion and the swap:
+    ///         detection flags, distance gate, minimum amplitude and channel region of interest.
+    ///         The echoes are compacted in place, their order is kept.
+    ///         Distances and amplitudes are unscaled values, they are converted to the result scales once per frame.
+    ///
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdEchoFilter
+    {
+    public:
+        LdEchoFilter( void );
+
+        void SetFlags( uint16_t aRequired, uint16_t aRejected = 0 );
+        void SetDistanceRange( float aMin, float aMax );
+        void SetMinAmplitude( float aMin );
+        void SetChannelRoi( uint16_t aHChan, uint16_t aFirstColumn, uint16_t aLastColumn, uint16_t aFirstRow, uint16_t aLastRow );
+        void ClearChannelRoi( void ) { mChannels.clear(); }
+        void Reset( void );
+
+        uint16_t GetRequiredFlags( void ) const { return mRequiredFlags; }
+        uint16_t GetRejectedFlags( void ) const { return mRejectedFlags; }
+        float GetMinDistance( void ) const { return mMinDistance; }
+        float GetMaxDistance( void ) const { return mMaxDistance; }
+        float GetMinAmplitude( void ) const { return mMinAmplitude; }
+        bool HasChannelRoi( void ) const { return !mChannels.empty(); }
+        bool IsEnabled( void ) const;
+
+        uint32_t Apply( LdEcho *aEchoes, uint32_t aCount, uint32_t aDistanceScale, uint32_t aAmplitudeScale ) const;
+
+    private:
+        uint16_t mRequiredFlags;
+        uint16_t mRejectedFlags;
+        float mMinDistance;
+        float mMaxDistance;
+        float mMinAmplitude;
+        std::vector<uint8_t> mChannels; ///< 1 for the channels of the region of interest, indexed by channel index, and a last 0 for the following channels. Empty for all the channels
+    };
+} // namespace LeddarConnection
@@ -0,0 +1,382 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdEchoFrameAssembler.cpp
+///
+/// \brief  Implements the LdEchoFrameAssembler class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdEchoFrameAssembler.h"
+
+#include <algorithm>
+
+using namespace LeddarConnection;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LdEchoFrameAssembler::LdEchoFrameAssembler( EmitFunction aEmit )
+///
+/// \brief  Constructor
+///
+/// \param  aEmit   Function called for each frame to emit.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LdEchoFrameAssembler::LdEchoFrameAssembler( EmitFunction aEmit )
+    : mEmit( aEmit )
+    , mMaxDetections( 0 )
+    , mHasEmitted( false )
+    , mLastEmittedTimestamp( 0 )
+    , mNewestTimestamp( 0 )
+    , mFragmentReordered( false )
+    , mTimeout( 100 )
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdEchoFrameAssembler::Init( uint32_t aMaxDetections, size_t aFramesInFlight )
+///
+/// \brief  Allocate the frames. Must be called before use, all memory is allocated here.
+///
+/// \param  aMaxDetections  The maximum number of echoes in a frame.
+/// \param  aFramesInFlight Number of frames that can be assembled at the same time.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LdEchoFrameAssembler::Init( uint32_t aMaxDetections, size_t aFramesInFlight )
+{
+    mMaxDetections = aMaxDetections;
+    mFrames.clear();
+    mFrames.resize( std::max<size_t>( aFramesInFlight, 1 ) );
+
+    for( auto &lFrame : mFrames )
+    {
+        lFrame.mEchoes.resize( aMaxDetections );
+        lFrame.mReceived.resize( ( aMaxDetections + 63 ) / 64 );
+    }
+
+    Reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdEchoFrameAssembler::Reset( void )
+///
+/// \brief  Drop the frames in flight (i.e. on reconnection)
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LdEchoFrameAssembler::Reset( void )
+{
+    for( auto &lFrame : mFrames )
+    {
+        LdEcho lEmptyEcho = {};
+        std::fill( lFrame.mEchoes.begin(), lFrame.mEchoes.end(), lEmptyEcho );
+        std::fill( lFrame.mReceived.begin(), lFrame.mReceived.end(), 0 );
+        lFrame.mUsedEnd       = 0;
+        lFrame.mReceivedCount = 0;
+        lFrame.mExpectedCount = 0;
+        lFrame.mLastFragment  = false;
+        lFrame.mRejected      = false;
+        lFrame.mInUse         = false;
+    }
+
+    mHasEmitted = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LdEchoFrameAssembler::LdFrame *LdEchoFrameAssembler::GetFrame( uint32_t aTimestamp )
+///
+/// \brief  Gets the frame of a fragment. A new frame is started if needed, which can emit the oldest frame if no slot is free.
+///
+/// \param  aTimestamp  The timestamp of the fragment.
+///
+/// \returns    Null if the frame was already emitted (late fragment), else the frame.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LdEchoFrameAssembler::LdFrame *LdEchoFrameAssembler::GetFrame( uint32_t aTimestamp )
+{
+    mFragmentReordered = false;
+
+    if( mHasEmitted && !IsOlder( mLastEmittedTimestamp, aTimestamp ) )
+    {
+        ++mStats.mFragmentsLate;
+        return nullptr;
+    }
+
+    LdFrame *lFree = nullptr;
+    bool lHasNewer = false;
+
+    for( auto &lFrame : mFrames )
+    {
+        if( !lFrame.mInUse )
+        {
+            lFree = ( lFree == nullptr ? &lFrame : lFree );
+        }
+        else if( lFrame.mTimestamp == aTimestamp )
+        {
+            if( IsOlder( aTimestamp, mNewestTimestamp ) )
+            {
+                ++mStats.mFragmentsReordered;
+                mFragmentReordered = true;
+            }
+
+            return &lFrame;
+        }
+        else if( IsOlder( aTimestamp, lFrame.mTimestamp ) )
+        {
+            lHasNewer = true;
+        }
+    }
+
+    if( lFree == nullptr )
+    {
+        LdFrame *lOldest = GetOldestFrame();
+
+        if( IsOlder( aTimestamp, lOldest->mTimestamp ) )
+        {
+            // Older than everything in flight and no room for it
+            ++mStats.mFragmentsLate;
+            return nullptr;
+        }
+
+        Emit( *lOldest );
+        lFree = lOldest;
+    }
+
+    if( lHasNewer )
+    {
+        ++mStats.mFragmentsReordered;
+        mFragmentReordered = true;
+    }
+    else
+    {
+        mNewestTimestamp = aTimestamp;
+    }
+
+    lFree->mInUse             = true;
+    lFree->mRejected          = false;
+    lFree->mTimestamp         = aTimestamp;
+    lFree->mMetadata          = LdFrameMetadata();
+    lFree->mNoiseLevelCount   = 0;
+    lFree->mFirstFragmentTime = std::chrono::steady_clock::now();
+    return lFree;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LdEchoFrameAssembler::AddRange( LdFrame &aFrame, uint32_t aStartIndex, uint32_t aCount )
+///
+/// \brief  Mark the echo indexes of a fragment as received.
+///
+/// \param [in,out] aFrame      The frame.
+/// \param          aStartIndex Index of the first echo of the fragment.
+/// \param          aCount      Number of echoes in the fragment.
+///
+/// \returns    False if the range does not fit in the frame.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LdEchoFrameAssembler::AddRange( LdFrame &aFrame, uint32_t aStartIndex, uint32_t aCount )
+{
+    if( aStartIndex > mMaxDetections || aCount > mMaxDetections - aStartIndex )
+    {
+        ++mStats.mFragmentsInvalid;
+        return false;
+    }
+
+    if( !mFragmentReordered && aStartIndex < aFrame.mUsedEnd )
+    {
+        ++mStats.mFragmentsReordered;
+    }
+
+    uint32_t lNewCount = 0;
+
+    for( uint32_t i = aStartIndex; i < aStartIndex + aCount; ++i )
+    {
+        uint64_t lMask = uint64_t( 1 ) << ( i % 64 );
+
+        if( ( aFrame.mReceived[i / 64] & lMask ) == 0 )
+        {
+            aFrame.mReceived[i / 64] |= lMask;
+            ++lNewCount;
+        }
+    }
+
+    if( lNewCount != aCount )
+    {
+        ++mStats.mFragmentsDuplicate;
+    }
+
+    aFrame.mReceivedCount += lNewCount;
+    aFrame.mUsedEnd = std::max( aFrame.mUsedEnd, aStartIndex + aCount );
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdEchoFrameAssembler::SetLastFragment( LdFrame &aFrame, uint32_t aEndIndex )
+///
+/// \brief  The last fragment of the frame (the one with the status) was received
+///
+/// \param [in,out] aFrame      The frame.
+/// \param          aEndIndex   One past the last echo index of the frame (total echo count).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LdEchoFrameAssembler::SetLastFragment( LdFrame &aFrame, uint32_t aEndIndex )
+{
+    aFrame.mExpectedCount = std::max( aEndIndex, aFrame.mUsedEnd );
+    aFrame.mLastFragment  = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdEchoFrameAssembler::RejectFragment( LdFrame &aFrame )
+///
+/// \brief  A fragment of the frame could not be decoded (echoes out of the frame). The frame will be emitted as incomplete.
+///
+/// \param [in,out] aFrame  The frame.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LdEchoFrameAssembler::RejectFragment( LdFrame &aFrame )
+{
+    ++mStats.mFragmentsInvalid;
+    aFrame.mRejected = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdEchoFrameAssembler::EndFragment( LdFrame &aFrame )
+///
+/// \brief  To call once a fragment is decoded. Emit the frame (and the older ones) if it is complete.
+///
+/// \param [in,out] aFrame  The frame.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LdEchoFrameAssembler::EndFragment( LdFrame &aFrame )
+{
+    if( aFrame.mInUse && aFrame.IsComplete() )
+    {
+        EmitOlderThan( aFrame.mTimestamp );
+        Emit( aFrame );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdEchoFrameAssembler::CheckTimeouts( void )
+///
+/// \brief  Emit the frames started more than the timeout ago (and the older ones).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LdEchoFrameAssembler::CheckTimeouts( void )
+{
+    std::chrono::steady_clock::time_point lNow = std::chrono::steady_clock::now();
+
+    for( LdFrame *lOldest = GetOldestFrame(); lOldest != nullptr && lNow - lOldest->mFirstFragmentTime > mTimeout; lOldest = GetOldestFrame() )
+    {
+        Emit( *lOldest );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LdEchoFrameAssembler::LdFrame *LdEchoFrameAssembler::GetOldestFrame( void )
+///
+/// \brief  Gets the oldest frame in flight
+///
+/// \returns    Null if no frame in flight.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LdEchoFrameAssembler::LdFrame *LdEchoFrameAssembler::GetOldestFrame( void )
+{
+    LdFrame *lOldest = nullptr;
+
+    for( auto &lFrame : mFrames )
+    {
+        if( lFrame.mInUse && ( lOldest == nullptr || IsOlder( lFrame.mTimestamp, lOldest->mTimestamp ) ) )
+        {
+            lOldest = &lFrame;
+        }
+    }
+
+    return lOldest;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdEchoFrameAssembler::EmitOlderThan( uint32_t aTimestamp )
+///
+/// \brief  Emit, in order, the frames older than aTimestamp
+///
+/// \param  aTimestamp  The timestamp.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LdEchoFrameAssembler::EmitOlderThan( uint32_t aTimestamp )
+{
+    for( LdFrame *lOldest = GetOldestFrame(); lOldest != nullptr && IsOlder( lOldest->mTimestamp, aTimestamp ); lOldest = GetOldestFrame() )
+    {
+        Emit( *lOldest );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdEchoFrameAssembler::Emit( LdFrame &aFrame )
+///
+/// \brief  Emit a frame and release its slot.
+///
+/// \param [in,out] aFrame  The frame.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LdEchoFrameAssembler::Emit( LdFrame &aFrame )
+{
+    if( aFrame.IsComplete() )
+    {
+        ++mStats.mFramesCompleted;
+    }
+    else
+    {
+        ++mStats.mFramesIncomplete;
+    }
+
+    mStats.mLastFrameReceived = aFrame.mReceivedCount;
+    mStats.mLastFrameExpected = aFrame.mLastFragment ? aFrame.mExpectedCount : 0;
+    mHasEmitted               = true;
+    mLastEmittedTimestamp     = aFrame.mTimestamp;
+
+    uint32_t lStaleCount = aFrame.mUsedEnd;
+
+    try
+    {
+        mEmit( aFrame, lStaleCount );
+    }
+    catch( ... )
+    {
+        Release( aFrame, lStaleCount );
+        throw;
+    }
+
+    Release( aFrame, lStaleCount );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdEchoFrameAssembler::Release( LdFrame &aFrame, uint32_t aStaleCount )
+///
+/// \brief  Release the slot of a frame. Only the used part of the echoes and of the bitmap is cleared.
+///
+/// \param [in,out] aFrame      The frame.
+/// \param          aStaleCount Number of echoes to clear.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LdEchoFrameAssembler::Release( LdFrame &aFrame, uint32_t aStaleCount )
+{
+    LdEcho lEmptyEcho = {};
+    std::fill( aFrame.mEchoes.begin(), aFrame.mEchoes.begin() + std::min<size_t>( aStaleCount, aFrame.mEchoes.size() ), lEmptyEcho );
+    std::fill( aFrame.mReceived.begin(), aFrame.mReceived.begin() + ( aFrame.mUsedEnd + 63 ) / 64, 0 );
+    aFrame.mUsedEnd       = 0;
+    aFrame.mReceivedCount = 0;
+    aFrame.mExpectedCount = 0;
+    aFrame.mLastFragment  = false;
+    aFrame.mRejected      = false;
+    aFrame.mInUse         = false;
+}
@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdEchoFrameAssembler.h
+///
+/// \brief  Declares the LdEchoFrameAssembler class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "LdResultEchoes.h"
+
+#include <chrono>
+#include <functional>
+#include <vector>
+
+namespace LeddarConnection
+{
+    /// \brief  Reassembly statistics
+    struct LdFrameAssemblyStats
+    {
+        uint64_t mFramesCompleted    = 0; ///< Frames emitted with all their echoes
+        uint64_t mFramesIncomplete   = 0; ///< Frames emitted on timeout or eviction, with missing echoes
+        uint64_t mFragmentsReordered = 0; ///< Fragments received after a fragment that follows them
+        uint64_t mFragmentsLate      = 0; ///< Fragments of a frame already emitted (dropped)
+        uint64_t mFragmentsDuplicate = 0; ///< Fragments with echo indexes already received
+        uint64_t mFragmentsInvalid   = 0; ///< Fragments with echo indexes out of range or not decoded (dropped)
+        uint32_t mLastFrameReceived  = 0; ///< Echoes received in the last emitted frame
+        uint32_t mLastFrameExpected  = 0; ///< Echoes expected in the last emitted frame, 0 if the last fragment was not received
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdEchoFrameAssembler
+    ///
+    /// \brief  Reassemble echo frames sent in several datagrams (i.e. LeddarAuto UDP data server).
+    ///         Several frames, keyed by their timestamp, can be in flight. The received echo indexes of each frame
+    ///         are tracked in a bitmap. A frame is emitted, in timestamp order, when all its echoes are received,
+    ///         when a more recent frame is complete, when it timed out or when its slot is needed for a new frame.
+    ///         The receiver of an incomplete frame can test LdFrame::IsComplete, it is published as LdFrameMetadata::mIncomplete.
+    ///
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdEchoFrameAssembler
+    {
+      public:
+        struct LdFrame
+        {
+            uint32_t mTimestamp     = 0;
+            std::vector<LdEcho> mEchoes;
+            std::vector<uint64_t> mReceived;   ///< Bitmap of the received echo indexes
+            uint32_t mUsedEnd       = 0;       ///< One past the highest echo index received
+            uint32_t mReceivedCount = 0;       ///< Number of distinct echoes received
+            uint32_t mExpectedCount = 0;       ///< Total echo count, known when the last fragment (with status) is received
+            bool mLastFragment      = false;   ///< The last fragment was received
+            bool mRejected          = false;   ///< A fragment could not be decoded, the frame is incomplete
+            LdFrameMetadata mMetadata;
+            std::vector<uint8_t> mNoiseLevel;  ///< Raw noise level storage
+            uint32_t mNoiseLevelCount = 0;
+            uint32_t mNoiseLevelSize  = 0;
+            std::chrono::steady_clock::time_point mFirstFragmentTime;
+            bool mInUse             = false;
+
+            bool IsComplete( void ) const { return !mRejected && mLastFragment && mReceivedCount >= mExpectedCount; }
+            uint32_t GetEchoCount( void ) const { return mLastFragment ? mExpectedCount : mUsedEnd; }
+        };
+
+        /// \brief  Called for each frame to emit. The receiver can swap aFrame.mEchoes with a vector of the same size,
+        ///         the first aStaleCount entries of the vector it gives back will be cleared.
+        typedef std::function<void( LdFrame &aFrame, uint32_t &aStaleCount )> EmitFunction;
+
+        explicit LdEchoFrameAssembler( EmitFunction aEmit );
+
+        void Init( uint32_t aMaxDetections, size_t aFramesInFlight = 4 );
+        bool IsInitialized( void ) const { return !mFrames.empty(); }
+        void Reset( void );
+
+        LdFrame *GetFrame( uint32_t aTimestamp );
+        bool AddRange( LdFrame &aFrame, uint32_t aStartIndex, uint32_t aCount );
+        void SetLastFragment( LdFrame &aFrame, uint32_t aEndIndex );
+        void RejectFragment( LdFrame &aFrame );
+        void EndFragment( LdFrame &aFrame );
+        void CheckTimeouts( void );
+
+        void SetTimeout( uint32_t aTimeoutMs ) { mTimeout = std::chrono::milliseconds( aTimeoutMs ); }
+        uint32_t GetTimeout( void ) const { return static_cast<uint32_t>( mTimeout.count() ); }
+        const LdFrameAssemblyStats &GetStats( void ) const { return mStats; }
+        void ResetStats( void ) { mStats = LdFrameAssemblyStats(); }
+
+      private:
+        static bool IsOlder( uint32_t aTimestamp, uint32_t aReference ) { return static_cast<int32_t>( aTimestamp - aReference ) < 0; }
+        LdFrame *GetOldestFrame( void );
+        void EmitOlderThan( uint32_t aTimestamp );
+        void Emit( LdFrame &aFrame );
+        void Release( LdFrame &aFrame, uint32_t aStaleCount );
+
+        EmitFunction mEmit;
+        std::vector<LdFrame> mFrames;
+        uint32_t mMaxDetections;
+        bool mHasEmitted;
+        uint32_t mLastEmittedTimestamp;
+        uint32_t mNewestTimestamp;
+        bool mFragmentReordered; ///< Current fragment already counted as reordered
+        std::chrono::milliseconds mTimeout;
+        LdFrameAssemblyStats mStats;
+    };
+} // namespace LeddarConnection
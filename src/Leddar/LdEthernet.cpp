@@ -64,6 +64,7 @@
 #include <stdlib.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #endif
@@ -113,6 +114,7 @@ LeddarConnection::LdEthernet::LdEthernet( const LdConnectionInfoEthernet *aConne
     ,
 #endif
     mIsConnected( false )
+    , mUDPTruncated( 0 )
 {
     SetDeviceType( aConnectionInfo->GetDeviceType() );
 }
@@ -1163,6 +1165,88 @@ uint32_t LeddarConnection::LdEthernet::ReceiveFrom( std::string &aIpAddress, uin
     return static_cast<uint32_t>( lResult );
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint32_t LeddarConnection::LdEthernet::ReceiveFromScatter( const sScatterBuffer *aBuffers, uint32_t aCount )
+///
+/// \brief  Receive one UDP datagram directly into several buffers (recvmsg / WSARecvFrom).
+///         The buffers are filled in order, so a protocol header and its payload can land in different places without copy.
+///
+/// \param  aBuffers    The destination buffers.
+/// \param  aCount      Number of buffers.
+///
+/// \returns    Number of bytes received, 0 if the datagram was bigger than the buffers (dropped and counted, see GetUDPTruncatedCount).
+///
+/// \exception LtComException when the receive fail
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t LeddarConnection::LdEthernet::ReceiveFromScatter( const sScatterBuffer *aBuffers, uint32_t aCount )
+{
+    const uint32_t lMaxBuffers = 4;
+
+    if( aCount == 0 || aCount > lMaxBuffers )
+    {
+        throw std::invalid_argument( "Invalid scatter buffer count" );
+    }
+
+#ifdef _WIN32
+    WSABUF lBuffers[lMaxBuffers];
+
+    for( uint32_t i = 0; i < aCount; ++i )
+    {
+        lBuffers[i].buf = reinterpret_cast<char *>( aBuffers[i].mData );
+        lBuffers[i].len = aBuffers[i].mSize;
+    }
+
+    DWORD lReceived = 0, lFlags = 0;
+    int32_t lResult = WSARecvFrom( mUDPSocket, lBuffers, aCount, &lReceived, &lFlags, nullptr, nullptr, nullptr, nullptr );
+
+    if( lResult == 0 )
+    {
+        lResult = static_cast<int32_t>( lReceived );
+    }
+    else if( WSAGetLastError() == WSAEMSGSIZE )
+    {
+        ++mUDPTruncated;
+        return 0;
+    }
+
+#else
+    iovec lBuffers[lMaxBuffers];
+
+    for( uint32_t i = 0; i < aCount; ++i )
+    {
+        lBuffers[i].iov_base = aBuffers[i].mData;
+        lBuffers[i].iov_len  = aBuffers[i].mSize;
+    }
+
+    msghdr lMessage     = {};
+    lMessage.msg_iov    = lBuffers;
+    lMessage.msg_iovlen = aCount;
+
+    const int32_t lResult = static_cast<int32_t>( recvmsg( mUDPSocket, &lMessage, 0 ) );
+
+    if( lResult > 0 && ( lMessage.msg_flags & MSG_TRUNC ) != 0 )
+    {
+        // The end of the datagram is lost, the packet is unusable
+        ++mUDPTruncated;
+        return 0;
+    }
+#endif
+
+    if( lResult == SOCKET_ERROR )
+    {
+        int lErr = LAST_ERROR;
+        throw LeddarException::LtComException( "Error to receive UDP data (" + LeddarUtils::LtSystemUtils::ErrnoToString( lErr ) + ")", lErr );
+    }
+    else if( lResult == 0 )
+    {
+        throw LeddarException::LtComException( "Error in Receive ( connection close ).", true );
+    }
+
+    return static_cast<uint32_t>( lResult );
+}
+
 // *****************************************************************************
 // Function: LdEthernet::FlushBuffer
 //
@@ -52,6 +52,8 @@ namespace LeddarConnection
         virtual void CloseUDPSocket( void ) override;
         uint32_t GetUDPPort() override;
         int SelectUDP( uint32_t aTimeoutus ) override;
+        virtual uint32_t ReceiveFromScatter( const sScatterBuffer *aBuffers, uint32_t aCount ) override;
+        virtual uint64_t GetUDPTruncatedCount( void ) const override { return mUDPTruncated; }
         
         static uint64_t CloseSocket( const SOCKET aSocket );
 
@@ -64,6 +66,7 @@ namespace LeddarConnection
         SOCKET mSocket;
         SOCKET mUDPSocket;
         bool mIsConnected;
+        uint64_t mUDPTruncated; ///< Datagrams dropped by ReceiveFromScatter because they did not fit the buffers
     };
 } // namespace LeddarConnection
 
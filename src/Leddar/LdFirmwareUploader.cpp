@@ -0,0 +1,201 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdFirmwareUploader.cpp
+///
+/// \brief  Implements the LdFirmwareUploader class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdFirmwareUploader.h"
+
+#include "LdBoolProperty.h"
+#include "LdIntegerProperty.h"
+#include "LdProtocolLeddarTech.h"
+
+#include "LtExceptions.h"
+#include "LtStringUtils.h"
+
+#include "comm/LtComLeddarTechPublic.h"
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <stdexcept>
+
+namespace
+{
+    uint64_t NowUs( void )
+    {
+        return static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count() );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarDevice::LdFirmwareUploader::LdFirmwareUploader( const uint8_t *aData, uint32_t aSize, uint32_t aChunkSize, uint8_t aWindow )
+///
+/// \brief  Constructor. The data must stay valid until the end of the upload.
+///
+/// \exception  std::invalid_argument   If the chunk size or the window is 0.
+///
+/// \param  aData       Firmware image.
+/// \param  aSize       Size of the image.
+/// \param  aChunkSize  Size of the chunks (block size of the device).
+/// \param  aWindow     Maximum number of chunks sent before waiting for an answer.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarDevice::LdFirmwareUploader::LdFirmwareUploader( const uint8_t *aData, uint32_t aSize, uint32_t aChunkSize, uint8_t aWindow ) :
+    mSize( aSize ),
+    mWindow( aWindow ),
+    mAcknowledged( 0 )
+{
+    if( aChunkSize == 0 || aWindow == 0 )
+    {
+        throw std::invalid_argument( "Invalid chunk size or window." );
+    }
+
+    uint32_t lCount = ( aSize + aChunkSize - 1 ) / aChunkSize;
+    mChunks.resize( lCount );
+
+    for( uint32_t i = 0; i < lCount; ++i )
+    {
+        mChunks[i].mIndex  = i;
+        mChunks[i].mOffset = i * aChunkSize;
+        mChunks[i].mData   = aData + mChunks[i].mOffset;
+        mChunks[i].mSize   = std::min( aChunkSize, aSize - mChunks[i].mOffset );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarDevice::LdFirmwareUploader::Upload( LdTransport &aTransport, LeddarCore::LdIntegerProperty *aProcessPercentage,
+/// LeddarCore::LdBoolProperty *aCancel )
+///
+/// \brief  Send the image, up to the window size chunks in flight. The exceptions of the transport (rejected
+///         chunk, disconnection) end the upload, GetAcknowledgedSize tells how much the device accepted.
+///
+/// \param [in,out] aProcessPercentage  If non-null, percentage of completion.
+/// \param [in,out] aCancel             If non-null, set to true to cancel the upload.
+///
+/// \returns    True if the whole image is acknowledged, false if the upload was canceled.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarDevice::LdFirmwareUploader::Upload( LdTransport &aTransport, LeddarCore::LdIntegerProperty *aProcessPercentage, LeddarCore::LdBoolProperty *aCancel )
+{
+    std::deque<uint32_t> lInFlight;
+    uint32_t lNext = 0;
+    bool lCanceled = false;
+
+    mAcknowledged = 0;
+
+    while( mAcknowledged < mSize )
+    {
+        lCanceled = lCanceled || ( aCancel != nullptr && aCancel->Value() );
+
+        while( !lCanceled && lInFlight.size() < mWindow && lNext < mChunks.size() )
+        {
+            const sChunk &lChunk = mChunks[lNext++];
+            uint64_t lStart      = NowUs();
+            aTransport.SendChunk( lChunk );
+            Notify( US_SEND, lChunk, lStart );
+            lInFlight.push_back( lChunk.mIndex );
+        }
+
+        if( lInFlight.empty() )
+        {
+            break;
+        }
+
+        const sChunk &lChunk = mChunks[lInFlight.front()];
+        uint64_t lStart      = NowUs();
+        aTransport.WaitAcknowledge( lChunk );
+        Notify( US_ACK, lChunk, lStart );
+        lInFlight.pop_front();
+
+        mAcknowledged = lChunk.mOffset + lChunk.mSize;
+
+        if( aProcessPercentage != nullptr )
+        {
+            aProcessPercentage->ForceValue( 0, static_cast<int64_t>( 100 * static_cast<uint64_t>( mAcknowledged ) / mSize ) );
+        }
+    }
+
+    return IsComplete();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarDevice::LdFirmwareUploader::Notify( eStage aStage, const sChunk &aChunk, uint64_t aStartUs )
+///
+/// \brief  Call the stage callback
+///
+/// \param  aStage      Stage done.
+/// \param  aChunk      Chunk processed.
+/// \param  aStartUs    Start time of the stage (NowUs).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarDevice::LdFirmwareUploader::Notify( eStage aStage, const sChunk &aChunk, uint64_t aStartUs )
+{
+    if( mStageCallback )
+    {
+        mStageCallback( aStage, aChunk, static_cast<uint32_t>( NowUs() - aStartUs ) );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarDevice::LdLeddarTechUpdateTransport::LdLeddarTechUpdateTransport( LeddarConnection::LdProtocolLeddarTech *aProtocol, uint8_t aSoftwareType,
+/// bool aCheckAnswer )
+///
+/// \brief  Constructor
+///
+/// \param [in,out] aProtocol       Configuration protocol, the update session is already opened.
+/// \param          aSoftwareType   Software type of the session (LT_COMM_SOFTWARE_TYPE_...).
+/// \param          aCheckAnswer    Throw if the answer code is not LT_COMM_ANSWER_OK.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarDevice::LdLeddarTechUpdateTransport::LdLeddarTechUpdateTransport( LeddarConnection::LdProtocolLeddarTech *aProtocol, uint8_t aSoftwareType, bool aCheckAnswer ) :
+    mProtocol( aProtocol ),
+    mSoftwareType( aSoftwareType ),
+    mCheckAnswer( aCheckAnswer )
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarDevice::LdLeddarTechUpdateTransport::SendChunk( const LdFirmwareUploader::sChunk &aChunk )
+///
+/// \brief  Send an update block request
+///
+/// \param  aChunk  The chunk to send.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarDevice::LdLeddarTechUpdateTransport::SendChunk( const LdFirmwareUploader::sChunk &aChunk )
+{
+    mProtocol->StartRequest( LtComLeddarTechPublic::LT_COMM_CFGSRV_REQUEST_UPDATE );
+    mProtocol->AddElement( LtComLeddarTechPublic::LT_COMM_ID_PROCESSOR, 1, sizeof( mSoftwareType ), &mSoftwareType, sizeof( mSoftwareType ) );
+    mProtocol->AddElement( LtComLeddarTechPublic::LT_COMM_ID_RAW_DATA, static_cast<uint16_t>( aChunk.mSize ), 1, aChunk.mData, 1 );
+    mProtocol->SendRequest();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarDevice::LdLeddarTechUpdateTransport::WaitAcknowledge( const LdFirmwareUploader::sChunk &aChunk )
+///
+/// \brief  Read the answer of an update block request
+///
+/// \exception  LeddarException::LtComException If the answer code is not LT_COMM_ANSWER_OK (when checked).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarDevice::LdLeddarTechUpdateTransport::WaitAcknowledge( const LdFirmwareUploader::sChunk & )
+{
+    mProtocol->ReadAnswer();
+
+    if( mCheckAnswer && mProtocol->GetAnswerCode() != LtComLeddarTechPublic::LT_COMM_ANSWER_OK )
+    {
+        throw LeddarException::LtComException(
+            "Update firmware error, request code: " + LeddarUtils::LtStringUtils::IntToString( LtComLeddarTechPublic::LT_COMM_CFGSRV_REQUEST_UPDATE ) +
+                " wrong answer code: " + LeddarUtils::LtStringUtils::IntToString( mProtocol->GetAnswerCode() ),
+            LeddarException::ERROR_COM_WRITE );
+    }
+}
@@ -0,0 +1,113 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdFirmwareUploader.h
+///
+/// \brief  Declares the LdFirmwareUploader class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <functional>
+#include <stdint.h>
+#include <vector>
+
+namespace LeddarCore
+{
+    class LdBoolProperty;
+    class LdIntegerProperty;
+}
+
+namespace LeddarConnection
+{
+    class LdProtocolLeddarTech;
+}
+
+namespace LeddarDevice
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdFirmwareUploader
+    ///
+    /// \brief  Sliding window firmware uploader.
+    ///         The image is cut in chunks, up to the window size chunks are sent before waiting for the
+    ///         answer of the oldest one. The integrity of the image is left to the device protocol (the
+    ///         update session of the LeddarTech protocol checks the CRC of the whole file).
+    ///
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdFirmwareUploader
+    {
+    public:
+        enum eStage
+        {
+            US_SEND,    ///< Chunk sent to the transport
+            US_ACK      ///< Wait for the answer of a chunk
+        };
+
+        struct sChunk
+        {
+            uint32_t       mIndex;
+            uint32_t       mOffset;
+            const uint8_t *mData;
+            uint32_t       mSize;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \class  LdTransport
+        ///
+        /// \brief  Device side of the upload. The answers must come in the order the chunks were sent.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////
+        class LdTransport
+        {
+        public:
+            virtual ~LdTransport() {}
+
+            /// \brief  Send a chunk without waiting for its answer
+            virtual void SendChunk( const sChunk &aChunk ) = 0;
+
+            /// \brief  Wait for the answer of the oldest chunk in flight. Throw if the device rejected it.
+            virtual void WaitAcknowledge( const sChunk &aChunk ) = 0;
+        };
+
+        typedef std::function<void( eStage aStage, const sChunk &aChunk, uint32_t aDurationUs )> StageCallback;
+
+        LdFirmwareUploader( const uint8_t *aData, uint32_t aSize, uint32_t aChunkSize, uint8_t aWindow = 1 );
+
+        bool     Upload( LdTransport &aTransport, LeddarCore::LdIntegerProperty *aProcessPercentage = nullptr, LeddarCore::LdBoolProperty *aCancel = nullptr );
+        void     SetStageCallback( const StageCallback &aCallback ) { mStageCallback = aCallback; }
+        uint32_t GetAcknowledgedSize( void ) const { return mAcknowledged; }
+        bool     IsComplete( void ) const { return mAcknowledged == mSize; }
+
+    private:
+        void Notify( eStage aStage, const sChunk &aChunk, uint64_t aStartUs );
+
+        uint32_t            mSize;
+        uint8_t             mWindow;
+        uint32_t            mAcknowledged;  ///< Size of the image acknowledged by the device
+        std::vector<sChunk> mChunks;
+        StageCallback       mStageCallback;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdLeddarTechUpdateTransport
+    ///
+    /// \brief  Firmware update blocks of the LeddarTech configuration protocol (LT_COMM_CFGSRV_REQUEST_UPDATE).
+    ///         The update session must be opened before the upload. The blocks carry no offset nor CRC,
+    ///         a rejected block ends the upload.
+    ///
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdLeddarTechUpdateTransport : public LdFirmwareUploader::LdTransport
+    {
+    public:
+        LdLeddarTechUpdateTransport( LeddarConnection::LdProtocolLeddarTech *aProtocol, uint8_t aSoftwareType, bool aCheckAnswer = true );
+
+        void SendChunk( const LdFirmwareUploader::sChunk &aChunk ) override;
+        void WaitAcknowledge( const LdFirmwareUploader::sChunk &aChunk ) override;
+
+    private:
+        LeddarConnection::LdProtocolLeddarTech *mProtocol;
+        uint8_t mSoftwareType;
+        bool    mCheckAnswer;
+    };
+}
@@ -16,7 +16,10 @@
 #include "LtScope.h"
 #include "LtStringUtils.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdio>
+#include <cstring>
 #include <iomanip>
 #include <ios>
 #include <limits>
@@ -24,8 +27,54 @@
 #include <sstream>
 #include <string>
 
+#if defined( __has_include )
+#if __has_include( <charconv> )
+#include <charconv>
+#endif
+#endif
+
+namespace
+{
+    // Raw storage conversion, the element size is resolved once for the whole buffer
+    template <typename TSource, typename TDestination>
+    void ConvertRaw( const uint8_t *aSource, uint8_t *aDestination, size_t aCount )
+    {
+        for( size_t i = 0; i < aCount; ++i )
+        {
+            TSource lValue;
+            memcpy( &lValue, aSource + i * sizeof( TSource ), sizeof( TSource ) );
+            const TDestination lConverted = static_cast<TDestination>( lValue );
+            memcpy( aDestination + i * sizeof( TDestination ), &lConverted, sizeof( TDestination ) );
+        }
+    }
+
+    template <typename TSource>
+    bool ConvertRawTo( const uint8_t *aSource, uint8_t *aDestination, size_t aCount, size_t aStride )
+    {
+        switch( aStride )
+        {
+        case sizeof( int8_t ):
+            ConvertRaw<TSource, int8_t>( aSource, aDestination, aCount );
+            return true;
+        case sizeof( int16_t ):
+            ConvertRaw<TSource, int16_t>( aSource, aDestination, aCount );
+            return true;
+        case sizeof( int32_t ):
+            ConvertRaw<TSource, int32_t>( aSource, aDestination, aCount );
+            return true;
+        case sizeof( int64_t ):
+            ConvertRaw<TSource, int64_t>( aSource, aDestination, aCount );
+            return true;
+        default:
+            return false;
+        }
+    }
+} // namespace
+
 LeddarCore::LdFloatProperty::LdFloatProperty( const LdFloatProperty &aProperty )
     : LdProperty( aProperty )
+    , mValuesVersion( 0 )
+    , mDeviceValuesVersion( 0 )
 {
     std::lock_guard<std::recursive_mutex> lock( aProperty.mPropertyMutex );
     mMinValue = aProperty.mMinValue;
@@ -66,6 +115,8 @@ LeddarCore::LdFloatProperty::LdFloatProperty( LdProperty::eCategories aCategory,
     , mMaxValue( std::numeric_limits<float>::max() )
     , mScale( aScale )
     , mDecimals( aDecimals )
+    , mValuesVersion( 0 )
+    , mDeviceValuesVersion( 0 )
 {
     SetMaxLimits();
 }
@@ -92,6 +143,12 @@ float LeddarCore::LdFloatProperty::PerformValue( size_t aIndex ) const
         throw std::out_of_range( "Index not valid, verify property count. Property id: " + LeddarUtils::LtStringUtils::IntToString( PerformGetId(), 16 ) );
     }
 
+    // Already scaled by a bulk read
+    if( mValuesVersion == StorageVersion() )
+    {
+        return mValues[aIndex];
+    }
+
     // If scale is 0 value is a float directly. Otherwise it is a fixed-point
     // that we must transform into a float.
     if( mScale != 0 )
@@ -136,6 +193,112 @@ float LeddarCore::LdFloatProperty::PerformDeviceValue( size_t aIndex ) const
     return reinterpret_cast<const float *>( BackupStorage() )[aIndex];
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LeddarCore::LdFloatProperty::GetValues( float *aDestination, size_t aCapacity ) const
+///
+/// \brief  Copy the current values, scaled, in a caller buffer (i.e. a numpy array).
+///
+/// \param [out]    aDestination    The values.
+/// \param          aCapacity       Size of aDestination, the following values are not copied.
+///
+/// \returns    The number of values copied.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t LeddarCore::LdFloatProperty::GetValues( float *aDestination, size_t aCapacity ) const
+{
+    std::lock_guard<std::recursive_mutex> lock( mPropertyMutex );
+    const std::vector<float> &lValues = PerformValues();
+    const size_t lCount               = std::min( lValues.size(), aCapacity );
+
+    if( lCount != 0 )
+    {
+        memcpy( aDestination, lValues.data(), lCount * sizeof( float ) );
+    }
+
+    return lCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn const std::vector<float> &LeddarCore::LdFloatProperty::PerformValues( void ) const
+///
+/// \brief  All the current values, scaled. They are computed on the first read after a write.
+///
+/// \returns    The values, valid until the next write.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const std::vector<float> &LeddarCore::LdFloatProperty::PerformValues( void ) const
+{
+    VerifyInitialization();
+
+    if( mValuesVersion != StorageVersion() )
+    {
+        ScaleValues( CStorage(), mValues );
+        mValuesVersion = StorageVersion();
+    }
+
+    return mValues;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn const std::vector<float> &LeddarCore::LdFloatProperty::PerformDeviceValues( void ) const
+///
+/// \brief  All the backup values (the values in the device), scaled. They are computed on the first read after a write.
+///
+/// \returns    The values, valid until the next write.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const std::vector<float> &LeddarCore::LdFloatProperty::PerformDeviceValues( void ) const
+{
+    VerifyInitialization();
+
+    if( mDeviceValuesVersion != StorageVersion() )
+    {
+        ScaleValues( BackupStorage(), mDeviceValues );
+        mDeviceValuesVersion = StorageVersion();
+    }
+
+    return mDeviceValues;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdFloatProperty::ScaleValues( const uint8_t *aStorage, std::vector<float> &aValues ) const
+///
+/// \brief  Convert a whole storage to floats, same results as PerformValue and PerformDeviceValue.
+///
+/// \param          aStorage    Current or backup storage.
+/// \param [out]    aValues     The values.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarCore::LdFloatProperty::ScaleValues( const uint8_t *aStorage, std::vector<float> &aValues ) const
+{
+    const size_t lCount = PerformCount();
+    aValues.resize( lCount );
+
+    if( lCount == 0 )
+    {
+        return;
+    }
+
+    if( mScale == 0 )
+    {
+        memcpy( aValues.data(), aStorage, lCount * sizeof( float ) );
+        return;
+    }
+
+    const float lScale = static_cast<float>( mScale );
+
+    for( size_t i = 0; i < lCount; ++i )
+    {
+        int32_t lRaw;
+        memcpy( &lRaw, aStorage + i * sizeof( int32_t ), sizeof( int32_t ) );
+        aValues[i] = static_cast<float>( lRaw ) / lScale;
+    }
+}
+
 // *****************************************************************************
 // Function: LdFloatProperty::PerformGetStringValue
 //
@@ -152,8 +315,28 @@ float LeddarCore::LdFloatProperty::PerformDeviceValue( size_t aIndex ) const
 // *****************************************************************************
 std::string LeddarCore::LdFloatProperty::PerformGetStringValue( size_t aIndex ) const
 {
+    const float lValue = PerformValue( aIndex );
+    char lBuffer[64];
+
+#if defined( __cpp_lib_to_chars )
+    const std::to_chars_result lChars = std::to_chars( lBuffer, lBuffer + sizeof( lBuffer ), lValue, std::chars_format::fixed, static_cast<int>( mDecimals ) );
+
+    if( lChars.ec == std::errc() )
+    {
+        return std::string( lBuffer, lChars.ptr );
+    }
+#else
+    const int lSize = snprintf( lBuffer, sizeof( lBuffer ), "%.*f", static_cast<int>( mDecimals ), lValue );
+
+    if( lSize > 0 && static_cast<size_t>( lSize ) < sizeof( lBuffer ) )
+    {
+        return std::string( lBuffer, lSize );
+    }
+#endif
+
+    // Longer than the buffer (large value with many decimals)
     std::stringstream lResult;
-    lResult << std::fixed << std::setprecision( mDecimals ) << PerformValue( aIndex );
+    lResult << std::fixed << std::setprecision( mDecimals ) << lValue;
     return lResult.str();
 }
 
@@ -571,45 +754,27 @@ void LeddarCore::LdFloatProperty::PerformSetRawStorage( uint8_t *aBuffer, size_t
                                          " id: " + LeddarUtils::LtStringUtils::IntToString( PerformGetId(), 16 ) );
         }
 
-        for( uint32_t i = 0; i < aCount; i++ )
+        if( aCount != 0 )
         {
-            int64_t lValue( 0 );
+            bool lConverted = false;
 
-            if( aSize == sizeof( int8_t ) )
-            {
-                lValue = reinterpret_cast<int8_t *>( aBuffer )[i];
-            }
-            else if( aSize == sizeof( int16_t ) )
-            {
-                lValue = reinterpret_cast<int16_t *>( aBuffer )[i];
-            }
-            else if( aSize == sizeof( int64_t ) )
-            {
-                lValue = reinterpret_cast<int64_t *>( aBuffer )[i];
-            }
-            else
+            switch( aSize )
             {
+            case sizeof( int8_t ):
+                lConverted = ConvertRawTo<int8_t>( aBuffer, Storage(), aCount, mStride );
+                break;
+            case sizeof( int16_t ):
+                lConverted = ConvertRawTo<int16_t>( aBuffer, Storage(), aCount, mStride );
+                break;
+            case sizeof( int64_t ):
+                lConverted = ConvertRawTo<int64_t>( aBuffer, Storage(), aCount, mStride );
+                break;
+            default:
                 throw std::logic_error( "Couldnt set storage value - Invalid size: " + LeddarUtils::LtStringUtils::IntToString( aSize ) +
                                         " id: " + LeddarUtils::LtStringUtils::IntToString( PerformGetId(), 16 ) );
             }
 
-            if( mStride == sizeof( int8_t ) )
-            {
-                reinterpret_cast<int8_t *>( &Storage()[0] )[i] = static_cast<int8_t>( lValue );
-            }
-            else if( mStride == sizeof( int16_t ) )
-            {
-                reinterpret_cast<int16_t *>( &Storage()[0] )[i] = static_cast<int16_t>( lValue );
-            }
-            else if( mStride == sizeof( int32_t ) )
-            {
-                reinterpret_cast<int32_t *>( &Storage()[0] )[i] = static_cast<int32_t>( lValue );
-            }
-            else if( mStride == sizeof( int64_t ) )
-            {
-                reinterpret_cast<int64_t *>( &Storage()[0] )[i] = static_cast<int64_t>( lValue );
-            }
-            else
+            if( !lConverted )
             {
                 throw std::logic_error( "Couldnt set storage value - Invalid stride: " + LeddarUtils::LtStringUtils::IntToString( mStride ) +
                                         " id: " + LeddarUtils::LtStringUtils::IntToString( PerformGetId(), 16 ) );
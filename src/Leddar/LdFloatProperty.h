@@ -65,6 +65,19 @@ namespace LeddarCore
             return PerformDeviceValue( aIndex );
         }
 
+        // All the values, scaled. Computed once after each write.
+        std::vector<float> Values( void ) const
+        {
+            std::lock_guard<std::recursive_mutex> lock( mPropertyMutex );
+            return PerformValues();
+        }
+        size_t GetValues( float *aDestination, size_t aCapacity ) const;
+        std::vector<float> DeviceValues( void ) const
+        {
+            std::lock_guard<std::recursive_mutex> lock( mPropertyMutex );
+            return PerformDeviceValues();
+        }
+
         void SetDecimals( uint32_t aValue )
         {
             std::lock_guard<std::recursive_mutex> lock( mPropertyMutex );
@@ -136,10 +149,17 @@ namespace LeddarCore
         }
         float PerformValue( size_t aIndex ) const;
         float PerformDeviceValue( size_t aIndex ) const;
+        const std::vector<float> &PerformValues( void ) const;
+        const std::vector<float> &PerformDeviceValues( void ) const;
+        void ScaleValues( const uint8_t *aStorage, std::vector<float> &aValues ) const;
 
         void PerformSetDecimals( uint32_t aValue ) { mDecimals = aValue; }
         uint32_t PerformGetScale( void ) const { return mScale; }
-        void PerformSetScale( uint32_t aValue ) { mScale = aValue; }
+        void PerformSetScale( uint32_t aValue )
+        {
+            mScale         = aValue;
+            mValuesVersion = mDeviceValuesVersion = 0;
+        }
         void PerformSetMaxLimits( void );
         void PerformSetLimits( float aMin, float aMax );
         void PerformSetRawLimits( int32_t aMin, int32_t aMax );
@@ -154,5 +174,9 @@ namespace LeddarCore
         float mMinValue, mMaxValue;
         uint32_t mScale; // Scale of 0 means its a float, else it's a fixed point (an integer that must be divided by the scale)
         uint32_t mDecimals;
+
+        // Scaled values of the storage version mValuesVersion (current) and mDeviceValuesVersion (backup), 0: not computed
+        mutable std::vector<float> mValues, mDeviceValues;
+        mutable uint64_t mValuesVersion, mDeviceValuesVersion;
     };
 } // namespace LeddarCore
\ No newline at end of file
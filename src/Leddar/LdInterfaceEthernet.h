@@ -26,6 +26,13 @@ namespace LeddarConnection
     class LdInterfaceEthernet : public LdConnection
     {
       public:
+        /// \brief  One destination buffer of a scatter receive
+        struct sScatterBuffer
+        {
+            uint8_t *mData;
+            uint32_t mSize;
+        };
+
         virtual void Connect( void ) override                      = 0;
         virtual void Disconnect( void ) override                   = 0;
         virtual void Send( uint8_t *lBuffer, uint32_t lSize )      = 0;
@@ -39,6 +46,8 @@ namespace LeddarConnection
         virtual void CloseUDPSocket( void )                                                                        = 0;
         virtual uint32_t GetUDPPort()                                                                              = 0;
         virtual int SelectUDP( uint32_t aTimeoutus )                                                               = 0;
+        virtual uint32_t ReceiveFromScatter( const sScatterBuffer *aBuffers, uint32_t aCount )                     = 0;
+        virtual uint64_t GetUDPTruncatedCount( void ) const                                                        = 0;
         
 
       protected:
@@ -41,6 +41,14 @@ extern "C"
 #include "LtTimeUtils.h"
 #include <cerrno>
 
+namespace
+{
+    // Margin added to the RTU inter-frame gap for the host side delays: USB frames for the virtual COM port,
+    // latency timer of the usual USB to serial adapters (16 ms by default) for the others.
+    const uint32_t FRAME_GAP_MARGIN_VIRTUAL_COM = 2000;
+    const uint32_t FRAME_GAP_MARGIN_SERIAL      = 16000;
+} // namespace
+
 // *****************************************************************************
 // Function: LdLibModbusSerial::LdLibModbusSerial
 //
@@ -54,13 +62,23 @@ LeddarConnection::LdLibModbusSerial::LdLibModbusSerial( const LdConnectionInfoMo
     : LeddarConnection::LdInterfaceModbus( aConnectionInfo )
     , mHandle( nullptr )
     , mSharedHandle( false )
+    , mFrameGap( 0 )
+    , mGuardTime( 0 )
+    , mLineState( std::make_shared<sLineState>() )
 {
+    char lParity = mConnectionInfoModbus->GetParity() == LdConnectionInfoModbus::MB_PARITY_NONE ? 'N' : 'E';
+    int lGap     = modbus_rtu_frame_gap_usec( mConnectionInfoModbus->GetBaud(), lParity, mConnectionInfoModbus->GetDataBits(), mConnectionInfoModbus->GetStopBits() );
+    mGuardTime   = lGap > 0 ? lGap : 1750;
+    mFrameGap    = mGuardTime + ( LdLibModbusSerial::IsVirtualCOMPort() ? FRAME_GAP_MARGIN_VIRTUAL_COM : FRAME_GAP_MARGIN_SERIAL );
+    mLineState->mIdle = false;
+
     LeddarConnection::LdLibModbusSerial *lExistingModbusConnection = dynamic_cast<LeddarConnection::LdLibModbusSerial *>( aExistingConnection );
 
     if( lExistingModbusConnection != nullptr && lExistingModbusConnection->GetHandle() != nullptr )
     {
         mHandle       = lExistingModbusConnection->GetHandle();
         mSharedHandle = true;
+        mLineState    = lExistingModbusConnection->mLineState;
     }
 }
 
@@ -171,7 +189,7 @@ void LeddarConnection::LdLibModbusSerial::ConnectRaw()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn int LeddarConnection::LdLibModbusSerial::ReadRawData( uint8_t *aBuffer )
 ///
-/// \brief  Reads data (maximum RTU_MAX_ADU_LENGTH) from device until it times out
+/// \brief  Reads data (maximum RTU_MAX_ADU_LENGTH) from device until the line is silent for the frame gap (GetFrameGap)
 ///
 /// \param [in,out] aBuffer The buffer to read data to
 ///
@@ -180,7 +198,7 @@ void LeddarConnection::LdLibModbusSerial::ConnectRaw()
 /// \author David Lévy
 /// \date   November 2020
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-int LeddarConnection::LdLibModbusSerial::ReadRawData( uint8_t *aBuffer ) { return modbus_receive_raw_data_timeoutEnd( mHandle, aBuffer ); }
+int LeddarConnection::LdLibModbusSerial::ReadRawData( uint8_t *aBuffer ) { return modbus_receive_raw_data_gapEnd( mHandle, aBuffer, static_cast<int>( mFrameGap ) ); }
 
 int LeddarConnection::LdLibModbusSerial::WriteRawData( uint8_t *aBuffer, size_t aSize, bool aCRC ) { return modbus_send_raw_data(mHandle, aBuffer, aSize, aCRC ? 1 : 0); }
 
@@ -236,6 +254,7 @@ void LeddarConnection::LdLibModbusSerial::SendRawRequest( uint8_t *aBuffer, uint
                                                    true );
     }
 
+    WaitGuard();
     int lResult = modbus_send_raw_request( mHandle, aBuffer, aSize );
 
     if( lResult < 0 )
@@ -244,6 +263,74 @@ void LeddarConnection::LdLibModbusSerial::SendRawRequest( uint8_t *aBuffer, uint
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdLibModbusSerial::SendRawFrame( const uint8_t *aFrame, uint32_t aSize )
+///
+/// \brief  Send a complete RTU frame (address, function, data and CRC), i.e. a request precomputed once
+///         by LdModbusProgram. The frame is sent after the guard time.
+///
+/// \param  aFrame  The frame.
+/// \param  aSize   Size of the frame, CRC included.
+///
+/// \exception LtComException on error in sending the frame
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdLibModbusSerial::SendRawFrame( const uint8_t *aFrame, uint32_t aSize )
+{
+    if( !IsConnected() )
+    {
+        throw LeddarException::LtNotConnectedException( "Modbus device not connected.", true );
+    }
+
+    modbus_flush( mHandle );
+    WaitGuard();
+
+    // The CRC is part of the frame, the data is not modified
+    if( modbus_send_raw_data( mHandle, const_cast<uint8_t *>( aFrame ), aSize, 0 ) != static_cast<int>( aSize ) )
+    {
+        throw LeddarException::LtComException( "Error on modbus_send_raw_data in SendRawFrame." );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdLibModbusSerial::WaitGuard( void )
+///
+/// \brief  Wait the end of the guard time (GetGuardTime), counted from the end of the last transaction
+///         of the bus: the work done since the last answer is part of the guard.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdLibModbusSerial::WaitGuard( void )
+{
+    if( !mLineState->mIdle )
+    {
+        return;
+    }
+
+    const int64_t lElapsed = std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - mLineState->mIdleSince ).count();
+
+    if( lElapsed < mGuardTime )
+    {
+        LeddarUtils::LtTimeUtils::WaitBlockingMicro( static_cast<uint32_t>( mGuardTime - lElapsed ) );
+    }
+
+    mLineState->mIdle = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdLibModbusSerial::SetLineIdle( void )
+///
+/// \brief  Mark the end of a transaction (last byte of the answer received, or reception failed).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdLibModbusSerial::SetLineIdle( void )
+{
+    mLineState->mIdleSince = std::chrono::steady_clock::now();
+    mLineState->mIdle      = true;
+}
+
 // *****************************************************************************
 // Function: LdLibModbusSerial::ReadRegisters
 //
@@ -267,7 +354,9 @@ void LeddarConnection::LdLibModbusSerial::ReadRegisters( uint16_t aAddr, uint8_t
                                                    true );
     }
 
+    WaitGuard();
     int lStatus = modbus_read_registers( mHandle, aAddr, aNb, aDest );
+    SetLineIdle();
 
     if( lStatus < 0 )
     {
@@ -298,7 +387,9 @@ void LeddarConnection::LdLibModbusSerial::ReadInputRegisters( uint16_t aAddr, ui
                                                    true );
     }
 
+    WaitGuard();
     int lStatus = modbus_read_input_registers( mHandle, aAddr, aNb, aDest );
+    SetLineIdle();
 
     if( lStatus < 0 )
     {
@@ -328,7 +419,9 @@ void LeddarConnection::LdLibModbusSerial::WriteRegister( uint16_t aAddr, int aVa
                                                    true );
     }
 
+    WaitGuard();
     int lStatus = modbus_write_register( mHandle, aAddr, aValue );
+    SetLineIdle();
 
     if( lStatus < 0 )
     {
@@ -348,8 +441,9 @@ void LeddarConnection::LdLibModbusSerial::WriteRegister( uint16_t aAddr, int aVa
 ///                     - Function code
 ///                     - Data
 ///                     - CRC16
-///                     Set to 0 if data length is undefined: this function will use
-///                     a timeout event to determine the end of Modbus frame transaction.
+///                     Set to 0 if data length is undefined: the length is predicted from
+///                     the function code and the header, or the end of the frame is the
+///                     inter-frame gap (GetFrameGap) for the unknown layouts.
 ///
 /// \exception LtComException on error on reception of if an error code in the returned function code.
 ///
@@ -370,28 +464,15 @@ size_t LeddarConnection::LdLibModbusSerial::ReceiveRawConfirmation( uint8_t *aBu
                                                    true );
     }
 
-    // Receive raw data.
-    if( aSize )
-    {
-        lResult = modbus_receive_raw_confirmation_sizeEnd( mHandle, aBuffer, aSize );
+    // Receive raw data. The length is predicted from the header when aSize is 0, the frame gap ends the unknown layouts.
+    lResult = modbus_receive_raw_confirmation_LT( mHandle, aBuffer, static_cast<modbus_lt_family_t>( GetFamily() ), static_cast<int>( aSize ), static_cast<int>( mFrameGap ) );
+    SetLineIdle();
 
-        if( lResult < 0 )
-        {
-            modbus_flush( mHandle );
-            throw LeddarException::LtComException( "Error on modbus modbus_receive_raw_confirmation_sizeEnd in ReceiveRawConfirmation (" +
-                                                   LeddarUtils::LtSystemUtils::ErrnoToString( errno ) + ")." );
-        }
-    }
-    else
+    if( lResult < 0 )
     {
-        lResult = modbus_receive_raw_confirmation_timeoutEnd( mHandle, aBuffer );
-
-        if( lResult < 0 )
-        {
-            modbus_flush( mHandle );
-            throw LeddarException::LtComException( "Error on modbus modbus_receive_raw_confirmation_timeoutEnd in ReceiveRawConfirmation (" +
-                                                   LeddarUtils::LtSystemUtils::ErrnoToString( errno ) + ")." );
-        }
+        modbus_flush( mHandle );
+        throw LeddarException::LtComException( "Error on modbus modbus_receive_raw_confirmation_LT in ReceiveRawConfirmation (" +
+                                               LeddarUtils::LtSystemUtils::ErrnoToString( errno ) + ")." );
     }
 
     // Check if the received message has an error
@@ -429,25 +510,30 @@ int LeddarConnection::LdLibModbusSerial::ReceiveRawConfirmationLT( uint8_t *aBuf
     }
 
     // Receive raw data
+    modbus_lt_family_t lFamily;
+
     if( aDeviceType == LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_IS16 || aDeviceType == LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_M16_EVALKIT ||
         aDeviceType == LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_M16 || aDeviceType == LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_M16_LASER )
     {
-        lResult = modbus_receive_raw_confirmation_0x41_0x6A_M16( mHandle, aBuffer );
+        lFamily = MODBUS_LT_FAMILY_M16;
     }
     else if( aDeviceType == LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_VU8 )
     {
-        lResult = modbus_receive_raw_confirmation_0x41_LeddarVu( mHandle, aBuffer );
+        lFamily = MODBUS_LT_FAMILY_LEDDARVU;
     }
     else
     {
         throw std::runtime_error( "LT custom command not supported for this sensor." );
     }
 
+    lResult = modbus_receive_raw_confirmation_LT( mHandle, aBuffer, lFamily, 0, static_cast<int>( mFrameGap ) );
+    SetLineIdle();
+
     if( lResult < 0 )
     {
         modbus_flush( mHandle );
-        throw LeddarException::LtComException( "Error on modbus modbus_receive_raw_confirmation_timeoutEnd in ReceiveRawConfirmation (" +
-                                               LeddarUtils::LtStringUtils::IntToString( lResult ) + ")." );
+        throw LeddarException::LtComException( "Error on modbus modbus_receive_raw_confirmation_LT in ReceiveRawConfirmationLT (" +
+                                               LeddarUtils::LtSystemUtils::ErrnoToString( errno ) + ")." );
     }
 
     // Check if the received message has an error
@@ -459,6 +545,37 @@ int LeddarConnection::LdLibModbusSerial::ReceiveRawConfirmationLT( uint8_t *aBuf
     return lResult;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn int LeddarConnection::LdLibModbusSerial::GetFamily( void )
+///
+/// \brief  Device family of the custom function codes layout (modbus_lt_family_t), from the device type.
+///
+/// \returns   The family, MODBUS_LT_FAMILY_GENERIC until the device type is known.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int LeddarConnection::LdLibModbusSerial::GetFamily( void )
+{
+    switch( GetDeviceType() )
+    {
+    case LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_IS16:
+    case LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_M16_EVALKIT:
+    case LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_M16:
+    case LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_M16_LASER:
+        return MODBUS_LT_FAMILY_M16;
+
+    case LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_VU8:
+        return MODBUS_LT_FAMILY_LEDDARVU;
+
+    case LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_SCH_EVALKIT:
+    case LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_SCH_LONG_RANGE:
+        return MODBUS_LT_FAMILY_LEDDARONE;
+
+    default:
+        return MODBUS_LT_FAMILY_GENERIC;
+    }
+}
+
 // *****************************************************************************
 // Function: LdLibModbusSerial::IsVirtualCOMPort
 //
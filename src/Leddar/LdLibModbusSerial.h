@@ -20,6 +20,8 @@
 #include "LdConnectionInfoModbus.h"
 #include "LdInterfaceModbus.h"
 
+#include <chrono>
+#include <memory>
 #include <vector>
 
 struct _modbus;
@@ -36,6 +38,7 @@ namespace LeddarConnection
         virtual bool IsConnected( void ) const override { return mHandle != nullptr; }
         virtual void Disconnect( void ) override;
         virtual void SendRawRequest( uint8_t *aBuffer, uint32_t aSize ) override;
+        void SendRawFrame( const uint8_t *aFrame, uint32_t aSize );
         virtual void ReadRegisters( uint16_t aAddr, uint8_t aNb, uint16_t *aDest ) override;
         virtual void ReadInputRegisters( uint16_t aAddr, uint8_t aNb, uint16_t *aDest );
         virtual void WriteRegister( uint16_t aAddr, int aValue ) override;
@@ -50,11 +53,29 @@ namespace LeddarConnection
 
         virtual bool IsVirtualCOMPort( void ) override;
 
+        uint32_t GetFrameGap( void ) const { return mFrameGap; } ///< In us
+        void SetFrameGap( uint32_t aFrameGap ) { mFrameGap = aFrameGap; }
+        uint32_t GetGuardTime( void ) const { return mGuardTime; } ///< In us
+        void SetGuardTime( uint32_t aGuardTime ) { mGuardTime = aGuardTime; }
+
         static std::vector<LdConnectionInfo *> GetDeviceList( void );
 
       protected:
+        int GetFamily( void );
+        void WaitGuard( void );
+        void SetLineIdle( void );
+
+        struct sLineState
+        {
+            std::chrono::steady_clock::time_point mIdleSince; // End of the last transaction
+            bool mIdle;                                       // mIdleSince is valid
+        };
+
         modbus_t *mHandle;
         bool mSharedHandle;
+        uint32_t mFrameGap;                     // Line silence that ends a frame of unknown length (us)
+        uint32_t mGuardTime;                    // Line silence before a request (us)
+        std::shared_ptr<sLineState> mLineState; // Shared by the interfaces of the same bus
     };
 } // namespace LeddarConnection
 
@@ -24,13 +24,15 @@
 #endif
 
 #include <cerrno>
+#include <cstring>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn LeddarRecord::LdLjrRecordReader::LdLjrRecordReader( const std::string &aFile )
 ///
-/// \brief  Constructor
+/// \brief  Constructor. The file is mapped and only the line offsets are indexed, the lines are parsed when they are read.
 ///
-/// \exception  std::logic_error    Raised when the file could not be opened or the record is invalid.
+/// \exception  LeddarException::LtException   Raised when the file could not be opened.
+/// \exception  std::logic_error    Raised when the record is invalid.
 /// \exception  std::runtime_error  Raised when a the header is missing / invalid. (from ReadHeader)
 ///
 /// \param  aFile   The record file to open.
@@ -40,32 +42,28 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 LeddarRecord::LdLjrRecordReader::LdLjrRecordReader( const std::string &aFile )
     : LdRecordReader()
-    , mFile()
+    , mFile( aFile )
 {
-    mFile.open( aFile, std::ios_base::in );
+    const char *lBegin = reinterpret_cast<const char *>( mFile.Data() );
+    const char *lEnd   = lBegin + mFile.Size();
 
-    if( !mFile.is_open() )
+    // Same lines as std::getline: the last line can be unterminated
+    for( const char *lLine = lBegin; lLine < lEnd; )
     {
-        throw std::logic_error( "Could not open file - Error code: " + LeddarUtils::LtStringUtils::IntToString( errno ) );
+        mLines.push_back( static_cast<size_t>( lLine - lBegin ) );
+        const char *lNewLine = static_cast<const char *>( memchr( lLine, '\n', static_cast<size_t>( lEnd - lLine ) ) );
+        lLine                = ( lNewLine == nullptr ) ? lEnd : lNewLine + 1;
     }
 
-    std::string lLine;
-    uint32_t lNbLine = 0;
-
-    while( std::getline( mFile, lLine ) )
-        ++lNbLine;
-
-    if( lNbLine < LJR_HEADER_LINES )
+    if( mLines.size() < LJR_HEADER_LINES )
     {
         throw std::logic_error( "Record is too short." );
     }
 
-    SetRecordSize( lNbLine - LJR_HEADER_LINES );
+    SetRecordSize( static_cast<uint32_t>( mLines.size() ) - LJR_HEADER_LINES );
 
-    mFile.clear();
-    mFile.seekg( 0, std::ifstream::beg );
-
-    std::getline( mFile, lLine );
+    std::string lLine;
+    GetLine( mCurrentLine, lLine );
     ++mCurrentLine;
     ReadHeader( lLine );
 }
@@ -80,10 +78,37 @@ LeddarRecord::LdLjrRecordReader::LdLjrRecordReader( const std::string &aFile )
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 LeddarRecord::LdLjrRecordReader::~LdLjrRecordReader()
 {
-    if( !mFile.is_open() )
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarRecord::LdLjrRecordReader::GetLine( uint32_t aLine, std::string &aText ) const
+///
+/// \brief  Copy a line of the file, without the line feed
+///
+/// \param          aLine   Zero based line number.
+/// \param [out]    aText   The line.
+///
+/// \returns    False if the line is past the end of the file.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarRecord::LdLjrRecordReader::GetLine( uint32_t aLine, std::string &aText ) const
+{
+    if( aLine >= mLines.size() )
     {
-        mFile.close();
+        return false;
     }
+
+    const char *lData = reinterpret_cast<const char *>( mFile.Data() );
+    size_t lEnd       = ( aLine + 1 < mLines.size() ) ? mLines[aLine + 1] - 1 : mFile.Size();
+
+    if( aLine + 1 == mLines.size() && lEnd > mLines[aLine] && lData[lEnd - 1] == '\n' )
+    {
+        --lEnd;
+    }
+
+    aText.assign( lData + mLines[aLine], lEnd - mLines[aLine] );
+    return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -148,7 +173,7 @@ void LeddarRecord::LdLjrRecordReader::ReadNext()
 {
     std::string lLine;
 
-    if( !std::getline( mFile, lLine ) )
+    if( !GetLine( mCurrentLine, lLine ) )
     {
         throw std::out_of_range( "End of file reached" );
     }
@@ -195,18 +220,8 @@ void LeddarRecord::LdLjrRecordReader::MoveTo( uint32_t aFrame )
         throw std::out_of_range( "Requested frame larger than record size" );
     }
 
-    // Not the fastest way, but the easiest to do.
-    mFile.clear();
-    mFile.seekg( 0, std::ifstream::beg );
-    mCurrentLine = 0;
-
-    for( uint32_t i = 0; i < aFrame + LJR_HEADER_LINES - 1; ++i )
-    {
-        std::string lLine;
-        std::getline( mFile, lLine );
-        ++mCurrentLine;
-    }
-
+    // The lines are indexed, only the requested frame is read
+    mCurrentLine = aFrame + LJR_HEADER_LINES - 1;
     ReadNext();
 }
 
@@ -258,8 +273,8 @@ uint32_t LeddarRecord::LdLjrRecordReader::GetCurrentPosition() const { return mC
 void LeddarRecord::LdLjrRecordReader::InitProperties()
 {
     std::string lLine;
+    GetLine( mCurrentLine, lLine ); // Line2
     ++mCurrentLine;
-    std::getline( mFile, lLine ); // Line2
 
     ReadProperties( lLine, PC_Sensor ); // Read all properties
     mSensor->UpdateConstants();         // Update the scale
@@ -862,7 +877,10 @@ void LeddarRecord::LdLjrRecordReader::ReadFrame( const std::string &aLine )
     if( lDOM["frame"].HasMember( "states" ) )
     {
         if(lTimestamp != 0)
+        {
             mSensor->GetResultStates()->SetTimestamp(lTimestamp);
+            mSensor->GetResultStates()->Swap();
+        }
 
         ReadProperties( aLine, PC_States );
     }
@@ -9,8 +9,10 @@
 
 #include "LdRecordReader.h"
 
-#include <fstream>
+#include "LtFileUtils.h"
+
 #include <string>
+#include <vector>
 
 namespace LeddarRecord
 {
@@ -39,7 +41,8 @@ namespace LeddarRecord
         void InitProperties();
 
       private:
-        std::ifstream mFile; /// File handle
+        LeddarUtils::LtFileUtils::LtFileView mFile; /// File view
+        std::vector<size_t> mLines;                 /// Offset of each line in the file
         uint32_t mCurrentLine = 0;
 
         enum ePropContainer
@@ -50,6 +53,7 @@ namespace LeddarRecord
             PC_Echoes  = 3
         };
 
+        bool GetLine( uint32_t aLine, std::string &aText ) const;
         void ReadHeader( const std::string &aLine );
         void ReadProperties( const std::string &aLine, ePropContainer aContainer );
         void ReadEchoProperties( const std::string &aLine );
@@ -412,9 +412,13 @@ void LeddarRecord::LdLjrRecorder::AddPropertyValues( const LeddarCore::LdPropert
         break;
 
     case LeddarCore::LdProperty::TYPE_FLOAT:
-        for( size_t i = 0; i < aProperty->Count(); ++i )
+        if( aProperty->Count() != 0 )
         {
-            mWriter->Double( dynamic_cast<const LeddarCore::LdFloatProperty *>( aProperty )->Value( i ) );
+            // One scaled copy of the whole array
+            for( float lValue : dynamic_cast<const LeddarCore::LdFloatProperty *>( aProperty )->Values() )
+            {
+                mWriter->Double( lValue );
+            }
         }
 
         break;
@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdModbusDetections.cpp
+///
+/// \brief  Implements the decoding of the Modbus detection answers (0x41, 0x6A)
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdModbusDetections.h"
+#ifdef BUILD_MODBUS
+
+#include "LdResultEchoes.h"
+
+#include "comm/Modbus/LtComLeddarM16Modbus.h"
+#include "comm/Modbus/LtComLeddarVu8Modbus.h"
+
+#include <cstring>
+
+namespace
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief  Fixed stride loop over the packed records: the fields are read with memcpy at constant offsets
+    ///         (no unaligned access through the packed structure, no bound check per echo), the compiler
+    ///         unrolls it and keeps the loads in registers.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <size_t STRIDE, size_t FLAG_OFFSET, bool SEGMENT_IN_FLAG>
+    void Unpack( const uint8_t *aSource, uint32_t aCount, LeddarConnection::LdEcho *aEchoes )
+    {
+        for( uint32_t i = 0; i < aCount; ++i, aSource += STRIDE )
+        {
+            uint16_t lDistance, lAmplitude;
+            memcpy( &lDistance, aSource, sizeof( lDistance ) );
+            memcpy( &lAmplitude, aSource + 2, sizeof( lAmplitude ) );
+            const uint8_t lFlag = aSource[FLAG_OFFSET];
+
+            LeddarConnection::LdEcho &lEcho = aEchoes[i];
+            lEcho.mDistance                 = lDistance;
+            lEcho.mAmplitude                = lAmplitude;
+
+            if( SEGMENT_IN_FLAG )
+            {
+                lEcho.mFlag         = lFlag & 0x0F;
+                lEcho.mChannelIndex = ( lFlag & 0xF0 ) >> 4;
+            }
+            else
+            {
+                lEcho.mFlag         = lFlag;
+                lEcho.mChannelIndex = aSource[FLAG_OFFSET + 1];
+            }
+        }
+    }
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdModbusDetections::UnpackVu8( const uint8_t *aSource, uint32_t aCount, LdEcho *aEchoes )
+///
+/// \brief  Unpack LeddarVu 8 detections (0x41)
+///
+/// \param          aSource First sLeddarVu8ModbusDetections.
+/// \param          aCount  Number of detections.
+/// \param [out]    aEchoes Echoes.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdModbusDetections::UnpackVu8( const uint8_t *aSource, uint32_t aCount, LdEcho *aEchoes )
+{
+    static_assert( sizeof( LtComLeddarVu8Modbus::sLeddarVu8ModbusDetections ) == 6, "Unexpected record size" );
+    Unpack<sizeof( LtComLeddarVu8Modbus::sLeddarVu8ModbusDetections ), offsetof( LtComLeddarVu8Modbus::sLeddarVu8ModbusDetections, mFlag ), false>( aSource, aCount,
+                                                                                                                                                  aEchoes );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdModbusDetections::UnpackM16_0x41( const uint8_t *aSource, uint32_t aCount, LdEcho *aEchoes )
+///
+/// \brief  Unpack M16 detections of the 0x41 function
+///
+/// \param          aSource First sLeddarM16Detections0x41.
+/// \param          aCount  Number of detections.
+/// \param [out]    aEchoes Echoes.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdModbusDetections::UnpackM16_0x41( const uint8_t *aSource, uint32_t aCount, LdEcho *aEchoes )
+{
+    static_assert( sizeof( LtComLeddarM16Modbus::sLeddarM16Detections0x41 ) == 5, "Unexpected record size" );
+    Unpack<sizeof( LtComLeddarM16Modbus::sLeddarM16Detections0x41 ), offsetof( LtComLeddarM16Modbus::sLeddarM16Detections0x41, mFlags ), true>( aSource, aCount, aEchoes );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdModbusDetections::UnpackM16_0x6A( const uint8_t *aSource, uint32_t aCount, LdEcho *aEchoes )
+///
+/// \brief  Unpack M16 detections of the 0x6A function
+///
+/// \param          aSource First sLeddarM16Detections0x6A.
+/// \param          aCount  Number of detections.
+/// \param [out]    aEchoes Echoes.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdModbusDetections::UnpackM16_0x6A( const uint8_t *aSource, uint32_t aCount, LdEcho *aEchoes )
+{
+    static_assert( sizeof( LtComLeddarM16Modbus::sLeddarM16Detections0x6A ) == 6, "Unexpected record size" );
+    Unpack<sizeof( LtComLeddarM16Modbus::sLeddarM16Detections0x6A ), offsetof( LtComLeddarM16Modbus::sLeddarM16Detections0x6A, mFlags ), false>( aSource, aCount, aEchoes );
+}
+
+uint16_t LeddarConnection::LdModbusDetections::ReadU16( const uint8_t *aSource )
+{
+    uint16_t lValue;
+    memcpy( &lValue, aSource, sizeof( lValue ) );
+    return lValue;
+}
+
+uint32_t LeddarConnection::LdModbusDetections::ReadU32( const uint8_t *aSource )
+{
+    uint32_t lValue;
+    memcpy( &lValue, aSource, sizeof( lValue ) );
+    return lValue;
+}
+
+#endif
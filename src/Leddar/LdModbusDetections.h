@@ -0,0 +1,39 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdModbusDetections.h
+///
+/// \brief  Declares the decoding of the Modbus detection answers (0x41, 0x6A)
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "LtDefines.h"
+#ifdef BUILD_MODBUS
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace LeddarConnection
+{
+    struct LdEcho;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief  Unpack the packed detection records of a Modbus answer straight into the echoes buffer, without
+    ///         intermediate copy. aSource points to the first record (after the echo count), aEchoes has room for
+    ///         aCount echoes. Distance, amplitude, flag and channel index are written, the other fields are kept.
+    ///
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    namespace LdModbusDetections
+    {
+        void UnpackVu8( const uint8_t *aSource, uint32_t aCount, LdEcho *aEchoes );      ///< sLeddarVu8ModbusDetections
+        void UnpackM16_0x41( const uint8_t *aSource, uint32_t aCount, LdEcho *aEchoes ); ///< sLeddarM16Detections0x41, segment in the high nibble of the flags
+        void UnpackM16_0x6A( const uint8_t *aSource, uint32_t aCount, LdEcho *aEchoes ); ///< sLeddarM16Detections0x6A
+
+        uint16_t ReadU16( const uint8_t *aSource ); ///< Unaligned read of a field of the answer
+        uint32_t ReadU32( const uint8_t *aSource );
+    } // namespace LdModbusDetections
+} // namespace LeddarConnection
+
+#endif
@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdModbusProgram.cpp
+///
+/// \brief  Implements the LdModbusProgram class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdModbusProgram.h"
+#ifdef BUILD_MODBUS
+
+#include "LdLibModbusSerial.h"
+
+#include "LtCRCUtils.h"
+#include "LtExceptions.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdModbusProgram::LdModbusProgram( LdLibModbusSerial *aInterface )
+///
+/// \brief  Constructor.
+///
+/// \param [in] aInterface  The bus, not owned.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdModbusProgram::LdModbusProgram( LdLibModbusSerial *aInterface ) :
+    mInterface( aInterface )
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LeddarConnection::LdModbusProgram::Add( uint8_t aAddress, const uint8_t *aPdu, uint32_t aPduSize, uint32_t aAnswerSize )
+///
+/// \brief  Append a request to the program, its RTU frame is built here.
+///
+/// \param  aAddress    Modbus address of the device.
+/// \param  aPdu        Function code and data.
+/// \param  aPduSize    Size of aPdu.
+/// \param  aAnswerSize Full size of the answer (address and CRC included), 0 to predict it from the answer header.
+///
+/// \returns    The index of the request (argument of Run).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t LeddarConnection::LdModbusProgram::Add( uint8_t aAddress, const uint8_t *aPdu, uint32_t aPduSize, uint32_t aAnswerSize )
+{
+    sRequest lRequest;
+    lRequest.mAnswerSize = aAnswerSize;
+    lRequest.mFrame.reserve( aPduSize + 3 );
+    lRequest.mFrame.push_back( aAddress );
+    lRequest.mFrame.insert( lRequest.mFrame.end(), aPdu, aPdu + aPduSize );
+
+    // RTU CRC, low byte first
+    uint16_t lCrc = LeddarUtils::LtCRCUtils::Crc16( CRCUTILS_CRC16_INIT_VALUE, lRequest.mFrame.data(), lRequest.mFrame.size() );
+    lRequest.mFrame.push_back( static_cast<uint8_t>( lCrc & 0xFF ) );
+    lRequest.mFrame.push_back( static_cast<uint8_t>( lCrc >> 8 ) );
+
+    mRequests.push_back( lRequest );
+    return mRequests.size() - 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LeddarConnection::LdModbusProgram::Run( size_t aIndex, uint8_t *aAnswer )
+///
+/// \brief  Run a transaction of the program: send the request once the guard time of the bus is elapsed,
+///         receive the answer. The answer ends on its last byte (predicted length), the next request of the
+///         program can be sent right away.
+///
+/// \param          aIndex  Index of the request (returned by Add).
+/// \param [out]    aAnswer The answer, at least LTMODBUS_RTU_MAX_ADU_LENGTH bytes.
+///
+/// \returns    The size of the answer.
+///
+/// \exception  LtComException on communication error, or if the answer is an exception.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t LeddarConnection::LdModbusProgram::Run( size_t aIndex, uint8_t *aAnswer )
+{
+    if( mInterface == nullptr )
+    {
+        throw LeddarException::LtComException( "Modbus program without interface." );
+    }
+
+    const sRequest &lRequest = mRequests.at( aIndex );
+    mInterface->SendRawFrame( lRequest.mFrame.data(), static_cast<uint32_t>( lRequest.mFrame.size() ) );
+    return mInterface->ReceiveRawConfirmation( aAnswer, lRequest.mAnswerSize );
+}
+
+#endif
@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdModbusProgram.h
+///
+/// \brief  Declares the LdModbusProgram class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "LtDefines.h"
+#ifdef BUILD_MODBUS
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace LeddarConnection
+{
+    class LdLibModbusSerial;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdModbusProgram
+    ///
+    /// \brief  Frame acquisition program: the requests polled for each frame (i.e. echoes then states), built
+    ///         once with their CRC. Each request is sent as soon as the answer of the previous one is received
+    ///         and the guard time of the bus (LdLibModbusSerial::GetGuardTime) is elapsed.
+    ///
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdModbusProgram
+    {
+    public:
+        explicit LdModbusProgram( LdLibModbusSerial *aInterface = nullptr );
+
+        size_t Add( uint8_t aAddress, const uint8_t *aPdu, uint32_t aPduSize, uint32_t aAnswerSize = 0 );
+        void Clear( void ) { mRequests.clear(); }
+        bool IsEmpty( void ) const { return mRequests.empty(); }
+        size_t GetSize( void ) const { return mRequests.size(); }
+        const std::vector<uint8_t> &GetRequest( size_t aIndex ) const { return mRequests.at( aIndex ).mFrame; } ///< Address, PDU and CRC
+
+        size_t Run( size_t aIndex, uint8_t *aAnswer );
+
+    private:
+        struct sRequest
+        {
+            std::vector<uint8_t> mFrame;
+            uint32_t mAnswerSize; ///< 0 if the length is predicted from the answer header
+        };
+
+        LdLibModbusSerial *mInterface;
+        std::vector<sRequest> mRequests;
+    };
+} // namespace LeddarConnection
+
+#endif
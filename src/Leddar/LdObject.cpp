@@ -7,6 +7,17 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "LdObject.h"
+#include "LdSignalDispatcher.h"
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+namespace
+{
+    // Emissions in flight on this thread (sender, epoch parity), so WaitEmissions does not wait for its own thread
+    thread_local std::vector<std::pair<const LeddarCore::LdObject *, uint32_t>> gThreadEmissions;
+} // namespace
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn LeddarCore::LdObject::LdObject( void )
@@ -17,7 +28,11 @@
 /// \date   January 2016
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 LeddarCore::LdObject::LdObject( void )
+    : mEmitEpoch( 0 )
+    , mEmitWaiters( 0 )
 {
+    mEmitting[0] = 0;
+    mEmitting[1] = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -30,38 +45,49 @@ LeddarCore::LdObject::LdObject( void )
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 LeddarCore::LdObject::~LdObject( void )
 {
-    std::lock_guard<std::mutex> lock( mObjectMutex );
     DisconnectAll();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// \fn void LeddarCore::LdObject::ConnectSignal( LdObject *aSender, const SIGNALS aSignal )
+/// \fn void LeddarCore::LdObject::ConnectSignal( LdObject *aSender, const SIGNALS aSignal, eConnectionType aType )
 ///
 /// \brief  Connect to the sender's signal.
 ///
 /// \param [in,out] aSender Pointer to object to connect.
 /// \param          aSignal Signal to connect.
+/// \param          aType   Direct (called in the emitting thread) or queued (called from the LdSignalDispatcher thread).
 ///
 /// \author Patrick Boulay
 /// \date   January 2016
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void
-LeddarCore::LdObject::ConnectSignal( LdObject *aSender, const SIGNALS aSignal ) const
+LeddarCore::LdObject::ConnectSignal( LdObject *aSender, const SIGNALS aSignal, eConnectionType aType ) const
 {
-    std::lock_guard<std::mutex> lock( mObjectMutex );
-    std::pair<std::multimap< LdObject *, SIGNALS>::iterator, std::multimap< LdObject *, SIGNALS>::iterator> lRange = mReceiverMap.equal_range( aSender );
+    if( aSignal < 0 || aSignal >= SIGNALS_COUNT )
+    {
+        throw std::invalid_argument( "Invalid signal" );
+    }
 
-    for( std::multimap< LdObject *, SIGNALS>::iterator lIter = lRange.first; lIter != lRange.second; ++lIter )
     {
-        if( lIter->second == aSignal && lIter->first == aSender )
+        std::lock_guard<std::mutex> lock( mObjectMutex );
+        std::shared_ptr<const ReceiverList> lCurrent = GetReceivers( aSignal );
+        std::shared_ptr<ReceiverList> lNew           = lCurrent ? std::make_shared<ReceiverList>( *lCurrent ) : std::make_shared<ReceiverList>();
+
+        for( ReceiverList::const_iterator lIter = lNew->begin(); lIter != lNew->end(); ++lIter )
         {
-            throw std::logic_error( "This object is already connected to this signal" );
+            if( lIter->mReceiver == aSender )
+            {
+                throw std::logic_error( "This object is already connected to this signal" );
+            }
         }
-    }
 
-    mReceiverMap.insert( std::make_pair( aSender, aSignal ) );
+        LdReceiver lReceiver = { aSender, aType };
+        lNew->push_back( lReceiver );
+        std::atomic_store( &mReceivers[aSignal], std::shared_ptr<const ReceiverList>( lNew ) );
+    }
 
-    aSender->mConnectedObject.insert( const_cast<LeddarCore::LdObject *>(this) );
+    std::lock_guard<std::mutex> lock( aSender->mObjectMutex );
+    aSender->mConnectedObject.insert( const_cast<LeddarCore::LdObject *>( this ) );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -78,28 +104,53 @@ LeddarCore::LdObject::ConnectSignal( LdObject *aSender, const SIGNALS aSignal )
 void
 LeddarCore::LdObject::DisconnectSignal( LdObject *aSender, const SIGNALS aSignal ) const
 {
-    std::lock_guard<std::mutex> lock( mObjectMutex );
-    std::pair<std::multimap< LdObject *, SIGNALS>::iterator, std::multimap< LdObject *, SIGNALS>::iterator> lRange = mReceiverMap.equal_range( aSender );
-
-    if( lRange.first == mReceiverMap.end() )
+    if( aSignal < 0 || aSignal >= SIGNALS_COUNT )
     {
         return;
     }
 
-    for( std::multimap< LdObject *, SIGNALS>::iterator lIter = lRange.first; lIter != lRange.second; ++lIter )
+    bool lStillConnected = false;
     {
-        if( lIter->second == aSignal && lIter->first == aSender )
-        {
-            mReceiverMap.erase( lIter );
-            break;
-        }
+        std::lock_guard<std::mutex> lock( mObjectMutex );
+        RemoveReceiver( aSender, aSignal );
+        lStillConnected = IsReceiver( aSender );
     }
 
+    // aSender is not called after this function returns
+    WaitEmissions();
+
     // If there is no aSender object, we need to remove this object in the mConnectedObject
-    if( mReceiverMap.find( aSender ) == mReceiverMap.end() )
+    if( !lStillConnected )
+    {
+        std::lock_guard<std::mutex> lock( aSender->mObjectMutex );
+        aSender->mConnectedObject.erase( const_cast<LeddarCore::LdObject *>( this ) );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LeddarCore::LdObject::GetConnectedObjectsSize( void ) const
+///
+/// \brief  Number of connections (receiver / signal pairs) of this object.
+///
+/// \returns    The number of connections.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t LeddarCore::LdObject::GetConnectedObjectsSize( void ) const
+{
+    size_t lCount = 0;
+
+    for( int i = 0; i < SIGNALS_COUNT; ++i )
     {
-        aSender->mConnectedObject.erase( const_cast<LeddarCore::LdObject *>(this) );
+        std::shared_ptr<const ReceiverList> lReceivers = GetReceivers( static_cast<SIGNALS>( i ) );
+
+        if( lReceivers )
+        {
+            lCount += lReceivers->size();
+        }
     }
+
+    return lCount;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -113,17 +164,181 @@ LeddarCore::LdObject::DisconnectSignal( LdObject *aSender, const SIGNALS aSignal
 void
 LeddarCore::LdObject::DisconnectAll( void ) const
 {
-    
+    LdObject *lThis = const_cast<LeddarCore::LdObject *>( this );
+    std::set<LdObject *> lReceivers;
+    std::set<LdObject *> lSenders;
+
+    {
+        std::lock_guard<std::mutex> lock( mObjectMutex );
+
+        for( int i = 0; i < SIGNALS_COUNT; ++i )
+        {
+            std::shared_ptr<const ReceiverList> lList = GetReceivers( static_cast<SIGNALS>( i ) );
+
+            if( lList )
+            {
+                for( ReceiverList::const_iterator lIter = lList->begin(); lIter != lList->end(); ++lIter )
+                {
+                    lReceivers.insert( lIter->mReceiver );
+                }
+            }
+
+            std::atomic_store( &mReceivers[i], std::shared_ptr<const ReceiverList>() );
+        }
+
+        lSenders.swap( mConnectedObject );
+    }
+
     // Delete links between the receiver and this object
-    for( std::multimap< LdObject *, SIGNALS>::iterator lIter = mReceiverMap.begin(); lIter != mReceiverMap.end(); ++lIter )
+    for( std::set<LdObject *>::iterator lIter = lReceivers.begin(); lIter != lReceivers.end(); ++lIter )
     {
-        ( *lIter ).first->mConnectedObject.erase( const_cast<LeddarCore::LdObject *>(this) );
+        if( *lIter != lThis )
+        {
+            std::lock_guard<std::mutex> lock( ( *lIter )->mObjectMutex );
+            ( *lIter )->mConnectedObject.erase( lThis );
+        }
     }
 
     // Delete links between this object and receiver
-    for( std::set< LdObject * >::iterator lIter = mConnectedObject.begin(); lIter != mConnectedObject.end(); ++lIter )
+    for( std::set<LdObject *>::iterator lIter = lSenders.begin(); lIter != lSenders.end(); ++lIter )
+    {
+        if( *lIter != lThis )
+        {
+            std::lock_guard<std::mutex> lock( ( *lIter )->mObjectMutex );
+
+            for( int i = 0; i < SIGNALS_COUNT; ++i )
+            {
+                ( *lIter )->RemoveReceiver( lThis, static_cast<SIGNALS>( i ) );
+            }
+        }
+    }
+
+    // Wait for the emissions that may still call this object (or post a callback to it)
+    for( std::set<LdObject *>::iterator lIter = lSenders.begin(); lIter != lSenders.end(); ++lIter )
+    {
+        if( *lIter != lThis )
+        {
+            ( *lIter )->WaitEmissions();
+        }
+    }
+
+    // Drop queued callbacks still referencing this object
+    LdSignalDispatcher::GetInstance().Cancel( lThis );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarCore::LdObject::IsReceiver( const LdObject *aReceiver ) const
+///
+/// \brief  Check if aReceiver is connected to any signal of this object. mObjectMutex must be locked.
+///
+/// \param  aReceiver   The receiver.
+///
+/// \returns    True if connected to at least one signal.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarCore::LdObject::IsReceiver( const LdObject *aReceiver ) const
+{
+    for( int i = 0; i < SIGNALS_COUNT; ++i )
+    {
+        std::shared_ptr<const ReceiverList> lList = GetReceivers( static_cast<SIGNALS>( i ) );
+
+        if( lList )
+        {
+            for( ReceiverList::const_iterator lIter = lList->begin(); lIter != lList->end(); ++lIter )
+            {
+                if( lIter->mReceiver == aReceiver )
+                {
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarCore::LdObject::IsReceiver( const LdObject *aReceiver, const SIGNALS aSignal ) const
+///
+/// \brief  Check if aReceiver is connected to aSignal of this object, from the current receivers list.
+///
+/// \param  aReceiver   The receiver.
+/// \param  aSignal     The signal.
+///
+/// \returns    True if connected.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarCore::LdObject::IsReceiver( const LdObject *aReceiver, const SIGNALS aSignal ) const
+{
+    std::shared_ptr<const ReceiverList> lList = GetReceivers( aSignal );
+
+    if( lList )
+    {
+        for( ReceiverList::const_iterator lIter = lList->begin(); lIter != lList->end(); ++lIter )
+        {
+            if( lIter->mReceiver == aReceiver )
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn std::shared_ptr<const LeddarCore::LdObject::ReceiverList> LeddarCore::LdObject::GetReceivers( const SIGNALS aSignal ) const
+///
+/// \brief  Snapshot of the receivers of a signal. The snapshot stays valid even if the list is modified after.
+///         This does not take mObjectMutex, but it is not lock-free: the standard library may guard
+///         the atomic shared_ptr access with a short internal lock.
+///
+/// \param  aSignal The signal.
+///
+/// \returns    The receivers list, can be null.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::shared_ptr<const LeddarCore::LdObject::ReceiverList> LeddarCore::LdObject::GetReceivers( const SIGNALS aSignal ) const
+{
+    return std::atomic_load( &mReceivers[aSignal] );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdObject::RemoveReceiver( const LdObject *aReceiver, const SIGNALS aSignal ) const
+///
+/// \brief  Publish a copy of the receivers list of aSignal without aReceiver. mObjectMutex must be locked.
+///
+/// \param  aReceiver   The receiver to remove.
+/// \param  aSignal     The signal.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarCore::LdObject::RemoveReceiver( const LdObject *aReceiver, const SIGNALS aSignal ) const
+{
+    std::shared_ptr<const ReceiverList> lCurrent = GetReceivers( aSignal );
+
+    if( !lCurrent )
+    {
+        return;
+    }
+
+    std::shared_ptr<ReceiverList> lNew = std::make_shared<ReceiverList>();
+    lNew->reserve( lCurrent->size() );
+
+    for( ReceiverList::const_iterator lIter = lCurrent->begin(); lIter != lCurrent->end(); ++lIter )
+    {
+        if( lIter->mReceiver != aReceiver )
+        {
+            lNew->push_back( *lIter );
+        }
+    }
+
+    if( lNew->size() != lCurrent->size() )
     {
-        ( *lIter )->mReceiverMap.erase( const_cast<LeddarCore::LdObject *>(this) );
+        std::atomic_store( &mReceivers[aSignal], lNew->empty() ? std::shared_ptr<const ReceiverList>() : std::shared_ptr<const ReceiverList>( lNew ) );
     }
 }
 
@@ -131,6 +346,9 @@ LeddarCore::LdObject::DisconnectAll( void ) const
 /// \fn void LeddarCore::LdObject::EmitSignal( const SIGNALS aSignal, void *aExtraData )
 ///
 /// \brief  Notify all connected object.
+///         Receivers are called from a snapshot of the list, without holding mObjectMutex, so a callback
+///         can connect / disconnect signals. Queued receivers are posted to the LdSignalDispatcher.
+///         The emission is counted in flight, a receiver being disconnected waits for it (see WaitEmissions).
 ///
 /// \param          aSignal     Notification signal.
 /// \param [in,out] aExtraData  If non-null, information describing the extra.
@@ -141,12 +359,116 @@ LeddarCore::LdObject::DisconnectAll( void ) const
 void
 LeddarCore::LdObject::EmitSignal( const SIGNALS aSignal, void *aExtraData )
 {
-    std::lock_guard<std::mutex> lock( mObjectMutex );
-    for( std::multimap< LdObject *, SIGNALS>::iterator lIter = mReceiverMap.begin(); lIter != mReceiverMap.end(); ++lIter )
+    if( aSignal < 0 || aSignal >= SIGNALS_COUNT )
+    {
+        return;
+    }
+
+    // The snapshot is taken once the emission is counted, so a receiver disconnected before is never called
+    LdEmission lEmission( *this );
+    std::shared_ptr<const ReceiverList> lReceivers = GetReceivers( aSignal );
+
+    if( !lReceivers )
+    {
+        return;
+    }
+
+    for( ReceiverList::const_iterator lIter = lReceivers->begin(); lIter != lReceivers->end(); ++lIter )
+    {
+        if( lIter->mType == CONNECTION_QUEUED )
+        {
+            // Do not post to a receiver disconnected since the snapshot, its pending callbacks may already be canceled
+            if( IsReceiver( lIter->mReceiver, aSignal ) )
+            {
+                LdSignalDispatcher::GetInstance().Post( this, lIter->mReceiver, aSignal );
+            }
+        }
+        else
+        {
+            lIter->mReceiver->Callback( this, aSignal, aExtraData );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdObject::WaitEmissions( void ) const
+///
+/// \brief  Wait for the emissions of this object started before the call, so a receiver removed from the lists
+///         before the call is not called (nor posted) after it returns. The emissions of the calling thread
+///         (a receiver disconnected from its own callback) are not waited for.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarCore::LdObject::WaitEmissions( void ) const
+{
+    std::lock_guard<std::mutex> lSyncLock( mEmitSyncMutex );
+    const uint32_t lParity = mEmitEpoch.fetch_add( 1 ) & 1;
+    const uint32_t lOwn    = static_cast<uint32_t>( std::count( gThreadEmissions.begin(), gThreadEmissions.end(), std::make_pair( this, lParity ) ) );
+
+    std::unique_lock<std::mutex> lLock( mEmitMutex );
+    ++mEmitWaiters;
+    mEmitCondition.wait( lLock, [this, lParity, lOwn] { return mEmitting[lParity].load() <= lOwn; } );
+    --mEmitWaiters;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdObject::NotifyEmissions( void ) const
+///
+/// \brief  Wake the WaitEmissions calls after an emission count decreased.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarCore::LdObject::NotifyEmissions( void ) const
+{
+    if( mEmitWaiters.load() != 0 )
+    {
+        std::lock_guard<std::mutex> lLock( mEmitMutex );
+        mEmitCondition.notify_all();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarCore::LdObject::LdEmission::LdEmission( const LdObject &aSender )
+///
+/// \brief  Count an emission of aSender in the parity of the current epoch.
+///
+/// \param  aSender The emitting object.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarCore::LdObject::LdEmission::LdEmission( const LdObject &aSender )
+    : mSender( aSender )
+    , mParity( 0 )
+{
+    while( true )
     {
-        if( lIter->second == aSignal )
+        const uint32_t lEpoch = mSender.mEmitEpoch.load();
+        mParity               = lEpoch & 1;
+        ++mSender.mEmitting[mParity];
+
+        // A WaitEmissions flipped the epoch before the increment could miss this emission
+        if( mSender.mEmitEpoch.load() == lEpoch )
         {
-            lIter->first->Callback( this, lIter->second, aExtraData );
+            break;
         }
+
+        --mSender.mEmitting[mParity];
+        mSender.NotifyEmissions();
     }
+
+    gThreadEmissions.push_back( std::make_pair( &mSender, mParity ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarCore::LdObject::LdEmission::~LdEmission( void )
+///
+/// \brief  End of the emission, wakes WaitEmissions.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarCore::LdObject::LdEmission::~LdEmission( void )
+{
+    gThreadEmissions.pop_back();
+    --mSender.mEmitting[mParity];
+    mSender.NotifyEmissions();
 }
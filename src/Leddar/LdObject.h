@@ -10,11 +10,16 @@
 
 #include "LtDefines.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <set>
 #include <stdexcept>
 #include <mutex>
+#include <vector>
 
 namespace LeddarCore
 {
@@ -40,23 +45,68 @@ namespace LeddarCore
             EXCEPTION
         };
 
+        /// \brief  How a receiver is notified when the signal is emitted
+        enum eConnectionType
+        {
+            CONNECTION_DIRECT = 0, ///< Callback is called in the emitting thread
+            CONNECTION_QUEUED = 1  ///< Callback is posted to the LdSignalDispatcher thread. aExtraData is always null.
+        };
+
         LdObject( void );
         virtual ~LdObject( void );
 
-        void ConnectSignal( LdObject *aSender, const SIGNALS aSignal ) const;
+        void ConnectSignal( LdObject *aSender, const SIGNALS aSignal, eConnectionType aType = CONNECTION_DIRECT ) const;
         void DisconnectSignal( LdObject *aSender, const SIGNALS aSignal ) const;
-        size_t GetConnectedObjectsSize( void ) const { return mReceiverMap.size(); }
+        size_t GetConnectedObjectsSize( void ) const;
         virtual void Callback( LdObject * /*aSender*/, const SIGNALS /*aSignal*/, void * /*aExtraData*/ ){};
 
       protected:
         virtual void EmitSignal( const SIGNALS aSignal, void *aExtraData = nullptr );
 
       private:
-        
+        struct LdReceiver
+        {
+            LdObject *mReceiver;
+            eConnectionType mType;
+        };
+        typedef std::vector<LdReceiver> ReceiverList;
+        static const int SIGNALS_COUNT = EXCEPTION + 1;
+
+        // Marks an emission in flight for WaitEmissions, for the scope of EmitSignal
+        class LdEmission
+        {
+          public:
+            explicit LdEmission( const LdObject &aSender );
+            ~LdEmission( void );
+
+          private:
+            LdEmission( const LdEmission & ) = delete;
+            LdEmission &operator=( const LdEmission & ) = delete;
+
+            const LdObject &mSender;
+            uint32_t mParity;
+        };
+
         void DisconnectAll( void ) const;
+        bool IsReceiver( const LdObject *aReceiver ) const;
+        bool IsReceiver( const LdObject *aReceiver, const SIGNALS aSignal ) const;
+        std::shared_ptr<const ReceiverList> GetReceivers( const SIGNALS aSignal ) const;
+        void RemoveReceiver( const LdObject *aReceiver, const SIGNALS aSignal ) const;
+        void WaitEmissions( void ) const;
+        void NotifyEmissions( void ) const;
+
         mutable std::mutex mObjectMutex;
         mutable std::set<LdObject *> mConnectedObject;
-        mutable std::multimap<LdObject *, SIGNALS> mReceiverMap;
+        // One copy-on-write list per signal: emitters take a snapshot (without mObjectMutex) and call receivers without holding it
+        mutable std::shared_ptr<const ReceiverList> mReceivers[SIGNALS_COUNT];
+
+        // Emissions in flight, counted by epoch parity: WaitEmissions flips the epoch and waits for the previous parity
+        mutable std::atomic<uint32_t> mEmitEpoch;
+        mutable std::atomic<uint32_t> mEmitting[2];
+        mutable std::atomic<uint32_t> mEmitWaiters;
+        mutable std::mutex mEmitMutex;
+        mutable std::mutex mEmitSyncMutex; ///< Serializes WaitEmissions
+        mutable std::condition_variable mEmitCondition;
     };
 
 } // namespace LeddarCore
\ No newline at end of file
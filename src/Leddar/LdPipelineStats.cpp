@@ -0,0 +1,270 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdPipelineStats.cpp
+///
+/// \brief  Latency histograms and counters of the sensor data path
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdPipelineStats.h"
+
+#include <sstream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint32_t LeddarCore::LdLatencyHistogram::GetBucketIndex( uint64_t aValueNs )
+///
+/// \brief  Bucket of a value: values under 16 have their own bucket, then 16 linear buckets per power of two.
+///
+/// \param  aValueNs    The value.
+///
+/// \returns    The bucket index.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t LeddarCore::LdLatencyHistogram::GetBucketIndex( uint64_t aValueNs )
+{
+    if( aValueNs < SUB_BUCKET_COUNT )
+    {
+        return static_cast<uint32_t>( aValueNs );
+    }
+
+    if( aValueNs >= ( static_cast<uint64_t>( 1 ) << ( MAX_EXPONENT + 1 ) ) )
+    {
+        return BUCKET_COUNT - 1;
+    }
+
+    uint32_t lExponent = SUB_BUCKET_BITS;
+
+    while( ( aValueNs >> ( lExponent + 1 ) ) != 0 )
+    {
+        ++lExponent;
+    }
+
+    uint32_t lSubBucket = static_cast<uint32_t>( ( aValueNs >> ( lExponent - SUB_BUCKET_BITS ) ) & ( SUB_BUCKET_COUNT - 1 ) );
+    return ( lExponent - SUB_BUCKET_BITS + 1 ) * SUB_BUCKET_COUNT + lSubBucket;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint64_t LeddarCore::LdLatencyHistogram::GetBucketValue( uint32_t aIndex )
+///
+/// \brief  Middle value of a bucket
+///
+/// \param  aIndex  The bucket index.
+///
+/// \returns    The value in nanoseconds.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t LeddarCore::LdLatencyHistogram::GetBucketValue( uint32_t aIndex )
+{
+    if( aIndex < SUB_BUCKET_COUNT )
+    {
+        return aIndex;
+    }
+
+    uint32_t lExponent = aIndex / SUB_BUCKET_COUNT + SUB_BUCKET_BITS - 1;
+    uint64_t lLow      = static_cast<uint64_t>( SUB_BUCKET_COUNT + aIndex % SUB_BUCKET_COUNT ) << ( lExponent - SUB_BUCKET_BITS );
+    uint64_t lWidth    = static_cast<uint64_t>( 1 ) << ( lExponent - SUB_BUCKET_BITS );
+    return lLow + lWidth / 2;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdLatencyHistogram::Record( uint64_t aValueNs )
+///
+/// \brief  Add a value to the histogram
+///
+/// \param  aValueNs    The value in nanoseconds.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarCore::LdLatencyHistogram::Record( uint64_t aValueNs )
+{
+    mBuckets[GetBucketIndex( aValueNs )].fetch_add( 1, std::memory_order_relaxed );
+    mCount.fetch_add( 1, std::memory_order_relaxed );
+    mSum.fetch_add( aValueNs, std::memory_order_relaxed );
+
+    uint64_t lMax = mMax.load( std::memory_order_relaxed );
+
+    while( aValueNs > lMax && !mMax.compare_exchange_weak( lMax, aValueNs, std::memory_order_relaxed ) )
+    {
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdLatencyHistogram::Reset( void )
+///
+/// \brief  Clear the histogram
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarCore::LdLatencyHistogram::Reset( void )
+{
+    for( auto &lBucket : mBuckets )
+    {
+        lBucket.store( 0, std::memory_order_relaxed );
+    }
+
+    mCount.store( 0, std::memory_order_relaxed );
+    mSum.store( 0, std::memory_order_relaxed );
+    mMax.store( 0, std::memory_order_relaxed );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn double LeddarCore::LdLatencyHistogram::GetMean( void ) const
+///
+/// \brief  Mean of the recorded values
+///
+/// \returns    The mean in nanoseconds, 0 if empty.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double LeddarCore::LdLatencyHistogram::GetMean( void ) const
+{
+    uint64_t lCount = GetCount();
+    return lCount == 0 ? 0.0 : static_cast<double>( mSum.load( std::memory_order_relaxed ) ) / static_cast<double>( lCount );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint64_t LeddarCore::LdLatencyHistogram::GetPercentile( double aPercentile ) const
+///
+/// \brief  Value at a percentile. The result has the bucket precision and never exceeds the maximum.
+///
+/// \param  aPercentile The percentile (0 to 100).
+///
+/// \returns    The value in nanoseconds, 0 if empty.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t LeddarCore::LdLatencyHistogram::GetPercentile( double aPercentile ) const
+{
+    uint64_t lTotal = 0;
+
+    for( const auto &lBucket : mBuckets )
+    {
+        lTotal += lBucket.load( std::memory_order_relaxed );
+    }
+
+    if( lTotal == 0 )
+    {
+        return 0;
+    }
+
+    uint64_t lRank = static_cast<uint64_t>( aPercentile / 100.0 * static_cast<double>( lTotal ) + 0.5 );
+
+    if( lRank == 0 )
+    {
+        lRank = 1;
+    }
+
+    uint64_t lSeen = 0;
+
+    for( uint32_t i = 0; i < BUCKET_COUNT; ++i )
+    {
+        lSeen += mBuckets[i].load( std::memory_order_relaxed );
+
+        if( lSeen >= lRank )
+        {
+            uint64_t lValue = GetBucketValue( i );
+            uint64_t lMax   = GetMax();
+            return lValue > lMax ? lMax : lValue;
+        }
+    }
+
+    return GetMax();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdPipelineStats::Reset( void )
+///
+/// \brief  Clear all histograms and counters
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarCore::LdPipelineStats::Reset( void )
+{
+    for( auto &lStage : mStages )
+    {
+        lStage.Reset();
+    }
+
+    for( auto &lCounter : mCounters )
+    {
+        lCounter.store( 0, std::memory_order_relaxed );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn const char *LeddarCore::LdPipelineStats::GetStageName( eStage aStage )
+///
+/// \brief  Name of a stage, as used in the json dump and LeddarPy
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const char *LeddarCore::LdPipelineStats::GetStageName( eStage aStage )
+{
+    static const char *const sNames[STAGE_COUNT] = { "receive", "decode", "cartesian", "swap", "notify", "reduce", "smooth", "range_image" };
+    return aStage < STAGE_COUNT ? sNames[aStage] : "unknown";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn const char *LeddarCore::LdPipelineStats::GetCounterName( eCounter aCounter )
+///
+/// \brief  Name of a counter, as used in the json dump and LeddarPy
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const char *LeddarCore::LdPipelineStats::GetCounterName( eCounter aCounter )
+{
+    static const char *const sNames[COUNTER_COUNT] = { "bytes_received", "frames_decoded", "frames_dropped", "lock_contention", "echoes_filtered", "echoes_reduced", "echoes_rejected" };
+    return aCounter < COUNTER_COUNT ? sNames[aCounter] : "unknown";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarCore::LdPipelineStats::IsEnabled( void )
+///
+/// \brief  Is the instrumentation compiled in (BUILD_PIPELINE_STATS)
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarCore::LdPipelineStats::IsEnabled( void )
+{
+#ifdef BUILD_PIPELINE_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn std::string LeddarCore::LdPipelineStats::ToJson( void ) const
+///
+/// \brief  Dump the statistics as a json object:
+///         {"enabled":true,"counters":{"bytes_received":0,...},"stages":{"receive":{"count":0,"mean_ns":0,"p50_ns":0,"p99_ns":0,"p999_ns":0,"max_ns":0},...}}
+///
+/// \returns    The json string.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string LeddarCore::LdPipelineStats::ToJson( void ) const
+{
+    std::ostringstream lJson;
+    lJson << "{\"enabled\":" << ( IsEnabled() ? "true" : "false" ) << ",\"counters\":{";
+
+    for( int i = 0; i < COUNTER_COUNT; ++i )
+    {
+        lJson << ( i == 0 ? "" : "," ) << "\"" << GetCounterName( static_cast<eCounter>( i ) ) << "\":" << GetCounter( static_cast<eCounter>( i ) );
+    }
+
+    lJson << "},\"stages\":{";
+
+    for( int i = 0; i < STAGE_COUNT; ++i )
+    {
+        const LdLatencyHistogram &lHistogram = mStages[i];
+        lJson << ( i == 0 ? "" : "," ) << "\"" << GetStageName( static_cast<eStage>( i ) ) << "\":{\"count\":" << lHistogram.GetCount()
+              << ",\"mean_ns\":" << static_cast<uint64_t>( lHistogram.GetMean() ) << ",\"p50_ns\":" << lHistogram.GetPercentile( 50 )
+              << ",\"p99_ns\":" << lHistogram.GetPercentile( 99 ) << ",\"p999_ns\":" << lHistogram.GetPercentile( 99.9 ) << ",\"max_ns\":" << lHistogram.GetMax() << "}";
+    }
+
+    lJson << "}}";
+    return lJson.str();
+}
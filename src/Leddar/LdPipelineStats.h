@@ -0,0 +1,178 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdPipelineStats.h
+///
+/// \brief  Latency histograms and counters of the sensor data path (receive, decode, cartesian, swap, notify).
+///         Instrumentation points use the LT_PIPELINE_* macros, they compile to nothing when BUILD_PIPELINE_STATS is not defined.
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <stdint.h>
+#include <string>
+
+namespace LeddarCore
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdLatencyHistogram
+    ///
+    /// \brief  Lock-free log-linear (HDR style) histogram of durations in nanoseconds.
+    ///         Each power of two is split in 16 buckets (about 6% precision), values above 2^40 ns are clamped.
+    ///
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdLatencyHistogram
+    {
+      public:
+        enum
+        {
+            SUB_BUCKET_BITS  = 4,
+            SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS,
+            MAX_EXPONENT     = 40,
+            BUCKET_COUNT     = ( MAX_EXPONENT - SUB_BUCKET_BITS + 2 ) * SUB_BUCKET_COUNT
+        };
+
+        LdLatencyHistogram( void ) { Reset(); }
+
+        void Record( uint64_t aValueNs );
+        void Reset( void );
+
+        uint64_t GetCount( void ) const { return mCount.load( std::memory_order_relaxed ); }
+        uint64_t GetMax( void ) const { return mMax.load( std::memory_order_relaxed ); }
+        double GetMean( void ) const;
+        uint64_t GetPercentile( double aPercentile ) const;
+
+        static uint32_t GetBucketIndex( uint64_t aValueNs );
+        static uint64_t GetBucketValue( uint32_t aIndex );
+
+      private:
+        LdLatencyHistogram( const LdLatencyHistogram & ) = delete;
+        LdLatencyHistogram &operator=( const LdLatencyHistogram & ) = delete;
+
+        std::atomic<uint64_t> mBuckets[BUCKET_COUNT];
+        std::atomic<uint64_t> mCount;
+        std::atomic<uint64_t> mSum;
+        std::atomic<uint64_t> mMax;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdPipelineStats
+    ///
+    /// \brief  Per sensor hot path statistics: one latency histogram per stage and a few counters.
+    ///         Safe to read from any thread while the data thread records.
+    ///         The data server sensors (LeddarAuto, Pixell, M16, DTec) record the receive and decode stages separately.
+    ///         The request / answer sensors (Modbus, CAN, SPI) read and decode the echoes in one call: the whole call,
+    ///         including their cartesian conversion and swap, is recorded in the receive stage and the decode stage stays empty.
+    ///
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdPipelineStats
+    {
+      public:
+        enum eStage
+        {
+            STAGE_RECEIVE     = 0, ///< Socket / bus read of one answer
+            STAGE_DECODE      = 1, ///< Elements decoding (ReadElement / PushElementDataToBuffer)
+            STAGE_CARTESIAN   = 2, ///< ComputeCartesianCoordinates
+            STAGE_SWAP        = 3, ///< Double buffer swap, mostly waiting on the B_GET lock
+            STAGE_NOTIFY      = 4, ///< NEW_DATA subscribers
+            STAGE_REDUCE      = 5, ///< Voxel grid downsampling
+            STAGE_SMOOTH      = 6, ///< Temporal filter
+            STAGE_RANGE_IMAGE = 7, ///< Dense range image
+            STAGE_COUNT
+        };
+
+        enum eCounter
+        {
+            COUNTER_BYTES_RECEIVED  = 0,
+            COUNTER_FRAMES_DECODED  = 1,
+            COUNTER_FRAMES_DROPPED  = 2, ///< Late, out of date or invalid answers that were discarded
+            COUNTER_LOCK_CONTENTION = 3, ///< Swaps that had to wait for a buffer lock
+            COUNTER_ECHOES_FILTERED = 4, ///< Echoes removed by the echo filter
+            COUNTER_ECHOES_REDUCED  = 5, ///< Echoes removed by the voxel grid
+            COUNTER_ECHOES_REJECTED = 6, ///< Outliers removed by the temporal filter
+            COUNTER_COUNT
+        };
+
+        LdPipelineStats( void ) { Reset(); }
+
+        void RecordStage( eStage aStage, uint64_t aDurationNs ) { mStages[aStage].Record( aDurationNs ); }
+        void AddCounter( eCounter aCounter, uint64_t aValue = 1 ) { mCounters[aCounter].fetch_add( aValue, std::memory_order_relaxed ); }
+
+        const LdLatencyHistogram &GetHistogram( eStage aStage ) const { return mStages[aStage]; }
+        uint64_t GetCounter( eCounter aCounter ) const { return mCounters[aCounter].load( std::memory_order_relaxed ); }
+        void Reset( void );
+        std::string ToJson( void ) const;
+
+        static const char *GetStageName( eStage aStage );
+        static const char *GetCounterName( eCounter aCounter );
+        static bool IsEnabled( void );
+
+      private:
+        LdPipelineStats( const LdPipelineStats & ) = delete;
+        LdPipelineStats &operator=( const LdPipelineStats & ) = delete;
+
+        LdLatencyHistogram mStages[STAGE_COUNT];
+        std::atomic<uint64_t> mCounters[COUNTER_COUNT];
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdStageTimer
+    ///
+    /// \brief  Records the time spent in a stage, from construction to Stop() or destruction. Does nothing without stats object.
+    ///
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdStageTimer
+    {
+      public:
+        LdStageTimer( LdPipelineStats *aStats, LdPipelineStats::eStage aStage )
+            : mStats( aStats )
+            , mStage( aStage )
+            , mStart( aStats != nullptr ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point() )
+        {
+        }
+        ~LdStageTimer() { Stop(); }
+
+        void Stop( void )
+        {
+            if( mStats != nullptr )
+            {
+                mStats->RecordStage( mStage, static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - mStart ).count() ) );
+                mStats = nullptr;
+            }
+        }
+
+      private:
+        LdPipelineStats *mStats;
+        LdPipelineStats::eStage mStage;
+        std::chrono::steady_clock::time_point mStart;
+    };
+} // namespace LeddarCore
+
+#ifdef BUILD_PIPELINE_STATS
+#define LT_PIPELINE_CONCAT_( aA, aB ) aA##aB
+#define LT_PIPELINE_CONCAT( aA, aB ) LT_PIPELINE_CONCAT_( aA, aB )
+/// Time the rest of the scope
+#define LT_PIPELINE_SCOPE( aStats, aStage ) LeddarCore::LdStageTimer LT_PIPELINE_CONCAT( lStageTimer, __LINE__ )( aStats, LeddarCore::LdPipelineStats::aStage )
+/// Named timer, stopped with LT_PIPELINE_STOP or at the end of the scope
+#define LT_PIPELINE_TIMER( aName, aStats, aStage ) LeddarCore::LdStageTimer aName( aStats, LeddarCore::LdPipelineStats::aStage )
+#define LT_PIPELINE_STOP( aName ) aName.Stop()
+#define LT_PIPELINE_COUNT( aStats, aCounter, aValue )                                        \
+    do                                                                                       \
+    {                                                                                        \
+        if( ( aStats ) != nullptr )                                                          \
+            ( aStats )->AddCounter( LeddarCore::LdPipelineStats::aCounter, ( aValue ) );     \
+    } while( false )
+#else
+#define LT_PIPELINE_SCOPE( aStats, aStage )
+#define LT_PIPELINE_TIMER( aName, aStats, aStage )
+#define LT_PIPELINE_STOP( aName )
+#define LT_PIPELINE_COUNT( aStats, aCounter, aValue ) \
+    do                                                \
+    {                                                 \
+    } while( false )
+#endif
@@ -0,0 +1,225 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdPointCloudBuilder.cpp
+///
+/// \brief  Implements the LdPointCloudBuilder class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdPointCloudBuilder.h"
+
+#include "LdResultEchoes.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    const uint16_t VALID_ECHO_FLAG = 0x01;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdPointCloudBuilder::LdPointCloudBuilder( uint32_t aFields, bool aValidOnly )
+///
+/// \brief  Constructor, computes the point layout. Each field is aligned on its size.
+///
+/// \param  aFields     Fields to build (eFields).
+/// \param  aValidOnly  Keep only the echoes with the valid flag.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdPointCloudBuilder::LdPointCloudBuilder( uint32_t aFields, bool aValidOnly ) :
+    mPointStep( 0 ),
+    mValidOnly( aValidOnly ),
+    mPadded( false ),
+    mOffsetXYZ( -1 ),
+    mOffsetIntensity( -1 ),
+    mOffsetDistance( -1 ),
+    mOffsetTimestamp( -1 ),
+    mOffsetChannel( -1 ),
+    mOffsetFlags( -1 ),
+    mWidth( 0 ),
+    mTimestamp( 0 )
+{
+    uint32_t lAlignment = 1;
+    uint32_t lFieldsSize = 0;
+
+    if( aFields & PF_XYZ )
+    {
+        lFieldsSize += AddField( "x", PT_FLOAT32, 4 );
+        mOffsetXYZ = static_cast<int32_t>( mFields.back().mOffset );
+        lFieldsSize += AddField( "y", PT_FLOAT32, 4 );
+        lFieldsSize += AddField( "z", PT_FLOAT32, 4 );
+        lAlignment = 4;
+    }
+
+    if( aFields & PF_INTENSITY )
+    {
+        lFieldsSize += AddField( "intensity", PT_FLOAT32, 4 );
+        mOffsetIntensity = static_cast<int32_t>( mFields.back().mOffset );
+        lAlignment = std::max<uint32_t>( lAlignment, 4 );
+    }
+
+    if( aFields & PF_DISTANCE )
+    {
+        lFieldsSize += AddField( "distance", PT_FLOAT32, 4 );
+        mOffsetDistance = static_cast<int32_t>( mFields.back().mOffset );
+        lAlignment = std::max<uint32_t>( lAlignment, 4 );
+    }
+
+    if( aFields & PF_TIMESTAMP )
+    {
+        lFieldsSize += AddField( "timestamp", PT_FLOAT64, 8 );
+        mOffsetTimestamp = static_cast<int32_t>( mFields.back().mOffset );
+        lAlignment = 8;
+    }
+
+    if( aFields & PF_CHANNEL )
+    {
+        lFieldsSize += AddField( "channel", PT_UINT16, 2 );
+        mOffsetChannel = static_cast<int32_t>( mFields.back().mOffset );
+        lAlignment = std::max<uint32_t>( lAlignment, 2 );
+    }
+
+    if( aFields & PF_FLAGS )
+    {
+        lFieldsSize += AddField( "flags", PT_UINT16, 2 );
+        mOffsetFlags = static_cast<int32_t>( mFields.back().mOffset );
+        lAlignment = std::max<uint32_t>( lAlignment, 2 );
+    }
+
+    mPointStep = ( mPointStep + lAlignment - 1 ) / lAlignment * lAlignment;
+    mPadded = ( lFieldsSize != mPointStep );
+}
+
+uint32_t LeddarConnection::LdPointCloudBuilder::AddField( const char *aName, uint8_t aDatatype, uint32_t aSize )
+{
+    uint32_t lOffset = ( mPointStep + aSize - 1 ) / aSize * aSize;
+    sPointField lField = { aName, lOffset, aDatatype, 1 };
+    mFields.push_back( lField );
+    mPointStep = lOffset + aSize;
+    return aSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LeddarConnection::LdPointCloudBuilder::GetCapacity( LdResultEchoes *aEchoes )
+///
+/// \brief  Maximum number of points of a frame (maximum number of detections)
+///
+/// \param [in] aEchoes The echoes.
+///
+/// \returns    The number of points.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t LeddarConnection::LdPointCloudBuilder::GetCapacity( LdResultEchoes *aEchoes )
+{
+    auto lLock = aEchoes->GetUniqueLock( B_GET );
+    return aEchoes->GetEchoes( B_GET )->size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint32_t LeddarConnection::LdPointCloudBuilder::Fill( LdResultEchoes *aEchoes )
+///
+/// \brief  Build the points of the last echoes in the internal buffer (GetData), it only grows.
+///
+/// \param [in] aEchoes The echoes.
+///
+/// \returns    The number of points (PointCloud2 width).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t LeddarConnection::LdPointCloudBuilder::Fill( LdResultEchoes *aEchoes )
+{
+    size_t lCapacity = GetCapacity( aEchoes );
+
+    if( mData.size() < lCapacity * mPointStep )
+    {
+        mData.resize( lCapacity * mPointStep );
+    }
+
+    return Fill( aEchoes, mData.data(), lCapacity );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint32_t LeddarConnection::LdPointCloudBuilder::Fill( LdResultEchoes *aEchoes, uint8_t *aDestination, size_t aCapacity )
+///
+/// \brief  Build the points of the last echoes in an external buffer (i.e. the data of a message).
+///
+/// \param [in]     aEchoes         The echoes.
+/// \param [out]    aDestination    At least aCapacity * GetPointStep() bytes.
+/// \param          aCapacity       Maximum number of points, the following echoes are dropped.
+///
+/// \returns    The number of points (PointCloud2 width).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t LeddarConnection::LdPointCloudBuilder::Fill( LdResultEchoes *aEchoes, uint8_t *aDestination, size_t aCapacity )
+{
+    auto lLock = aEchoes->GetUniqueLock( B_GET );
+
+    const LdFrameMetadata &lMetadata = aEchoes->GetFrameMetadata( B_GET );
+    mTimestamp = ( lMetadata.mFields & LdFrameMetadata::MF_TIMESTAMP64 ) != 0 ? lMetadata.mTimestamp64 : aEchoes->GetTimestamp( B_GET );
+
+    const LdEcho *lEchoes = aEchoes->GetEchoes( B_GET )->data();
+    const uint32_t lCount = aEchoes->GetEchoCount( B_GET );
+    const float lDistanceFactor = 1.0f / aEchoes->GetDistanceScale();
+    const float lAmplitudeFactor = 1.0f / aEchoes->GetAmplitudeScale();
+    uint8_t *lPoint = aDestination;
+    uint32_t lWidth = 0;
+
+    for( uint32_t i = 0; i < lCount && lWidth < aCapacity; ++i )
+    {
+        const LdEcho &lEcho = lEchoes[i];
+
+        if( mValidOnly && ( lEcho.mFlag & VALID_ECHO_FLAG ) == 0 )
+        {
+            continue;
+        }
+
+        if( mPadded )
+        {
+            memset( lPoint, 0, mPointStep );
+        }
+
+        if( mOffsetXYZ >= 0 )
+        {
+            const float lXYZ[3] = { lEcho.mX, lEcho.mY, lEcho.mZ };
+            memcpy( lPoint + mOffsetXYZ, lXYZ, sizeof( lXYZ ) );
+        }
+
+        if( mOffsetIntensity >= 0 )
+        {
+            const float lIntensity = lEcho.mAmplitude * lAmplitudeFactor;
+            memcpy( lPoint + mOffsetIntensity, &lIntensity, sizeof( lIntensity ) );
+        }
+
+        if( mOffsetDistance >= 0 )
+        {
+            const float lDistance = lEcho.mDistance * lDistanceFactor;
+            memcpy( lPoint + mOffsetDistance, &lDistance, sizeof( lDistance ) );
+        }
+
+        if( mOffsetTimestamp >= 0 )
+        {
+            const double lTimestamp = static_cast<double>( lEcho.mTimestamp );
+            memcpy( lPoint + mOffsetTimestamp, &lTimestamp, sizeof( lTimestamp ) );
+        }
+
+        if( mOffsetChannel >= 0 )
+        {
+            memcpy( lPoint + mOffsetChannel, &lEcho.mChannelIndex, sizeof( lEcho.mChannelIndex ) );
+        }
+
+        if( mOffsetFlags >= 0 )
+        {
+            memcpy( lPoint + mOffsetFlags, &lEcho.mFlag, sizeof( lEcho.mFlag ) );
+        }
+
+        lPoint += mPointStep;
+        ++lWidth;
+    }
+
+    mWidth = lWidth;
+    return lWidth;
+}
@@ -0,0 +1,95 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdPointCloudBuilder.h
+///
+/// \brief  Declares the LdPointCloudBuilder class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace LeddarConnection
+{
+    class LdResultEchoes;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdPointCloudBuilder
+    ///
+    /// \brief  Fills a buffer with the layout of a sensor_msgs/PointCloud2 message (dense, little endian,
+    ///         height 1) from the B_GET echoes, in a single pass and without allocation once the buffer is
+    ///         sized. The field layout is computed once in the constructor.
+    ///
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdPointCloudBuilder
+    {
+    public:
+        enum eFields
+        {
+            PF_XYZ       = 1 << 0, ///< x, y, z (float32, m)
+            PF_INTENSITY = 1 << 1, ///< intensity (float32, unscaled amplitude)
+            PF_DISTANCE  = 1 << 2, ///< distance (float32, unscaled)
+            PF_TIMESTAMP = 1 << 3, ///< timestamp (float64, echo timestamp)
+            PF_CHANNEL   = 1 << 4, ///< channel (uint16, channel index)
+            PF_FLAGS     = 1 << 5, ///< flags (uint16, detection flag)
+            PF_DEFAULT   = PF_XYZ | PF_INTENSITY,
+            PF_ALL       = PF_XYZ | PF_INTENSITY | PF_DISTANCE | PF_TIMESTAMP | PF_CHANNEL | PF_FLAGS
+        };
+
+        /// \brief  sensor_msgs/PointField datatype values
+        enum eDatatype
+        {
+            PT_UINT16  = 4,
+            PT_FLOAT32 = 7,
+            PT_FLOAT64 = 8
+        };
+
+        struct sPointField
+        {
+            const char *mName;
+            uint32_t    mOffset;
+            uint8_t     mDatatype; ///< eDatatype
+            uint32_t    mCount;
+        };
+
+        explicit LdPointCloudBuilder( uint32_t aFields = PF_DEFAULT, bool aValidOnly = true );
+
+        const std::vector<sPointField> &GetFields( void ) const { return mFields; }
+        uint32_t GetPointStep( void ) const { return mPointStep; }
+        bool IsValidOnly( void ) const { return mValidOnly; }
+
+        uint32_t Fill( LdResultEchoes *aEchoes );
+        uint32_t Fill( LdResultEchoes *aEchoes, uint8_t *aDestination, size_t aCapacity );
+
+        // Result of the last Fill
+        const std::vector<uint8_t> &GetData( void ) const { return mData; } ///< Sized to the capacity, GetWidth() * GetPointStep() bytes are used
+        uint32_t GetWidth( void ) const { return mWidth; }
+        uint64_t GetTimestamp( void ) const { return mTimestamp; }          ///< 64 bits timestamp if the sensor provides it, else the 32 bits timestamp
+
+        static size_t GetCapacity( LdResultEchoes *aEchoes );
+
+    private:
+        uint32_t AddField( const char *aName, uint8_t aDatatype, uint32_t aSize );
+
+        std::vector<sPointField> mFields;
+        uint32_t mPointStep;
+        bool mValidOnly;
+        bool mPadded;       // The layout has padding bytes, they are cleared
+
+        // Offsets in a point, -1 if the field is not built
+        int32_t mOffsetXYZ;
+        int32_t mOffsetIntensity;
+        int32_t mOffsetDistance;
+        int32_t mOffsetTimestamp;
+        int32_t mOffsetChannel;
+        int32_t mOffsetFlags;
+
+        std::vector<uint8_t> mData;
+        uint32_t mWidth;
+        uint64_t mTimestamp;
+    };
+} // namespace LeddarConnection
@@ -19,12 +19,37 @@
 #include "LtStringUtils.h"
 
 #include "rapidjson/error/en.h"
+#include <cstring>
 #include <fstream>
 #include <rapidjson/document.h>
 #include <rapidjson/istreamwrapper.h>
 
 #include <typeinfo>
 
+namespace
+{
+    // Snapshot layout, little endian:
+    //  header: magic (uint32), version (uint16), reserved (uint16), number of properties (uint32)
+    //  each property, sorted by id: id, device id, unit size, stride, count (uint32), then count * stride bytes of raw storage
+    const uint32_t SNAPSHOT_MAGIC          = 0x5350444C; // "LDPS"
+    const uint16_t SNAPSHOT_VERSION        = 1;
+    const size_t SNAPSHOT_HEADER_SIZE      = 12;
+    const size_t SNAPSHOT_ENTRY_SIZE       = 20;
+
+    template <typename T> uint8_t *Insert( uint8_t *aBuffer, T aValue )
+    {
+        memcpy( aBuffer, &aValue, sizeof( T ) );
+        return aBuffer + sizeof( T );
+    }
+
+    template <typename T> T Extract( const uint8_t *aBuffer )
+    {
+        T lValue;
+        memcpy( &lValue, aBuffer, sizeof( T ) );
+        return lValue;
+    }
+} // namespace
+
 // *****************************************************************************
 // Function: LdPropertiesContainer::LdPropertiesContainer
 ///
@@ -795,4 +820,252 @@ void LeddarCore::LdPropertiesContainer::AddPropertiesFromFile( std::string aFile
     }
 
     lInputFileStream.close();
-}
\ No newline at end of file
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn std::vector<uint8_t> LeddarCore::LdPropertiesContainer::Snapshot( uint32_t aCategories ) const
+///
+/// \brief  Capture the raw storage of the properties of the categories in a binary, versioned buffer.
+///         All the captured properties are locked during the copy, so the snapshot is consistent even with
+///         concurrent writers. Properties without value (count of 0) are skipped.
+///
+/// \param  aCategories Bit mask of LdProperty::eCategories.
+///
+/// \returns    The snapshot, see Restore() and Diff().
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::vector<uint8_t> LeddarCore::LdPropertiesContainer::Snapshot( uint32_t aCategories ) const
+{
+    std::vector<const LdProperty *> lProperties;
+    std::vector<std::unique_lock<std::recursive_mutex>> lLocks;
+    size_t lSize = SNAPSHOT_HEADER_SIZE;
+
+    // Locked in id order, like Restore()
+    for( std::map<uint32_t, LeddarCore::LdProperty *>::const_iterator lIter = mProperties.cbegin(); lIter != mProperties.cend(); ++lIter )
+    {
+        if( ( lIter->second->GetCategory() & aCategories ) != 0 )
+        {
+            lLocks.push_back( lIter->second->GetUniqueLock() );
+
+            if( lIter->second->Count() != 0 )
+            {
+                lProperties.push_back( lIter->second );
+                lSize += SNAPSHOT_ENTRY_SIZE + lIter->second->Count() * lIter->second->Stride();
+            }
+        }
+    }
+
+    std::vector<uint8_t> lSnapshot( lSize );
+    uint8_t *lData = Insert<uint32_t>( lSnapshot.data(), SNAPSHOT_MAGIC );
+    lData          = Insert<uint16_t>( lData, SNAPSHOT_VERSION );
+    lData          = Insert<uint16_t>( lData, 0 );
+    lData          = Insert<uint32_t>( lData, static_cast<uint32_t>( lProperties.size() ) );
+
+    for( size_t i = 0; i < lProperties.size(); ++i )
+    {
+        const std::vector<uint8_t> lStorage = lProperties[i]->GetStorage();
+        lData = Insert<uint32_t>( lData, lProperties[i]->GetId() );
+        lData = Insert<uint32_t>( lData, lProperties[i]->GetDeviceId() );
+        lData = Insert<uint32_t>( lData, lProperties[i]->UnitSize() );
+        lData = Insert<uint32_t>( lData, static_cast<uint32_t>( lProperties[i]->Stride() ) );
+        lData = Insert<uint32_t>( lData, static_cast<uint32_t>( lProperties[i]->Count() ) );
+        memcpy( lData, lStorage.data(), lStorage.size() );
+        lData += lStorage.size();
+    }
+
+    return lSnapshot;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn std::vector<LeddarCore::LdPropertiesContainer::sSnapshotEntry> LeddarCore::LdPropertiesContainer::ParseSnapshot( const uint8_t *aSnapshot, size_t aSize ) const
+///
+/// \brief  Validate a snapshot and match its entries with the properties of the container.
+///         Entries of unknown properties are returned with a null property.
+///
+/// \exception  std::runtime_error  Raised when the snapshot is invalid or truncated, or when the layout of a property differs.
+///
+/// \param  aSnapshot   The snapshot.
+/// \param  aSize       Size of the snapshot.
+///
+/// \returns    The entries, sorted by id.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::vector<LeddarCore::LdPropertiesContainer::sSnapshotEntry> LeddarCore::LdPropertiesContainer::ParseSnapshot( const uint8_t *aSnapshot, size_t aSize ) const
+{
+    if( aSnapshot == nullptr || aSize < SNAPSHOT_HEADER_SIZE || Extract<uint32_t>( aSnapshot ) != SNAPSHOT_MAGIC )
+    {
+        throw std::runtime_error( "Invalid properties snapshot." );
+    }
+
+    if( Extract<uint16_t>( aSnapshot + 4 ) != SNAPSHOT_VERSION )
+    {
+        throw std::runtime_error( "Unsupported properties snapshot version: " + LeddarUtils::LtStringUtils::IntToString( Extract<uint16_t>( aSnapshot + 4 ) ) );
+    }
+
+    const uint32_t lCount = Extract<uint32_t>( aSnapshot + 8 );
+    std::vector<sSnapshotEntry> lEntries;
+    lEntries.reserve( lCount );
+    size_t lOffset = SNAPSHOT_HEADER_SIZE;
+
+    for( uint32_t i = 0; i < lCount; ++i )
+    {
+        if( aSize - lOffset < SNAPSHOT_ENTRY_SIZE )
+        {
+            throw std::runtime_error( "Truncated properties snapshot." );
+        }
+
+        const uint32_t lId       = Extract<uint32_t>( aSnapshot + lOffset );
+        const uint32_t lUnitSize = Extract<uint32_t>( aSnapshot + lOffset + 8 );
+        sSnapshotEntry lEntry;
+        lEntry.mStride = Extract<uint32_t>( aSnapshot + lOffset + 12 );
+        lEntry.mCount  = Extract<uint32_t>( aSnapshot + lOffset + 16 );
+        lOffset += SNAPSHOT_ENTRY_SIZE;
+
+        if( ( aSize - lOffset ) / ( lEntry.mStride == 0 ? 1 : lEntry.mStride ) < lEntry.mCount )
+        {
+            throw std::runtime_error( "Truncated properties snapshot." );
+        }
+
+        if( !lEntries.empty() && lId <= lEntries.back().mId )
+        {
+            throw std::runtime_error( "Invalid properties snapshot, ids are not sorted." );
+        }
+
+        std::map<uint32_t, LeddarCore::LdProperty *>::const_iterator lIter = mProperties.find( lId );
+        lEntry.mId       = lId;
+        lEntry.mProperty = ( lIter != mProperties.end() ? lIter->second : nullptr );
+        lEntry.mData     = aSnapshot + lOffset;
+        lOffset += static_cast<size_t>( lEntry.mCount ) * lEntry.mStride;
+
+        if( lEntry.mProperty != nullptr && ( lEntry.mProperty->Stride() != lEntry.mStride || lEntry.mProperty->UnitSize() != lUnitSize ) )
+        {
+            throw std::runtime_error( "Property layout differs from the snapshot, id: " + LeddarUtils::LtStringUtils::IntToString( lId, 16 ) );
+        }
+
+        lEntries.push_back( lEntry );
+    }
+
+    return lEntries;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn std::vector<std::unique_lock<std::recursive_mutex>> LeddarCore::LdPropertiesContainer::LockProperties( const std::vector<sSnapshotEntry> &aEntries ) const
+///
+/// \brief  Lock the properties of the snapshot entries, in id order.
+///
+/// \param  aEntries    Entries from ParseSnapshot().
+///
+/// \returns    The locks.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::vector<std::unique_lock<std::recursive_mutex>> LeddarCore::LdPropertiesContainer::LockProperties( const std::vector<sSnapshotEntry> &aEntries ) const
+{
+    std::vector<std::unique_lock<std::recursive_mutex>> lLocks;
+    lLocks.reserve( aEntries.size() );
+
+    for( size_t i = 0; i < aEntries.size(); ++i )
+    {
+        if( aEntries[i].mProperty != nullptr )
+        {
+            lLocks.push_back( aEntries[i].mProperty->GetUniqueLock() );
+        }
+    }
+
+    return lLocks;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn std::vector<uint32_t> LeddarCore::LdPropertiesContainer::Diff( const uint8_t *aSnapshot, size_t aSize ) const
+///
+/// \brief  List the properties whose value differs from the snapshot.
+///
+/// \exception  std::runtime_error  Raised when the snapshot is invalid (see ParseSnapshot()).
+///
+/// \param  aSnapshot   The snapshot from Snapshot().
+/// \param  aSize       Size of the snapshot.
+///
+/// \returns    Ids of the differing properties. Properties unknown to the container are not listed.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::vector<uint32_t> LeddarCore::LdPropertiesContainer::Diff( const uint8_t *aSnapshot, size_t aSize ) const
+{
+    const std::vector<sSnapshotEntry> lEntries = ParseSnapshot( aSnapshot, aSize );
+    std::vector<std::unique_lock<std::recursive_mutex>> lLocks = LockProperties( lEntries );
+    std::vector<uint32_t> lIds;
+
+    for( size_t i = 0; i < lEntries.size(); ++i )
+    {
+        const sSnapshotEntry &lEntry = lEntries[i];
+
+        if( lEntry.mProperty != nullptr )
+        {
+            const std::vector<uint8_t> lStorage = lEntry.mProperty->GetStorage();
+
+            if( lEntry.mProperty->Count() != lEntry.mCount || ( !lStorage.empty() && memcmp( lStorage.data(), lEntry.mData, lStorage.size() ) != 0 ) )
+            {
+                lIds.push_back( lEntry.mId );
+            }
+        }
+    }
+
+    return lIds;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LeddarCore::LdPropertiesContainer::Restore( const uint8_t *aSnapshot, size_t aSize, bool aForce )
+///
+/// \brief  Apply a snapshot. Only the properties whose value differs are written, so only they are modified
+///         and sent to the device by the next SetConfig(). The properties are locked during the whole restore.
+///         Properties unknown to the container are skipped, as are the non editable properties unless forced.
+///
+/// \exception  std::runtime_error  Raised when the snapshot is invalid (see ParseSnapshot()), nothing is written.
+///
+/// \param  aSnapshot   The snapshot from Snapshot().
+/// \param  aSize       Size of the snapshot.
+/// \param  aForce      Write the non editable properties too (ForceRawStorage).
+///
+/// \returns    The number of written properties.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t LeddarCore::LdPropertiesContainer::Restore( const uint8_t *aSnapshot, size_t aSize, bool aForce )
+{
+    const std::vector<sSnapshotEntry> lEntries = ParseSnapshot( aSnapshot, aSize );
+    std::vector<std::unique_lock<std::recursive_mutex>> lLocks = LockProperties( lEntries );
+    size_t lWritten = 0;
+
+    for( size_t i = 0; i < lEntries.size(); ++i )
+    {
+        const sSnapshotEntry &lEntry = lEntries[i];
+
+        if( lEntry.mProperty == nullptr || lEntry.mCount == 0 || ( !aForce && ( lEntry.mProperty->GetFeatures() & LdProperty::F_EDITABLE ) == 0 ) )
+        {
+            continue;
+        }
+
+        const std::vector<uint8_t> lStorage = lEntry.mProperty->GetStorage();
+
+        if( lEntry.mProperty->Count() == lEntry.mCount && memcmp( lStorage.data(), lEntry.mData, lStorage.size() ) == 0 )
+        {
+            continue;
+        }
+
+        std::vector<uint8_t> lValues( lEntry.mData, lEntry.mData + static_cast<size_t>( lEntry.mCount ) * lEntry.mStride );
+
+        if( aForce )
+        {
+            lEntry.mProperty->ForceRawStorage( lValues.data(), lEntry.mCount, lEntry.mStride );
+        }
+        else
+        {
+            lEntry.mProperty->SetRawStorage( lValues.data(), lEntry.mCount, lEntry.mStride );
+        }
+
+        ++lWritten;
+    }
+
+    return lWritten;
+}
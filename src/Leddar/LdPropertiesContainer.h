@@ -23,6 +23,9 @@
 #include "LdProperty.h"
 #include "LdTextProperty.h"
 
+#include <mutex>
+#include <vector>
+
 namespace LeddarCore
 {
     class LdPropertiesContainer : public LdObject
@@ -61,12 +64,30 @@ namespace LeddarCore
         std::vector<const LdProperty *> FindPropertiesByFeature( uint32_t aFeature ) const;
         bool IsModified( LdProperty::eCategories aCategory ) const;
 
+        std::vector<uint8_t> Snapshot( uint32_t aCategories = LdProperty::CAT_CONFIGURATION | LdProperty::CAT_CALIBRATION ) const;
+        std::vector<uint32_t> Diff( const uint8_t *aSnapshot, size_t aSize ) const;
+        std::vector<uint32_t> Diff( const std::vector<uint8_t> &aSnapshot ) const { return Diff( aSnapshot.data(), aSnapshot.size() ); }
+        size_t Restore( const uint8_t *aSnapshot, size_t aSize, bool aForce = false );
+        size_t Restore( const std::vector<uint8_t> &aSnapshot, bool aForce = false ) { return Restore( aSnapshot.data(), aSnapshot.size(), aForce ); }
+
         const std::map<uint32_t, LeddarCore::LdProperty *> *GetContent( void ) const { return &mProperties; }
         void SetPropertiesOwnership( bool aIsPropertiesOwner ) { mIsPropertiesOwner = aIsPropertiesOwner; }
 
         virtual void Callback( LdObject *aSender, const SIGNALS aSignal, void * /*aExtraData*/ ) override;
 
       private:
+        struct sSnapshotEntry
+        {
+            uint32_t mId;
+            LdProperty *mProperty; ///< nullptr if the container does not have the property
+            const uint8_t *mData;
+            uint32_t mCount;
+            uint32_t mStride;
+        };
+
+        std::vector<sSnapshotEntry> ParseSnapshot( const uint8_t *aSnapshot, size_t aSize ) const;
+        std::vector<std::unique_lock<std::recursive_mutex>> LockProperties( const std::vector<sSnapshotEntry> &aEntries ) const;
+
         bool mIsPropertiesOwner;
         std::map<uint32_t, LeddarCore::LdProperty *> mProperties;
     };
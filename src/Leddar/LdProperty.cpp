@@ -126,7 +126,11 @@ void LeddarCore::LdProperty::EmitSignal( const SIGNALS aSignal, void *aExtraData
 /// \author Patrick Boulay
 /// \date   January 2016
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void LeddarCore::LdProperty::PerformSetClean( void ) { mBackupStorage = mStorage; }
+void LeddarCore::LdProperty::PerformSetClean( void )
+{
+    mBackupStorage = mStorage;
+    ++mStorageVersion;
+}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn void LeddarCore::LdProperty::SetCount( size_t aValue )
@@ -142,6 +146,7 @@ void LeddarCore::LdProperty::PerformSetCount( size_t aValue )
 {
     mStorage.resize( aValue * mStride );
     mBackupStorage.resize( mStorage.size() );
+    ++mStorageVersion;
 
     if( aValue == 0 )
         SetInitialized( false );
@@ -160,6 +165,7 @@ void LeddarCore::LdProperty::PerformRestore( void )
     if( PerformModified() )
     {
         mStorage = mBackupStorage;
+        ++mStorageVersion;
         EmitSignal( LdObject::VALUE_CHANGED );
     }
 }
@@ -189,6 +195,8 @@ void LeddarCore::LdProperty::PerformSetRawStorage( uint8_t *aBuffer, size_t aCou
         PerformSetCount( aCount );
     }
 
+    ++mStorageVersion;
+
     if( aSize == mStride )
     {
         memcpy( static_cast<uint8_t *>( &mStorage[0] ), aBuffer, aSize * aCount );
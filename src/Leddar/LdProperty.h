@@ -191,6 +191,7 @@ namespace LeddarCore
             std::lock_guard<std::recursive_mutex> lock( mPropertyMutex );
             return PerformGetStorage();
         }
+        std::unique_lock<std::recursive_mutex> GetUniqueLock( void ) const { return std::unique_lock<std::recursive_mutex>( mPropertyMutex ); } ///< Hold to read or write several values consistently
 
         void EnableCallbacks( bool aEnable ) { mEnableCallbacks = aEnable; }
 
@@ -213,7 +214,12 @@ namespace LeddarCore
                     const std::string &aDescription = "" );
 
         const uint8_t *CStorage( void ) const { return &mStorage[0]; }
-        uint8_t *Storage( void ) { return &mStorage[0]; }
+        uint8_t *Storage( void )
+        {
+            ++mStorageVersion;
+            return &mStorage[0];
+        }
+        uint64_t StorageVersion( void ) const { return mStorageVersion; } ///< Changes on each write of the current or backup values
         const uint8_t *BackupStorage( void ) const { return &mBackupStorage[0]; }
         bool IsInitialized( void ) const { return mInitialized; }
         void SetInitialized( bool aStatus ) { mInitialized = aStatus; }
@@ -267,6 +273,7 @@ namespace LeddarCore
         uint32_t mDeviceId;
         bool mInitialized;
         bool mEnableCallbacks = true;
+        uint64_t mStorageVersion = 1;
 
         std::vector<uint8_t> mStorage, mBackupStorage;
     };
@@ -8,6 +8,7 @@
 #include "LdInterfaceEthernet.h"
 #include "LdRtpPacketReceiver.h"
 #include "LdWaveformPacketReceiver.h"
+#include "LtSystemUtils.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn	LeddarConnection::LdProtocolLeddarEngineRTP::LdProtocolLeddarEngineRTP( const LdConnectionInfo *aConnectionInfo, LdConnection *aInterface )
@@ -127,6 +128,8 @@ uint32_t LeddarConnection::LdProtocolLeddarEngineRTP::GetPort()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void LeddarConnection::LdProtocolLeddarEngineRTP::GetDataLoop()
 {
+    LeddarUtils::LtSystemUtils::ApplyAcquisitionThreadPolicy();
+
     while( mAcquisitionning.load() )
     {
         try
@@ -8,9 +8,10 @@
 
 #include "LdProtocolLeddartechEthernetPixell.h"
 
-#include "LdRtpPacketReceiver.h"
+#include "LdRtpPacket.h"
 #include "comm/LtComEthernetPublic.h"
 
+#include <algorithm>
 #include <cstring>
 
 #if defined( BUILD_ETHERNET )
@@ -30,10 +31,12 @@ constexpr uint8_t RTP_PAYLOAD_PIXELL = 0x40;
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 LeddarConnection::LdProtocolLeddartechEthernetPixell::LdProtocolLeddartechEthernetPixell( const LdConnectionInfo *aConnectionInfo, LdConnection *aInterface )
     : LdProtocolLeddarTech( aConnectionInfo, aInterface )
+    , mJitterBuffer( [this]( uint32_t aSize ) { ResizeInternalBuffers( aSize ); } )
+    , mOverflow( 65536 )
 {
     mInterfaceEthernet = dynamic_cast<LdInterfaceEthernet *>( aInterface );
     SetDeviceType( dynamic_cast<const LdConnectionInfoEthernet *>( aConnectionInfo )->GetDeviceType() );
-    mPayLoad.reserve( 200000 ); // Somehow big value to limit the number of resize in normal usage
+    ResizeInternalBuffers( 200000 ); // Somehow big value to limit the number of resize in normal usage
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -62,11 +65,9 @@ void LeddarConnection::LdProtocolLeddartechEthernetPixell::Connect( void )
 {
     // Connect interface
     mInterfaceEthernet->OpenUDPSocket( dynamic_cast<const LeddarConnection::LdConnectionInfoEthernet *>( mConnectionInfo )->GetPort() );
-    mIsConnected       = true;
-    mRTPFrameIsValid   = false;
-    mRTPSequenceNumber = 0;
-    mRTPTimestamp      = 0;
-    mFirstFrame        = true;
+    mIsConnected = true;
+    mFirstFrame  = true;
+    mJitterBuffer.Reset();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -87,7 +88,8 @@ void LeddarConnection::LdProtocolLeddartechEthernetPixell::Disconnect( void )
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn void LeddarConnection::LdProtocolLeddartechEthernetPixell::ReadAnswer( void )
 ///
-/// \brief  Reads next data from sensor
+/// \brief  Reads next data from sensor. RTP packets are reassembled by the jitter buffer, that tolerates reordering
+///         up to its reorder window.
 ///
 /// \author David Lvy
 /// \date   March 2021
@@ -95,107 +97,123 @@ void LeddarConnection::LdProtocolLeddartechEthernetPixell::Disconnect( void )
 void LeddarConnection::LdProtocolLeddartechEthernetPixell::ReadAnswer( void )
 {
     VerifyConnection();
-    bool lFrameReceived = false;
-    mRequestCode        = 0;
-    mAnswerCode         = 0;
-    mMessageSize        = 0;
-    mElementOffset      = 0;
-    bool lThrowError    = false;
-    constexpr uint16_t lUint16LoopDelta =
-        std::numeric_limits<uint16_t>::max() / 100; // Value to handle cases when the sequence number loop on the uint16 and the new number is inferior than the old one
+    mRequestCode   = 0;
+    mAnswerCode    = 0;
+    mMessageSize   = 0;
+    mElementOffset = 0;
+
+    uint64_t lDroppedFrames = mJitterBuffer.GetStats().mFramesDropped;
+    bool lFrameReceived     = mJitterBuffer.ReplayParked(); // Packets of this frame may have arrived with the previous one
 
     while( !lFrameReceived && mInterfaceEthernet->SelectUDP( 0 ) )
     {
-        auto lSizeRead = Read( 0 ); // Argument is not used in UDP. UDP protocol reads the whole message (opposed to TCP stream)
+        // Header apart, payload directly at its place in the frame (mTransferOutputBuffer) when it arrives in order
+        uint32_t lSlotSize = 0;
+        uint8_t *lSlot     = mJitterBuffer.GetReceiveSlot( lSlotSize );
 
-        LeddarConnection::LdRtpPacketReceiver lRTPPaquet( mTransferOutputBuffer, lSizeRead );
+        LdInterfaceEthernet::sScatterBuffer lBuffers[3];
+        uint32_t lBufferCount     = 0;
+        lBuffers[lBufferCount++] = { mRTPHeader, sizeof( mRTPHeader ) };
 
-        if( lRTPPaquet.isExtended() )
+        if( lSlot != nullptr )
         {
-            throw std::runtime_error( "Extended RTP paquet not supported." );
+            lBuffers[lBufferCount++] = { lSlot, lSlotSize };
         }
-        if( lRTPPaquet.GetPayloadType() != RTP_PAYLOAD_PIXELL )
+
+        lBuffers[lBufferCount++] = { mOverflow.data(), static_cast<uint32_t>( mOverflow.size() ) };
+
+        uint32_t lSizeRead = mInterfaceEthernet->ReceiveFromScatter( lBuffers, lBufferCount );
+
+        if( lSizeRead == 0 )
         {
-            throw std::runtime_error( "Wrong payload type." );
+            continue; // Truncated datagram, dropped: the frame will miss this packet
         }
 
-        uint16_t lNewSequenceNumber = lRTPPaquet.GetSequenceNumber();
-        uint32_t lNewTimestamp      = lRTPPaquet.GetTimeStamp();
-        bool lSetNextFrameValid     = false;
+        if( lSizeRead <= sizeof( mRTPHeader ) )
+        {
+            throw std::runtime_error( "RTP header: Payload is empty" );
+        }
 
-        if( !mRTPFrameIsValid ) // Current frame is invalid, ignore data until we start a new frame
+        // RTP fixed header, network order: V(2) P(1) X(1) CC(4) | M(1) PT(7) | sequence(16) | timestamp(32) | SSRC(32)
+        uint8_t lVersion     = mRTPHeader[0] >> 6;
+        bool lPadding        = ( mRTPHeader[0] & 0x20 ) != 0;
+        bool lExtension      = ( mRTPHeader[0] & 0x10 ) != 0;
+        uint32_t lCsrcSize   = static_cast<uint32_t>( mRTPHeader[0] & 0x0F ) * 4;
+        bool lMarker         = ( mRTPHeader[1] & 0x80 ) != 0;
+        uint8_t lPayloadType = mRTPHeader[1] & 0x7F;
+        uint16_t lSequence   = static_cast<uint16_t>( ( mRTPHeader[2] << 8 ) | mRTPHeader[3] );
+        uint32_t lTimestamp  = ( static_cast<uint32_t>( mRTPHeader[4] ) << 24 ) | ( static_cast<uint32_t>( mRTPHeader[5] ) << 16 ) |
+                              ( static_cast<uint32_t>( mRTPHeader[6] ) << 8 ) | mRTPHeader[7];
+
+        if( lVersion != LdRtpPacket::GetSupportedProtocolVersion() )
+        {
+            throw std::runtime_error( "RTP header: Unexpected protocol version" );
+        }
+        if( lExtension )
         {
-            if( lRTPPaquet.IsMarked() ) // Next paquet is the start of a new frame
-            {
-                lSetNextFrameValid = true;
-            }
-
-            if( mRTPTimestamp != lNewTimestamp && ( lNewSequenceNumber == static_cast<uint16_t>( mRTPSequenceNumber + 2 ) ) )
-            {
-                // We missed IsMarked, but we missed only one frame and the timestamp changed, so its the first paquet of a new frame
-                mRTPFrameIsValid = true;
-                mPayLoad.clear();
-                mRTPSequenceNumber =
-                    lNewSequenceNumber - 1; // Small hack so we dont skip current data because we missed previous frame, because we know its the beginning of a new frame
-            }
+            throw std::runtime_error( "Extended RTP paquet not supported." );
+        }
+        if( lPayloadType != RTP_PAYLOAD_PIXELL )
+        {
+            throw std::runtime_error( "Wrong payload type." );
         }
 
-        if( lNewSequenceNumber < mRTPSequenceNumber && lNewSequenceNumber > lUint16LoopDelta )
+        uint32_t lPayloadSize   = lSizeRead - sizeof( mRTPHeader );
+        const uint8_t *lPayload = mOverflow.data();
+
+        if( lSlot != nullptr && lPayloadSize <= lSlotSize )
         {
-            // Old data, just ignore it
+            lPayload = lSlot;
         }
-        else if( !mRTPFrameIsValid || lNewSequenceNumber != static_cast<uint16_t>( mRTPSequenceNumber + 1 ) )
+        else if( lSlot != nullptr )
         {
-            // We missed a paquet
-            mRTPFrameIsValid = false;
-            mPayLoad.clear();
-
-            static uint32_t sLastErrorTimestamp = 0;
-            if( lNewTimestamp != sLastErrorTimestamp )
-            {
-                lThrowError = !mFirstFrame; // only throw the error if not the first frame
-                sLastErrorTimestamp = lNewTimestamp;
-            }
+            // Bigger than the slot: the end is in mOverflow, make it contiguous there
+            memmove( mOverflow.data() + lSlotSize, mOverflow.data(), lPayloadSize - lSlotSize );
+            memcpy( mOverflow.data(), lSlot, lSlotSize );
         }
-        else
+
+        if( lPadding )
         {
-            mFirstFrame = false;
-            // append payload
-            auto lPayload = lRTPPaquet.GetPayLoad();
-            mPayLoad.insert( mPayLoad.end(), lPayload, lPayload + lRTPPaquet.GetPayLoadSize() );
-
-            if( lRTPPaquet.IsMarked() )
-            {
-                // End of the frame - Copy the payload to mTransferOutputBuffer so all LeddarTech function work as usual
-                if( mPayLoad.size() > mTransferBufferSize )
-                {
-                    ResizeInternalBuffers( mPayLoad.size() );
-                }
-
-                memcpy( mTransferOutputBuffer, mPayLoad.data(), mPayLoad.size() );
-                mPayLoad.clear();
-                LtComLeddarTechPublic::sLtCommAnswerHeader *lHeader = reinterpret_cast<LtComLeddarTechPublic::sLtCommAnswerHeader *>( mTransferOutputBuffer );
-                mRequestCode                                        = lHeader->mRequestCode;
-                mAnswerCode                                         = lHeader->mAnswerCode;
-                mMessageSize                                        = lHeader->mAnswerSize - sizeof( LtComLeddarTechPublic::sLtCommAnswerHeader );
-                mElementOffset                                      = sizeof( LtComLeddarTechPublic::sLtCommAnswerHeader );
-                lFrameReceived                                      = true;
-            }
+            lPayloadSize -= std::min<uint32_t>( lPayloadSize, lPayload[lPayloadSize - 1] );
         }
 
-        if( lNewSequenceNumber >= static_cast<uint16_t>( mRTPSequenceNumber + 1 ) ||
-            ( lNewSequenceNumber < lUint16LoopDelta && mRTPSequenceNumber > std::numeric_limits<uint16_t>::max() - lUint16LoopDelta ) )
+        if( lPayloadSize <= lCsrcSize )
         {
-            mRTPSequenceNumber = lNewSequenceNumber;
-            mRTPTimestamp      = lNewTimestamp;
+            throw std::runtime_error( "RTP header: Payload is empty" );
         }
 
-        if( lSetNextFrameValid )
-            mRTPFrameIsValid = true;
+        lFrameReceived = mJitterBuffer.AddPacket( lSequence, lTimestamp, lMarker, lPayload + lCsrcSize, lPayloadSize - lCsrcSize );
     }
 
-    if( lThrowError )
+    if( lFrameReceived )
+    {
+        // The frame is at the start of mTransferOutputBuffer so all LeddarTech function work as usual
+        mFirstFrame                                         = false;
+        LtComLeddarTechPublic::sLtCommAnswerHeader *lHeader = reinterpret_cast<LtComLeddarTechPublic::sLtCommAnswerHeader *>( mTransferOutputBuffer );
+        mRequestCode                                        = lHeader->mRequestCode;
+        mAnswerCode                                         = lHeader->mAnswerCode;
+        mMessageSize                                        = lHeader->mAnswerSize - sizeof( LtComLeddarTechPublic::sLtCommAnswerHeader );
+        mElementOffset                                      = sizeof( LtComLeddarTechPublic::sLtCommAnswerHeader );
+    }
+    else if( mJitterBuffer.GetStats().mFramesDropped != lDroppedFrames && !mFirstFrame ) // only throw the error if not the first frame
+    {
         throw std::runtime_error( "Missed a frame " );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdProtocolLeddartechEthernetPixell::ResizeInternalBuffers( const uint32_t &aSize )
+///
+/// \brief  Resize the internal buffers, the frame being assembled in mTransferOutputBuffer is kept
+///
+/// \param  aSize   The new size.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdProtocolLeddartechEthernetPixell::ResizeInternalBuffers( const uint32_t &aSize )
+{
+    LdProtocolLeddarTech::ResizeInternalBuffers( aSize );
+    mJitterBuffer.SetFrameBuffer( mTransferOutputBuffer, mTransferBufferSize );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
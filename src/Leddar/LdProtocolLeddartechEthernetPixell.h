@@ -13,6 +13,7 @@
 
 #include "LdInterfaceEthernet.h"
 #include "LdProtocolLeddarTech.h"
+#include "LdRtpJitterBuffer.h"
 
 namespace LeddarConnection
 {
@@ -27,15 +28,21 @@ namespace LeddarConnection
         virtual void Connect( void ) override;
         virtual void Disconnect( void ) override;
         virtual void ReadAnswer( void ) override;
+        virtual void ResizeInternalBuffers( const uint32_t &aSize ) override;
+
+        const LdRtpJitterStats &GetRtpStats( void ) const { return mJitterBuffer.GetStats(); }
+        void ResetRtpStats( void ) { mJitterBuffer.ResetStats(); }
+        void SetReorderWindow( uint16_t aPackets ) { mJitterBuffer.SetReorderWindow( aPackets ); }
+        uint16_t GetReorderWindow( void ) const { return mJitterBuffer.GetReorderWindow(); }
 
       private:
         virtual uint32_t Read( uint32_t ) override;
 
         LdInterfaceEthernet *mInterfaceEthernet;
-        uint16_t mRTPSequenceNumber = 0;
-        uint32_t mRTPTimestamp = 0;
-        bool mRTPFrameIsValid = false, mFirstFrame = true;
-        std::vector<uint8_t> mPayLoad;
+        bool mFirstFrame = true;
+        LdRtpJitterBuffer mJitterBuffer;
+        uint8_t mRTPHeader[12];          ///< Fixed RTP header, received apart from the payload
+        std::vector<uint8_t> mOverflow; ///< Receives what does not fit in the frame buffer slot
     };
 } // namespace LeddarConnection
 
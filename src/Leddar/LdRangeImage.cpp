@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdRangeImage.cpp
+///
+/// \brief  Implements the LdRangeImage class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdRangeImage.h"
+
+#include "LdResultEchoes.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+    const uint32_t INVALID_PIXEL = std::numeric_limits<uint32_t>::max();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdRangeImage::LdRangeImage( void )
+///
+/// \brief  Constructor, the image is disabled.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdRangeImage::LdRangeImage( void ) : mWidth( 0 ), mHeight( 0 ), mEchoesPerPixel( 0 ), mEchoCount( 0 ) {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdRangeImage::Init( uint16_t aWidth, uint16_t aHeight, uint32_t aEchoesPerPixel, uint32_t aChannelCount )
+///
+/// \brief  Sets the size of the image and computes the pixel of each channel. aEchoesPerPixel 0 disables the image and releases its memory.
+///
+/// \param  aWidth          Number of horizontal channels.
+/// \param  aHeight         Number of vertical channels.
+/// \param  aEchoesPerPixel Maximum echoes per pixel (K), the next echoes of a pixel are ignored.
+/// \param  aChannelCount   Number of channel indexes of the sensor, 0 for aWidth x aHeight. The indexes after aWidth x aHeight
+///                         fold on the same pixels (channel index modulo aWidth x aHeight).
+///
+/// \exception  std::invalid_argument   Thrown when the image is empty or the channel indexes do not fit in 16 bits.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdRangeImage::Init( uint16_t aWidth, uint16_t aHeight, uint32_t aEchoesPerPixel, uint32_t aChannelCount )
+{
+    if( aEchoesPerPixel == 0 )
+    {
+        mWidth          = 0;
+        mHeight         = 0;
+        mEchoesPerPixel = 0;
+        std::vector<uint32_t>().swap( mPixels );
+        std::vector<float>().swap( mDistances );
+        std::vector<float>().swap( mAmplitudes );
+        std::vector<uint8_t>().swap( mCounts );
+        mEchoCount = 0;
+        return;
+    }
+
+    const uint32_t lPixels   = static_cast<uint32_t>( aWidth ) * aHeight;
+    const uint32_t lChannels = std::max( aChannelCount, lPixels );
+
+    if( lPixels == 0 || aEchoesPerPixel > std::numeric_limits<uint8_t>::max() || lChannels > static_cast<uint32_t>( std::numeric_limits<uint16_t>::max() ) + 1 )
+    {
+        throw std::invalid_argument( "Invalid range image size." );
+    }
+
+    mWidth          = aWidth;
+    mHeight         = aHeight;
+    mEchoesPerPixel = aEchoesPerPixel;
+    mPixels.resize( lChannels + 1 );
+
+    for( uint32_t i = 0; i < lChannels; ++i )
+    {
+        mPixels[i] = i % lPixels;
+    }
+
+    mPixels[lChannels] = INVALID_PIXEL;
+    mDistances.assign( static_cast<size_t>( lPixels ) * aEchoesPerPixel, 0 );
+    mAmplitudes.assign( static_cast<size_t>( lPixels ) * aEchoesPerPixel, 0 );
+    mCounts.assign( lPixels, 0 );
+    mEchoCount = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdRangeImage::Clear( void )
+///
+/// \brief  Empty all the pixels.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdRangeImage::Clear( void )
+{
+    if( !mCounts.empty() )
+    {
+        memset( mDistances.data(), 0, mDistances.size() * sizeof( float ) );
+        memset( mAmplitudes.data(), 0, mAmplitudes.size() * sizeof( float ) );
+        memset( mCounts.data(), 0, mCounts.size() );
+    }
+
+    mEchoCount = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdRangeImage::Fill( const LdEcho *aEchoes, uint32_t aCount, uint32_t aDistanceScale, uint32_t aAmplitudeScale )
+///
+/// \brief  Scatter the echoes of a frame in the image, in one pass and without allocation. Echoes with a negative distance are ignored.
+///
+/// \param  aEchoes         The echoes.
+/// \param  aCount          Number of echoes.
+/// \param  aDistanceScale  Distance scale of the echoes.
+/// \param  aAmplitudeScale Amplitude scale of the echoes.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdRangeImage::Fill( const LdEcho *aEchoes, uint32_t aCount, uint32_t aDistanceScale, uint32_t aAmplitudeScale )
+{
+    Clear();
+
+    if( mEchoesPerPixel == 0 )
+    {
+        return;
+    }
+
+    const uint32_t *lPixels        = mPixels.data();
+    const uint32_t lLastChannel    = static_cast<uint32_t>( mPixels.size() - 1 );
+    float *lDistances              = mDistances.data();
+    float *lAmplitudes             = mAmplitudes.data();
+    uint8_t *lCounts               = mCounts.data();
+    const uint32_t lEchoesPerPixel = mEchoesPerPixel;
+    const float lInverseDistance   = aDistanceScale != 0 ? 1.0f / aDistanceScale : 1.0f;
+    const float lInverseAmplitude  = aAmplitudeScale != 0 ? 1.0f / aAmplitudeScale : 1.0f;
+    uint32_t lEchoCount            = 0;
+
+    for( uint32_t i = 0; i < aCount; ++i )
+    {
+        const LdEcho &lEcho   = aEchoes[i];
+        const uint32_t lPixel = lPixels[std::min( static_cast<uint32_t>( lEcho.mChannelIndex ), lLastChannel )];
+
+        if( lPixel == INVALID_PIXEL || lEcho.mDistance < 0 || lCounts[lPixel] >= lEchoesPerPixel )
+        {
+            continue;
+        }
+
+        const size_t lSlot = static_cast<size_t>( lPixel ) * lEchoesPerPixel + lCounts[lPixel]++;
+        lDistances[lSlot]  = static_cast<float>( lEcho.mDistance ) * lInverseDistance;
+        lAmplitudes[lSlot] = static_cast<float>( lEcho.mAmplitude ) * lInverseAmplitude;
+        ++lEchoCount;
+    }
+
+    mEchoCount = lEchoCount;
+}
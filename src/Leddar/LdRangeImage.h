@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdRangeImage.h
+///
+/// \brief  Declares the LdRangeImage class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+namespace LeddarConnection
+{
+    struct LdEcho;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdRangeImage
+    ///
+    /// \brief  Dense image of the echoes of a sensor with a regular channel grid: height x width pixels (vertical x horizontal
+    ///         channels, channel index = row * width + column) with up to K echoes per pixel, in the order of the echoes.
+    ///         Distances and amplitudes are unscaled float32 in [row][column][echo] order, the slots after the echo count of a pixel are 0.
+    ///         The pixel of each channel index comes from a table computed once, the channels after width x height
+    ///         (the other gains of a Pixell) fold on the same pixels.
+    ///
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdRangeImage
+    {
+    public:
+        LdRangeImage( void );
+
+        void Init( uint16_t aWidth, uint16_t aHeight, uint32_t aEchoesPerPixel, uint32_t aChannelCount = 0 );
+        void Clear( void );
+
+        uint16_t GetWidth( void ) const { return mWidth; }
+        uint16_t GetHeight( void ) const { return mHeight; }
+        uint32_t GetEchoesPerPixel( void ) const { return mEchoesPerPixel; }
+        bool IsEnabled( void ) const { return mEchoesPerPixel != 0; }
+
+        void Fill( const LdEcho *aEchoes, uint32_t aCount, uint32_t aDistanceScale, uint32_t aAmplitudeScale );
+
+        // Result of the last Fill
+        const std::vector<float> &GetDistances( void ) const { return mDistances; }   ///< height x width x K
+        const std::vector<float> &GetAmplitudes( void ) const { return mAmplitudes; } ///< height x width x K
+        const std::vector<uint8_t> &GetCounts( void ) const { return mCounts; }       ///< height x width, echoes per pixel
+        uint32_t GetEchoCount( void ) const { return mEchoCount; }                   ///< Echoes in the image
+
+    private:
+        uint16_t mWidth;
+        uint16_t mHeight;
+        uint32_t mEchoesPerPixel;
+        std::vector<uint32_t> mPixels; ///< Pixel of each channel index, and a last INVALID_PIXEL for the following channels
+
+        std::vector<float> mDistances;
+        std::vector<float> mAmplitudes;
+        std::vector<uint8_t> mCounts;
+        uint32_t mEchoCount;
+    };
+} // namespace LeddarConnection
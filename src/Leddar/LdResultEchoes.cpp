@@ -9,8 +9,11 @@
 #include "LdResultEchoes.h"
 #include "LdPropertyIds.h"
 #include "LtMathUtils.h"
+#include "LtSystemUtils.h"
 #include "LtTimeUtils.h"
 
+#include <algorithm>
+
 #ifdef _DEBUG
 #include <sstream>
 #endif
@@ -32,7 +35,10 @@ LdResultEchoes::LdResultEchoes( void )
     , mVFOV( 0 )
     , mHChan( 0 )
     , mVChan( 0 )
-
+    , mFilterEnabled( false )
+    , mTemporalFilterEnabled( false )
+    , mRangeImageEnabled( false )
+    , mVoxelGridEnabled( false )
 {
     auto *lTS =
         new LeddarCore::LdIntegerProperty( LeddarCore::LdProperty::CAT_INFO, LeddarCore::LdProperty::F_SAVE  | LeddarCore::LdProperty::F_NO_MODIFIED_WARNING, LeddarCore::LdPropertyIds::ID_RS_TIMESTAMP, 0, 4, "Timestamp" );
@@ -82,6 +88,26 @@ void LdResultEchoes::Init( uint32_t aDistanceScale, uint32_t aAmplitudeScale, ui
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdResultEchoes::PrefaultBuffers( void )
+///
+/// \brief  Touch the memory of both echoes buffers so no page fault happens when the first frames are written.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdResultEchoes::PrefaultBuffers( void )
+{
+    const eBuffer lBuffers[] = { B_GET, B_SET };
+
+    for( eBuffer lBuffer : lBuffers )
+    {
+        // cppcheck-suppress unreadVariable
+        auto lLock                   = mDoubleBuffer.GetUniqueLock( lBuffer );
+        std::vector<LdEcho> &lEchoes = mDoubleBuffer.GetBuffer( lBuffer )->Buffer()->mEchoes;
+        LeddarUtils::LtSystemUtils::PrefaultMemory( lEchoes.data(), lEchoes.size() * sizeof( LdEcho ) );
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn void LeddarConnection::LdResultEchoes::Swap()
 ///
@@ -90,7 +116,236 @@ void LdResultEchoes::Init( uint32_t aDistanceScale, uint32_t aAmplitudeScale, ui
 /// \author David Levy
 /// \date   May 2018
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void LeddarConnection::LdResultEchoes::Swap() { mDoubleBuffer.Swap(); }
+void LeddarConnection::LdResultEchoes::Swap()
+{
+    if( mFilterEnabled.load( std::memory_order_acquire ) || mTemporalFilterEnabled.load( std::memory_order_acquire ) ||
+        mRangeImageEnabled.load( std::memory_order_acquire ) || mVoxelGridEnabled.load( std::memory_order_acquire ) )
+    {
+        // The filters were applied before the cartesian conversion, except for the results written by the user
+        // cppcheck-suppress unreadVariable
+        auto lLock = mDoubleBuffer.GetUniqueLock( B_SET );
+        FilterEchoes();
+        FillRangeImage();
+        ReduceEchoes();
+    }
+
+    LT_PIPELINE_SCOPE( mPipelineStats, STAGE_SWAP );
+
+    if( mDoubleBuffer.Swap() )
+    {
+        LT_PIPELINE_COUNT( mPipelineStats, COUNTER_LOCK_CONTENTION, 1 );
+    }
+
+    LT_PIPELINE_COUNT( mPipelineStats, COUNTER_FRAMES_DECODED, 1 );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdResultEchoes::SetFilter( const LdEchoFilter &aFilter )
+///
+/// \brief  Set the filter applied to the next frames. A filter that keeps all the echoes disables the filtering.
+///
+/// \param  aFilter The filter.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdResultEchoes::SetFilter( const LdEchoFilter &aFilter )
+{
+    std::lock_guard<std::mutex> lLock( mFilterMutex );
+    mFilter = aFilter;
+    mFilterEnabled.store( mFilter.IsEnabled(), std::memory_order_release );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LdEchoFilter LeddarConnection::LdResultEchoes::GetFilter( void ) const
+///
+/// \brief  Gets a copy of the echo filter
+///
+/// \returns    The filter.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdEchoFilter LeddarConnection::LdResultEchoes::GetFilter( void ) const
+{
+    std::lock_guard<std::mutex> lLock( mFilterMutex );
+    return mFilter;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint32_t LeddarConnection::LdResultEchoes::FilterEchoes( void )
+///
+/// \brief  Apply the echo filter then the temporal filter to the B_SET buffer, once per frame: the echo count is reduced to the kept echoes.
+///         The B_SET lock must be held.
+///
+/// \returns    The number of removed echoes.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t LeddarConnection::LdResultEchoes::FilterEchoes( void )
+{
+    EchoBuffer *lBuffer  = mDoubleBuffer.GetBuffer( B_SET )->Buffer();
+    const bool lFilter   = mFilterEnabled.load( std::memory_order_acquire );
+    const bool lTemporal = mTemporalFilterEnabled.load( std::memory_order_acquire );
+
+    if( ( !lFilter && !lTemporal ) || lBuffer->mFiltered )
+    {
+        return 0;
+    }
+
+    const uint32_t lCount = std::min( lBuffer->mCount, static_cast<uint32_t>( lBuffer->mEchoes.size() ) );
+    uint32_t lKept        = lCount;
+
+    if( lFilter )
+    {
+        std::lock_guard<std::mutex> lLock( mFilterMutex );
+        lKept = mFilter.Apply( lBuffer->mEchoes.data(), lCount, mDistanceScale, mAmplitudeScale );
+        LT_PIPELINE_COUNT( mPipelineStats, COUNTER_ECHOES_FILTERED, lCount - lKept );
+    }
+
+    if( lTemporal )
+    {
+        LT_PIPELINE_SCOPE( mPipelineStats, STAGE_SMOOTH );
+        std::lock_guard<std::mutex> lLock( mTemporalFilterMutex );
+        const uint32_t lFiltered = lKept;
+        lKept                    = mTemporalFilter.Apply( lBuffer->mEchoes.data(), lFiltered, mDistanceScale );
+        LT_PIPELINE_COUNT( mPipelineStats, COUNTER_ECHOES_REJECTED, lFiltered - lKept );
+    }
+
+    lBuffer->mCount    = lKept;
+    lBuffer->mFiltered = true;
+    return lCount - lKept;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdResultEchoes::SetTemporalFilter( const LdTemporalFilter &aTemporalFilter )
+///
+/// \brief  Set the frame to frame smoothing applied to the next frames, its state restarts. A disabled filter, or without channels, removes it.
+///
+/// \param  aTemporalFilter The temporal filter.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdResultEchoes::SetTemporalFilter( const LdTemporalFilter &aTemporalFilter )
+{
+    std::lock_guard<std::mutex> lLock( mTemporalFilterMutex );
+    mTemporalFilter = aTemporalFilter;
+    mTemporalFilter.Reset();
+    mTemporalFilterEnabled.store( mTemporalFilter.IsEnabled(), std::memory_order_release );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LdTemporalFilter LeddarConnection::LdResultEchoes::GetTemporalFilter( void ) const
+///
+/// \brief  Gets a copy of the temporal filter, with its state
+///
+/// \returns    The temporal filter.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdTemporalFilter LeddarConnection::LdResultEchoes::GetTemporalFilter( void ) const
+{
+    std::lock_guard<std::mutex> lLock( mTemporalFilterMutex );
+    return mTemporalFilter;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdResultEchoes::SetRangeImage( uint16_t aWidth, uint16_t aHeight, uint32_t aEchoesPerPixel, uint32_t aChannelCount )
+///
+/// \brief  Enable the dense range image of the next frames (see LdRangeImage::Init), in both buffers. aEchoesPerPixel 0 disables it.
+///
+/// \param  aWidth          Number of horizontal channels.
+/// \param  aHeight         Number of vertical channels.
+/// \param  aEchoesPerPixel Maximum echoes per pixel.
+/// \param  aChannelCount   Number of channel indexes of the sensor, 0 for aWidth x aHeight.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdResultEchoes::SetRangeImage( uint16_t aWidth, uint16_t aHeight, uint32_t aEchoesPerPixel, uint32_t aChannelCount )
+{
+    LdRangeImage lRangeImage;
+    lRangeImage.Init( aWidth, aHeight, aEchoesPerPixel, aChannelCount );
+
+    auto lGetLock = mDoubleBuffer.GetUniqueLock( B_GET, true );
+    auto lSetLock = mDoubleBuffer.GetUniqueLock( B_SET, true );
+    std::lock( lGetLock, lSetLock );
+
+    mDoubleBuffer.GetBuffer( B_GET )->Buffer()->mRangeImage = lRangeImage;
+    mDoubleBuffer.GetBuffer( B_SET )->Buffer()->mRangeImage = lRangeImage;
+    mRangeImageEnabled.store( lRangeImage.IsEnabled(), std::memory_order_release );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdResultEchoes::FillRangeImage( void )
+///
+/// \brief  Fill the range image of the B_SET buffer from its echoes. The B_SET lock must be held.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdResultEchoes::FillRangeImage( void )
+{
+    if( !mRangeImageEnabled.load( std::memory_order_acquire ) )
+    {
+        return;
+    }
+
+    LT_PIPELINE_SCOPE( mPipelineStats, STAGE_RANGE_IMAGE );
+    EchoBuffer *lBuffer   = mDoubleBuffer.GetBuffer( B_SET )->Buffer();
+    const uint32_t lCount = std::min( lBuffer->mCount, static_cast<uint32_t>( lBuffer->mEchoes.size() ) );
+    lBuffer->mRangeImage.Fill( lBuffer->mEchoes.data(), lCount, mDistanceScale, mAmplitudeScale );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdResultEchoes::SetVoxelGrid( const LdVoxelGrid &aVoxelGrid )
+///
+/// \brief  Set the spatial downsampling applied to the next frames. A voxel grid without voxels nor region of interest disables it.
+///
+/// \param  aVoxelGrid  The voxel grid.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdResultEchoes::SetVoxelGrid( const LdVoxelGrid &aVoxelGrid )
+{
+    std::lock_guard<std::mutex> lLock( mVoxelGridMutex );
+    mVoxelGrid = aVoxelGrid;
+    mVoxelGridEnabled.store( mVoxelGrid.IsEnabled(), std::memory_order_release );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LdVoxelGrid LeddarConnection::LdResultEchoes::GetVoxelGrid( void ) const
+///
+/// \brief  Gets a copy of the voxel grid
+///
+/// \returns    The voxel grid.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdVoxelGrid LeddarConnection::LdResultEchoes::GetVoxelGrid( void ) const
+{
+    std::lock_guard<std::mutex> lLock( mVoxelGridMutex );
+    return mVoxelGrid;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdResultEchoes::ReduceEchoes( void )
+///
+/// \brief  Apply the voxel grid to the B_SET buffer. The B_SET lock must be held.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdResultEchoes::ReduceEchoes( void )
+{
+    if( !mVoxelGridEnabled.load( std::memory_order_acquire ) )
+    {
+        return;
+    }
+
+    LT_PIPELINE_SCOPE( mPipelineStats, STAGE_REDUCE );
+    EchoBuffer *lBuffer   = mDoubleBuffer.GetBuffer( B_SET )->Buffer();
+    const uint32_t lCount = std::min( lBuffer->mCount, static_cast<uint32_t>( lBuffer->mEchoes.size() ) );
+
+    std::lock_guard<std::mutex> lLock( mVoxelGridMutex );
+    lBuffer->mCount = mVoxelGrid.Reduce( lBuffer->mEchoes.data(), lCount );
+    LT_PIPELINE_COUNT( mPipelineStats, COUNTER_ECHOES_REDUCED, lCount - lBuffer->mCount );
+}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn uint32_t LdResultEchoes::GetEchoCount( eBuffer aBuffer ) const
@@ -231,6 +486,68 @@ uint32_t LeddarConnection::LdResultEchoes::GetTimestamp( eBuffer aBuffer ) const
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void LeddarConnection::LdResultEchoes::SetTimestamp( uint32_t aTimestamp ) { mDoubleBuffer.SetPropertyValue( LeddarCore::LdPropertyIds::ID_RS_TIMESTAMP, 0, aTimestamp ); }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn const LeddarCore::LdPropertiesContainer *LeddarConnection::LdResultEchoes::GetProperties() const
+///
+/// \brief  Gets the properties of the B_GET buffer, with the frame metadata up to date
+///
+/// \returns    The properties.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const LeddarCore::LdPropertiesContainer *LeddarConnection::LdResultEchoes::GetProperties() const
+{
+    MirrorFrameMetadata();
+    return mDoubleBuffer.GetProperties();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdResultEchoes::MirrorFrameMetadata( void ) const
+///
+/// \brief  Copy the typed metadata of the B_GET buffer to its properties, if it changed since the last call.
+///         Properties not declared by the sensor are skipped.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdResultEchoes::MirrorFrameMetadata( void ) const
+{
+    std::lock_guard<std::mutex> lock( mMetadataMutex );
+    // The mirror is a cache of the typed metadata, so it is updated from const accessors
+    DataBuffer<EchoBuffer> *lGetBuffer = const_cast<LdDoubleBuffer<EchoBuffer> &>( mDoubleBuffer ).GetBuffer( B_GET );
+    EchoBuffer *lEchoBuffer            = lGetBuffer->Buffer();
+
+    if( !lEchoBuffer->mMetadataDirty )
+    {
+        return;
+    }
+
+    const LdFrameMetadata &lMetadata               = lEchoBuffer->mMetadata;
+    LeddarCore::LdPropertiesContainer *lProperties = const_cast<LeddarCore::LdPropertiesContainer *>( lGetBuffer->GetProperties() );
+    LeddarCore::LdProperty *lProperty              = nullptr;
+
+    if( ( lMetadata.mFields & LdFrameMetadata::MF_TIMESTAMP64 ) && ( lProperty = lProperties->FindProperty( LeddarCore::LdPropertyIds::ID_RS_TIMESTAMP64 ) ) != nullptr )
+    {
+        dynamic_cast<LeddarCore::LdIntegerProperty *>( lProperty )->ForceValueUnsigned( 0, lMetadata.mTimestamp64 );
+    }
+
+    if( ( lMetadata.mFields & LdFrameMetadata::MF_FRAME_ID ) && ( lProperty = lProperties->FindProperty( LeddarCore::LdPropertyIds::ID_RS_FRAME_ID ) ) != nullptr )
+    {
+        dynamic_cast<LeddarCore::LdIntegerProperty *>( lProperty )->ForceValueUnsigned( 0, lMetadata.mFrameId );
+    }
+
+    if( ( lMetadata.mFields & LdFrameMetadata::MF_LED_POWER ) && ( lProperty = lProperties->FindProperty( LeddarCore::LdPropertyIds::ID_CURRENT_LED_INTENSITY ) ) != nullptr )
+    {
+        dynamic_cast<LeddarCore::LdIntegerProperty *>( lProperty )->ForceValue( 0, lMetadata.mLedPower );
+    }
+
+    if( ( lMetadata.mFields & LdFrameMetadata::MF_NOISE_LEVEL_AVG ) && ( lProperty = lProperties->FindProperty( LeddarCore::LdPropertyIds::ID_RS_NOISE_LEVEL_AVG ) ) != nullptr )
+    {
+        dynamic_cast<LeddarCore::LdIntegerProperty *>( lProperty )->ForceValue( 0, lMetadata.mNoiseLevelAvg );
+    }
+
+    lEchoBuffer->mMetadataDirty = false;
+}
+
 #ifdef _DEBUG
 // *****************************************************************************
 // Function: LdResultEchoes::ToString
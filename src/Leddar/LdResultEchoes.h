@@ -9,9 +9,14 @@
 #pragma once
 
 #include "LdDoubleBuffer.h"
+#include "LdEchoFilter.h"
 #include "LdIntegerProperty.h"
+#include "LdRangeImage.h"
 #include "LdResultProvider.h"
+#include "LdTemporalFilter.h"
+#include "LdVoxelGrid.h"
 
+#include <atomic>
 #include <cassert>
 
 namespace LeddarUtils
@@ -45,10 +50,37 @@ namespace LeddarConnection
         }
     };
 
+    /// \brief  Per frame metadata decoded with the echoes.
+    ///         Stored as plain fields so the decoding does not go through the properties,
+    ///         they are mirrored to the result properties only when the properties are read.
+    struct LdFrameMetadata
+    {
+        enum eFields
+        {
+            MF_NONE            = 0,
+            MF_TIMESTAMP64     = 1 << 0,
+            MF_FRAME_ID        = 1 << 1,
+            MF_LED_POWER       = 1 << 2,
+            MF_NOISE_LEVEL_AVG = 1 << 3
+        };
+
+        uint64_t mTimestamp64   = 0;       ///< Timestamp in usec since 1970/01/01
+        uint64_t mFrameId       = 0;       ///< Frame id
+        uint32_t mNoiseLevelAvg = 0;       ///< Noise level mean
+        uint16_t mLedPower      = 0;       ///< Current led power in %
+        uint32_t mFields        = MF_NONE; ///< Fields provided by the sensor (eFields)
+        bool mIncomplete        = false;   ///< Some echoes of the frame were not received (frame reassembled from several datagrams)
+    };
+
     typedef struct EchoBuffer
     {
         std::vector<LdEcho> mEchoes;
         uint32_t mCount           = 0;
+        uint32_t mUsedCount       = 0; ///< Count given to SetEchoCount, the filters lower mCount in place and leave [mCount, mUsedCount) stale
+        LdFrameMetadata mMetadata;
+        bool mMetadataDirty       = false; ///< mMetadata not yet mirrored to the properties
+        bool mFiltered            = false; ///< The echo and temporal filters were applied since the last SetEchoCount
+        LdRangeImage mRangeImage;          ///< Dense image of the echoes, filled by Swap when enabled
     } EchoBuffer;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -67,6 +99,7 @@ namespace LeddarConnection
 
         void Init( uint32_t aDistanceScale, uint32_t aAmplitudeScale, uint32_t aMaxDetections );
         bool IsInitialized( void ) const { return mIsInitialized; }
+        void PrefaultBuffers( void );
         void Swap();
         std::unique_lock<std::mutex> GetUniqueLock( eBuffer aBuffer, bool aDefer = false ) const { return mDoubleBuffer.GetUniqueLock( aBuffer, aDefer ); }
 
@@ -74,19 +107,52 @@ namespace LeddarConnection
         float GetEchoDistance( size_t aIndex ) const;
         float GetEchoAmplitude( size_t aIndex ) const;
         float GetEchoBase( size_t aIndex ) const;
-        void SetEchoCount( uint32_t aValue ) { mDoubleBuffer.GetBuffer( B_SET )->Buffer()->mCount = aValue; }
+        void SetEchoCount( uint32_t aValue )
+        {
+            EchoBuffer *lBuffer = mDoubleBuffer.GetBuffer( B_SET )->Buffer();
+            lBuffer->mCount     = aValue;
+            lBuffer->mUsedCount = aValue;
+            lBuffer->mFiltered  = false;
+        }
         uint32_t GetEchoCount( eBuffer aBuffer = B_GET ) const;
+        uint32_t GetUsedEchoCount( eBuffer aBuffer = B_GET ) const { return mDoubleBuffer.GetConstBuffer( aBuffer )->Buffer()->mUsedCount; }
         uint32_t GetDistanceScale( void ) const { return mDistanceScale; }
         void SetDistanceScale( uint32_t aNewScale ) { mDistanceScale = aNewScale; }
         uint32_t GetAmplitudeScale( void ) const { return mAmplitudeScale; }
         void SetAmplitudeScale( uint32_t aNewScale ) { mAmplitudeScale = aNewScale; }
         uint32_t GetTimestamp( eBuffer aBuffer = B_GET ) const;
         void SetTimestamp( uint32_t aTimestamp );
-        const LeddarCore::LdPropertiesContainer *GetProperties() const { return mDoubleBuffer.GetProperties(); }
+        const LeddarCore::LdPropertiesContainer *GetProperties() const;
         void SetPropertyRawStorage(uint32_t aId, uint8_t *aBuffer, size_t aCount, uint32_t aSize) {mDoubleBuffer.ForceRawStorage(aId, aBuffer, aCount, aSize);}
         void SetPropertyValue( uint32_t aId, uint32_t aIndex, boost::any aValue ) {mDoubleBuffer.SetPropertyValue(aId, aIndex, aValue);}
         void AddProperty( LeddarCore::LdProperty *aProperty ) {mDoubleBuffer.AddProperty(aProperty);}
         void SetPropertyCount( uint32_t aId, size_t aCount ) { mDoubleBuffer.SetPropertyCount( aId, aCount ); }
+
+        // Typed per frame metadata, written in the B_SET buffer (lock must be held)
+        void SetTimestamp64( uint64_t aTimestamp64 ) { SetMetadataField( &LdFrameMetadata::mTimestamp64, aTimestamp64, LdFrameMetadata::MF_TIMESTAMP64 ); }
+        void SetFrameId( uint64_t aFrameId ) { SetMetadataField( &LdFrameMetadata::mFrameId, aFrameId, LdFrameMetadata::MF_FRAME_ID ); }
+        void SetCurrentLedPower( uint16_t aLedPower ) { SetMetadataField( &LdFrameMetadata::mLedPower, aLedPower, LdFrameMetadata::MF_LED_POWER ); }
+        void SetNoiseLevelAvg( uint32_t aNoiseLevelAvg ) { SetMetadataField( &LdFrameMetadata::mNoiseLevelAvg, aNoiseLevelAvg, LdFrameMetadata::MF_NOISE_LEVEL_AVG ); }
+        void SetIncomplete( bool aIncomplete ) { mDoubleBuffer.GetBuffer( B_SET )->Buffer()->mMetadata.mIncomplete = aIncomplete; }
+        const LdFrameMetadata &GetFrameMetadata( eBuffer aBuffer = B_GET ) const { return mDoubleBuffer.GetConstBuffer( aBuffer )->Buffer()->mMetadata; }
+
+        // Echo filter, applied to the B_SET buffer by the sensor before the cartesian conversion, else by Swap
+        void SetFilter( const LdEchoFilter &aFilter );
+        LdEchoFilter GetFilter( void ) const;
+        uint32_t FilterEchoes( void );
+
+        // Frame to frame smoothing, applied to the B_SET buffer after the echo filter
+        void SetTemporalFilter( const LdTemporalFilter &aTemporalFilter );
+        LdTemporalFilter GetTemporalFilter( void ) const;
+
+        // Dense range image, filled in the B_SET buffer by Swap from the filtered echoes, before the spatial downsampling
+        void SetRangeImage( uint16_t aWidth, uint16_t aHeight, uint32_t aEchoesPerPixel, uint32_t aChannelCount = 0 );
+        bool IsRangeImageEnabled( void ) const { return mRangeImageEnabled.load( std::memory_order_acquire ); }
+        const LdRangeImage &GetRangeImage( eBuffer aBuffer = B_GET ) const { return mDoubleBuffer.GetConstBuffer( aBuffer )->Buffer()->mRangeImage; } ///< The buffer lock must be held
+
+        // Spatial downsampling, applied to the B_SET buffer by Swap, after the cartesian conversion
+        void SetVoxelGrid( const LdVoxelGrid &aVoxelGrid );
+        LdVoxelGrid GetVoxelGrid( void ) const;
         // Useful for cartesian coordinates
         double GetVFOV( void ) const { return mVFOV; }
         void SetVFOV( const double aVFOV ) { mVFOV = aVFOV; }
@@ -102,11 +168,33 @@ namespace LeddarConnection
 #endif
 
       private:
+        template <typename T> void SetMetadataField( T LdFrameMetadata::*aField, T aValue, uint32_t aFlag )
+        {
+            EchoBuffer *lBuffer        = mDoubleBuffer.GetBuffer( B_SET )->Buffer();
+            lBuffer->mMetadata.*aField = aValue;
+            lBuffer->mMetadata.mFields |= aFlag;
+            lBuffer->mMetadataDirty    = true;
+        }
+        void MirrorFrameMetadata( void ) const;
+        void FillRangeImage( void );
+        void ReduceEchoes( void );
+
         bool mIsInitialized;
         uint32_t mDistanceScale;
         uint32_t mAmplitudeScale;
         double mHFOV, mVFOV;
         uint16_t mHChan, mVChan;
+        mutable std::mutex mMetadataMutex;
+        mutable std::mutex mFilterMutex;
+        LdEchoFilter mFilter;
+        std::atomic<bool> mFilterEnabled;
+        mutable std::mutex mTemporalFilterMutex;
+        LdTemporalFilter mTemporalFilter;
+        std::atomic<bool> mTemporalFilterEnabled;
+        std::atomic<bool> mRangeImageEnabled;
+        mutable std::mutex mVoxelGridMutex;
+        LdVoxelGrid mVoxelGrid;
+        std::atomic<bool> mVoxelGridEnabled;
 
         LdDoubleBuffer<EchoBuffer> mDoubleBuffer;
     };
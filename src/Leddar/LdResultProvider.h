@@ -15,6 +15,7 @@
 #pragma once
 
 #include "LdObject.h"
+#include "LdPipelineStats.h"
 
 namespace LeddarConnection
 {
@@ -22,8 +23,16 @@ namespace LeddarConnection
     {
       public:
         LdResultProvider( void ) = default;
-        void UpdateFinished( void ) { EmitSignal( LeddarCore::LdObject::NEW_DATA ); }
+        void UpdateFinished( void )
+        {
+            LT_PIPELINE_SCOPE( mPipelineStats, STAGE_NOTIFY );
+            EmitSignal( LeddarCore::LdObject::NEW_DATA );
+        }
         void HandleException( std::exception_ptr aEptr ) { EmitSignal( LeddarCore::LdObject::EXCEPTION, (void *)&aEptr ); }
+        void SetPipelineStats( LeddarCore::LdPipelineStats *aStats ) { mPipelineStats = aStats; }
+
+      protected:
+        LeddarCore::LdPipelineStats *mPipelineStats = nullptr; ///< Not owned, null when the provider is not instrumented
 
       private:
         LdResultProvider( const LdResultProvider &aProvider ) = delete;            // Disable copy constructor
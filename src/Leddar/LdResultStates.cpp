@@ -14,6 +14,8 @@
 
 #include "LdResultStates.h"
 
+#include "LdEnumProperty.h"
+#include "LdFloatProperty.h"
 #include "LdIntegerProperty.h"
 #include "LdPropertyIds.h"
 
@@ -30,7 +32,8 @@
 // *****************************************************************************
 
 LeddarConnection::LdResultStates::LdResultStates( void )
-    : mIsInitialized( false )
+    : mIsInitialized( false ),
+      mRecordDirty( false )
 {
     auto *lTS =
         new LeddarCore::LdIntegerProperty( LeddarCore::LdProperty::CAT_INFO, LeddarCore::LdProperty::F_SAVE, LeddarCore::LdPropertyIds::ID_RS_TIMESTAMP, 0, 4, "Timestamp" );
@@ -65,6 +68,14 @@ void LeddarConnection::LdResultStates::Init( uint32_t aTemperatureScale, uint32_
         lCPULoad->ForceValue( 0, 0.0 );
     }
 
+    std::lock_guard<std::mutex> lock( mRecordMutex );
+
+    for( LdStatesRecord &lRecord : mRecords )
+    {
+        lRecord.mTemperatureScale = aTemperatureScale;
+        lRecord.mCpuLoadScale     = aCpuLoadScale;
+    }
+
     mIsInitialized = true;
 }
 
@@ -81,6 +92,7 @@ void LeddarConnection::LdResultStates::Init( uint32_t aTemperatureScale, uint32_
 // *****************************************************************************
 std::string LeddarConnection::LdResultStates::ToString( void ) const
 {
+    MirrorRecord();
     const std::map<uint32_t, LeddarCore::LdProperty *> *lProperties = mProperties.GetContent();
     std::stringstream lResult;
 
@@ -95,26 +107,163 @@ std::string LeddarConnection::LdResultStates::ToString( void ) const
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn uint32_t LeddarConnection::LdResultStates::GetTimestamp( void ) const
 ///
-/// \brief  Gets the timestamp
+/// \brief  Gets the timestamp of the last published states
 ///
 /// \author David Lvy
 /// \date   March 2021
 ///
 /// \returns    The timestamp.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-uint32_t LeddarConnection::LdResultStates::GetTimestamp( void ) const { return mProperties.GetIntegerProperty( LeddarCore::LdPropertyIds::ID_RS_TIMESTAMP )->ValueT<uint32_t>(); }
+uint32_t LeddarConnection::LdResultStates::GetTimestamp( void ) const
+{
+    {
+        std::lock_guard<std::mutex> lock( mRecordMutex );
+
+        if( mRecords[B_GET].mFields & LdStatesRecord::SF_TIMESTAMP )
+        {
+            return mRecords[B_GET].mTimestamp;
+        }
+    }
+
+    // Sensors that decode the states in the properties
+    return mProperties.GetIntegerProperty( LeddarCore::LdPropertyIds::ID_RS_TIMESTAMP )->ValueT<uint32_t>();
+}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn void LeddarConnection::LdResultStates::SetTimestamp( uint32_t aTimestamp )
 ///
-/// \brief  Sets a timestamp
+/// \brief  Sets the timestamp of the states being decoded, published by Swap
 ///
 /// \author David Lvy
 /// \date   March 2021
 ///
 /// \param  aTimestamp  The timestamp.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void LeddarConnection::LdResultStates::SetTimestamp( uint32_t aTimestamp )
+void LeddarConnection::LdResultStates::SetTimestamp( uint32_t aTimestamp ) { SetRecordField( &LdStatesRecord::mTimestamp, aTimestamp, LdStatesRecord::SF_TIMESTAMP ); }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarCore::LdPropertiesContainer *LeddarConnection::LdResultStates::GetProperties( void )
+///
+/// \brief  Gets the properties, with the last published states record up to date
+///
+/// \returns    The properties.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarCore::LdPropertiesContainer *LeddarConnection::LdResultStates::GetProperties( void )
+{
+    MirrorRecord();
+    return &mProperties;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdResultStates::SetTemperatureScale( uint32_t aTemperatureScale )
+///
+/// \brief  Sets the scale of the system and predicted temperatures
+///
+/// \param  aTemperatureScale   The temperature scale.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdResultStates::SetTemperatureScale( uint32_t aTemperatureScale )
+{
+    const uint32_t lIds[] = { LeddarCore::LdPropertyIds::ID_RS_SYSTEM_TEMP, LeddarCore::LdPropertyIds::ID_RS_PREDICT_TEMP };
+
+    for( uint32_t lId : lIds )
+    {
+        LeddarCore::LdFloatProperty *lTemperature = dynamic_cast<LeddarCore::LdFloatProperty *>( mProperties.FindProperty( lId ) );
+
+        if( lTemperature != nullptr )
+        {
+            lTemperature->SetScale( aTemperatureScale );
+        }
+    }
+
+    std::lock_guard<std::mutex> lock( mRecordMutex );
+    mRecords[B_SET].mTemperatureScale = aTemperatureScale;
+    mRecords[B_GET].mTemperatureScale = aTemperatureScale;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdResultStates::Swap( void )
+///
+/// \brief  Publish the states record written since the last swap. The fields not written keep their last value.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdResultStates::Swap( void )
 {
-    mProperties.GetIntegerProperty( LeddarCore::LdPropertyIds::ID_RS_TIMESTAMP )->ForceValue( 0, aTimestamp );
+    std::lock_guard<std::mutex> lock( mRecordMutex );
+    mRecords[B_GET] = mRecords[B_SET];
+    mRecordDirty    = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdStatesRecord LeddarConnection::LdResultStates::GetRecord( void ) const
+///
+/// \brief  Gets a copy of the last published states record
+///
+/// \returns    The record.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdStatesRecord LeddarConnection::LdResultStates::GetRecord( void ) const
+{
+    std::lock_guard<std::mutex> lock( mRecordMutex );
+    return mRecords[B_GET];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdResultStates::MirrorRecord( void ) const
+///
+/// \brief  Copy the last published states record to the properties, if it changed since the last call.
+///         Properties not declared by the sensor are skipped.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdResultStates::MirrorRecord( void ) const
+{
+    LdStatesRecord lRecord;
+
+    {
+        std::lock_guard<std::mutex> lock( mRecordMutex );
+
+        if( !mRecordDirty )
+        {
+            return;
+        }
+
+        lRecord      = mRecords[B_GET];
+        mRecordDirty = false;
+    }
+
+    // The mirror is a cache of the typed record, so it is updated from const accessors.
+    // The properties are written without the record lock, their signals may read the states.
+    LeddarCore::LdPropertiesContainer *lProperties = const_cast<LeddarCore::LdPropertiesContainer *>( &mProperties );
+    LeddarCore::LdProperty *lProperty              = nullptr;
+
+    if( ( lRecord.mFields & LdStatesRecord::SF_TIMESTAMP ) && ( lProperty = lProperties->FindProperty( LeddarCore::LdPropertyIds::ID_RS_TIMESTAMP ) ) != nullptr )
+    {
+        dynamic_cast<LeddarCore::LdIntegerProperty *>( lProperty )->ForceValue( 0, lRecord.mTimestamp );
+    }
+
+    if( ( lRecord.mFields & LdStatesRecord::SF_SYSTEM_TEMP ) && ( lProperty = lProperties->FindProperty( LeddarCore::LdPropertyIds::ID_RS_SYSTEM_TEMP ) ) != nullptr )
+    {
+        dynamic_cast<LeddarCore::LdFloatProperty *>( lProperty )->ForceRawValue( 0, lRecord.mSystemTemp );
+    }
+
+    if( ( lRecord.mFields & LdStatesRecord::SF_PREDICT_TEMP ) && ( lProperty = lProperties->FindProperty( LeddarCore::LdPropertyIds::ID_RS_PREDICT_TEMP ) ) != nullptr )
+    {
+        dynamic_cast<LeddarCore::LdFloatProperty *>( lProperty )->ForceRawValue( 0, lRecord.mPredictTemp );
+    }
+
+    if( ( lRecord.mFields & LdStatesRecord::SF_CPU_LOAD ) && ( lProperty = lProperties->FindProperty( LeddarCore::LdPropertyIds::ID_RS_CPU_LOAD ) ) != nullptr )
+    {
+        dynamic_cast<LeddarCore::LdFloatProperty *>( lProperty )->ForceRawValue( 0, static_cast<int32_t>( lRecord.mCpuLoad ) );
+    }
+
+    if( ( lRecord.mFields & LdStatesRecord::SF_BACKUP ) && ( lProperty = lProperties->FindProperty( LeddarCore::LdPropertyIds::ID_RS_BACKUP ) ) != nullptr )
+    {
+        dynamic_cast<LeddarCore::LdEnumProperty *>( lProperty )->ForceValue( 0, lRecord.mBackup );
+    }
 }
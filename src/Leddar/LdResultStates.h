@@ -14,12 +14,41 @@
 
 #pragma once
 
+#include "LdDoubleBuffer.h"
 #include "LdResultProvider.h"
 
 #include "LdPropertiesContainer.h"
 
+#include <mutex>
+
 namespace LeddarConnection
 {
+    /// \brief  States decoded with each frame, as sent by the sensor (raw values, scale in the record).
+    ///         Stored as plain fields so the decoding does not go through the properties,
+    ///         they are mirrored to the result properties only when the properties are read.
+    ///         The layout is fixed (no padding), LeddarPy exposes it as a numpy record.
+    struct LdStatesRecord
+    {
+        enum eFields
+        {
+            SF_NONE         = 0,
+            SF_TIMESTAMP    = 1 << 0,
+            SF_SYSTEM_TEMP  = 1 << 1,
+            SF_PREDICT_TEMP = 1 << 2,
+            SF_CPU_LOAD     = 1 << 3,
+            SF_BACKUP       = 1 << 4
+        };
+
+        uint32_t mFields           = SF_NONE; ///< Fields provided by the sensor (eFields)
+        uint32_t mTimestamp        = 0;       ///< Timestamp in ms
+        int32_t  mSystemTemp       = 0;       ///< Raw system temperature (divide by mTemperatureScale)
+        int32_t  mPredictTemp      = 0;       ///< Raw predicted temperature (divide by mTemperatureScale)
+        uint32_t mCpuLoad          = 0;       ///< Raw cpu load (divide by mCpuLoadScale)
+        uint32_t mBackup           = 0;       ///< Calibration backup flag
+        uint32_t mTemperatureScale = 1;
+        uint32_t mCpuLoadScale     = 1;
+    };
+
     class LdResultStates : public LdResultProvider
     {
     public:
@@ -33,10 +62,29 @@ namespace LeddarConnection
         uint32_t GetTimestamp( void ) const;
         virtual void SetTimestamp( uint32_t aTimestamp );
 
-        LeddarCore::LdPropertiesContainer *GetProperties( void ) { return &mProperties; }
+        LeddarCore::LdPropertiesContainer *GetProperties( void );
+        void SetTemperatureScale( uint32_t aTemperatureScale );
+
+        // Typed states, written in the B_SET record by the data thread and published by Swap
+        void SetSystemTemperatureRaw( int32_t aRawValue ) { SetRecordField( &LdStatesRecord::mSystemTemp, aRawValue, LdStatesRecord::SF_SYSTEM_TEMP ); }
+        void SetPredictedTemperatureRaw( int32_t aRawValue ) { SetRecordField( &LdStatesRecord::mPredictTemp, aRawValue, LdStatesRecord::SF_PREDICT_TEMP ); }
+        void SetCpuLoadRaw( uint32_t aRawValue ) { SetRecordField( &LdStatesRecord::mCpuLoad, aRawValue, LdStatesRecord::SF_CPU_LOAD ); }
+        void SetBackupFlag( uint32_t aBackup ) { SetRecordField( &LdStatesRecord::mBackup, aBackup, LdStatesRecord::SF_BACKUP ); }
+        void Swap( void );
+        LdStatesRecord GetRecord( void ) const;
 
     private:
+        template <typename T> void SetRecordField( T LdStatesRecord::*aField, T aValue, uint32_t aFlag )
+        {
+            mRecords[B_SET].*aField = aValue;
+            mRecords[B_SET].mFields |= aFlag;
+        }
+        void MirrorRecord( void ) const;
+
         bool     mIsInitialized;
         LeddarCore::LdPropertiesContainer mProperties;
+        LdStatesRecord mRecords[2];          ///< Indexed by eBuffer, B_GET is protected by mRecordMutex
+        mutable bool mRecordDirty;           ///< mRecords[B_GET] not yet mirrored to the properties
+        mutable std::mutex mRecordMutex;
     };
 }
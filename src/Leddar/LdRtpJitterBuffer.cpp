@@ -0,0 +1,425 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdRtpJitterBuffer.cpp
+///
+/// \brief  Implements the LdRtpJitterBuffer class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdRtpJitterBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    const int32_t MAX_PACKETS_PER_FRAME = 8192;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdRtpJitterBuffer::LdRtpJitterBuffer( ResizeFunction aResize, uint16_t aReorderWindow )
+///
+/// \brief  Constructor
+///
+/// \param  aResize         Called when the frame buffer is too small.
+/// \param  aReorderWindow  Number of packets of the next frame kept while waiting for the current frame.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdRtpJitterBuffer::LdRtpJitterBuffer( ResizeFunction aResize, uint16_t aReorderWindow )
+    : mResize( aResize )
+    , mBuffer( nullptr )
+    , mBufferSize( 0 )
+    , mReorderWindow( aReorderWindow == 0 ? 1 : aReorderWindow )
+{
+    mSlotBytes.reserve( 1024 );
+    Reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdRtpJitterBuffer::SetFrameBuffer( uint8_t *aBuffer, uint32_t aSize )
+///
+/// \brief  Set the buffer the frames are assembled in. Its content must be kept if it is reallocated during a frame.
+///
+/// \param [in,out] aBuffer The buffer.
+/// \param          aSize   Size of the buffer.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdRtpJitterBuffer::SetFrameBuffer( uint8_t *aBuffer, uint32_t aSize )
+{
+    mBuffer     = aBuffer;
+    mBufferSize = aSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdRtpJitterBuffer::Reset( void )
+///
+/// \brief  Forget the current frame, wait for a marked packet to synchronize again
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdRtpJitterBuffer::Reset( void )
+{
+    StartFrame( 0 );
+    mSynchronized = false;
+    mSlotSize     = 0;
+    mFrameSize    = 0;
+    mParked.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint8_t *LeddarConnection::LdRtpJitterBuffer::GetReceiveSlot( uint32_t &aSize )
+///
+/// \brief  Where the payload of the next packet should be received: the slot of the most probable next packet.
+///
+/// \param [out] aSize   Size of the slot.
+///
+/// \returns    Null if the payload cannot be received in place (not synchronized, next frame expected).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint8_t *LeddarConnection::LdRtpJitterBuffer::GetReceiveSlot( uint32_t &aSize )
+{
+    if( !mSynchronized || mSlotSize == 0 )
+    {
+        return nullptr;
+    }
+
+    int32_t lIndex = mHighestIndex + 1;
+
+    if( mMarkerIndex >= 0 )
+    {
+        // Only missing packets are expected for this frame, bet on the oldest one
+        lIndex = static_cast<int32_t>( std::find( mSlotBytes.begin(), mSlotBytes.end(), 0u ) - mSlotBytes.begin() );
+
+        if( lIndex > mMarkerIndex )
+        {
+            return nullptr;
+        }
+    }
+
+    if( lIndex >= MAX_PACKETS_PER_FRAME )
+    {
+        return nullptr;
+    }
+
+    EnsureCapacity( static_cast<uint32_t>( lIndex + 1 ) * mSlotSize );
+    aSize = mSlotSize;
+    return mBuffer + static_cast<uint32_t>( lIndex ) * mSlotSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarConnection::LdRtpJitterBuffer::AddPacket( uint16_t aSequence, uint32_t aTimestamp, bool aMarker, const uint8_t *aPayload, uint32_t aPayloadSize )
+///
+/// \brief  Add a received packet. The payload is moved to its place if it was not received there.
+///
+/// \param  aSequence       RTP sequence number.
+/// \param  aTimestamp      RTP timestamp.
+/// \param  aMarker         RTP marker (last packet of the frame).
+/// \param  aPayload        The payload.
+/// \param  aPayloadSize    Size of the payload.
+///
+/// \returns    True if a frame is complete at the start of the frame buffer (see GetFrameSize).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarConnection::LdRtpJitterBuffer::AddPacket( uint16_t aSequence, uint32_t aTimestamp, bool aMarker, const uint8_t *aPayload, uint32_t aPayloadSize )
+{
+    if( aPayloadSize == 0 )
+    {
+        return false;
+    }
+
+    if( !mSynchronized )
+    {
+        // The packet following a marked packet starts a frame
+        if( aMarker )
+        {
+            StartFrame( static_cast<uint16_t>( aSequence + 1 ) );
+        }
+
+        return false;
+    }
+
+    int32_t lIndex = static_cast<int16_t>( static_cast<uint16_t>( aSequence - mFirstSequence ) );
+
+    if( lIndex < 0 )
+    {
+        ++mStats.mPacketsLate;
+        return false;
+    }
+
+    if( ( mTimestampKnown && aTimestamp != mTimestamp ) || ( mMarkerIndex >= 0 && lIndex > mMarkerIndex ) )
+    {
+        if( mParked.size() < mReorderWindow )
+        {
+            Park( aSequence, aTimestamp, aMarker, aPayload, aPayloadSize );
+            return false;
+        }
+
+        // The current frame will not complete
+        Park( aSequence, aTimestamp, aMarker, aPayload, aPayloadSize );
+        DropFrame();
+        return ReplayParked();
+    }
+
+    return Place( lIndex, aTimestamp, aMarker, aPayload, aPayloadSize );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarConnection::LdRtpJitterBuffer::ReplayParked( void )
+///
+/// \brief  Process the parked packets against the current frame. Call it before receiving when a frame was just completed.
+///
+/// \returns    True if a frame is complete.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarConnection::LdRtpJitterBuffer::ReplayParked( void )
+{
+    std::deque<sParkedPacket> lParked;
+    lParked.swap( mParked );
+    bool lComplete = false;
+
+    while( !lParked.empty() && !lComplete )
+    {
+        sParkedPacket &lPacket = lParked.front();
+        lComplete              = AddPacket( lPacket.mSequence, lPacket.mTimestamp, lPacket.mMarker, lPacket.mPayload.data(), static_cast<uint32_t>( lPacket.mPayload.size() ) );
+        lParked.pop_front();
+    }
+
+    // Not yet processed packets were parked before the ones parked again
+    lParked.insert( lParked.end(), std::make_move_iterator( mParked.begin() ), std::make_move_iterator( mParked.end() ) );
+    mParked.swap( lParked );
+    return lComplete;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarConnection::LdRtpJitterBuffer::Place( int32_t aIndex, uint32_t aTimestamp, bool aMarker, const uint8_t *aPayload, uint32_t aPayloadSize )
+///
+/// \brief  Store a packet of the current frame
+///
+/// \returns    True if the frame is complete.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarConnection::LdRtpJitterBuffer::Place( int32_t aIndex, uint32_t aTimestamp, bool aMarker, const uint8_t *aPayload, uint32_t aPayloadSize )
+{
+    if( aIndex >= MAX_PACKETS_PER_FRAME )
+    {
+        DropFrame();
+        return false;
+    }
+
+    if( aIndex < static_cast<int32_t>( mSlotBytes.size() ) && mSlotBytes[aIndex] != 0 )
+    {
+        ++mStats.mPacketsDuplicate;
+        return false;
+    }
+
+    if( aMarker )
+    {
+        mMarkerIndex = aIndex;
+    }
+
+    if( mSlotSize == 0 && !aMarker )
+    {
+        mSlotSize = aPayloadSize;
+    }
+
+    bool lSinglePacket = ( aMarker && aIndex == 0 );
+
+    if( !lSinglePacket && ( mSlotSize == 0 || aPayloadSize > mSlotSize ) )
+    {
+        // Payload does not fit in its slot: learn the size from this packet and give up this frame
+        if( !aMarker )
+        {
+            mSlotSize = aPayloadSize;
+        }
+
+        DropFrame();
+        return false;
+    }
+
+    if( !mTimestampKnown )
+    {
+        mTimestamp      = aTimestamp;
+        mTimestampKnown = true;
+    }
+
+    uint32_t lOffset = static_cast<uint32_t>( aIndex ) * mSlotSize;
+
+    // The payload may have been received in another slot of the frame buffer, that can move when it grows
+    if( aPayload >= mBuffer && aPayload < mBuffer + mBufferSize )
+    {
+        size_t lReceivedOffset = static_cast<size_t>( aPayload - mBuffer );
+        EnsureCapacity( lOffset + std::max( aPayloadSize, mSlotSize ) );
+        aPayload = mBuffer + lReceivedOffset;
+    }
+    else
+    {
+        EnsureCapacity( lOffset + std::max( aPayloadSize, mSlotSize ) );
+    }
+
+    if( mBuffer + lOffset != aPayload )
+    {
+        memmove( mBuffer + lOffset, aPayload, aPayloadSize );
+    }
+
+    if( aIndex < mHighestIndex )
+    {
+        ++mStats.mPacketsReordered;
+    }
+
+    if( aIndex >= static_cast<int32_t>( mSlotBytes.size() ) )
+    {
+        mSlotBytes.resize( aIndex + 1, 0 );
+    }
+
+    mSlotBytes[aIndex] = aPayloadSize;
+    mIrregular |= ( !aMarker && aPayloadSize != mSlotSize );
+    mHighestIndex = std::max( mHighestIndex, aIndex );
+    ++mReceivedCount;
+
+    if( mMarkerIndex >= 0 && mReceivedCount == static_cast<uint32_t>( mMarkerIndex + 1 ) )
+    {
+        return CompleteFrame();
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdRtpJitterBuffer::Park( uint16_t aSequence, uint32_t aTimestamp, bool aMarker, const uint8_t *aPayload, uint32_t aPayloadSize )
+///
+/// \brief  Keep a packet of a following frame
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdRtpJitterBuffer::Park( uint16_t aSequence, uint32_t aTimestamp, bool aMarker, const uint8_t *aPayload, uint32_t aPayloadSize )
+{
+    mParked.push_back( sParkedPacket() );
+    sParkedPacket &lPacket = mParked.back();
+    lPacket.mSequence      = aSequence;
+    lPacket.mTimestamp     = aTimestamp;
+    lPacket.mMarker        = aMarker;
+    lPacket.mPayload.assign( aPayload, aPayload + aPayloadSize );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdRtpJitterBuffer::StartFrame( uint16_t aFirstSequence )
+///
+/// \brief  Start a new frame at a known sequence number
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdRtpJitterBuffer::StartFrame( uint16_t aFirstSequence )
+{
+    mSynchronized   = true;
+    mFirstSequence  = aFirstSequence;
+    mTimestampKnown = false;
+    mTimestamp      = 0;
+    mReceivedCount  = 0;
+    mHighestIndex   = -1;
+    mMarkerIndex    = -1;
+    mIrregular      = false;
+    mSlotBytes.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdRtpJitterBuffer::DropFrame( void )
+///
+/// \brief  Give up the current frame. If its last packet is known, the next frame start is known too, else wait for a marked packet.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdRtpJitterBuffer::DropFrame( void )
+{
+    int32_t lExpected = ( mMarkerIndex >= 0 ? mMarkerIndex : mHighestIndex ) + 1;
+
+    ++mStats.mFramesDropped;
+
+    if( lExpected > static_cast<int32_t>( mReceivedCount ) )
+    {
+        mStats.mPacketsLost += static_cast<uint32_t>( lExpected ) - mReceivedCount;
+    }
+
+    if( mMarkerIndex >= 0 )
+    {
+        StartFrame( static_cast<uint16_t>( mFirstSequence + mMarkerIndex + 1 ) );
+        return;
+    }
+
+    // The marker was lost. If exactly one sequence number is missing before the first packet of the next frame,
+    // it was the marker and the next frame can start there. Otherwise resynchronize on the next marked packet.
+    if( mTimestampKnown )
+    {
+        for( std::deque<sParkedPacket>::const_iterator lIter = mParked.begin(); lIter != mParked.end(); ++lIter )
+        {
+            int32_t lIndex = static_cast<int16_t>( static_cast<uint16_t>( lIter->mSequence - mFirstSequence ) );
+
+            if( lIter->mTimestamp != mTimestamp && lIndex == mHighestIndex + 2 )
+            {
+                ++mStats.mPacketsLost;
+                StartFrame( lIter->mSequence );
+                return;
+            }
+        }
+    }
+
+    mSynchronized = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarConnection::LdRtpJitterBuffer::CompleteFrame( void )
+///
+/// \brief  Finalize the current frame (compact it if some payloads were short) and start the next one
+///
+/// \returns    True.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarConnection::LdRtpJitterBuffer::CompleteFrame( void )
+{
+    uint32_t lSize = 0;
+
+    if( mIrregular )
+    {
+        for( int32_t i = 0; i <= mMarkerIndex; ++i )
+        {
+            uint32_t lOffset = static_cast<uint32_t>( i ) * mSlotSize;
+
+            if( lOffset != lSize )
+            {
+                memmove( mBuffer + lSize, mBuffer + lOffset, mSlotBytes[i] );
+            }
+
+            lSize += mSlotBytes[i];
+        }
+    }
+    else
+    {
+        lSize = static_cast<uint32_t>( mMarkerIndex ) * mSlotSize + mSlotBytes[mMarkerIndex];
+    }
+
+    ++mStats.mFramesCompleted;
+    StartFrame( static_cast<uint16_t>( mFirstSequence + mMarkerIndex + 1 ) );
+    mFrameSize = lSize;
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdRtpJitterBuffer::EnsureCapacity( uint32_t aSize )
+///
+/// \brief  Grow the frame buffer (at least doubling it) if needed
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdRtpJitterBuffer::EnsureCapacity( uint32_t aSize )
+{
+    if( aSize > mBufferSize )
+    {
+        mResize( std::max( aSize, mBufferSize * 2 ) );
+    }
+}
@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdRtpJitterBuffer.h
+///
+/// \brief  Declares the LdRtpJitterBuffer class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <stdint.h>
+#include <vector>
+
+namespace LeddarConnection
+{
+    /// \brief  Counters of the RTP frame reassembly
+    struct LdRtpJitterStats
+    {
+        uint64_t mFramesCompleted  = 0;
+        uint64_t mFramesDropped    = 0; ///< Frames given up because of missing or inconsistent packets
+        uint64_t mPacketsLost      = 0; ///< Missing packets of the dropped frames
+        uint64_t mPacketsReordered = 0; ///< Packets received after a packet with a higher sequence number of the same frame
+        uint64_t mPacketsDuplicate = 0;
+        uint64_t mPacketsLate      = 0; ///< Packets of a frame already completed or dropped
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdRtpJitterBuffer
+    ///
+    /// \brief  Assembles RTP frames (packets sharing a timestamp, the last one marked) keyed by sequence number.
+    ///         Payloads are placed at (sequence - first sequence) * slot size in the frame buffer, the slot size being the payload
+    ///         size of the non final packets. The owner receives payloads directly in GetReceiveSlot(), so in-order frames are
+    ///         assembled without copy. Packets of the next frame that arrive before the current frame is complete are parked
+    ///         (copied), up to the reorder window, then the current frame is dropped.
+    ///
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdRtpJitterBuffer
+    {
+      public:
+        typedef std::function<void( uint32_t aSize )> ResizeFunction; ///< Must grow the frame buffer (keeping its content) and call SetFrameBuffer
+
+        explicit LdRtpJitterBuffer( ResizeFunction aResize, uint16_t aReorderWindow = 32 );
+
+        void SetFrameBuffer( uint8_t *aBuffer, uint32_t aSize );
+        void SetReorderWindow( uint16_t aWindow ) { mReorderWindow = ( aWindow == 0 ? 1 : aWindow ); }
+        uint16_t GetReorderWindow( void ) const { return mReorderWindow; }
+        void Reset( void );
+
+        uint8_t *GetReceiveSlot( uint32_t &aSize );
+        bool AddPacket( uint16_t aSequence, uint32_t aTimestamp, bool aMarker, const uint8_t *aPayload, uint32_t aPayloadSize );
+        bool ReplayParked( void );
+        uint32_t GetFrameSize( void ) const { return mFrameSize; }
+
+        const LdRtpJitterStats &GetStats( void ) const { return mStats; }
+        void ResetStats( void ) { mStats = LdRtpJitterStats(); }
+
+      private:
+        struct sParkedPacket
+        {
+            uint16_t mSequence;
+            uint32_t mTimestamp;
+            bool mMarker;
+            std::vector<uint8_t> mPayload;
+        };
+
+        bool Place( int32_t aIndex, uint32_t aTimestamp, bool aMarker, const uint8_t *aPayload, uint32_t aPayloadSize );
+        void Park( uint16_t aSequence, uint32_t aTimestamp, bool aMarker, const uint8_t *aPayload, uint32_t aPayloadSize );
+        void StartFrame( uint16_t aFirstSequence );
+        void DropFrame( void );
+        bool CompleteFrame( void );
+        void EnsureCapacity( uint32_t aSize );
+
+        ResizeFunction mResize;
+        uint8_t *mBuffer;
+        uint32_t mBufferSize;
+        uint16_t mReorderWindow;
+
+        bool mSynchronized; ///< The sequence number of the first packet of the current frame is known
+        uint16_t mFirstSequence;
+        bool mTimestampKnown;
+        uint32_t mTimestamp;
+        uint32_t mSlotSize;
+        std::vector<uint32_t> mSlotBytes; ///< Payload size of each received packet of the current frame, 0 if missing
+        uint32_t mReceivedCount;
+        int32_t mHighestIndex;
+        int32_t mMarkerIndex;
+        bool mIrregular; ///< A non final payload is shorter than the slot, the frame must be compacted
+        uint32_t mFrameSize;
+
+        std::deque<sParkedPacket> mParked;
+        LdRtpJitterStats mStats;
+    };
+} // namespace LeddarConnection
@@ -44,8 +44,10 @@ LdSensor::LdSensor( LeddarConnection::LdConnection *aConnection, LeddarCore::LdP
     LdDevice( aConnection, aProperties ),
     mEchoes(),
     mStates(),
-    mDataMask( 0 )
+    mDataMask( 0 ),
+    mFirmwareUpdateWindow( 1 )
 {
+    mEchoes.SetPipelineStats( &mPipelineStats );
     InitProperties();
 }
 
@@ -92,6 +94,31 @@ void LeddarDevice::LdSensor::StopAcquisition(void)
     throw std::runtime_error("Stop acquisition is not supported");
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarDevice::LdSensor::PrepareAcquisition( uint32_t aTransferBufferSize )
+///
+/// \brief  Size and pre-fault the frame buffers up front, so no allocation or page fault happens once acquisition is running.
+///         Call it after Connect() and before StartAcquisition() / the first GetData().
+///
+/// \param  aTransferBufferSize Minimum size of the connection transfer buffers (largest expected answer), 0 to keep the current size.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarDevice::LdSensor::PrepareAcquisition( uint32_t aTransferBufferSize )
+{
+    LeddarConnection::LdConnection *lConnection = GetConnection();
+
+    if( lConnection != nullptr && aTransferBufferSize > lConnection->GetInternalBuffersSize() )
+    {
+        lConnection->ResizeInternalBuffers( aTransferBufferSize );
+    }
+
+    if( mEchoes.IsInitialized() )
+    {
+        mEchoes.PrefaultBuffers();
+    }
+}
+
 // *****************************************************************************
 // Function: LdSensor::GetData
 //
@@ -116,6 +143,8 @@ LdSensor::GetData( void )
 
     if( ( mDataMask & DM_ECHOES ) == DM_ECHOES )
     {
+        // Request / answer sensors read and decode the echoes in one call, timed as a whole in the receive stage
+        LT_PIPELINE_SCOPE( &mPipelineStats, STAGE_RECEIVE );
         lDataReceived = GetEchoes();
     }
 
@@ -143,8 +172,10 @@ void LeddarDevice::LdSensor::ComputeCartesianCoordinates()
 {
     // This is a generic conversion
     // A better one can be provided by overridding this function in the corresponding sensor class
+    LT_PIPELINE_SCOPE( &mPipelineStats, STAGE_CARTESIAN );
 
     auto lLock            = GetResultEchoes()->GetUniqueLock( LeddarConnection::B_SET );
+    GetResultEchoes()->FilterEchoes(); // Convert only the kept echoes
     double lHFoV          = GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_HFOV )->Value();
     double lVFoV          = GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_VFOV )->Value();
     int32_t lHChanNumber  = GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_HSEGMENT )->Value();
@@ -259,14 +290,37 @@ void LeddarDevice::LdSensor::UpdateFirmware( const std::string &aFileName, Ledda
         throw std::logic_error( "Provided file is not for this device" );
     }
 
-    const std::list< std::pair <uint32_t, std::vector<uint8_t> > > lFirmwares = lLtbReader.GetFirmwares();
+    // The firmwares are read from the file one at a time
+    const std::vector<LeddarUtils::LtFileUtils::LtLtbReader::sSection> &lFirmwares = lLtbReader.GetSections();
 
-    for( std::list<std::pair <uint32_t, std::vector<uint8_t> > >::const_iterator it = lFirmwares.begin(); it != lFirmwares.end(); ++it )
+    for( std::vector<LeddarUtils::LtFileUtils::LtLtbReader::sSection>::const_iterator it = lFirmwares.begin(); it != lFirmwares.end(); ++it )
     {
-        UpdateFirmware( LtbTypeToFirmwareType( it->first ), LdFirmwareData(it->second), aProcessPercentage, aCancel );
+        UpdateFirmware( LtbTypeToFirmwareType( it->mId ), LdFirmwareData( std::vector<uint8_t>( it->mData, it->mData + it->mSize ) ), aProcessPercentage, aCancel );
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarDevice::LdSensor::SetFirmwareUpdateWindow( uint8_t aWindow )
+///
+/// \brief  Set the number of firmware blocks sent before waiting for the answer of the first one.
+///         Only used by the sensors using the LeddarTech protocol update session. Default is 1.
+///
+/// \exception  std::invalid_argument   If the window is 0.
+///
+/// \param  aWindow Number of blocks.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarDevice::LdSensor::SetFirmwareUpdateWindow( uint8_t aWindow )
+{
+    if( aWindow == 0 )
+    {
+        throw std::invalid_argument( "Firmware update window must be at least 1." );
+    }
+
+    mFirmwareUpdateWindow = aWindow;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn uint32_t LeddarDevice::LdSensor::ConvertDataMaskToLTDataMask( uint32_t aMask )
 ///
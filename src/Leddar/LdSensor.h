@@ -17,6 +17,7 @@
 #include "LdConnection.h"
 #include "LdDefines.h"
 #include "LdDevice.h"
+#include "LdFirmwareUploader.h"
 #include "LdResultEchoes.h"
 #include "LdResultStates.h"
 
@@ -44,6 +45,13 @@ namespace LeddarDevice
             : mFirmwareData( aFPGAData )
             , mAlgoData( aAlgoData ){};
 
+        // Take the vectors read from a file (LtLtbReader::GetFirmware) without copy
+        explicit LdFirmwareData( std::vector<uint8_t> &&aFirmwareData ) : mFirmwareData( std::move( aFirmwareData ) ) {};
+
+        explicit LdFirmwareData( std::vector<uint8_t> &&aFPGAData, std::vector<uint8_t> &&aAlgoData )
+            : mFirmwareData( std::move( aFPGAData ) )
+            , mAlgoData( std::move( aAlgoData ) ){};
+
         std::vector<uint8_t> mFirmwareData;
         std::vector<uint8_t> mAlgoData;
     };
@@ -94,6 +102,7 @@ namespace LeddarDevice
         ~LdSensor() override;
         virtual void                        StartAcquisition(void);
         virtual void                        StopAcquisition(void);
+        virtual void                        PrepareAcquisition( uint32_t aTransferBufferSize = 0 );
         virtual void GetConfig( void ) {}
         virtual void SetConfig( void ) = 0;
         virtual void WriteConfig( void ) {}
@@ -107,6 +116,8 @@ namespace LeddarDevice
         virtual void Reset( LeddarDefines::eResetType aType, LeddarDefines::eResetOptions aOptions = LeddarDefines::RO_NO_OPTION, uint32_t aSubOptions = 0 ) = 0;
         LeddarConnection::LdResultEchoes *GetResultEchoes( void ) { return &mEchoes; }
         LeddarConnection::LdResultStates *GetResultStates( void ) { return &mStates; }
+        const LeddarCore::LdPipelineStats &GetPipelineStats( void ) const { return mPipelineStats; }
+        void ResetPipelineStats( void ) { mPipelineStats.Reset(); }
 
         virtual void SetDataMask( uint32_t aDataMask ) { mDataMask = aDataMask; }
 
@@ -124,16 +135,22 @@ namespace LeddarDevice
         {
             throw std::logic_error( "Firmware update not implemented for this sensor" );
         }
+        void SetFirmwareUpdateWindow( uint8_t aWindow );
+        uint8_t GetFirmwareUpdateWindow( void ) const { return mFirmwareUpdateWindow; }
+        void SetFirmwareUpdateStageCallback( const LdFirmwareUploader::StageCallback &aCallback ) { mFirmwareUpdateCallback = aCallback; }
 
       protected:
         explicit LdSensor( LeddarConnection::LdConnection *aConnection, LeddarCore::LdPropertiesContainer *aProperties = nullptr );
         virtual void ComputeCartesianCoordinates();
+        LeddarCore::LdPipelineStats mPipelineStats;
         LeddarConnection::LdResultEchoes mEchoes;
         LeddarConnection::LdResultStates mStates;
 
         static uint32_t GetDataMaskAll( void ) { return DM_ALL; }
         virtual uint32_t ConvertDataMaskToLTDataMask( uint32_t aMask );
         uint32_t mDataMask;
+        uint8_t mFirmwareUpdateWindow;                          ///< Number of firmware blocks sent before waiting for an answer
+        LdFirmwareUploader::StageCallback mFirmwareUpdateCallback;
 
       private:
         void InitProperties( void );
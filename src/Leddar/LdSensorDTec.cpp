@@ -662,6 +662,7 @@ bool LeddarDevice::LdSensorDTec::GetData( void )
 {
     try
     {
+        LT_PIPELINE_SCOPE( &mPipelineStats, STAGE_RECEIVE );
         mProtocolData->ReadRequest();
     }
     catch( LeddarException::LtTimeoutException & )
@@ -669,6 +670,7 @@ bool LeddarDevice::LdSensorDTec::GetData( void )
         return false;
     }
 
+    LT_PIPELINE_COUNT( &mPipelineStats, COUNTER_BYTES_RECEIVED, mProtocolData->GetMessageSize() );
     uint16_t lRequestCode = mProtocolData->GetRequestCode();
 
     return ProcessData( lRequestCode );
@@ -710,6 +712,7 @@ bool LeddarDevice::LdSensorDTec::ProcessData( uint16_t aRequestCode )
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 bool LeddarDevice::LdSensorDTec::ProcessEchoes( void )
 {
+    LT_PIPELINE_TIMER( lDecodeTimer, &mPipelineStats, STAGE_DECODE );
     auto lLock = mEchoes.GetUniqueLock(LeddarConnection::B_SET);
     std::vector<LeddarConnection::LdEcho> &lEchoes = *mEchoes.GetEchoes( LeddarConnection::B_SET );
     uint32_t lTimestamp                            = 0;
@@ -757,6 +760,7 @@ bool LeddarDevice::LdSensorDTec::ProcessEchoes( void )
     }
 
     lLock.unlock();
+    LT_PIPELINE_STOP( lDecodeTimer );
     ComputeCartesianCoordinates();
     mEchoes.Swap();
     mEchoes.UpdateFinished();
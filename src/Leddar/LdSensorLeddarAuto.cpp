@@ -58,6 +58,7 @@ LeddarDevice::LdSensorLeddarAuto::LdSensorLeddarAuto( LeddarConnection::LdConnec
     , mProtocolData( nullptr )
     , mPingEnabled( true )
     , mAllDataReceived( false )
+    , mFrameAssembler( [this]( LeddarConnection::LdEchoFrameAssembler::LdFrame &aFrame, uint32_t &aStaleCount ) { EmitAssembledFrame( aFrame, aStaleCount ); } )
 {
     LdSensorLeddarAuto::InitProperties();
     mProtocolConfig = dynamic_cast<LeddarConnection::LdProtocolLeddartechEthernet *>( aConnection );
@@ -98,6 +99,7 @@ void LeddarDevice::LdSensorLeddarAuto::Connect( void )
 {
     LdDevice::Connect();
     ConnectDataServer();
+    mFrameAssembler.Reset();
 }
 
 // *****************************************************************************
@@ -366,6 +368,7 @@ bool LeddarDevice::LdSensorLeddarAuto::GetData( void )
                 // Read available data on the data channel
                 try
                 {
+                    LT_PIPELINE_SCOPE( &mPipelineStats, STAGE_RECEIVE );
                     mProtocolData->ReadAnswer();
                 }
                 catch( LeddarException::LtComException &e )
@@ -380,6 +383,7 @@ bool LeddarDevice::LdSensorLeddarAuto::GetData( void )
                     }
                 }
 
+                LT_PIPELINE_COUNT( &mPipelineStats, COUNTER_BYTES_RECEIVED, mProtocolData->GetMessageSize() );
                 uint16_t lRequestCode = mProtocolData->GetRequestCode();
 
                 lReceivedData |= ProcessData( lRequestCode );
@@ -395,7 +399,12 @@ bool LeddarDevice::LdSensorLeddarAuto::GetData( void )
     else
     {
         // Read available data on the data channel
-        mProtocolData->ReadAnswer();
+        {
+            LT_PIPELINE_SCOPE( &mPipelineStats, STAGE_RECEIVE );
+            mProtocolData->ReadAnswer();
+        }
+
+        LT_PIPELINE_COUNT( &mPipelineStats, COUNTER_BYTES_RECEIVED, mProtocolData->GetMessageSize() );
         uint16_t lRequestCode = mProtocolData->GetRequestCode();
 
         lReceivedData |= ProcessData( lRequestCode );
@@ -489,6 +498,11 @@ bool LeddarDevice::LdSensorLeddarAuto::ProcessEchoes( void )
                                                mProtocolData->GetAnswerCode(), false );
     }
 
+    if( !mIsTCPDataServer )
+    {
+        return ProcessEchoesFragment();
+    }
+
     if( mProtocolData->GetMessageSize() == 0 ) // Should not happen, case should be covered by answer code != 0
     {
 
@@ -499,6 +513,7 @@ bool LeddarDevice::LdSensorLeddarAuto::ProcessEchoes( void )
         return false;
     }
 
+    LT_PIPELINE_TIMER( lDecodeTimer, &mPipelineStats, STAGE_DECODE );
     auto lLock                                     = mEchoes.GetUniqueLock( LeddarConnection::B_SET );
     std::vector<LeddarConnection::LdEcho> &lEchoes = *mEchoes.GetEchoes( LeddarConnection::B_SET );
 
@@ -552,7 +567,7 @@ bool LeddarDevice::LdSensorLeddarAuto::ProcessEchoes( void )
             {
                 uint64_t lTimestamp64 = 0;
                 mProtocolData->PushElementDataToBuffer( &lTimestamp64, mProtocolData->GetElementCount(), sizeof( uint64_t ), sizeof( uint64_t ) );
-                mEchoes.SetPropertyValue(LeddarCore::LdPropertyIds::ID_RS_TIMESTAMP64, 0, lTimestamp64);
+                mEchoes.SetTimestamp64( lTimestamp64 );
             }
             break;
 
@@ -560,7 +575,7 @@ bool LeddarDevice::LdSensorLeddarAuto::ProcessEchoes( void )
             {
                 uint64_t lFrameId = 0;
                 mProtocolData->PushElementDataToBuffer( &lFrameId, mProtocolData->GetElementCount(), sizeof( uint64_t ), sizeof( uint64_t ) );
-                mEchoes.SetPropertyValue(LeddarCore::LdPropertyIds::ID_RS_FRAME_ID, 0, lFrameId);
+                mEchoes.SetFrameId( lFrameId );
             }
             break;
 
@@ -582,31 +597,6 @@ bool LeddarDevice::LdSensorLeddarAuto::ProcessEchoes( void )
 
                 break;
 
-            case LtComLeddarTechPublic::LT_COMM_ID_AUTO_ECHOES_AMPLITUDE:
-                mProtocolData->PushElementDataToBuffer( &lEchoes[lStartIndexAndCount[0]].mAmplitude, mProtocolData->GetElementCount(),
-                                                        sizeof( ( (LeddarConnection::LdEcho *)0 )->mAmplitude ), sizeof( lEchoes[0] ) );
-                break;
-
-            case LtComLeddarTechPublic::LT_COMM_ID_AUTO_ECHOES_DISTANCE:
-                mProtocolData->PushElementDataToBuffer( &lEchoes[lStartIndexAndCount[0]].mDistance, mProtocolData->GetElementCount(),
-                                                        sizeof( ( (LeddarConnection::LdEcho *)0 )->mDistance ), sizeof( lEchoes[0] ) );
-                break;
-
-            case LtComLeddarTechPublic::LT_COMM_ID_AUTO_ECHOES_CHANNEL_INDEX:
-                mProtocolData->PushElementDataToBuffer( &lEchoes[lStartIndexAndCount[0]].mChannelIndex, mProtocolData->GetElementCount(),
-                                                        sizeof( ( (LeddarConnection::LdEcho *)0 )->mChannelIndex ), sizeof( lEchoes[0] ) );
-                break;
-
-            case LtComLeddarTechPublic::LT_COMM_ID_AUTO_ECHOES_VALID:
-                mProtocolData->PushElementDataToBuffer( &lEchoes[lStartIndexAndCount[0]].mFlag, mProtocolData->GetElementCount(),
-                                                        sizeof( ( (LeddarConnection::LdEcho *)0 )->mFlag ), sizeof( lEchoes[0] ) );
-                break;
-
-            case LtComLeddarTechPublic::LT_COMM_ID_AUTO_ECHOES_TIMESTAMP_UTC:
-                mProtocolData->PushElementDataToBuffer( &lEchoes[lStartIndexAndCount[0]].mTimestamp, mProtocolData->GetElementCount(),
-                                                        sizeof( ( (LeddarConnection::LdEcho *)0 )->mTimestamp ), sizeof( lEchoes[0] ) );
-                break;
-
             case LtComLeddarTechPublic::LT_COMM_ID_STATUS:
 
                 mProtocolData->PushElementDataToBuffer( &lDataReceivedStatus, mProtocolData->GetElementCount(), sizeof( lDataReceivedStatus ), sizeof( lDataReceivedStatus ) );
@@ -622,17 +612,24 @@ bool LeddarDevice::LdSensorLeddarAuto::ProcessEchoes( void )
             {
                 uint32_t lNoiseMean = 0;
                 mProtocolData->PushElementDataToBuffer( &lNoiseMean, mProtocolData->GetElementCount(), sizeof( uint32_t ), sizeof( uint32_t ) );
-                mEchoes.SetPropertyValue( LeddarCore::LdPropertyIds::ID_RS_NOISE_LEVEL_AVG, 0, lNoiseMean );
+                mEchoes.SetNoiseLevelAvg( lNoiseMean );
             }
             break;
+
+            default:
+                // Echoes out of the buffer, the packet is dropped
+                lFlush = !DecodeEchoElement( lEchoes, lStartIndexAndCount[0] );
+                break;
             }
         }
     }
 
     lLock.unlock();
+    LT_PIPELINE_STOP( lDecodeTimer );
 
     if( lFlush )
     {
+        LT_PIPELINE_COUNT( &mPipelineStats, COUNTER_FRAMES_DROPPED, 1 );
         return false;
     }
 
@@ -646,6 +643,251 @@ bool LeddarDevice::LdSensorLeddarAuto::ProcessEchoes( void )
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarDevice::LdSensorLeddarAuto::ProcessEchoesFragment( void )
+///
+/// \brief  Process one datagram of echoes from the UDP data server.
+///         A frame can be sent in several datagrams that may arrive out of order, they are reassembled
+///         by mFrameAssembler that emits the frames once complete (or timed out).
+///
+/// \returns    False if the datagram was dropped (late or invalid).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarDevice::LdSensorLeddarAuto::ProcessEchoesFragment( void )
+{
+    if( !mFrameAssembler.IsInitialized() )
+    {
+        // cppcheck-suppress unreadVariable
+        auto lLock = mEchoes.GetUniqueLock( LeddarConnection::B_SET );
+        mFrameAssembler.Init( static_cast<uint32_t>( mEchoes.GetEchoes( LeddarConnection::B_SET )->size() ) );
+    }
+
+    if( mProtocolData->GetMessageSize() == 0 ) // Should not happen, case should be covered by answer code != 0
+    {
+        mFrameAssembler.CheckTimeouts();
+        SetDataReceived( true );
+        return false;
+    }
+
+    LT_PIPELINE_TIMER( lDecodeTimer, &mPipelineStats, STAGE_DECODE );
+    LeddarConnection::LdEchoFrameAssembler::LdFrame *lFrame = nullptr;
+    uint8_t lDataReceivedStatus                               = 0;
+    uint32_t lStartIndexAndCount[2]                           = {};
+    bool lFlush                                               = false;
+
+    while( mProtocolData->ReadElement() )
+    {
+        uint16_t lElementId = mProtocolData->GetElementId();
+
+        if( lElementId == LtComLeddarTechPublic::LT_COMM_ID_STATUS )
+        {
+            mProtocolData->PushElementDataToBuffer( &lDataReceivedStatus, mProtocolData->GetElementCount(), sizeof( lDataReceivedStatus ), sizeof( lDataReceivedStatus ) );
+            SetDataReceived( lDataReceivedStatus == 0 ? false : true );
+            continue;
+        }
+
+        if( lFlush || ( lFrame == nullptr && lElementId != LtComLeddarTechPublic::LT_COMM_ID_TIMESTAMP ) )
+        {
+            continue;
+        }
+
+        switch( lElementId )
+        {
+        case LtComLeddarTechPublic::LT_COMM_ID_TIMESTAMP:
+        {
+            uint32_t lTimestamp = 0;
+            mProtocolData->PushElementDataToBuffer( &lTimestamp, mProtocolData->GetElementCount(), sizeof( uint32_t ), sizeof( uint32_t ) );
+            lFrame = mFrameAssembler.GetFrame( lTimestamp );
+            lFlush = ( lFrame == nullptr );
+        }
+        break;
+
+        case LtComLeddarTechPublic::LT_COMM_ID_AUTO_TIMESTAMP64:
+            mProtocolData->PushElementDataToBuffer( &lFrame->mMetadata.mTimestamp64, mProtocolData->GetElementCount(), sizeof( uint64_t ), sizeof( uint64_t ) );
+            lFrame->mMetadata.mFields |= LeddarConnection::LdFrameMetadata::MF_TIMESTAMP64;
+            break;
+
+        case LtComLeddarTechPublic::LT_COMM_ID_FRAME_ID:
+            mProtocolData->PushElementDataToBuffer( &lFrame->mMetadata.mFrameId, mProtocolData->GetElementCount(), sizeof( uint64_t ), sizeof( uint64_t ) );
+            lFrame->mMetadata.mFields |= LeddarConnection::LdFrameMetadata::MF_FRAME_ID;
+            break;
+
+        case LtComLeddarTechPublic::LT_COMM_ID_AUTO_NOISE_LEVEL_MEAN:
+            mProtocolData->PushElementDataToBuffer( &lFrame->mMetadata.mNoiseLevelAvg, mProtocolData->GetElementCount(), sizeof( uint32_t ), sizeof( uint32_t ) );
+            lFrame->mMetadata.mFields |= LeddarConnection::LdFrameMetadata::MF_NOISE_LEVEL_AVG;
+            break;
+
+        case LtComLeddarTechPublic::LT_COMM_ID_AUTO_NOISE_LEVEL:
+        {
+            const uint8_t *lData = reinterpret_cast<const uint8_t *>( mProtocolData->GetElementData() );
+            lFrame->mNoiseLevelCount = mProtocolData->GetElementCount();
+            lFrame->mNoiseLevelSize  = mProtocolData->GetElementSize();
+            lFrame->mNoiseLevel.assign( lData, lData + lFrame->mNoiseLevelCount * lFrame->mNoiseLevelSize );
+        }
+        break;
+
+        case LtComLeddarTechPublic::LT_COMM_ID_AUTO_NUMBER_DATA_SENT:
+            mProtocolData->PushElementDataToBuffer( lStartIndexAndCount, mProtocolData->GetElementCount(), sizeof( uint32_t ), sizeof( uint32_t ) );
+            lFlush = !mFrameAssembler.AddRange( *lFrame, lStartIndexAndCount[0], lStartIndexAndCount[1] );
+            break;
+
+        default:
+            if( !DecodeEchoElement( lFrame->mEchoes, lStartIndexAndCount[0] ) )
+            {
+                // Echoes out of the frame, the frame is emitted as incomplete
+                mFrameAssembler.RejectFragment( *lFrame );
+                lFlush = true;
+            }
+
+            break;
+        }
+    }
+
+    LT_PIPELINE_STOP( lDecodeTimer );
+
+    if( lFlush )
+    {
+        LT_PIPELINE_COUNT( &mPipelineStats, COUNTER_FRAMES_DROPPED, 1 );
+    }
+
+    if( lFrame != nullptr && !lFlush )
+    {
+        // Status is set by the sensor on the last datagram of the frame
+        if( lDataReceivedStatus != 0 )
+        {
+            mFrameAssembler.SetLastFragment( *lFrame, lStartIndexAndCount[0] + lStartIndexAndCount[1] );
+        }
+
+        mFrameAssembler.EndFragment( *lFrame );
+    }
+
+    mFrameAssembler.CheckTimeouts();
+    return !lFlush;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarDevice::LdSensorLeddarAuto::DecodeEchoElement( std::vector<LeddarConnection::LdEcho> &aEchoes, uint32_t aStartIndex )
+///
+/// \brief  Decode the current element if it is one of the echoes arrays. The start index comes from the datagram,
+///         an echoes array that does not fit in aEchoes is not decoded.
+///
+/// \param [in,out] aEchoes     The echoes to fill.
+/// \param          aStartIndex Index of the first echo of the element.
+///
+/// \returns    False if the element is an echoes array out of aEchoes.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarDevice::LdSensorLeddarAuto::DecodeEchoElement( std::vector<LeddarConnection::LdEcho> &aEchoes, uint32_t aStartIndex )
+{
+    switch( mProtocolData->GetElementId() )
+    {
+    case LtComLeddarTechPublic::LT_COMM_ID_AUTO_ECHOES_AMPLITUDE:
+    case LtComLeddarTechPublic::LT_COMM_ID_AUTO_ECHOES_DISTANCE:
+    case LtComLeddarTechPublic::LT_COMM_ID_AUTO_ECHOES_CHANNEL_INDEX:
+    case LtComLeddarTechPublic::LT_COMM_ID_AUTO_ECHOES_VALID:
+    case LtComLeddarTechPublic::LT_COMM_ID_AUTO_ECHOES_TIMESTAMP_UTC:
+        if( aStartIndex > aEchoes.size() || mProtocolData->GetElementCount() > aEchoes.size() - aStartIndex )
+        {
+            return false;
+        }
+
+        break;
+
+    default:
+        return true;
+    }
+
+    switch( mProtocolData->GetElementId() )
+    {
+    case LtComLeddarTechPublic::LT_COMM_ID_AUTO_ECHOES_AMPLITUDE:
+        mProtocolData->PushElementDataToBuffer( &aEchoes[aStartIndex].mAmplitude, mProtocolData->GetElementCount(), sizeof( ( (LeddarConnection::LdEcho *)0 )->mAmplitude ),
+                                                sizeof( aEchoes[0] ) );
+        return true;
+
+    case LtComLeddarTechPublic::LT_COMM_ID_AUTO_ECHOES_DISTANCE:
+        mProtocolData->PushElementDataToBuffer( &aEchoes[aStartIndex].mDistance, mProtocolData->GetElementCount(), sizeof( ( (LeddarConnection::LdEcho *)0 )->mDistance ),
+                                                sizeof( aEchoes[0] ) );
+        return true;
+
+    case LtComLeddarTechPublic::LT_COMM_ID_AUTO_ECHOES_CHANNEL_INDEX:
+        mProtocolData->PushElementDataToBuffer( &aEchoes[aStartIndex].mChannelIndex, mProtocolData->GetElementCount(),
+                                                sizeof( ( (LeddarConnection::LdEcho *)0 )->mChannelIndex ), sizeof( aEchoes[0] ) );
+        return true;
+
+    case LtComLeddarTechPublic::LT_COMM_ID_AUTO_ECHOES_VALID:
+        mProtocolData->PushElementDataToBuffer( &aEchoes[aStartIndex].mFlag, mProtocolData->GetElementCount(), sizeof( ( (LeddarConnection::LdEcho *)0 )->mFlag ),
+                                                sizeof( aEchoes[0] ) );
+        return true;
+
+    case LtComLeddarTechPublic::LT_COMM_ID_AUTO_ECHOES_TIMESTAMP_UTC:
+        mProtocolData->PushElementDataToBuffer( &aEchoes[aStartIndex].mTimestamp, mProtocolData->GetElementCount(), sizeof( ( (LeddarConnection::LdEcho *)0 )->mTimestamp ),
+                                                sizeof( aEchoes[0] ) );
+        return true;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarDevice::LdSensorLeddarAuto::EmitAssembledFrame( LeddarConnection::LdEchoFrameAssembler::LdFrame &aFrame, uint32_t &aStaleCount )
+///
+/// \brief  Publish a reassembled frame in the echoes result.
+///         The frame echoes are swapped with the B_SET buffer (no copy), the frame gets back the B_SET buffer to clear.
+///
+/// \param [in,out] aFrame      The frame.
+/// \param [out]    aStaleCount Number of echoes to clear in the buffer given back to the frame.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarDevice::LdSensorLeddarAuto::EmitAssembledFrame( LeddarConnection::LdEchoFrameAssembler::LdFrame &aFrame, uint32_t &aStaleCount )
+{
+    auto lLock                                     = mEchoes.GetUniqueLock( LeddarConnection::B_SET );
+    std::vector<LeddarConnection::LdEcho> &lEchoes = *mEchoes.GetEchoes( LeddarConnection::B_SET );
+
+    if( lEchoes.size() == aFrame.mEchoes.size() )
+    {
+        // The filters compact the echoes in place, the echoes after the filtered count are stale too
+        aStaleCount = std::max( mEchoes.GetEchoCount( LeddarConnection::B_SET ), mEchoes.GetUsedEchoCount( LeddarConnection::B_SET ) );
+        lEchoes.swap( aFrame.mEchoes );
+    }
+    else
+    {
+        std::copy( aFrame.mEchoes.begin(), aFrame.mEchoes.begin() + std::min( aFrame.GetEchoCount(), static_cast<uint32_t>( lEchoes.size() ) ), lEchoes.begin() );
+    }
+
+    mEchoes.SetEchoCount( aFrame.GetEchoCount() );
+    mEchoes.SetTimestamp( aFrame.mTimestamp );
+    mEchoes.SetIncomplete( !aFrame.IsComplete() );
+
+    if( aFrame.mMetadata.mFields & LeddarConnection::LdFrameMetadata::MF_TIMESTAMP64 )
+    {
+        mEchoes.SetTimestamp64( aFrame.mMetadata.mTimestamp64 );
+    }
+
+    if( aFrame.mMetadata.mFields & LeddarConnection::LdFrameMetadata::MF_FRAME_ID )
+    {
+        mEchoes.SetFrameId( aFrame.mMetadata.mFrameId );
+    }
+
+    if( aFrame.mMetadata.mFields & LeddarConnection::LdFrameMetadata::MF_NOISE_LEVEL_AVG )
+    {
+        mEchoes.SetNoiseLevelAvg( aFrame.mMetadata.mNoiseLevelAvg );
+    }
+
+    if( aFrame.mNoiseLevelCount != 0 )
+    {
+        mEchoes.SetPropertyRawStorage( LeddarCore::LdPropertyIds::ID_RS_NOISE_LEVEL, aFrame.mNoiseLevel.data(), aFrame.mNoiseLevelCount, aFrame.mNoiseLevelSize );
+    }
+
+    lLock.unlock();
+
+    ComputeCartesianCoordinates();
+    mEchoes.Swap();
+    mEchoes.UpdateFinished();
+}
+
 // *****************************************************************************
 // Function: LdSensorLeddarAuto::ProcessStates
 //
@@ -685,6 +927,7 @@ bool LeddarDevice::LdSensorLeddarAuto::ProcessStates( void )
         {
             GetResultStates()->SetTimestamp( lTimeStamp );
             mProtocolData->ReadElementToProperties( GetResultStates()->GetProperties() );
+            mStates.Swap();
             mStates.UpdateFinished();
         }
         else
@@ -1350,41 +1593,11 @@ void LeddarDevice::LdSensorLeddarAuto::UpdateFirmware( eFirmwareType aFirmwareTy
         throw LeddarException::LtException( "Transfert block length invalid(0)." );
     }
 
-    // Send the file block by block
-    uint32_t lCount = 0;
-
-    while( ( lCount < lFileSize ) && ( aCancel == nullptr || !aCancel->Value() ) )
-    {
-        mProtocolConfig->StartRequest( LtComLeddarTechPublic::LT_COMM_CFGSRV_REQUEST_UPDATE );
-        mProtocolConfig->AddElement( LtComLeddarTechPublic::LT_COMM_ID_PROCESSOR, 1, sizeof( lFirmwareType ), &lFirmwareType, sizeof( lFirmwareType ) );
-
-        if( lFileSize - lCount >= lBlockSize )
-        {
-            mProtocolConfig->AddElement( LtComLeddarTechPublic::LT_COMM_ID_RAW_DATA, lBlockSize, 1, &aFirmwareData.mFirmwareData[lCount], 1 );
-        }
-        else
-        {
-            mProtocolConfig->AddElement( LtComLeddarTechPublic::LT_COMM_ID_RAW_DATA, lFileSize - lCount, 1, &aFirmwareData.mFirmwareData[lCount], 1 );
-        }
-
-        mProtocolConfig->SendRequest();
-        mProtocolConfig->ReadAnswer();
-
-        if( mProtocolConfig->GetAnswerCode() != LtComLeddarTechPublic::LT_COMM_ANSWER_OK )
-        {
-            throw LeddarException::LtComException(
-                "Update firmware error, request code: " + LeddarUtils::LtStringUtils::IntToString( LtComLeddarTechPublic::LT_COMM_CFGSRV_REQUEST_UPDATE ) +
-                    " wrong answer code: " + LeddarUtils::LtStringUtils::IntToString( mProtocolConfig->GetAnswerCode() ),
-                LeddarException::ERROR_COM_WRITE );
-        }
-
-        if( aProcessPercentage != nullptr )
-        {
-            aProcessPercentage->SetValue( 0, static_cast<uint8_t>( 100 * static_cast<double>( lCount ) / lFileSize ) );
-        }
-
-        lCount += lBlockSize;
-    }
+    // Send the file block by block, up to mFirmwareUpdateWindow blocks in flight
+    LdLeddarTechUpdateTransport lTransport( mProtocolConfig, lFirmwareType );
+    LdFirmwareUploader lUploader( &aFirmwareData.mFirmwareData[0], lFileSize, lBlockSize, mFirmwareUpdateWindow );
+    lUploader.SetStageCallback( mFirmwareUpdateCallback );
+    lUploader.Upload( lTransport, aProcessPercentage, aCancel );
 
     if( aProcessPercentage != nullptr )
     {
@@ -18,6 +18,7 @@
 #if defined(BUILD_ETHERNET) && defined(BUILD_AUTO)
 
 #include "LdSensor.h"
+#include "LdEchoFrameAssembler.h"
 #include "LdProtocolLeddartechEthernet.h"
 #include "LdProtocolLeddartechEthernetUDP.h"
 
@@ -55,10 +56,19 @@ namespace LeddarDevice
 
         virtual void   SetDataMask( uint32_t aDataMask ) override;
 
+        // UDP data server echoes reassembly
+        const LeddarConnection::LdFrameAssemblyStats &GetFrameAssemblyStats( void ) const { return mFrameAssembler.GetStats(); }
+        void ResetFrameAssemblyStats( void ) { mFrameAssembler.ResetStats(); }
+        void SetFrameAssemblyTimeout( uint32_t aTimeoutMs ) { mFrameAssembler.SetTimeout( aTimeoutMs ); }
+        uint32_t GetFrameAssemblyTimeout( void ) const { return mFrameAssembler.GetTimeout(); }
+
     protected:
         virtual bool    ProcessData( uint16_t aRequestCode );
         virtual bool    RequestData( uint32_t &aMask );
         bool            ProcessEchoes( void );
+        bool            ProcessEchoesFragment( void );
+        bool            DecodeEchoElement( std::vector<LeddarConnection::LdEcho> &aEchoes, uint32_t aStartIndex );
+        void            EmitAssembledFrame( LeddarConnection::LdEchoFrameAssembler::LdFrame &aFrame, uint32_t &aStaleCount );
         bool            ProcessStates( void );
 
         void            GetCategoryPropertiesFromDevice( LeddarCore::LdProperty::eCategories aCategory, uint16_t aRequestCode );
@@ -79,6 +89,7 @@ namespace LeddarDevice
         void   InitProperties( void );
 
         bool   mAllDataReceived;
+        LeddarConnection::LdEchoFrameAssembler mFrameAssembler;
 
     };
 }
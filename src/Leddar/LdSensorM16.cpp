@@ -870,6 +870,7 @@ bool LeddarDevice::LdSensorM16::GetData( void )
     // Read available data on the data channel
     try
     {
+        LT_PIPELINE_SCOPE( &mPipelineStats, STAGE_RECEIVE );
         mProtocolData->ReadRequest();
     }
     catch( LeddarException::LtTimeoutException & )
@@ -877,6 +878,7 @@ bool LeddarDevice::LdSensorM16::GetData( void )
         return false;
     }
 
+    LT_PIPELINE_COUNT( &mPipelineStats, COUNTER_BYTES_RECEIVED, mProtocolData->GetMessageSize() );
     uint16_t lRequestCode = mProtocolData->GetRequestCode();
 
     // Return true only on states because they are received last for a frame, and they hold the timestamp (trace and echo dont know the timestamp by themselves)
@@ -944,6 +946,7 @@ void LeddarDevice::LdSensorM16::ProcessEchoes( void )
         return;
     }
 
+    LT_PIPELINE_SCOPE( &mPipelineStats, STAGE_DECODE );
     std::vector<LeddarConnection::LdEcho> &lEchoes = *mEchoes.GetEchoes( LeddarConnection::B_SET );
     auto lLock = mEchoes.GetUniqueLock(LeddarConnection::B_SET);
 
@@ -1130,27 +1133,26 @@ void LeddarDevice::LdSensorM16::UpdateFirmware( const std::string &aFileName, Le
         throw std::logic_error( "Provided file is not for this device" );
     }
 
-    const std::list<std::pair<uint32_t, std::vector<uint8_t>>> lFirmwares = lLtbReader.GetFirmwares();
+    // Only the firmwares that are sent are read from the file
+    typedef LeddarUtils::LtFileUtils::LtLtbReader LtLtbReader;
+    const bool lDSP      = lLtbReader.HasFirmware( LtLtbReader::ID_LTB_GALAXY_BINARY );
+    const bool lFPGAAlgo = lLtbReader.HasFirmware( LtLtbReader::ID_LTB_FPGA_ALGO );
+    const bool lFPGAData = lLtbReader.HasFirmware( LtLtbReader::ID_LTB_FPGA_DATA );
 
-    auto lDSP = std::find_if( lFirmwares.cbegin(), lFirmwares.cend(),
-                              []( const std::pair<uint32_t, std::vector<uint8_t>> &a ) { return a.first == LeddarUtils::LtFileUtils::LtLtbReader::ID_LTB_GALAXY_BINARY; } );
-    auto lFPGAAlgo = std::find_if( lFirmwares.cbegin(), lFirmwares.cend(),
-                                   []( const std::pair<uint32_t, std::vector<uint8_t>> &a ) { return a.first == LeddarUtils::LtFileUtils::LtLtbReader::ID_LTB_FPGA_ALGO; } );
-    auto lFPGAData = std::find_if( lFirmwares.cbegin(), lFirmwares.cend(),
-                                   []( const std::pair<uint32_t, std::vector<uint8_t>> &a ) { return a.first == LeddarUtils::LtFileUtils::LtLtbReader::ID_LTB_FPGA_DATA; } );
-    if( lDSP != lFirmwares.cend() )
+    if( lDSP )
     {
-        UpdateFirmware( FT_DSP, LdFirmwareData( ( *lDSP ).second ), aProcessPercentage, aCancel );
+        UpdateFirmware( FT_DSP, LdFirmwareData( lLtbReader.GetFirmware( LtLtbReader::ID_LTB_GALAXY_BINARY ) ), aProcessPercentage, aCancel );
     }
-    else if( lFPGAAlgo != lFirmwares.cend() && lFPGAData != lFirmwares.cend() )
+    else if( lFPGAAlgo && lFPGAData )
     {
-        UpdateFirmware( FT_FPGA, LdFirmwareData( ( *lFPGAData ).second, ( *lFPGAAlgo ).second ), aProcessPercentage, aCancel );
+        UpdateFirmware( FT_FPGA, LdFirmwareData( lLtbReader.GetFirmware( LtLtbReader::ID_LTB_FPGA_DATA ), lLtbReader.GetFirmware( LtLtbReader::ID_LTB_FPGA_ALGO ) ),
+                        aProcessPercentage, aCancel );
     }
-    else if( lFPGAAlgo == lFirmwares.cend() && lFPGAData != lFirmwares.cend() )
+    else if( !lFPGAAlgo && lFPGAData )
     {
         throw std::logic_error( "Missing FPGA Algo data" );
     }
-    else if( lFPGAAlgo != lFirmwares.cend() && lFPGAData == lFirmwares.cend() )
+    else if( lFPGAAlgo && !lFPGAData )
     {
         throw std::logic_error( "Missing FPGA data" );
     }
@@ -1211,26 +1213,11 @@ void LeddarDevice::LdSensorM16::UpdateFirmware( eFirmwareType aFirmwareType, con
             }
         }
 
-        // Send the file block by block
-        uint32_t lCount = 0;
-
-        while( ( ( aCancel != nullptr && !aCancel->Value() ) || aCancel == nullptr ) && lCount < lFileSize )
-        {
-            mProtocolConfig->StartRequest( LtComLeddarTechPublic::LT_COMM_CFGSRV_REQUEST_UPDATE );
-            mProtocolConfig->AddElement( LtComLeddarTechPublic::LT_COMM_ID_PROCESSOR, 1, sizeof( lFirmwareType ), &lFirmwareType, sizeof( lFirmwareType ) );
-
-            uint32_t lSizeToSend = lFileSize - lCount < lBlockSize ? lFileSize - lCount : lBlockSize;
-            mProtocolConfig->AddElement( LtComLeddarTechPublic::LT_COMM_ID_RAW_DATA, lSizeToSend, 1, &aFirmwareData.mFirmwareData[lCount], 1 );
-            mProtocolConfig->SendRequest();
-            mProtocolConfig->ReadAnswer();
-
-            if( aProcessPercentage != nullptr )
-            {
-                aProcessPercentage->SetValue( 0, 100 * lCount / lFileSize );
-            }
-
-            lCount += lBlockSize;
-        }
+        // Send the file block by block, up to mFirmwareUpdateWindow blocks in flight (answer codes not checked on this device)
+        LdLeddarTechUpdateTransport lTransport( mProtocolConfig, lFirmwareType, false );
+        LdFirmwareUploader lUploader( &aFirmwareData.mFirmwareData[0], lFileSize, lBlockSize, mFirmwareUpdateWindow );
+        lUploader.SetStageCallback( mFirmwareUpdateCallback );
+        lUploader.Upload( lTransport, aProcessPercentage, aCancel );
 
         // Close the update session.
         mProtocolConfig->StartRequest( LtComLeddarTechPublic::LT_COMM_CFGSRV_REQUEST_UPDATE );
@@ -624,7 +624,13 @@ void LeddarDevice::LdSensorM16Can::GetConstants( void )
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 bool LeddarDevice::LdSensorM16Can::GetData( void )
 {
-    bool lRet = GetEchoes();
+    bool lRet;
+
+    {
+        // Read and decoded in one call, timed as a whole in the receive stage
+        LT_PIPELINE_SCOPE( &mPipelineStats, STAGE_RECEIVE );
+        lRet = GetEchoes();
+    }
 
     if( !mProtocol->IsStreaming() )
         GetStates();
@@ -751,7 +757,7 @@ bool LeddarDevice::LdSensorM16Can::GetEchoes( void )
         throw std::runtime_error( "Missing echoes" );
     }
 
-    mEchoes.SetPropertyValue( LeddarCore::LdPropertyIds::ID_CURRENT_LED_INTENSITY, 0, lCrurrentLedPower );
+    mEchoes.SetCurrentLedPower( lCrurrentLedPower );
     mEchoes.SetTimestamp( lTimestamp );
     lLock.unlock();
 
@@ -784,9 +790,10 @@ void LeddarDevice::LdSensorM16Can::GetStates( void )
     LtComCanBus::sCanData lConfigData = mProtocol->GetValue( LtComCanBus::M16_CMD_GET_INPUT_DATA, LtComCanBus::M16_ID_TEMP );
 
     uint16_t lRawTemp = *reinterpret_cast<uint32_t *>( &lConfigData.mFrame.Cmd.mArg[2] );
-    GetResultStates()->GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_RS_SYSTEM_TEMP )->ForceRawValue( 0, lRawTemp );
+    GetResultStates()->SetSystemTemperatureRaw( lRawTemp );
 
     GetResultStates()->SetTimestamp( mEchoes.GetTimestamp( LeddarConnection::B_GET ) ); //we use latest echo timestamp, better than nothing
+    GetResultStates()->Swap();
     GetResultStates()->UpdateFinished();
 }
 
@@ -18,6 +18,7 @@
 #include "comm/Modbus/LtComLeddarM16Modbus.h"
 #include "comm/LtComLeddarTechPublic.h"
 
+#include "LdModbusDetections.h"
 #include "LdPropertyIds.h"
 
 #include "LtExceptions.h"
@@ -25,6 +26,7 @@
 #include "LtStringUtils.h"
 #include "LtTimeUtils.h"
 
+#include <algorithm>
 #include <string.h>
 
 using namespace LeddarDevice;
@@ -43,7 +45,11 @@ LdSensorM16Modbus::LdSensorM16Modbus( LeddarConnection::LdConnection *aConnectio
     LdSensor( aConnection ),
     mConnectionInfoModbus( nullptr ),
     mInterface( nullptr ),
-    mUse0x6A( true )
+    mUse0x6A( true ),
+    mDeviceType( 0 ),
+    mLastTimestamp( 0 ),
+    mEchoesRequest( 0 ),
+    mStatesRequest( 0 )
 {
     using namespace LeddarCore;
 
@@ -80,6 +86,38 @@ void
 LdSensorM16Modbus::Connect( void )
 {
     LdDevice::Connect();
+    mDeviceType    = mInterface->GetDeviceType();
+    mLastTimestamp = 0;
+    mProgram.Clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdSensorM16Modbus::BuildProgram( void )
+///
+/// \brief  Build the frame acquisition program: echoes (0x6A or 0x41), then the temperature (input register 0).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LdSensorM16Modbus::BuildProgram( void )
+{
+    if( mDeviceType == 0 )
+    {
+        mDeviceType = GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_DEVICE_TYPE )->ValueT<uint16_t>();
+    }
+
+    // The answer length of the detection functions is predicted from the device type
+    if( mInterface->GetDeviceType() == 0 )
+    {
+        mInterface->SetDeviceType( mDeviceType );
+    }
+
+    const uint8_t lEchoesPdu[] = { static_cast<uint8_t>( mUse0x6A ? 0x6A : 0x41 ) };
+    const uint8_t lStatesPdu[] = { 0x04, 0, 0, 0, 1 };
+
+    mProgram = LeddarConnection::LdModbusProgram( mInterface );
+    mEchoesRequest = mProgram.Add( mConnectionInfoModbus->GetModbusAddr(), lEchoesPdu, sizeof( lEchoesPdu ) );
+    mStatesRequest = mProgram.Add( mConnectionInfoModbus->GetModbusAddr(), lStatesPdu, sizeof( lStatesPdu ), MODBUS_DATA_OFFSET + 1 + 2 + MODBUS_CRC_SIZE );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,61 +135,7 @@ LdSensorM16Modbus::Connect( void )
 bool
 LdSensorM16Modbus::GetEchoes0x41( void )
 {
-    uint8_t lRawRequest[ 2 ] = { mConnectionInfoModbus->GetModbusAddr(), 0x41 };
-    uint8_t lResponse[LTMODBUS_RTU_MAX_ADU_LENGTH] = { 0 };
-
-    mInterface->SendRawRequest( lRawRequest, 2 );
-    size_t lReceivedSize = mInterface->ReceiveRawConfirmationLT( lResponse, GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_DEVICE_TYPE )->ValueT<uint16_t>() );
-
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( LtComLeddarM16Modbus::M16_WAIT_AFTER_REQUEST );
-
-    if( lReceivedSize <= MODBUS_DATA_OFFSET )
-    {
-        mInterface->Flush();
-        throw LeddarException::LtComException( "Received size too small: " + LeddarUtils::LtStringUtils::IntToString( lReceivedSize ) );
-    }
-
-    uint8_t lEchoCount = lResponse[MODBUS_DATA_OFFSET];
-
-    if( lReceivedSize > MODBUS_DATA_OFFSET + lEchoCount * sizeof( LtComLeddarM16Modbus::sLeddarM16Detections0x41 ) + 6 )
-    {
-        uint32_t lLastTimeStamp = mEchoes.GetTimestamp();
-        uint32_t lTimeStamp = *reinterpret_cast<uint32_t *>( &lResponse[MODBUS_DATA_OFFSET + lEchoCount * 5u] );
-
-        if( lLastTimeStamp != lTimeStamp )
-        {
-            mEchoes.SetEchoCount( lEchoCount );
-            LtComLeddarM16Modbus::sLeddarM16Detections0x41 *lDetections = reinterpret_cast< LtComLeddarM16Modbus::sLeddarM16Detections0x41 * >( &lResponse[MODBUS_DATA_OFFSET + 1] );
-
-            for( uint8_t i = 0; ( i < lEchoCount ) && ( i < LtComLeddarM16Modbus::M16_MAX_SERIAL_DETECTIONS ); ++i )
-            {
-                LeddarConnection::LdEcho &lEcho = ( *mEchoes.GetEchoes( LeddarConnection::B_SET ) )[i];
-                lEcho.mDistance = lDetections->mDistance;
-                lEcho.mAmplitude = lDetections->mAmplitude;
-                lEcho.mFlag = lDetections->mFlags & 0x0F;
-                lEcho.mChannelIndex = ( lDetections->mFlags & 0xF0 ) >> 4;
-                lDetections++;
-            }
-
-            uint16_t lLedPower = *reinterpret_cast<uint16_t *>( &lResponse[MODBUS_DATA_OFFSET + lEchoCount * sizeof( LtComLeddarM16Modbus::sLeddarM16Detections0x41 ) + 4] );
-            mEchoes.SetTimestamp( lTimeStamp );
-            mEchoes.SetPropertyValue( LeddarCore::LdPropertyIds::ID_CURRENT_LED_INTENSITY, 0, lLedPower );
-            ComputeCartesianCoordinates();
-            mEchoes.Swap();
-            mEchoes.UpdateFinished();
-        }
-        else
-        {
-            return false;
-        }
-    }
-    else
-    {
-        mInterface->Flush();
-        throw LeddarException::LtComException( "Not enough data received, size: " + LeddarUtils::LtStringUtils::IntToString( lReceivedSize ) );
-    }
-
-    return true;
+    return GetEchoesLT( sizeof( LtComLeddarM16Modbus::sLeddarM16Detections0x41 ), LeddarConnection::LdModbusDetections::UnpackM16_0x41 );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -169,13 +153,36 @@ LdSensorM16Modbus::GetEchoes0x41( void )
 bool
 LdSensorM16Modbus::GetEchoes0x6A( void )
 {
-    uint8_t lRawRequest[ 2 ] = { mConnectionInfoModbus->GetModbusAddr(), 0x6A };
-    uint8_t lResponse[LTMODBUS_RTU_MAX_ADU_LENGTH] = { 0 };
+    return GetEchoesLT( sizeof( LtComLeddarM16Modbus::sLeddarM16Detections0x6A ), LeddarConnection::LdModbusDetections::UnpackM16_0x6A );
+}
 
-    mInterface->SendRawRequest( lRawRequest, 2 );
-    size_t lReceivedSize = mInterface->ReceiveRawConfirmationLT( lResponse, GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_DEVICE_TYPE )->ValueT<uint16_t>() );
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LdSensorM16Modbus::GetEchoesLT( size_t aDetectionSize, void ( *aUnpack )( const uint8_t *, uint32_t, LeddarConnection::LdEcho * ) )
+///
+/// \brief  Get the echoes with the detection function of the program (0x41 or 0x6A). The answer is: echo count,
+///         detections, timestamp (uint32), led power (uint16). The timestamp is checked before the detections are decoded.
+///
+/// \exception  LeddarException::LtComException Thrown when we don't receive the expected amount of data.
+///
+/// \param  aDetectionSize  Size of a detection record.
+/// \param  aUnpack         Decoding of the detection records (LdModbusDetections).
+///
+/// \return Return true if there is new echoes.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool
+LdSensorM16Modbus::GetEchoesLT( size_t aDetectionSize, void ( *aUnpack )( const uint8_t *, uint32_t, LeddarConnection::LdEcho * ) )
+{
+    uint8_t lResponse[LTMODBUS_RTU_MAX_ADU_LENGTH];
 
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( LtComLeddarM16Modbus::M16_WAIT_AFTER_REQUEST );
+    if( mProgram.IsEmpty() )
+    {
+        BuildProgram();
+    }
+
+    // No wait after the answer: the guard time of the bus elapses while it is decoded
+    size_t lReceivedSize = mProgram.Run( mEchoesRequest, lResponse );
 
     if( lReceivedSize <= MODBUS_DATA_OFFSET )
     {
@@ -183,39 +190,29 @@ LdSensorM16Modbus::GetEchoes0x6A( void )
         throw LeddarException::LtComException( "Received size too small: " + LeddarUtils::LtStringUtils::IntToString( lReceivedSize ) );
     }
 
-    uint8_t lEchoCount = lResponse[MODBUS_DATA_OFFSET];
+    const uint8_t lEchoCount = lResponse[MODBUS_DATA_OFFSET];
+    const uint8_t *lDetections = &lResponse[MODBUS_DATA_OFFSET + 1];
+    const uint8_t *lTrailing = lDetections + lEchoCount * aDetectionSize;
 
-    if( lReceivedSize > MODBUS_DATA_OFFSET + lEchoCount * sizeof( LtComLeddarM16Modbus::sLeddarM16Detections0x6A ) + 6 )
+    if( lReceivedSize > MODBUS_DATA_OFFSET + lEchoCount * aDetectionSize + 6 )
     {
-        uint32_t lLastTimeStamp = mEchoes.GetTimestamp();
-        uint32_t lTimeStamp = *reinterpret_cast<uint32_t *>( &lResponse[MODBUS_DATA_OFFSET + lEchoCount * 5u] );
-
-        if( lLastTimeStamp != lTimeStamp )
-        {
-            mEchoes.SetEchoCount( lEchoCount );
-            LtComLeddarM16Modbus::sLeddarM16Detections0x6A *lDetections = reinterpret_cast< LtComLeddarM16Modbus::sLeddarM16Detections0x6A * >( &lResponse[MODBUS_DATA_OFFSET + 1] );
-
-            for( uint8_t i = 0; ( i < lEchoCount ) && ( i < LtComLeddarM16Modbus::M16_MAX_SERIAL_DETECTIONS ); ++i )
-            {
-                LeddarConnection::LdEcho &lEcho = ( *mEchoes.GetEchoes( LeddarConnection::B_SET ) )[i];
-                lEcho.mDistance = lDetections->mDistance;
-                lEcho.mAmplitude = lDetections->mAmplitude;
-                lEcho.mFlag = lDetections->mFlags;
-                lEcho.mChannelIndex = lDetections->mSegment;
-                lDetections++;
-            }
+        uint32_t lTimeStamp = LeddarConnection::LdModbusDetections::ReadU32( lTrailing );
 
-            uint16_t lLedPower = *reinterpret_cast<uint16_t *>( &lResponse[MODBUS_DATA_OFFSET + lEchoCount * sizeof( LtComLeddarM16Modbus::sLeddarM16Detections0x6A ) + 4] );
-            mEchoes.SetTimestamp( lTimeStamp );
-            mEchoes.SetPropertyValue( LeddarCore::LdPropertyIds::ID_CURRENT_LED_INTENSITY, 0, lLedPower );
-            ComputeCartesianCoordinates();
-            mEchoes.Swap();
-            mEchoes.UpdateFinished();
-        }
-        else
+        if( lTimeStamp == mLastTimestamp )
         {
             return false;
         }
+
+        const uint32_t lCount = std::min<uint32_t>( lEchoCount, LtComLeddarM16Modbus::M16_MAX_SERIAL_DETECTIONS );
+        aUnpack( lDetections, lCount, mEchoes.GetEchoes( LeddarConnection::B_SET )->data() );
+        mEchoes.SetEchoCount( lCount );
+
+        mLastTimestamp = lTimeStamp;
+        mEchoes.SetTimestamp( lTimeStamp );
+        mEchoes.SetCurrentLedPower( LeddarConnection::LdModbusDetections::ReadU16( lTrailing + 4 ) );
+        ComputeCartesianCoordinates();
+        mEchoes.Swap();
+        mEchoes.UpdateFinished();
     }
     else
     {
@@ -237,11 +234,24 @@ LdSensorM16Modbus::GetEchoes0x6A( void )
 void
 LdSensorM16Modbus::GetStates( void )
 {
-    uint16_t lResponse[LTMODBUS_RTU_MAX_ADU_LENGTH / 2] = { 0 };
-    mInterface->ReadInputRegisters( 0, 1, lResponse );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( LtComLeddarM16Modbus::M16_WAIT_AFTER_REQUEST );
+    uint8_t lResponse[LTMODBUS_RTU_MAX_ADU_LENGTH];
+
+    if( mProgram.IsEmpty() )
+    {
+        BuildProgram();
+    }
+
+    // Sent right after the echoes answer
+    size_t lReceivedSize = mProgram.Run( mStatesRequest, lResponse );
+
+    if( lReceivedSize != MODBUS_DATA_OFFSET + 1 + 2 + MODBUS_CRC_SIZE || lResponse[MODBUS_DATA_OFFSET] != 2 )
+    {
+        mInterface->Flush();
+        throw LeddarException::LtComException( "Wrong states answer, size: " + LeddarUtils::LtStringUtils::IntToString( lReceivedSize ) );
+    }
 
-    GetResultStates()->GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_RS_SYSTEM_TEMP )->ForceRawValue( 0, lResponse[0] );
+    GetResultStates()->SetSystemTemperatureRaw( static_cast<uint16_t>( ( lResponse[MODBUS_DATA_OFFSET + 1] << 8 ) | lResponse[MODBUS_DATA_OFFSET + 2] ) );
+    GetResultStates()->Swap();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -346,7 +356,7 @@ LdSensorM16Modbus::SetConfig( void )
     {
         if( ( *lPropertyIter )->Modified() )
         {
-            int lValue;
+            int lValue = 0;
 
             switch( ( *lPropertyIter )->GetType() )
             {
@@ -472,6 +482,7 @@ LdSensorM16Modbus::GetConstants( void )
     GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_FPGA_VERSION )->ForceValue( 0, lDeviceInfo->mFPGAVersion );
     GetProperties()->GetBitProperty( LeddarCore::LdPropertyIds::ID_OPTIONS )->ForceValue( 0, lDeviceInfo->mDeviceOptions );
     GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_DEVICE_TYPE )->ForceValue( 0, lDeviceInfo->mDeviceId );
+    mDeviceType = lDeviceInfo->mDeviceId;
 
     if( GetConnection()->GetDeviceType() == 0 )
         GetConnection()->SetDeviceType( lDeviceInfo->mDeviceId );
@@ -21,6 +21,7 @@
 #include "LdConnectionInfoModbus.h"
 
 #include "LdLibModbusSerial.h"
+#include "LdModbusProgram.h"
 
 namespace LeddarDevice
 {
@@ -39,7 +40,7 @@ namespace LeddarDevice
         virtual void        GetStates( void ) override;
         virtual void        Reset( LeddarDefines::eResetType /*aType*/, LeddarDefines::eResetOptions = LeddarDefines::RO_NO_OPTION, uint32_t = 0 ) override {};
         bool                GetUse0x6A( void ) const { return mUse0x6A; }
-        void                SetUse0x6A( bool use0x6A ) { mUse0x6A = use0x6A; }
+        void                SetUse0x6A( bool use0x6A ) { mUse0x6A = use0x6A; mProgram.Clear(); }
 
     protected:
         const LeddarConnection::LdConnectionInfoModbus  *mConnectionInfoModbus;
@@ -49,8 +50,15 @@ namespace LeddarDevice
         void    InitProperties( void );
         bool    GetEchoes0x41( void );
         bool    GetEchoes0x6A( void );
+        bool    GetEchoesLT( size_t aDetectionSize, void ( *aUnpack )( const uint8_t *, uint32_t, LeddarConnection::LdEcho * ) );
+        void    BuildProgram( void );
 
-        bool    mUse0x6A; ///< Use modbus function 0x6A to get echoes. Allows entire flag, but less echoes
+        bool        mUse0x6A;       ///< Use modbus function 0x6A to get echoes. Allows entire flag, but less echoes
+        uint16_t    mDeviceType;    ///< Cached at connection, selects the answer layout
+        uint32_t    mLastTimestamp; ///< Timestamp of the last decoded frame
+        LeddarConnection::LdModbusProgram mProgram; ///< Echoes then states requests, built on the first poll
+        size_t      mEchoesRequest;
+        size_t      mStatesRequest;
     };
 }
 
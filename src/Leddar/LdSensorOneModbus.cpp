@@ -43,6 +43,7 @@ using namespace LtComLeddarOneModbus;
 LdSensorOneModbus::LdSensorOneModbus( LeddarConnection::LdConnection *aConnection )
     : LdSensor( aConnection )
     , mParameterVersion( 1 )
+    , mEchoesRequest( 0 )
 {
     using namespace LeddarCore;
 
@@ -73,7 +74,46 @@ LdSensorOneModbus::~LdSensorOneModbus() {}
 ///
 /// \since   September 2017
 /// *****************************************************************************
-void LdSensorOneModbus::Connect( void ) { LdDevice::Connect(); }
+void LdSensorOneModbus::Connect( void )
+{
+    LdDevice::Connect();
+    mProgram.Clear();
+}
+
+// *****************************************************************************
+// Function: LdSensorOneModbus::BuildProgram
+//
+/// \brief   Build the frame acquisition program: one read of the input registers
+///          (led power, detections, temperatures), it depends on the parameter version.
+///
+/// \since   October 2026
+// *****************************************************************************
+void LdSensorOneModbus::BuildProgram( void )
+{
+    uint8_t lStartAddress = 0, lRegisterNumber = 0;
+
+    if( mParameterVersion > 2 )
+    {
+        lStartAddress   = 19;
+        lRegisterNumber = 12;
+    }
+    else if( mParameterVersion > 1 )
+    {
+        lStartAddress   = 19;
+        lRegisterNumber = 11;
+    }
+    else
+    {
+        lStartAddress   = 20;
+        lRegisterNumber = 10;
+    }
+
+    // The answer length is predicted from its byte count
+    const uint8_t lEchoesPdu[] = { 0x04, 0, lStartAddress, 0, lRegisterNumber };
+
+    mProgram       = LeddarConnection::LdModbusProgram( mInterface );
+    mEchoesRequest = mProgram.Add( mConnectionInfoModbus->GetModbusAddr(), lEchoesPdu, sizeof( lEchoesPdu ) );
+}
 
 // *****************************************************************************
 // Function: LdSensorOneModbus::GetData
@@ -114,6 +154,8 @@ bool LdSensorOneModbus::RequestData( uint32_t &aDataMask )
     // GetEchoes also get states
     if( ( aDataMask & LdSensor::DM_ECHOES ) == LdSensor::DM_ECHOES || ( aDataMask & LdSensor::DM_STATES ) == LdSensor::DM_STATES )
     {
+        // Read and decoded in one request, timed as a whole in the receive stage
+        LT_PIPELINE_SCOPE( &mPipelineStats, STAGE_RECEIVE );
         return GetEchoes();
     }
 
@@ -134,37 +176,15 @@ bool LdSensorOneModbus::RequestData( uint32_t &aDataMask )
 bool LdSensorOneModbus::GetEchoes( void )
 {
     using namespace LeddarUtils;
-    uint16_t lStartAddress = 0, lRegisterNumber = 0;
-    if( mParameterVersion > 2 )
-    {
-        lStartAddress   = 19;
-        lRegisterNumber = 12;
-    }
-    else if( mParameterVersion > 1 )
-    {
-        lStartAddress   = 19;
-        lRegisterNumber = 11;
-    }
-    else
+    uint8_t lResponse[LTMODBUS_RTU_MAX_ADU_LENGTH] = { 0 };
+
+    if( mProgram.IsEmpty() )
     {
-        lStartAddress   = 20;
-        lRegisterNumber = 10;
+        BuildProgram();
     }
 
-    uint16_t lStartAddressBigEndian   = LtIntUtilities::SwapEndian( lStartAddress );
-    uint16_t lRegisterNumberBigEndian = LtIntUtilities::SwapEndian( lRegisterNumber );
-    uint8_t lRawRequest[6]            = { mConnectionInfoModbus->GetModbusAddr(), 0x4 };
-    *(uint16_t *)( &lRawRequest[2] )  = lStartAddressBigEndian;   // First two values are starting register address
-    *(uint16_t *)( &lRawRequest[4] )  = lRegisterNumberBigEndian; // The other two are : Quantity of Input Registers
-
-    uint8_t lResponse[LTMODBUS_RTU_MAX_ADU_LENGTH] = { 0 };
-
-    mInterface->SendRawRequest( lRawRequest, 6 );
-    uint32_t lSizeToReceive =
-        static_cast<uint32_t>( sizeof( LeddarConnection::LdConnectionModbuStructures::sModbusHeader ) +
-                               offsetof( LeddarConnection::LdConnectionModbuStructures::sModbusReadDataAnswer, mData ) + MODBUS_CRC_SIZE + sizeof( sLeddarOneDetections ) );
-    size_t lReceivedSize = mInterface->ReceiveRawConfirmation( lResponse, lSizeToReceive );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( ONE_WAIT_AFTER_REQUEST );
+    // No wait after the answer: the guard time of the bus elapses while it is decoded
+    size_t lReceivedSize = mProgram.Run( mEchoesRequest, lResponse );
 
     if( lReceivedSize <= MODBUS_DATA_OFFSET )
     {
@@ -198,11 +218,11 @@ bool LdSensorOneModbus::GetEchoes( void )
         lEchoes->SetTimestamp( lTimestamp );
         GetResultStates()->SetTimestamp( lTimestamp );
 
-        lStatesProp->GetFloatProperty( LeddarCore::LdPropertyIds::ID_RS_SYSTEM_TEMP )->ForceRawValue( 0, LtIntUtilities::SwapEndian( lDetections->mTemperature ) );
+        GetResultStates()->SetSystemTemperatureRaw( LtIntUtilities::SwapEndian( lDetections->mTemperature ) );
         if( mParameterVersion > 2 )
         {
             uint16_t lPredTemp = *reinterpret_cast<uint16_t *>( &lResponse[MODBUS_DATA_OFFSET + 1 + lOffset] );
-            lStatesProp->GetFloatProperty( LeddarCore::LdPropertyIds::ID_RS_PREDICT_TEMP )->ForceRawValue( 0, LtIntUtilities::SwapEndian( lPredTemp ) );
+            GetResultStates()->SetPredictedTemperatureRaw( LtIntUtilities::SwapEndian( lPredTemp ) );
         }
 
         uint16_t lEchoCount = LtIntUtilities::SwapEndian( lDetections->mNumberDetections );
@@ -224,6 +244,7 @@ bool LdSensorOneModbus::GetEchoes( void )
         ComputeCartesianCoordinates();
         GetResultEchoes()->Swap();
         GetResultEchoes()->UpdateFinished();
+        GetResultStates()->Swap();
         GetResultStates()->UpdateFinished();
     }
 
@@ -314,7 +335,7 @@ void LdSensorOneModbus::SetConfig( void )
     {
         if( ( *lPropertyIter )->Modified() )
         {
-            int lValue;
+            int lValue = 0;
 
             switch( ( *lPropertyIter )->GetType() )
             {
@@ -450,6 +471,8 @@ void LdSensorOneModbus::GetConstants( void )
         mParameterVersion = 2;
     }
 
+    mProgram.Clear();
+
     if( mParameterVersion >= 4 )
         GetProperties()->GetTextProperty( LeddarCore::LdPropertyIds::ID_SERIAL_NUMBER )->ForceValue( 0, lDeviceInfo->mSerialNumberV2 );
     else
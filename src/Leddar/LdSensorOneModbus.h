@@ -21,6 +21,7 @@
 #include "LdSensor.h"
 
 #include "LdLibModbusSerial.h"
+#include "LdModbusProgram.h"
 
 namespace LeddarDevice
 {
@@ -54,6 +55,10 @@ namespace LeddarDevice
 
       private:
         void InitProperties( void );
+        void BuildProgram( void );
+
+        LeddarConnection::LdModbusProgram mProgram; ///< Echoes and states request, built on the first poll
+        size_t mEchoesRequest;
     };
 } // namespace LeddarDevice
 
@@ -333,6 +333,7 @@ void LeddarDevice::LdSensorPixell::ComputeCartesianCoordinates()
 
     // cppcheck-suppress unreadVariable
     auto lLock                                     = GetResultEchoes()->GetUniqueLock( LeddarConnection::B_SET );
+    GetResultEchoes()->FilterEchoes(); // Convert only the kept echoes
     std::vector<LeddarConnection::LdEcho> &lEchoes = *GetResultEchoes()->GetEchoes( LeddarConnection::B_SET );
     LdFloatProperty *lAzimutProp                   = GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_CHANNEL_ANGLE_AZIMUT );
     LdFloatProperty *lElevationProp                = GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_CHANNEL_ANGLE_ELEVATION );
@@ -1066,7 +1066,7 @@ LdSensorVu::GetEchoes()
             }
 
             lResultEchoes->SetEchoCount( lEchoCount );
-            mEchoes.SetPropertyValue( LeddarCore::LdPropertyIds::ID_CURRENT_LED_INTENSITY, 0, lCurrentLwdPower );
+            mEchoes.SetCurrentLedPower( lCurrentLwdPower );
         }
         else
         {
@@ -1126,7 +1126,7 @@ LdSensorVu::GetStates()
         // Read state from device
         uint32_t lCpuLoad;
         mConnectionUniversal->ReadRegister( GetBankAddress( REGMAP_CMD_LIST ) + offsetof( sCmdList, mCpuUsage ), ( uint8_t * )&lCpuLoad, sizeof( lCpuLoad ), 5 );
-        aResultStates.GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_RS_CPU_LOAD )->ForceRawValue( 0, lCpuLoad );
+        aResultStates.SetCpuLoadRaw( lCpuLoad );
 
         if( mBackupFlagAvailable )
         {
@@ -1135,12 +1135,12 @@ LdSensorVu::GetStates()
                 // Read backup flag
                 uint32_t lBackupFlag;
                 mConnectionUniversal->ReadRegister( GetBankAddress( REGMAP_CMD_LIST ) + offsetof( sCmdList, mBackupStatus ), ( uint8_t * )&lBackupFlag, sizeof( lBackupFlag ), 5 );
-                aResultStates.GetProperties()->GetEnumProperty( LeddarCore::LdPropertyIds::ID_RS_BACKUP )->ForceValue( 0, lBackupFlag );
+                aResultStates.SetBackupFlag( lBackupFlag );
             }
             catch( ... )
             {
                 mBackupFlagAvailable = false;
-                aResultStates.GetProperties()->GetEnumProperty( LeddarCore::LdPropertyIds::ID_RS_BACKUP )->ForceValue( 0, 0 );
+                aResultStates.SetBackupFlag( 0 );
                 throw LeddarException::LtException( "Error to read the calibration backup flag, please update your sensor firmware." );
             }
         }
@@ -1152,6 +1152,7 @@ LdSensorVu::GetStates()
     }
 
     // Emit state update completed
+    aResultStates.Swap();
     aResultStates.UpdateFinished();
 }
 
@@ -1618,32 +1619,24 @@ void LeddarDevice::LdSensorVu::UpdateFirmware( const std::string &aFileName, Led
         throw std::logic_error( "Provided file is not for this device" );
     }
 
-    const std::list<std::pair<uint32_t, std::vector<uint8_t>>> lFirmwares = lLtbReader.GetFirmwares();
-
-    auto lDSP      = std::find_if( lFirmwares.cbegin(), lFirmwares.cend(),
-                              []( const std::pair<uint32_t, std::vector<uint8_t>> &a ) { return a.first == LeddarUtils::LtFileUtils::LtLtbReader::ID_LTB_GALAXY_BINARY; } );
-    auto lFPGAAlgo = std::find_if( lFirmwares.cbegin(), lFirmwares.cend(),
-                                   []( const std::pair<uint32_t, std::vector<uint8_t>> &a ) { return a.first == LeddarUtils::LtFileUtils::LtLtbReader::ID_LTB_FPGA_ALGO; } );
-    auto lFPGAData = std::find_if( lFirmwares.cbegin(), lFirmwares.cend(),
-                                   []( const std::pair<uint32_t, std::vector<uint8_t>> &a ) { return a.first == LeddarUtils::LtFileUtils::LtLtbReader::ID_LTB_FPGA_DATA; } );
-    auto lFPGAEraseAlgo = std::find_if( lFirmwares.cbegin(), lFirmwares.cend(),
-                                   []( const std::pair<uint32_t, std::vector<uint8_t>> &a ) { return a.first == LeddarUtils::LtFileUtils::LtLtbReader::ID_LTB_FPGA_ERASE_ALGO; } );
-    auto lFPGAEraseData = std::find_if( lFirmwares.cbegin(), lFirmwares.cend(),
-                                   []( const std::pair<uint32_t, std::vector<uint8_t>> &a ) { return a.first == LeddarUtils::LtFileUtils::LtLtbReader::ID_LTB_FPGA_ERASE_DATA; } );
-    auto lAsicHexData = std::find_if( lFirmwares.cbegin(), lFirmwares.cend(),
-                                   []( const std::pair<uint32_t, std::vector<uint8_t>> &a ) { return a.first == LeddarUtils::LtFileUtils::LtLtbReader::ID_LTB_ASIC_HEX; } );
-    if( lDSP != lFirmwares.cend() )
+    // Only the firmwares that are sent are read from the file
+    typedef LeddarUtils::LtFileUtils::LtLtbReader LtLtbReader;
+
+    if( lLtbReader.HasFirmware( LtLtbReader::ID_LTB_GALAXY_BINARY ) )
     {
-        UpdateFirmware( FT_DSP, LdFirmwareData( ( *lDSP ).second ), aProcessPercentage, aCancel );
+        UpdateFirmware( FT_DSP, LdFirmwareData( lLtbReader.GetFirmware( LtLtbReader::ID_LTB_GALAXY_BINARY ) ), aProcessPercentage, aCancel );
     }
-    else if( lAsicHexData != lFirmwares.cend() )
+    else if( lLtbReader.HasFirmware( LtLtbReader::ID_LTB_ASIC_HEX ) )
     {
-        UpdateFirmware( FT_ASIC, LdFirmwareData( ( *lAsicHexData ).second ), aProcessPercentage, aCancel );
+        UpdateFirmware( FT_ASIC, LdFirmwareData( lLtbReader.GetFirmware( LtLtbReader::ID_LTB_ASIC_HEX ) ), aProcessPercentage, aCancel );
     }
-    else if( lFPGAAlgo != lFirmwares.cend() && lFPGAData != lFirmwares.cend() && lFPGAEraseAlgo != lFirmwares.cend() && lFPGAEraseData != lFirmwares.cend() )
+    else if( lLtbReader.HasFirmware( LtLtbReader::ID_LTB_FPGA_ALGO ) && lLtbReader.HasFirmware( LtLtbReader::ID_LTB_FPGA_DATA ) &&
+             lLtbReader.HasFirmware( LtLtbReader::ID_LTB_FPGA_ERASE_ALGO ) && lLtbReader.HasFirmware( LtLtbReader::ID_LTB_FPGA_ERASE_DATA ) )
     {
-        UpdateFirmware( FT_FPGA, LdFirmwareData( ( *lFPGAEraseData ).second, ( *lFPGAEraseAlgo ).second ), aProcessPercentage, aCancel );
-        UpdateFirmware( FT_FPGA, LdFirmwareData( ( *lFPGAData ).second, ( *lFPGAAlgo ).second ), aProcessPercentage, aCancel );
+        UpdateFirmware( FT_FPGA, LdFirmwareData( lLtbReader.GetFirmware( LtLtbReader::ID_LTB_FPGA_ERASE_DATA ), lLtbReader.GetFirmware( LtLtbReader::ID_LTB_FPGA_ERASE_ALGO ) ),
+                        aProcessPercentage, aCancel );
+        UpdateFirmware( FT_FPGA, LdFirmwareData( lLtbReader.GetFirmware( LtLtbReader::ID_LTB_FPGA_DATA ), lLtbReader.GetFirmware( LtLtbReader::ID_LTB_FPGA_ALGO ) ),
+                        aProcessPercentage, aCancel );
     }
     else
     {
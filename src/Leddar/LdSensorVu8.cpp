@@ -155,7 +155,7 @@ LdSensorVu8::GetStates()
     // Get product specific states
     uint32_t lTemperature;
     mConnectionUniversal->Read( 0xb, GetBankAddress( REGMAP_PRD_CMD_LIST ) + offsetof( sProductCmdList, mSensorTemp ), ( uint8_t * )&lTemperature, sizeof( lTemperature ) );
-    GetResultStates()->GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_RS_SYSTEM_TEMP )->ForceRawValue( 0, lTemperature );
+    GetResultStates()->SetSystemTemperatureRaw( static_cast<int32_t>( lTemperature ) );
 
     if( mPredictedTempAvailable )
     {
@@ -164,12 +164,12 @@ LdSensorVu8::GetStates()
             // Read the predicted temperature
             uint32_t lPredictedTemp;
             mConnectionUniversal->ReadRegister( GetBankAddress( REGMAP_PRD_CMD_LIST ) + offsetof( sProductCmdList, mSensorTempPred ), ( uint8_t * )&lPredictedTemp, sizeof( lPredictedTemp ), 5 );
-            GetResultStates()->GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_RS_PREDICT_TEMP )->ForceRawValue( 0, lPredictedTemp );
+            GetResultStates()->SetPredictedTemperatureRaw( static_cast<int32_t>( lPredictedTemp ) );
         }
         catch( ... )
         {
             mPredictedTempAvailable = false;
-            GetResultStates()->GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_RS_PREDICT_TEMP )->ForceValue( 0, 0 );
+            GetResultStates()->SetPredictedTemperatureRaw( 0 );
             throw LeddarException::LtInfoException( "Error to read the predicted temperature, please update your sensor firmware." );
         }
     }
@@ -270,8 +270,7 @@ LdSensorVu8::GetConstants()
         lIntProp->ForceValue( 0, lTempScale );
         lIntProp->SetClean();
 
-        GetResultStates()->GetProperties()->GetFloatProperty( LdPropertyIds::ID_RS_SYSTEM_TEMP )->SetScale( lTempScale );
-        GetResultStates()->GetProperties()->GetFloatProperty( LdPropertyIds::ID_RS_PREDICT_TEMP )->SetScale( lTempScale );
+        GetResultStates()->SetTemperatureScale( lTempScale );
     }
     catch( std::exception &e )
     {
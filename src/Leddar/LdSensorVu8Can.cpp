@@ -536,6 +536,8 @@ void LeddarDevice::LdSensorVu8Can::SetConfig( void )
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 bool LeddarDevice::LdSensorVu8Can::GetData( void )
 {
+    // Read and decoded in one call, timed as a whole in the receive stage
+    LT_PIPELINE_SCOPE( &mPipelineStats, STAGE_RECEIVE );
     return GetEchoes();
 }
 
@@ -655,7 +657,7 @@ bool LeddarDevice::LdSensorVu8Can::GetEchoes( void )
         throw std::runtime_error( "Missing echoes" );
     }
 
-    mEchoes.SetPropertyValue( LeddarCore::LdPropertyIds::ID_CURRENT_LED_INTENSITY, 0, lCrurrentLedPower );
+    mEchoes.SetCurrentLedPower( lCrurrentLedPower );
     mEchoes.SetTimestamp( lTimestamp );
     lLock.unlock();
 
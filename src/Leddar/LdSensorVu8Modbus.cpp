@@ -23,12 +23,15 @@
 #include "LdIntegerProperty.h"
 #include "LdTextProperty.h"
 #include "LdConnectionUniversal.h"
+#include "LdModbusDetections.h"
 #include "LtExceptions.h"
 #include "LtStringUtils.h"
 #include "LtTimeUtils.h"
 
 #include "comm/Modbus/LtComLeddarVu8Modbus.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <limits>
 #include <string.h>
 
@@ -53,7 +56,10 @@ using namespace LeddarDevice;
 LdSensorVu8Modbus::LdSensorVu8Modbus( LeddarConnection::LdConnection *aConnection ) :
     LdSensor( aConnection ),
     mConnectionInfoModbus( nullptr ),
-    mInterface( nullptr )
+    mInterface( nullptr ),
+    mDeviceType( 0 ),
+    mLastTimestamp( 0 ),
+    mEchoesRequest( 0 )
 {
     if( aConnection != nullptr )
     {
@@ -92,11 +98,42 @@ void
 LdSensorVu8Modbus::Connect( void )
 {
     LdDevice::Connect();
+    mDeviceType    = mInterface->GetDeviceType();
+    mLastTimestamp = 0;
+    mProgram.Clear();
 
     // Make sure the acqusition engine is started.
     mInterface->WriteRegister( 0x0A, 1 );
 }
 
+// *****************************************************************************
+// Function: LdSensorVu8Modbus::BuildProgram
+//
+/// \brief   Build the frame acquisition program: echoes (0x41).
+///
+/// \since   October 2026
+// *****************************************************************************
+
+void
+LdSensorVu8Modbus::BuildProgram( void )
+{
+    if( mDeviceType == 0 )
+    {
+        mDeviceType = GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_DEVICE_TYPE )->ValueT<uint16_t>();
+    }
+
+    // The answer length of 0x41 is predicted from the device type
+    if( mInterface->GetDeviceType() == 0 )
+    {
+        mInterface->SetDeviceType( mDeviceType );
+    }
+
+    const uint8_t lEchoesPdu[] = { 0x41 };
+
+    mProgram = LeddarConnection::LdModbusProgram( mInterface );
+    mEchoesRequest = mProgram.Add( mConnectionInfoModbus->GetModbusAddr(), lEchoesPdu, sizeof( lEchoesPdu ) );
+}
+
 // *****************************************************************************
 // Function: LdSensorVu8Modbus::GetStates
 //
@@ -127,11 +164,14 @@ LdSensorVu8Modbus::GetStates()
 bool
 LdSensorVu8Modbus::GetEchoes( void )
 {
-    uint8_t lRawRequest[ 10 ] = { mConnectionInfoModbus->GetModbusAddr(), 0x41 };
-    uint8_t lResponse[LTMODBUS_RTU_MAX_ADU_LENGTH] = { 0 };
+    uint8_t lResponse[LTMODBUS_RTU_MAX_ADU_LENGTH];
 
-    mInterface->SendRawRequest( lRawRequest, 2 );
-    size_t lReceivedSize = mInterface->ReceiveRawConfirmationLT( lResponse, GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_DEVICE_TYPE )->ValueT<uint16_t>() );
+    if( mProgram.IsEmpty() )
+    {
+        BuildProgram();
+    }
+
+    size_t lReceivedSize = mProgram.Run( mEchoesRequest, lResponse );
 
     if( lReceivedSize <= MODBUS_DATA_OFFSET )
     {
@@ -139,41 +179,40 @@ LdSensorVu8Modbus::GetEchoes( void )
         throw LeddarException::LtComException( "Received size too small: " + LeddarUtils::LtStringUtils::IntToString( lReceivedSize ) );
     }
 
-    uint8_t lEchoCount = lResponse[MODBUS_DATA_OFFSET];
+    const uint8_t lEchoCount = lResponse[MODBUS_DATA_OFFSET];
+    const uint8_t *lDetections = &lResponse[MODBUS_DATA_OFFSET + 1];
+    const size_t lDetectionsSize = lEchoCount * sizeof( LtComLeddarVu8Modbus::sLeddarVu8ModbusDetections );
 
-    if( lReceivedSize >= MODBUS_DATA_OFFSET + 1u + lEchoCount * sizeof( LtComLeddarVu8Modbus::sLeddarVu8ModbusDetections ) )
+    if( lReceivedSize < MODBUS_DATA_OFFSET + 1u + lDetectionsSize )
     {
-        mEchoes.SetEchoCount( lEchoCount );
-        LtComLeddarVu8Modbus::sLeddarVu8ModbusDetections *lDetections = ( LtComLeddarVu8Modbus::sLeddarVu8ModbusDetections * )&lResponse[MODBUS_DATA_OFFSET + 1];
-
-        for( uint8_t i = 0; ( i < lEchoCount ) && ( i < LEDDARVU8_MAX_SERIAL_DETECTIONS ); ++i )
-        {
-            LeddarConnection::LdEcho &lEcho = ( *mEchoes.GetEchoes( LeddarConnection::B_SET ) )[i];
-            lEcho.mDistance = lDetections->mDistance;
-            lEcho.mAmplitude = lDetections->mAmplitude;
-            lEcho.mFlag = lDetections->mFlag;
-            lEcho.mChannelIndex = lDetections->mSegment;
-            lDetections++;
-        }
+        mInterface->Flush();
+        throw LeddarException::LtComException( "Not enough data received, size: " + LeddarUtils::LtStringUtils::IntToString( lReceivedSize ) );
+    }
 
-        if( lReceivedSize >=
-            MODBUS_DATA_OFFSET + 1u + lEchoCount * sizeof( LtComLeddarVu8Modbus::sLeddarVu8ModbusDetections ) + sizeof( LtComLeddarVu8Modbus::sLeddarVu8ModbusDetectionsTrailing ) )
-        {
+    // Trailing timestamp first, a frame already received is not decoded again
+    const bool lHasTrailing = lReceivedSize >= MODBUS_DATA_OFFSET + 1u + lDetectionsSize + sizeof( LtComLeddarVu8Modbus::sLeddarVu8ModbusDetectionsTrailing );
+    const uint8_t *lTrailing = lDetections + lDetectionsSize;
+    uint32_t lTimestamp = 0;
 
-            LtComLeddarVu8Modbus::sLeddarVu8ModbusDetectionsTrailing *lDetectionsTrail = (LtComLeddarVu8Modbus::sLeddarVu8ModbusDetectionsTrailing *)lDetections;
-            if( mEchoes.GetTimestamp( LeddarConnection::B_GET ) == lDetectionsTrail->mTimestamp )
-            {
-                return false;
-            }
+    if( lHasTrailing )
+    {
+        lTimestamp = LeddarConnection::LdModbusDetections::ReadU32( lTrailing + offsetof( LtComLeddarVu8Modbus::sLeddarVu8ModbusDetectionsTrailing, mTimestamp ) );
 
-            mEchoes.SetTimestamp( lDetectionsTrail->mTimestamp );
-            mEchoes.SetPropertyValue( LeddarCore::LdPropertyIds::ID_CURRENT_LED_INTENSITY, 0, lDetectionsTrail->mLedPower );
+        if( lTimestamp == mLastTimestamp )
+        {
+            return false;
         }
     }
-    else
+
+    const uint32_t lCount = std::min<uint32_t>( lEchoCount, LEDDARVU8_MAX_SERIAL_DETECTIONS );
+    LeddarConnection::LdModbusDetections::UnpackVu8( lDetections, lCount, mEchoes.GetEchoes( LeddarConnection::B_SET )->data() );
+    mEchoes.SetEchoCount( lCount );
+
+    if( lHasTrailing )
     {
-        mInterface->Flush();
-        throw LeddarException::LtComException( "Not enough data received, size: " + LeddarUtils::LtStringUtils::IntToString( lReceivedSize ) );
+        mLastTimestamp = lTimestamp;
+        mEchoes.SetTimestamp( lTimestamp );
+        mEchoes.SetCurrentLedPower( lTrailing[offsetof( LtComLeddarVu8Modbus::sLeddarVu8ModbusDetectionsTrailing, mLedPower )] );
     }
 
     ComputeCartesianCoordinates();
@@ -295,6 +334,7 @@ LdSensorVu8Modbus::GetConstants( void )
     GetProperties()->GetIntegerProperty( LdPropertyIds::ID_FPGA_VERSION )->ForceValue( 0, lServedId.mFpgaVersion );
     GetProperties()->GetBitProperty( LdPropertyIds::ID_OPTIONS )->ForceValue( 0, lServedId.mDeviceOptions );
     GetProperties()->GetIntegerProperty( LdPropertyIds::ID_DEVICE_TYPE )->ForceValue( 0, lServedId.mDeviceId );
+    mDeviceType = lServedId.mDeviceId;
 
     if( GetConnection()->GetDeviceType() == 0 )
     {
@@ -543,7 +583,7 @@ LdSensorVu8Modbus::SetConfig( void )
     {
         if( ( *lPropertyIter )->Modified() && ( ( *lPropertyIter )->GetDeviceId() != 0 || ( *lPropertyIter )->GetId() == LeddarCore::LdPropertyIds::ID_ACCUMULATION_EXP ) )
         {
-            int lValue;
+            int lValue = 0;
 
             switch( ( *lPropertyIter )->GetType() )
             {
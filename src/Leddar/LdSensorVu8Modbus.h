@@ -20,6 +20,7 @@
 #include "LdSensor.h"
 #include "LdConnectionInfoModbus.h"
 #include "LdLibModbusSerial.h"
+#include "LdModbusProgram.h"
 
 namespace LeddarDevice
 {
@@ -52,6 +53,12 @@ namespace LeddarDevice
 
     private:
         void            InitProperties( void );
+        void            BuildProgram( void );
+
+        uint16_t        mDeviceType;    ///< Cached at connection, selects the 0x41 answer layout
+        uint32_t        mLastTimestamp; ///< Timestamp of the last decoded frame
+        LeddarConnection::LdModbusProgram mProgram; ///< Echoes request (the states are not polled), built on the first poll
+        size_t          mEchoesRequest;
     };
 }
 
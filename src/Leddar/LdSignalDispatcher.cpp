@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdSignalDispatcher.cpp
+///
+/// \brief  Implements the LdSignalDispatcher class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdSignalDispatcher.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarCore::LdSignalDispatcher &LeddarCore::LdSignalDispatcher::GetInstance( void )
+///
+/// \brief  Gets the process wide dispatcher
+///
+/// \returns    The instance.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarCore::LdSignalDispatcher &LeddarCore::LdSignalDispatcher::GetInstance( void )
+{
+    static LdSignalDispatcher sInstance;
+    return sInstance;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarCore::LdSignalDispatcher::LdSignalDispatcher( void )
+///
+/// \brief  Constructor
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarCore::LdSignalDispatcher::LdSignalDispatcher( void )
+    : mCurrent()
+    , mIsDispatching( false )
+    , mStop( false )
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarCore::LdSignalDispatcher::~LdSignalDispatcher( void )
+///
+/// \brief  Destructor. Pending callbacks are dropped.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarCore::LdSignalDispatcher::~LdSignalDispatcher( void )
+{
+    {
+        std::lock_guard<std::mutex> lock( mMutex );
+        mStop = true;
+        mQueue.clear();
+    }
+
+    mQueueCondition.notify_all();
+
+    if( mThread.joinable() )
+    {
+        mThread.join();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdSignalDispatcher::Post( LdObject *aSender, LdObject *aReceiver, const LdObject::SIGNALS aSignal )
+///
+/// \brief  Queue a call to aReceiver->Callback( aSender, aSignal, nullptr )
+///
+/// \param [in] aSender     The sender.
+/// \param [in] aReceiver   The receiver.
+/// \param      aSignal     The signal.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarCore::LdSignalDispatcher::Post( LdObject *aSender, LdObject *aReceiver, const LdObject::SIGNALS aSignal )
+{
+    {
+        std::lock_guard<std::mutex> lock( mMutex );
+
+        if( mStop )
+        {
+            return;
+        }
+
+        if( !mThread.joinable() )
+        {
+            mThread = std::thread( &LeddarCore::LdSignalDispatcher::DispatchLoop, this );
+        }
+
+        LdPendingSignal lPending = { aSender, aReceiver, aSignal };
+        mQueue.push_back( lPending );
+    }
+
+    mQueueCondition.notify_one();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdSignalDispatcher::Cancel( const LdObject *aObject )
+///
+/// \brief  Remove pending callbacks where aObject is the sender or the receiver.
+///         If such a callback is running on the dispatcher thread, wait for it to complete
+///         (unless called from the dispatcher thread itself).
+///
+/// \param  aObject The object being disconnected.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarCore::LdSignalDispatcher::Cancel( const LdObject *aObject )
+{
+    std::unique_lock<std::mutex> lock( mMutex );
+
+    for( std::deque<LdPendingSignal>::iterator lIter = mQueue.begin(); lIter != mQueue.end(); )
+    {
+        if( lIter->mSender == aObject || lIter->mReceiver == aObject )
+        {
+            lIter = mQueue.erase( lIter );
+        }
+        else
+        {
+            ++lIter;
+        }
+    }
+
+    if( std::this_thread::get_id() != mThread.get_id() )
+    {
+        mIdleCondition.wait( lock, [this, aObject] { return !mIsDispatching || ( mCurrent.mSender != aObject && mCurrent.mReceiver != aObject ); } );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LeddarCore::LdSignalDispatcher::GetPendingCount( void ) const
+///
+/// \brief  Number of callbacks waiting to be dispatched
+///
+/// \returns    The pending count.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t LeddarCore::LdSignalDispatcher::GetPendingCount( void ) const
+{
+    std::lock_guard<std::mutex> lock( mMutex );
+    return mQueue.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdSignalDispatcher::DispatchLoop( void )
+///
+/// \brief  Worker thread
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarCore::LdSignalDispatcher::DispatchLoop( void )
+{
+    std::unique_lock<std::mutex> lock( mMutex );
+
+    while( true )
+    {
+        mQueueCondition.wait( lock, [this] { return mStop || !mQueue.empty(); } );
+
+        if( mStop )
+        {
+            return;
+        }
+
+        mCurrent = mQueue.front();
+        mQueue.pop_front();
+        mIsDispatching = true;
+        lock.unlock();
+
+        try
+        {
+            mCurrent.mReceiver->Callback( mCurrent.mSender, mCurrent.mSignal, nullptr );
+        }
+        catch( ... )
+        {
+            // Nobody to report to, the receiver is responsible of its own errors
+        }
+
+        lock.lock();
+        mIsDispatching = false;
+        mIdleCondition.notify_all();
+    }
+}
@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdSignalDispatcher.h
+///
+/// \brief  Declares the LdSignalDispatcher class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "LdObject.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace LeddarCore
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdSignalDispatcher.
+    ///
+    /// \brief  Executor of the queued signal connections (LdObject::CONNECTION_QUEUED).
+    ///         Callbacks are called in order from a single worker thread, so a slow receiver does not
+    ///         delay the acquisition thread. The worker thread is started on the first posted callback.
+    ///
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdSignalDispatcher
+    {
+      public:
+        static LdSignalDispatcher &GetInstance( void );
+        ~LdSignalDispatcher( void );
+
+        void Post( LdObject *aSender, LdObject *aReceiver, const LdObject::SIGNALS aSignal );
+        void Cancel( const LdObject *aObject );
+        size_t GetPendingCount( void ) const;
+
+      private:
+        struct LdPendingSignal
+        {
+            LdObject *mSender;
+            LdObject *mReceiver;
+            LdObject::SIGNALS mSignal;
+        };
+
+        LdSignalDispatcher( void );
+        LdSignalDispatcher( const LdSignalDispatcher & ) = delete;
+        LdSignalDispatcher &operator=( const LdSignalDispatcher & ) = delete;
+
+        void DispatchLoop( void );
+
+        mutable std::mutex mMutex;
+        std::condition_variable mQueueCondition;
+        std::condition_variable mIdleCondition;
+        std::deque<LdPendingSignal> mQueue;
+        LdPendingSignal mCurrent;
+        bool mIsDispatching;
+        bool mStop;
+        std::thread mThread;
+    };
+} // namespace LeddarCore
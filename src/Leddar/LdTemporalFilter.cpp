@@ -0,0 +1,439 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdTemporalFilter.cpp
+///
+/// \brief  Implements the LdTemporalFilter class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdTemporalFilter.h"
+
+#include "LdResultEchoes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+    // Rounded to the nearest, std::lround is a libm call
+    int32_t RoundDistance( float aValue ) { return aValue >= 0 ? static_cast<int32_t>( aValue + 0.5f ) : -static_cast<int32_t>( 0.5f - aValue ); }
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdTemporalFilter::LdTemporalFilter( void )
+///
+/// \brief  Constructor, the filter is disabled.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdTemporalFilter::LdTemporalFilter( void ) :
+    mMode( TF_NONE ),
+    mChannelCount( 0 ),
+    mEchoesPerChannel( 1 ),
+    mAlpha( 0.5f ),
+    mWindow( 5 ),
+    mAccelerationVariance( 0.01f ),
+    mMeasurementVariance( 0.01f ),
+    mGate( 0 ),
+    mMaxRejects( 3 ),
+    mMaxGap( 3 ),
+    mFrame( 0 )
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdTemporalFilter::SetChannels( uint32_t aChannelCount, uint32_t aEchoesPerChannel )
+///
+/// \brief  Sets the size of the state. The echoes of the channels after aChannelCount, and the echoes after
+///         aEchoesPerChannel in their channel, are not filtered.
+///
+/// \param  aChannelCount       Number of channels of the sensor.
+/// \param  aEchoesPerChannel   Number of filtered echoes per channel.
+///
+/// \exception  std::invalid_argument   Thrown when aEchoesPerChannel is 0 or above MAX_RANK.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdTemporalFilter::SetChannels( uint32_t aChannelCount, uint32_t aEchoesPerChannel )
+{
+    if( aEchoesPerChannel == 0 || aEchoesPerChannel > MAX_RANK )
+    {
+        throw std::invalid_argument( "Invalid echoes per channel." );
+    }
+
+    mChannelCount     = aChannelCount;
+    mEchoesPerChannel = aEchoesPerChannel;
+    Allocate();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdTemporalFilter::SetEma( float aAlpha )
+///
+/// \brief  Exponential moving average: estimate += aAlpha * ( distance - estimate ).
+///
+/// \param  aAlpha  Weight of the new distance, in ]0, 1].
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdTemporalFilter::SetEma( float aAlpha )
+{
+    if( !( aAlpha > 0 && aAlpha <= 1 ) )
+    {
+        throw std::invalid_argument( "Invalid moving average weight." );
+    }
+
+    mMode  = TF_EMA;
+    mAlpha = aAlpha;
+    Allocate();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdTemporalFilter::SetMedian( uint32_t aWindow )
+///
+/// \brief  Median of the last aWindow distances.
+///
+/// \param  aWindow Number of frames, 2 to MAX_WINDOW.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdTemporalFilter::SetMedian( uint32_t aWindow )
+{
+    if( aWindow < 2 || aWindow > MAX_WINDOW )
+    {
+        throw std::invalid_argument( "Invalid median window." );
+    }
+
+    mMode   = TF_MEDIAN;
+    mWindow = aWindow;
+    Allocate();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdTemporalFilter::SetKalman( float aAccelerationNoise, float aMeasurementNoise )
+///
+/// \brief  Constant velocity Kalman filter on the distance, the time unit is the frame.
+///
+/// \param  aAccelerationNoise  Standard deviation of the distance change between two frames not explained by the velocity (m / frame^2).
+/// \param  aMeasurementNoise   Standard deviation of the measured distance (m).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdTemporalFilter::SetKalman( float aAccelerationNoise, float aMeasurementNoise )
+{
+    if( !( aAccelerationNoise > 0 && std::isfinite( aAccelerationNoise ) ) || !( aMeasurementNoise > 0 && std::isfinite( aMeasurementNoise ) ) )
+    {
+        throw std::invalid_argument( "Invalid Kalman noise." );
+    }
+
+    mMode                 = TF_KALMAN;
+    mAccelerationVariance = aAccelerationNoise * aAccelerationNoise;
+    mMeasurementVariance  = aMeasurementNoise * aMeasurementNoise;
+    Allocate();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdTemporalFilter::SetOutlierGate( float aGate, uint32_t aMaxRejects )
+///
+/// \brief  Remove the echoes further than aGate from the predicted distance. After aMaxRejects consecutive removed echoes
+///         of a channel and rank, the next echo restarts the filter.
+///
+/// \param  aGate       Maximum distance from the prediction (m), 0 to keep all the echoes.
+/// \param  aMaxRejects Maximum consecutive removed echoes.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdTemporalFilter::SetOutlierGate( float aGate, uint32_t aMaxRejects )
+{
+    if( !( aGate >= 0 ) || aMaxRejects > MAX_RANK )
+    {
+        throw std::invalid_argument( "Invalid outlier gate." );
+    }
+
+    mGate       = aGate;
+    mMaxRejects = aMaxRejects;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdTemporalFilter::SetMaxGap( uint32_t aFrames )
+///
+/// \brief  A channel and rank without echo for more than aFrames frames restarts on its next echo.
+///
+/// \param  aFrames Number of frames, at least 1.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdTemporalFilter::SetMaxGap( uint32_t aFrames )
+{
+    if( aFrames == 0 )
+    {
+        throw std::invalid_argument( "Invalid maximum gap." );
+    }
+
+    mMaxGap = aFrames;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdTemporalFilter::Reset( void )
+///
+/// \brief  Forget the previous frames, the next echo of each channel and rank restarts the filter.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdTemporalFilter::Reset( void )
+{
+    mFrame = 0;
+    std::fill( mRankFrame.begin(), mRankFrame.end(), 0 );
+    std::fill( mLastFrame.begin(), mLastFrame.end(), 0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdTemporalFilter::Allocate( void )
+///
+/// \brief  Size the state arrays for the channels and the mode, and reset the state. The arrays of the other modes are released.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdTemporalFilter::Allocate( void )
+{
+    const size_t lSlots = static_cast<size_t>( mChannelCount ) * mEchoesPerChannel;
+    const bool lKalman  = mMode == TF_KALMAN;
+    const bool lMedian  = mMode == TF_MEDIAN;
+
+    mRankFrame.assign( mChannelCount, 0 );
+    mRank.assign( mChannelCount, 0 );
+    mLastFrame.assign( lSlots, 0 );
+    mRejects.assign( lSlots, 0 );
+    mEstimate.assign( lSlots, 0 );
+    std::vector<float>( lKalman ? lSlots : 0 ).swap( mVelocity );
+    std::vector<float>( lKalman ? lSlots : 0 ).swap( mP00 );
+    std::vector<float>( lKalman ? lSlots : 0 ).swap( mP01 );
+    std::vector<float>( lKalman ? lSlots : 0 ).swap( mP11 );
+    std::vector<uint8_t>( lMedian ? lSlots : 0 ).swap( mWindowCount );
+    std::vector<uint8_t>( lMedian ? lSlots : 0 ).swap( mWindowPosition );
+    std::vector<float>( lMedian ? lSlots * mWindow : 0 ).swap( mWindowValues );
+    mFrame = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn template <LeddarConnection::LdTemporalFilter::eMode tMode> uint32_t LeddarConnection::LdTemporalFilter::ApplyMode( LdEcho *aEchoes, uint32_t aCount, float aScale )
+///
+/// \brief  Apply for one mode, so the mode tests are resolved at compile time. The state arrays are read through local pointers:
+///         the stores to the echoes could otherwise alias them and force a reload for each echo.
+///
+/// \param [in,out] aEchoes The echoes.
+/// \param          aCount  Number of echoes.
+/// \param          aScale  Distance scale of the echoes.
+///
+/// \returns    The number of kept echoes.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <LeddarConnection::LdTemporalFilter::eMode tMode>
+uint32_t LeddarConnection::LdTemporalFilter::ApplyMode( LdEcho *aEchoes, uint32_t aCount, float aScale )
+{
+    uint32_t *const lRankFrame       = mRankFrame.data();
+    uint8_t *const lRanks            = mRank.data();
+    uint32_t *const lLastFrame       = mLastFrame.data();
+    uint8_t *const lRejects          = mRejects.data();
+    float *const lEstimate           = mEstimate.data();
+    float *const lVelocity           = mVelocity.data();
+    float *const lP00                = mP00.data();
+    float *const lP01                = mP01.data();
+    float *const lP11                = mP11.data();
+    uint8_t *const lWindowCount      = mWindowCount.data();
+    uint8_t *const lWindowPosition   = mWindowPosition.data();
+    float *const lWindowValues       = mWindowValues.data();
+    const uint32_t lFrame            = mFrame;
+    const uint32_t lChannelCount     = mChannelCount;
+    const uint32_t lEchoesPerChannel = mEchoesPerChannel;
+    const uint32_t lMaxGap           = mMaxGap;
+    const uint32_t lMaxRejects       = mMaxRejects;
+    const uint32_t lWindow           = mWindow;
+    const float lAlpha               = mAlpha;
+    const float lQ                   = mAccelerationVariance;
+    const float lR                   = mMeasurementVariance;
+    const float lGate                = mGate;
+    const float lInverseScale        = 1.0f / aScale;
+    uint32_t lKept                   = 0;
+
+    for( uint32_t i = 0; i < aCount; ++i )
+    {
+        LdEcho &lEcho           = aEchoes[i];
+        const uint32_t lChannel = lEcho.mChannelIndex;
+
+        if( lChannel < lChannelCount && lEcho.mDistance >= 0 )
+        {
+            const uint32_t lRank = lRankFrame[lChannel] == lFrame ? lRanks[lChannel] + 1u : 0u;
+            lRankFrame[lChannel] = lFrame;
+            lRanks[lChannel]     = static_cast<uint8_t>( std::min<uint32_t>( lRank, MAX_RANK ) );
+
+            if( lRank < lEchoesPerChannel )
+            {
+                const uint32_t lSlot   = lChannel * lEchoesPerChannel + lRank;
+                const uint32_t lFrames = lFrame - lLastFrame[lSlot];
+                const float lDistance  = static_cast<float>( lEcho.mDistance ) * lInverseScale;
+                bool lStart            = lLastFrame[lSlot] == 0 || lFrames > lMaxGap;
+
+                if( !lStart && lGate > 0 )
+                {
+                    const float lPrediction = tMode == TF_KALMAN ? lEstimate[lSlot] + lVelocity[lSlot] * static_cast<float>( lFrames ) : lEstimate[lSlot];
+
+                    if( std::fabs( lDistance - lPrediction ) > lGate )
+                    {
+                        if( lRejects[lSlot] < lMaxRejects )
+                        {
+                            // Removed, the state waits for the next frame
+                            ++lRejects[lSlot];
+                            continue;
+                        }
+
+                        lStart = true; // Too many rejections, the target really moved
+                    }
+                }
+
+                lRejects[lSlot]   = 0;
+                lLastFrame[lSlot] = lFrame;
+                float &lFiltered  = lEstimate[lSlot];
+
+                if( lStart )
+                {
+                    lFiltered = lDistance;
+
+                    if( tMode == TF_KALMAN )
+                    {
+                        // Unknown velocity, as uncertain as the distance
+                        lVelocity[lSlot] = 0;
+                        lP00[lSlot]      = lR;
+                        lP01[lSlot]      = 0;
+                        lP11[lSlot]      = lR;
+                    }
+                    else if( tMode == TF_MEDIAN )
+                    {
+                        lWindowValues[lSlot * lWindow] = lDistance;
+                        lWindowCount[lSlot]            = 1;
+                        lWindowPosition[lSlot]         = 1;
+                    }
+                }
+                else if( tMode == TF_EMA )
+                {
+                    lFiltered += lAlpha * ( lDistance - lFiltered );
+                }
+                else if( tMode == TF_MEDIAN )
+                {
+                    float *lValues     = &lWindowValues[lSlot * lWindow];
+                    uint8_t &lPosition = lWindowPosition[lSlot];
+                    uint8_t &lCount    = lWindowCount[lSlot];
+
+                    lValues[lPosition] = lDistance;
+                    lPosition          = static_cast<uint8_t>( lPosition + 1u == lWindow ? 0 : lPosition + 1 );
+                    lCount             = static_cast<uint8_t>( std::min<uint32_t>( lCount + 1u, lWindow ) );
+
+                    // Insertion sort of a copy, the window is at most MAX_WINDOW values
+                    float lSorted[MAX_WINDOW];
+
+                    for( uint32_t j = 0; j < lCount; ++j )
+                    {
+                        uint32_t k = j;
+
+                        for( ; k > 0 && lSorted[k - 1] > lValues[j]; --k )
+                        {
+                            lSorted[k] = lSorted[k - 1];
+                        }
+
+                        lSorted[k] = lValues[j];
+                    }
+
+                    lFiltered = ( lCount & 1 ) ? lSorted[lCount / 2] : 0.5f * ( lSorted[lCount / 2 - 1] + lSorted[lCount / 2] );
+                }
+                else
+                {
+                    float &lV        = lVelocity[lSlot];
+                    float &l00       = lP00[lSlot];
+                    float &l01       = lP01[lSlot];
+                    float &l11       = lP11[lSlot];
+                    const float lDt  = static_cast<float>( lFrames );
+                    const float lDt2 = lDt * lDt;
+
+                    // Prediction, white acceleration noise
+                    lFiltered += lV * lDt;
+                    l00 += lDt * ( 2 * l01 + lDt * l11 ) + lQ * lDt2 * lDt2 * 0.25f;
+                    l01 += lDt * l11 + lQ * lDt2 * lDt * 0.5f;
+                    l11 += lQ * lDt2;
+
+                    // Correction
+                    const float lGain0      = l00 / ( l00 + lR );
+                    const float lGain1      = l01 / ( l00 + lR );
+                    const float lInnovation = lDistance - lFiltered;
+                    lFiltered += lGain0 * lInnovation;
+                    lV += lGain1 * lInnovation;
+                    l11 -= lGain1 * l01;
+                    l01 *= 1 - lGain0;
+                    l00 *= 1 - lGain0;
+                }
+
+                const int32_t lNew = RoundDistance( lFiltered * aScale );
+
+                if( lEcho.mDistance > 0 && lNew != lEcho.mDistance )
+                {
+                    const float lRatio = static_cast<float>( lNew ) / static_cast<float>( lEcho.mDistance );
+                    lEcho.mX *= lRatio;
+                    lEcho.mY *= lRatio;
+                    lEcho.mZ *= lRatio;
+                }
+
+                lEcho.mDistance = lNew;
+            }
+        }
+
+        if( lKept != i )
+            aEchoes[lKept] = lEcho;
+
+        ++lKept;
+    }
+
+    return lKept;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint32_t LeddarConnection::LdTemporalFilter::Apply( LdEcho *aEchoes, uint32_t aCount, uint32_t aDistanceScale )
+///
+/// \brief  Filter the distances of a frame. The rank of an echo is its order among the echoes of its channel in the frame.
+///         The cartesian coordinates are scaled with the distance, so they stay consistent when they were already computed.
+///         Echoes with a negative distance are kept unchanged. The removed outliers are compacted out, the order is kept.
+///
+/// \param [in,out] aEchoes         The echoes.
+/// \param          aCount          Number of echoes.
+/// \param          aDistanceScale  Distance scale of the echoes.
+///
+/// \returns    The number of kept echoes.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t LeddarConnection::LdTemporalFilter::Apply( LdEcho *aEchoes, uint32_t aCount, uint32_t aDistanceScale )
+{
+    if( !IsEnabled() || aDistanceScale == 0 )
+    {
+        return aCount;
+    }
+
+    ++mFrame;
+
+    if( mFrame == 0 ) // 0 is never, restart everything on the wrap around
+    {
+        Reset();
+        mFrame = 1;
+    }
+
+    const float lScale = static_cast<float>( aDistanceScale );
+
+    switch( mMode )
+    {
+        case TF_EMA:
+            return ApplyMode<TF_EMA>( aEchoes, aCount, lScale );
+        case TF_MEDIAN:
+            return ApplyMode<TF_MEDIAN>( aEchoes, aCount, lScale );
+        default:
+            return ApplyMode<TF_KALMAN>( aEchoes, aCount, lScale );
+    }
+}
@@ -0,0 +1,95 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdTemporalFilter.h
+///
+/// \brief  Declares the LdTemporalFilter class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+namespace LeddarConnection
+{
+    struct LdEcho;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdTemporalFilter
+    ///
+    /// \brief  Frame to frame smoothing of the echo distances, keyed by channel index and echo rank (order of the echo in its channel).
+    ///         The state of each channel / rank is kept in flat arrays (one per field) sized from the channel count.
+    ///         With an outlier gate, the echoes too far from the prediction are removed, until maxRejects consecutive
+    ///         rejections restart the state on the new distance.
+    ///
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdTemporalFilter
+    {
+    public:
+        enum eMode
+        {
+            TF_NONE   = 0, ///< Disabled
+            TF_EMA    = 1, ///< Exponential moving average
+            TF_MEDIAN = 2, ///< Median of the last N distances
+            TF_KALMAN = 3  ///< Constant velocity Kalman filter
+        };
+
+        enum
+        {
+            MAX_WINDOW = 15, ///< Maximum median window
+            MAX_RANK   = 255 ///< Maximum echoes per channel
+        };
+
+        LdTemporalFilter( void );
+
+        void SetChannels( uint32_t aChannelCount, uint32_t aEchoesPerChannel );
+        void SetEma( float aAlpha );
+        void SetMedian( uint32_t aWindow );
+        void SetKalman( float aAccelerationNoise, float aMeasurementNoise );
+        void SetOutlierGate( float aGate, uint32_t aMaxRejects );
+        void SetMaxGap( uint32_t aFrames );
+        void Disable( void ) { mMode = TF_NONE; }
+        void Reset( void );
+
+        eMode GetMode( void ) const { return mMode; }
+        uint32_t GetChannelCount( void ) const { return mChannelCount; }
+        uint32_t GetEchoesPerChannel( void ) const { return mEchoesPerChannel; }
+        float GetAlpha( void ) const { return mAlpha; }
+        uint32_t GetWindow( void ) const { return mWindow; }
+        float GetGate( void ) const { return mGate; }
+        bool IsEnabled( void ) const { return mMode != TF_NONE && mChannelCount != 0; }
+
+        uint32_t Apply( LdEcho *aEchoes, uint32_t aCount, uint32_t aDistanceScale );
+
+    private:
+        void Allocate( void );
+        template <eMode tMode> uint32_t ApplyMode( LdEcho *aEchoes, uint32_t aCount, float aScale );
+
+        eMode mMode;
+        uint32_t mChannelCount;
+        uint32_t mEchoesPerChannel;
+        float mAlpha;
+        uint32_t mWindow;
+        float mAccelerationVariance;
+        float mMeasurementVariance;
+        float mGate;
+        uint32_t mMaxRejects;
+        uint32_t mMaxGap;
+
+        uint32_t mFrame;
+        std::vector<uint32_t> mRankFrame; ///< Per channel, frame of the last echo of the channel
+        std::vector<uint8_t> mRank;       ///< Per channel, rank of the last echo of the channel
+
+        // Per channel and rank (slot = channel * mEchoesPerChannel + rank)
+        std::vector<uint32_t> mLastFrame;     ///< Frame of the last update, 0 for never
+        std::vector<uint8_t> mRejects;        ///< Consecutive removed echoes
+        std::vector<float> mEstimate;         ///< Filtered distance (m)
+        std::vector<float> mVelocity;         ///< TF_KALMAN: distance change per frame (m)
+        std::vector<float> mP00, mP01, mP11;  ///< TF_KALMAN: covariance
+        std::vector<uint8_t> mWindowCount;    ///< TF_MEDIAN: number of distances in the window
+        std::vector<uint8_t> mWindowPosition; ///< TF_MEDIAN: next position in the window
+        std::vector<float> mWindowValues;     ///< TF_MEDIAN: mWindow distances per slot
+    };
+} // namespace LeddarConnection
@@ -0,0 +1,310 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdVoxelGrid.cpp
+///
+/// \brief  Implements the LdVoxelGrid class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdVoxelGrid.h"
+
+#include "LdResultEchoes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+    const uint32_t KEY_BITS        = 21; ///< Bits of each voxel index in the key
+    const float KEY_OFFSET         = static_cast<float>( 1 << ( KEY_BITS - 1 ) );
+    const uint64_t KEY_MASK        = ( 1ull << KEY_BITS ) - 1;
+    const uint32_t MIN_TABLE_BITS  = 6;
+    const uint64_t HASH_MULTIPLIER = 0x9E3779B97F4A7C15ull;
+
+    // Voxel index of a coordinate, saturated to the key range (also for nan). The floor is done with integers, std::floor is a libm call without SSE4.1
+    uint64_t GetIndex( float aValue, float aInverseSize )
+    {
+        const float lScaled = aValue * aInverseSize;
+
+        if( !( lScaled > -KEY_OFFSET ) )
+            return 0;
+
+        if( lScaled >= KEY_OFFSET )
+            return KEY_MASK;
+
+        int32_t lIndex = static_cast<int32_t>( lScaled );
+        lIndex -= static_cast<float>( lIndex ) > lScaled;
+        return static_cast<uint64_t>( lIndex + static_cast<int32_t>( KEY_OFFSET ) );
+    }
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdVoxelGrid::LdVoxelGrid( void )
+///
+/// \brief  Constructor, without voxels nor region of interest the echoes are kept.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdVoxelGrid::LdVoxelGrid( void ) :
+    mVoxelSize{ 0, 0, 0 },
+    mInverseSize{ 0, 0, 0 },
+    mPolicy( VP_CENTROID ),
+    mHasRoi( false ),
+    mRoiMin{ 0, 0, 0 },
+    mRoiMax{ 0, 0, 0 },
+    mShift( 64 ),
+    mGeneration( 0 )
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdVoxelGrid::SetVoxelSize( float aSizeX, float aSizeY, float aSizeZ )
+///
+/// \brief  Sets the size of the voxels, 0 for the three axes to only apply the region of interest.
+///
+/// \param  aSizeX  Size along x (m).
+/// \param  aSizeY  Size along y (m).
+/// \param  aSizeZ  Size along z (m).
+///
+/// \exception  std::invalid_argument   Thrown when a size is negative, or only some sizes are 0.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdVoxelGrid::SetVoxelSize( float aSizeX, float aSizeY, float aSizeZ )
+{
+    const float lSizes[3] = { aSizeX, aSizeY, aSizeZ };
+    const bool lNoVoxel   = aSizeX == 0 && aSizeY == 0 && aSizeZ == 0;
+
+    for( size_t i = 0; i < 3; ++i )
+    {
+        if( !lNoVoxel && !( lSizes[i] > 0 && std::isfinite( lSizes[i] ) ) )
+        {
+            throw std::invalid_argument( "Invalid voxel size." );
+        }
+
+        mVoxelSize[i]   = lSizes[i];
+        mInverseSize[i] = lNoVoxel ? 0 : 1.0f / lSizes[i];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdVoxelGrid::SetPolicy( ePolicy aPolicy )
+///
+/// \brief  Sets how the echoes of a voxel are reduced to one echo.
+///
+/// \param  aPolicy The policy.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdVoxelGrid::SetPolicy( ePolicy aPolicy )
+{
+    if( aPolicy != VP_CENTROID && aPolicy != VP_MAX_AMPLITUDE && aPolicy != VP_NEAREST )
+    {
+        throw std::invalid_argument( "Invalid voxel policy." );
+    }
+
+    mPolicy = aPolicy;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdVoxelGrid::SetRoi( float aMinX, float aMaxX, float aMinY, float aMaxY, float aMinZ, float aMaxZ )
+///
+/// \brief  Keep only the echoes in a box, bounds included. Use infinity for an open side.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdVoxelGrid::SetRoi( float aMinX, float aMaxX, float aMinY, float aMaxY, float aMinZ, float aMaxZ )
+{
+    if( !( aMinX <= aMaxX ) || !( aMinY <= aMaxY ) || !( aMinZ <= aMaxZ ) )
+    {
+        throw std::invalid_argument( "Invalid region of interest." );
+    }
+
+    mRoiMin[0] = aMinX;
+    mRoiMin[1] = aMinY;
+    mRoiMin[2] = aMinZ;
+    mRoiMax[0] = aMaxX;
+    mRoiMax[1] = aMaxY;
+    mRoiMax[2] = aMaxZ;
+    mHasRoi    = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarConnection::LdVoxelGrid::IsInRoi( const LdEcho &aEcho ) const
+///
+/// \brief  Is the echo in the region of interest (true without region of interest)
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarConnection::LdVoxelGrid::IsInRoi( const LdEcho &aEcho ) const
+{
+    return !mHasRoi || ( ( aEcho.mX >= mRoiMin[0] ) & ( aEcho.mX <= mRoiMax[0] ) & ( aEcho.mY >= mRoiMin[1] ) & ( aEcho.mY <= mRoiMax[1] ) & ( aEcho.mZ >= mRoiMin[2] ) &
+                         ( aEcho.mZ <= mRoiMax[2] ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint64_t LeddarConnection::LdVoxelGrid::GetKey( const LdEcho &aEcho ) const
+///
+/// \brief  Key of the voxel of the echo: the 3 voxel indexes on 21 bits
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t LeddarConnection::LdVoxelGrid::GetKey( const LdEcho &aEcho ) const
+{
+    return GetIndex( aEcho.mX, mInverseSize[0] ) | ( GetIndex( aEcho.mY, mInverseSize[1] ) << KEY_BITS ) | ( GetIndex( aEcho.mZ, mInverseSize[2] ) << ( 2 * KEY_BITS ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdVoxelGrid::PrepareTable( uint32_t aCount )
+///
+/// \brief  Empty the hash table for a new frame, by changing the generation. The table is at most half full.
+///
+/// \param  aCount  Number of echoes of the frame.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdVoxelGrid::PrepareTable( uint32_t aCount )
+{
+    uint32_t lBits = MIN_TABLE_BITS;
+
+    while( ( 1ull << lBits ) < 2ull * aCount )
+    {
+        ++lBits;
+    }
+
+    if( mTable.size() < ( 1ull << lBits ) )
+    {
+        mTable.assign( 1ull << lBits, sSlot{ 0, 0, 0 } );
+        mShift      = 64 - lBits;
+        mGeneration = 0;
+    }
+
+    if( ++mGeneration == 0 )
+    {
+        for( sSlot &lSlot : mTable )
+        {
+            lSlot.mGeneration = 0;
+        }
+
+        mGeneration = 1;
+    }
+
+    if( mPolicy == VP_CENTROID && mSums.size() < aCount )
+    {
+        mSums.resize( aCount );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint32_t LeddarConnection::LdVoxelGrid::Reduce( LdEcho *aEchoes, uint32_t aCount )
+///
+/// \brief  Reduce the echoes in place. The echoes with a negative distance have no cartesian coordinates and are removed.
+///
+/// \param [in,out] aEchoes The echoes, with their cartesian coordinates.
+/// \param          aCount  Number of echoes.
+///
+/// \returns    The number of echoes after the reduction.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t LeddarConnection::LdVoxelGrid::Reduce( LdEcho *aEchoes, uint32_t aCount )
+{
+    if( !HasVoxels() )
+    {
+        LdEcho *lEnd = std::remove_if( aEchoes, aEchoes + aCount, [this]( const LdEcho &aEcho ) { return aEcho.mDistance < 0 || !IsInRoi( aEcho ); } );
+        return static_cast<uint32_t>( lEnd - aEchoes );
+    }
+
+    PrepareTable( aCount );
+
+    const uint64_t lMask = mTable.size() - 1;
+    sSlot *lTable        = mTable.data();
+    uint32_t lOutput     = 0;
+
+    for( uint32_t i = 0; i < aCount; ++i )
+    {
+        // The output index is never after i, so the echo is read before it can be overwritten
+        const LdEcho lEcho = aEchoes[i];
+
+        if( lEcho.mDistance < 0 || !IsInRoi( lEcho ) )
+        {
+            continue;
+        }
+
+        const uint64_t lKey = GetKey( lEcho );
+        uint64_t lIndex     = ( lKey * HASH_MULTIPLIER ) >> mShift;
+
+        while( lTable[lIndex].mGeneration == mGeneration && lTable[lIndex].mKey != lKey )
+        {
+            lIndex = ( lIndex + 1 ) & lMask;
+        }
+
+        sSlot &lSlot = lTable[lIndex];
+
+        if( lSlot.mGeneration != mGeneration )
+        {
+            // First echo of the voxel
+            lSlot.mKey        = lKey;
+            lSlot.mOutput     = lOutput;
+            lSlot.mGeneration = mGeneration;
+            aEchoes[lOutput]  = lEcho;
+
+            if( mPolicy == VP_CENTROID )
+            {
+                mSums[lOutput] = sSum{ lEcho.mX, lEcho.mY, lEcho.mZ, static_cast<double>( lEcho.mDistance ), static_cast<double>( lEcho.mAmplitude ), 1 };
+            }
+
+            ++lOutput;
+            continue;
+        }
+
+        LdEcho &lVoxel = aEchoes[lSlot.mOutput];
+
+        switch( mPolicy )
+        {
+            case VP_CENTROID:
+            {
+                sSum &lSum = mSums[lSlot.mOutput];
+                lSum.mX += lEcho.mX;
+                lSum.mY += lEcho.mY;
+                lSum.mZ += lEcho.mZ;
+                lSum.mDistance += lEcho.mDistance;
+                lSum.mAmplitude += lEcho.mAmplitude;
+                ++lSum.mCount;
+                break;
+            }
+
+            case VP_MAX_AMPLITUDE:
+                if( lEcho.mAmplitude > lVoxel.mAmplitude )
+                    lVoxel = lEcho;
+
+                break;
+
+            case VP_NEAREST:
+                if( lEcho.mDistance < lVoxel.mDistance )
+                    lVoxel = lEcho;
+
+                break;
+        }
+    }
+
+    if( mPolicy == VP_CENTROID )
+    {
+        for( uint32_t i = 0; i < lOutput; ++i )
+        {
+            const sSum &lSum = mSums[i];
+
+            if( lSum.mCount > 1 )
+            {
+                aEchoes[i].mX         = static_cast<float>( lSum.mX / lSum.mCount );
+                aEchoes[i].mY         = static_cast<float>( lSum.mY / lSum.mCount );
+                aEchoes[i].mZ         = static_cast<float>( lSum.mZ / lSum.mCount );
+                aEchoes[i].mDistance  = static_cast<int32_t>( std::lround( lSum.mDistance / lSum.mCount ) );
+                aEchoes[i].mAmplitude = static_cast<uint32_t>( std::lround( lSum.mAmplitude / lSum.mCount ) );
+            }
+        }
+    }
+
+    return lOutput;
+}
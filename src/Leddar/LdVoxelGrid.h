@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdVoxelGrid.h
+///
+/// \brief  Declares the LdVoxelGrid class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+namespace LeddarConnection
+{
+    struct LdEcho;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdVoxelGrid
+    ///
+    /// \brief  Spatial downsampling of the echoes on their cartesian coordinates: an optional axis aligned region of
+    ///         interest, then one echo per voxel. The echoes are reduced in place, in the order of the first echo of each voxel.
+    ///         The voxels are found with an open addressing hash table kept from one frame to the next, it is only
+    ///         reallocated when a frame has more echoes than the previous ones.
+    ///
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdVoxelGrid
+    {
+    public:
+        enum ePolicy
+        {
+            VP_CENTROID      = 0, ///< Mean of the coordinates, distance and amplitude, the other fields of the first echo
+            VP_MAX_AMPLITUDE = 1, ///< Echo with the highest amplitude
+            VP_NEAREST       = 2  ///< Echo with the shortest distance
+        };
+
+        LdVoxelGrid( void );
+
+        void SetVoxelSize( float aSize ) { SetVoxelSize( aSize, aSize, aSize ); }
+        void SetVoxelSize( float aSizeX, float aSizeY, float aSizeZ );
+        void SetPolicy( ePolicy aPolicy );
+        void SetRoi( float aMinX, float aMaxX, float aMinY, float aMaxY, float aMinZ, float aMaxZ );
+        void ClearRoi( void ) { mHasRoi = false; }
+
+        const float *GetVoxelSize( void ) const { return mVoxelSize; } ///< x, y, z sizes, 0 without voxels
+        ePolicy GetPolicy( void ) const { return mPolicy; }
+        bool HasRoi( void ) const { return mHasRoi; }
+        bool HasVoxels( void ) const { return mVoxelSize[0] > 0; }
+        bool IsEnabled( void ) const { return HasVoxels() || mHasRoi; }
+
+        uint32_t Reduce( LdEcho *aEchoes, uint32_t aCount );
+
+    private:
+        struct sSlot
+        {
+            uint64_t mKey;
+            uint32_t mOutput;     ///< Index of the voxel echo
+            uint32_t mGeneration; ///< The slot is used if equal to mGeneration
+        };
+
+        struct sSum
+        {
+            double mX, mY, mZ, mDistance, mAmplitude;
+            uint32_t mCount;
+        };
+
+        bool IsInRoi( const LdEcho &aEcho ) const;
+        uint64_t GetKey( const LdEcho &aEcho ) const;
+        void PrepareTable( uint32_t aCount );
+
+        float mVoxelSize[3];
+        float mInverseSize[3];
+        ePolicy mPolicy;
+        bool mHasRoi;
+        float mRoiMin[3];
+        float mRoiMax[3];
+
+        std::vector<sSlot> mTable;
+        uint32_t mShift;
+        uint32_t mGeneration;
+        std::vector<sSum> mSums; ///< Per output echo, VP_CENTROID only
+    };
+} // namespace LeddarConnection
@@ -0,0 +1,192 @@
+// *****************************************************************************
+// Module..: LeddarBench
+//
+/// \file    BenchCanBurst.cpp
+///
+/// \brief   Block read throughput of LdConnectionUniversalCan against a loopback CAN device.
+///          Frames reach the bus after the adapter (USB) latency and take the time of a 1 Mbit/s bus,
+///          the device answers VU_CMD_READ_DATA requests after a processing time.
+///          "can-burst/window-N" reads 512 bytes with N requests in flight,
+///          "can-burst-lossy" drops one read answer out of 40 to exercise the retransmission.
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LeddarBench.h"
+
+#include "LtDefines.h"
+
+#if defined( BUILD_CANBUS ) && defined( BUILD_CANBUS_KOMODO )
+
+#include "LdConnectionInfoCan.h"
+#include "LdConnectionUniversalCan.h"
+#include "LdConnectionUniversalDefines.h"
+#include "LdInterfaceCan.h"
+
+#include "comm/Canbus/LtComVuCanbus.h"
+
+#include <cstring>
+#include <deque>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+    const uint32_t gReadSize  = 512;
+    const uint32_t gReadCount = 20;
+    const auto gFrameDuration = std::chrono::microseconds( 130 ); // ~110 bits at 1 Mbit/s
+    const auto gHostLatency   = std::chrono::microseconds( 250 ); // Adapter latency, each direction
+    const auto gDeviceLatency = std::chrono::microseconds( 150 );
+
+    class LdBenchCanDevice : public LeddarConnection::LdInterfaceCan
+    {
+      public:
+        LdBenchCanDevice( const LeddarConnection::LdConnectionInfoCan *aConnectionInfo, uint32_t aDropPeriod ) :
+            LdInterfaceCan( aConnectionInfo ),
+            mDropPeriod( aDropPeriod ),
+            mAnswerCount( 0 ),
+            mBaseAddress( 0 ),
+            mBusFree( std::chrono::steady_clock::now() ),
+            mDeviceFree( mBusFree )
+        {
+        }
+
+        void Connect( void ) override { mIsConnected = true; }
+        void Disconnect( void ) override { mIsConnected = false; }
+
+        bool Read( const LdInterfaceCan *aRequestingInterface ) override
+        {
+            if( mAnswers.empty() || mAnswers.front().mReady > std::chrono::steady_clock::now() )
+            {
+                return false;
+            }
+
+            std::vector<uint8_t> lData( mAnswers.front().mData, mAnswers.front().mData + LtComCanBus::CAN_DATA_SIZE );
+            mAnswers.pop_front();
+            const LeddarConnection::LdConnectionInfoCan *lInfo = dynamic_cast<const LeddarConnection::LdConnectionInfoCan *>( GetConnectionInfo() );
+            return ForwardDataMaster( lInfo->GetBaseIdTx(), lData ) == aRequestingInterface;
+        }
+
+        void Write( uint16_t, const std::vector<uint8_t> &aData ) override
+        {
+            // Request on the bus, processed by the device, answer on the bus
+            auto lRequestEnd  = std::max( std::chrono::steady_clock::now() + gHostLatency, mBusFree ) + gFrameDuration;
+            mDeviceFree       = std::max( lRequestEnd, mDeviceFree ) + gDeviceLatency;
+            auto lAnswerEnd   = std::max( mDeviceFree, lRequestEnd ) + gFrameDuration;
+            mBusFree          = lRequestEnd;
+
+            sAnswer lAnswer;
+            memcpy( lAnswer.mData, aData.data(), LtComCanBus::CAN_DATA_SIZE );
+            lAnswer.mReady = lAnswerEnd + gHostLatency;
+
+            if( aData[0] == LtComCanBus::VU_CMD_SET_BASE_ADDRESS )
+            {
+                memcpy( &mBaseAddress, &aData[4], sizeof( mBaseAddress ) );
+            }
+            else if( aData[0] == LtComCanBus::VU_CMD_READ_DATA )
+            {
+                uint32_t lAddress = mBaseAddress | ( aData[2] | ( aData[3] << 8 ) );
+
+                for( uint8_t i = 0; i < aData[1] && i < 4; ++i )
+                {
+                    lAnswer.mData[4 + i] = static_cast<uint8_t>( ( lAddress + i ) * 7 );
+                }
+            }
+
+            if( aData[0] == LtComCanBus::VU_CMD_READ_DATA && mDropPeriod != 0 && ++mAnswerCount % mDropPeriod == 0 )
+            {
+                return;
+            }
+
+            // Answers are sent in the order the device processed the requests
+            mAnswers.push_back( lAnswer );
+        }
+
+        bool WriteAndWaitForAnswer( uint16_t aId, const std::vector<uint8_t> &aData ) override
+        {
+            Write( aId, aData );
+            auto lTimeout = std::chrono::steady_clock::now() + std::chrono::milliseconds( 100 );
+
+            while( !Read( this ) )
+            {
+                if( std::chrono::steady_clock::now() > lTimeout )
+                {
+                    return false;
+                }
+
+                std::this_thread::yield();
+            }
+
+            return true;
+        }
+
+      private:
+        struct sAnswer
+        {
+            uint8_t mData[LtComCanBus::CAN_DATA_SIZE];
+            std::chrono::steady_clock::time_point mReady;
+        };
+
+        uint32_t mDropPeriod;
+        uint32_t mAnswerCount;
+        uint32_t mBaseAddress;
+        std::chrono::steady_clock::time_point mBusFree;
+        std::chrono::steady_clock::time_point mDeviceFree;
+        std::deque<sAnswer> mAnswers;
+    };
+
+    void RunBurst( const std::string &aName, uint8_t aWindow, uint32_t aDropPeriod )
+    {
+        LeddarConnection::LdConnectionInfoCan lInfo( LeddarConnection::LdConnectionInfo::CT_CAN_KOMODO, "LeddarBench", 0 );
+        LdBenchCanDevice lDevice( &lInfo, aDropPeriod );
+        lDevice.Connect();
+
+        LeddarConnection::LdConnectionUniversalCan lConnection( &lInfo, &lDevice );
+        lConnection.SetReadWindow( aWindow );
+
+        uint8_t *lInput, *lOutput;
+        lConnection.InternalBuffers( lInput, lOutput );
+        const uint32_t lAddress = 0x0001FF00; // Crosses a base address boundary
+
+        LeddarBench::LdBenchTimer lTimer;
+
+        for( uint32_t i = 0; i < gReadCount; ++i )
+        {
+            lConnection.Read( REGMAP_READ, lAddress, gReadSize );
+
+            for( uint32_t j = 0; j < gReadSize; ++j )
+            {
+                if( lOutput[j] != static_cast<uint8_t>( ( lAddress + j ) * 7 ) )
+                {
+                    throw std::runtime_error( aName + ": wrong data at offset " + std::to_string( j ) );
+                }
+            }
+        }
+
+        double lSeconds = lTimer.ElapsedNs() / 1e9;
+        LeddarBench::Report( aName, gReadCount * gReadSize / lSeconds / 1024.0, "KiB/s" );
+
+        if( aDropPeriod != 0 )
+        {
+            LeddarBench::Report( aName + "/retransmissions", lConnection.GetRetransmissionCount(), "segments" );
+        }
+    }
+} // namespace
+
+void LeddarBench::BenchCanBurst( void )
+{
+    RunBurst( "can-burst/window-1", 1, 0 );
+    RunBurst( "can-burst/window-4", 4, 0 );
+    RunBurst( "can-burst/window-16", 16, 0 );
+    RunBurst( "can-burst-lossy/window-16", 16, 40 );
+}
+
+#else
+
+void LeddarBench::BenchCanBurst( void )
+{
+}
+
+#endif
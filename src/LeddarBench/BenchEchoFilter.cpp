@@ -0,0 +1,166 @@
+// *****************************************************************************
+// Module..: LeddarBench
+//
+/// \file    BenchEchoFilter.cpp
+///
+/// \brief   Echo filter of the decode path on a synthetic 96 x 8 channels, 6 echoes per channel frame
+///          (valid flag, 0.5 to 50 m, minimum amplitude, columns 16 to 79).
+///          "echo-filter/compact" is LdEchoFilter::Apply, "/compact/mask-copy" is the consumer side filtering with the
+///          same criteria (mask of the kept echoes, then copy to another array).
+///          "echo-filter/pipeline" is the decode end (swap) followed by the point cloud build of the valid echoes,
+///          "/unfiltered" without filter and "/filtered" with the filter set on the result.
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LeddarBench.h"
+
+#include "LdEchoFilter.h"
+#include "LdPointCloudBuilder.h"
+#include "LdResultEchoes.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+    const uint16_t gHChan          = 96;
+    const uint16_t gVChan          = 8;
+    const uint32_t gEchoesPerChan  = 6;
+    const uint32_t gEchoes         = gHChan * gVChan * gEchoesPerChan;
+    const uint32_t gDistanceScale  = 65536;
+    const uint32_t gAmplitudeScale = 64;
+    const uint32_t gFrames         = 2000;
+
+    void FillFrame( LeddarConnection::LdEcho *aEchoes, uint32_t aFrame )
+    {
+        for( uint32_t i = 0; i < gEchoes; ++i )
+        {
+            LeddarConnection::LdEcho &lEcho = aEchoes[i];
+            lEcho.mChannelIndex             = static_cast<uint16_t>( i / gEchoesPerChan );
+            lEcho.mDistance                 = static_cast<int32_t>( ( ( i * 7919u + aFrame * 31u ) % ( 80u * gDistanceScale ) ) );
+            lEcho.mAmplitude                = ( i * 11 + aFrame ) % ( 64 * gAmplitudeScale );
+            lEcho.mBase                     = 0;
+            lEcho.mFlag                     = ( i % 3 == 0 ) ? 0 : 1; // Two thirds are valid
+            lEcho.mTimestamp                = aFrame;
+            lEcho.mX                        = i * 0.01f;
+            lEcho.mY                        = i * 0.02f;
+            lEcho.mZ                        = i * 0.03f;
+        }
+    }
+
+    LeddarConnection::LdEchoFilter MakeFilter( void )
+    {
+        LeddarConnection::LdEchoFilter lFilter;
+        lFilter.SetFlags( 0x01 );
+        lFilter.SetDistanceRange( 0.5f, 50.0f );
+        lFilter.SetMinAmplitude( 4.0f );
+        lFilter.SetChannelRoi( gHChan, 16, 79, 0, gVChan - 1 );
+        return lFilter;
+    }
+
+    bool KeepReference( const LeddarConnection::LdEcho &aEcho )
+    {
+        const uint16_t lColumn = aEcho.mChannelIndex % gHChan;
+        return ( aEcho.mFlag & 0x01 ) != 0 && aEcho.mDistance >= static_cast<int32_t>( gDistanceScale / 2 ) &&
+               aEcho.mDistance <= static_cast<int32_t>( 50 * gDistanceScale ) && aEcho.mAmplitude >= 4 * gAmplitudeScale && lColumn >= 16 && lColumn <= 79;
+    }
+
+    void BenchCompaction( void )
+    {
+        const LeddarConnection::LdEchoFilter lFilter = MakeFilter();
+        std::vector<LeddarConnection::LdEcho> lSource( gEchoes ), lFiltered( gEchoes ), lCopy;
+        std::vector<bool> lMask( gEchoes );
+        double lFilterNs = 0, lCopyNs = 0;
+        uint64_t lKept = 0;
+
+        for( uint32_t lFrame = 0; lFrame < gFrames; ++lFrame )
+        {
+            FillFrame( lSource.data(), lFrame );
+            memcpy( lFiltered.data(), lSource.data(), gEchoes * sizeof( LeddarConnection::LdEcho ) );
+
+            LeddarBench::LdBenchTimer lTimer;
+            const uint32_t lCount = lFilter.Apply( lFiltered.data(), gEchoes, gDistanceScale, gAmplitudeScale );
+            lFilterNs += lTimer.ElapsedNs();
+
+            // Consumer side filtering: mask of the kept echoes, then copy to another array
+            lTimer.Restart();
+
+            for( uint32_t i = 0; i < gEchoes; ++i )
+            {
+                lMask[i] = KeepReference( lSource[i] );
+            }
+
+            lCopy.clear();
+
+            for( uint32_t i = 0; i < gEchoes; ++i )
+            {
+                if( lMask[i] )
+                {
+                    lCopy.push_back( lSource[i] );
+                }
+            }
+
+            lCopyNs += lTimer.ElapsedNs();
+
+            if( lCount != lCopy.size() || memcmp( lFiltered.data(), lCopy.data(), lCount * sizeof( LeddarConnection::LdEcho ) ) != 0 )
+            {
+                throw std::runtime_error( "echo-filter: compaction differs from the reference" );
+            }
+
+            lKept += lCount;
+        }
+
+        LeddarBench::Report( "echo-filter/compact", lFilterNs / gFrames / 1000.0, "us/frame" );
+        LeddarBench::Report( "echo-filter/compact/throughput", static_cast<double>( gEchoes ) * gFrames / ( lFilterNs / 1e9 ) / 1e6, "Mechoes/s" );
+        LeddarBench::Report( "echo-filter/compact/mask-copy", lCopyNs / gFrames / 1000.0, "us/frame" );
+        LeddarBench::Report( "echo-filter/kept", 100.0 * lKept / ( static_cast<double>( gEchoes ) * gFrames ), "%" );
+    }
+
+    double RunPipeline( const LeddarConnection::LdEchoFilter &aFilter, uint64_t &aPoints )
+    {
+        LeddarConnection::LdResultEchoes lEchoes;
+        lEchoes.Init( gDistanceScale, gAmplitudeScale, gEchoes );
+        lEchoes.SetFilter( aFilter );
+        LeddarConnection::LdPointCloudBuilder lBuilder;
+        double lNs = 0;
+
+        for( uint32_t lFrame = 0; lFrame < gFrames; ++lFrame )
+        {
+            {
+                auto lLock = lEchoes.GetUniqueLock( LeddarConnection::B_SET );
+                FillFrame( lEchoes.GetEchoes( LeddarConnection::B_SET )->data(), lFrame );
+                lEchoes.SetEchoCount( gEchoes );
+            }
+
+            LeddarBench::LdBenchTimer lTimer;
+            lEchoes.Swap();
+            aPoints += lBuilder.Fill( &lEchoes );
+            lNs += lTimer.ElapsedNs();
+        }
+
+        return lNs;
+    }
+} // namespace
+
+void LeddarBench::BenchEchoFilter( void )
+{
+    BenchCompaction();
+
+    uint64_t lUnfilteredPoints = 0, lFilteredPoints = 0;
+    const double lUnfilteredNs = RunPipeline( LeddarConnection::LdEchoFilter(), lUnfilteredPoints );
+    const double lFilteredNs   = RunPipeline( MakeFilter(), lFilteredPoints );
+
+    if( lFilteredPoints == 0 || lFilteredPoints >= lUnfilteredPoints )
+    {
+        throw std::runtime_error( "echo-filter: the filter did not remove echoes" );
+    }
+
+    Report( "echo-filter/pipeline/unfiltered", lUnfilteredNs / gFrames / 1000.0, "us/frame" );
+    Report( "echo-filter/pipeline/unfiltered/points", static_cast<double>( lUnfilteredPoints ) / gFrames, "points/frame" );
+    Report( "echo-filter/pipeline/filtered", lFilteredNs / gFrames / 1000.0, "us/frame" );
+    Report( "echo-filter/pipeline/filtered/points", static_cast<double>( lFilteredPoints ) / gFrames, "points/frame" );
+}
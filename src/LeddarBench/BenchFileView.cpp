@@ -0,0 +1,278 @@
+// *****************************************************************************
+// Module..: LeddarBench
+//
+/// \file    BenchFileView.cpp
+///
+/// \brief   Loading of firmware bundles from a warm page cache, on a generated 12 MiB ltb file
+///          (6 MiB DSP, 4 MiB FPGA data, 2 MiB FPGA algo) and a 64 KiB Intel HEX image.
+///          "file-view/ltb/open" is the LtLtbReader constructor (file view, headers only),
+///          "file-view/ltb/one-firmware" adds the copy of the FPGA data, "file-view/ltb/all" the copy of
+///          all the firmwares (GetFirmwares) and "file-view/ltb/stream" is the previous ifstream reader.
+///          "/resident" is the growth of the resident memory while the reader is alive (Linux only).
+///          "file-view/hex/load" is LoadHex, "file-view/hex/stream" the previous std::istream load.
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LeddarBench.h"
+
+#include "LtFileUtils.h"
+#include "LtIntelHex.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <malloc.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    typedef LeddarUtils::LtFileUtils::LtLtbReader LtLtbReader;
+
+    const uint32_t gDspSize      = 6 * 1024 * 1024;
+    const uint32_t gFpgaDataSize = 4 * 1024 * 1024;
+    const uint32_t gFpgaAlgoSize = 2 * 1024 * 1024;
+    const uint32_t gIterations   = 20;
+
+#pragma pack( push, 1 )
+    struct LdBenchLtbHeader // LtLtbReader::LtElementHeader
+    {
+        uint32_t mId;
+        uint32_t mUnitSize;
+        uint32_t mCount;
+        uint32_t mFlags;
+    };
+#pragma pack( pop )
+
+    void WriteSection( std::ofstream &aFile, uint32_t aId, uint32_t aSize )
+    {
+        LdBenchLtbHeader lHeader = { aId, 1, aSize, 0 };
+        aFile.write( reinterpret_cast<const char *>( &lHeader ), sizeof( lHeader ) );
+        std::vector<char> lData( aSize );
+
+        for( uint32_t i = 0; i < aSize; ++i )
+        {
+            lData[i] = static_cast<char>( ( i * 31 + aId ) >> 3 );
+        }
+
+        aFile.write( lData.data(), aSize );
+    }
+
+    void WriteLtb( const std::string &aFileName )
+    {
+        std::ofstream lFile( aFileName.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+        const uint32_t lSignature[2] = { LtLtbReader::LTB_SIGNATURE, LtLtbReader::LT_DOCUMENT_VERSION_SDK_POST_DOUBLE_BUFFER_REWORK };
+        lFile.write( reinterpret_cast<const char *>( lSignature ), sizeof( lSignature ) );
+
+        const uint32_t lContentSize = 3 * sizeof( LdBenchLtbHeader ) + gDspSize + gFpgaDataSize + gFpgaAlgoSize + sizeof( LdBenchLtbHeader ) + sizeof( uint16_t );
+        LdBenchLtbHeader lSection = { LtLtbReader::ID_LTB_FIRMWARE_SECTION, lContentSize, 1, 1 };
+        lFile.write( reinterpret_cast<const char *>( &lSection ), sizeof( lSection ) );
+
+        LdBenchLtbHeader lDeviceType = { LtLtbReader::ID_LTB_DEVICE_TYPE, sizeof( uint16_t ), 1, 0 };
+        const uint16_t lType = 0x0D;
+        lFile.write( reinterpret_cast<const char *>( &lDeviceType ), sizeof( lDeviceType ) );
+        lFile.write( reinterpret_cast<const char *>( &lType ), sizeof( lType ) );
+
+        WriteSection( lFile, LtLtbReader::ID_LTB_GALAXY_BINARY, gDspSize );
+        WriteSection( lFile, LtLtbReader::ID_LTB_FPGA_DATA, gFpgaDataSize );
+        WriteSection( lFile, LtLtbReader::ID_LTB_FPGA_ALGO, gFpgaAlgoSize );
+
+        if( !lFile )
+        {
+            throw std::runtime_error( "file-view: cannot write " + aFileName );
+        }
+    }
+
+    void WriteHex( const std::string &aFileName )
+    {
+        std::ofstream lFile( aFileName.c_str(), std::ios_base::out | std::ios_base::trunc );
+
+        for( uint32_t lAddress = 0; lAddress < 65536; lAddress += 32 )
+        {
+            uint32_t lSum = 32 + ( lAddress >> 8 ) + ( lAddress & 0xFF );
+            char lRecord[16 + 2 * 32];
+            int lLength = snprintf( lRecord, sizeof( lRecord ), ":20%04X00", lAddress );
+
+            for( uint32_t i = 0; i < 32; ++i )
+            {
+                uint8_t lByte = static_cast<uint8_t>( ( lAddress + i ) * 7 );
+                lLength += snprintf( lRecord + lLength, sizeof( lRecord ) - lLength, "%02X", lByte );
+                lSum += lByte;
+            }
+
+            lFile << lRecord;
+            snprintf( lRecord, sizeof( lRecord ), "%02X\r\n", static_cast<uint8_t>( -static_cast<int32_t>( lSum ) ) );
+            lFile << lRecord;
+        }
+
+        lFile << ":00000001FF\r\n";
+    }
+
+    // Previous LtLtbReader: all the firmwares are read in vectors
+    std::list<std::pair<uint32_t, std::vector<uint8_t>>> ReadLtbStream( const std::string &aFileName )
+    {
+        std::ifstream lFile;
+        lFile.exceptions( lFile.failbit );
+        lFile.open( aFileName.c_str(), std::ios_base::in | std::ios_base::binary );
+
+        uint32_t lValue[2];
+        lFile.read( reinterpret_cast<char *>( lValue ), sizeof( lValue ) );
+        LdBenchLtbHeader lHeader;
+        lFile.read( reinterpret_cast<char *>( &lHeader ), sizeof( lHeader ) );
+        int64_t lSizeToRead = lHeader.mUnitSize;
+
+        lFile.read( reinterpret_cast<char *>( &lHeader ), sizeof( lHeader ) );
+        uint16_t lDeviceType;
+        lFile.read( reinterpret_cast<char *>( &lDeviceType ), sizeof( lDeviceType ) );
+        lSizeToRead -= sizeof( lHeader ) + sizeof( lDeviceType );
+
+        std::list<std::pair<uint32_t, std::vector<uint8_t>>> lFirmwares;
+
+        while( lSizeToRead > 0 )
+        {
+            lFile.read( reinterpret_cast<char *>( &lHeader ), sizeof( lHeader ) );
+            lFirmwares.push_back( std::make_pair( lHeader.mId, std::vector<uint8_t>( lHeader.mCount ) ) );
+            lFile.read( reinterpret_cast<char *>( lFirmwares.back().second.data() ), lHeader.mCount );
+            lSizeToRead -= sizeof( lHeader ) + lHeader.mCount;
+        }
+
+        return lFirmwares;
+    }
+
+    // Resident memory in MiB, 0 if not available
+    double ResidentMiB( void )
+    {
+#ifdef __linux__
+        FILE *lStatm = fopen( "/proc/self/statm", "r" );
+        unsigned long lSize = 0, lResident = 0;
+
+        if( lStatm != nullptr )
+        {
+            if( fscanf( lStatm, "%lu %lu", &lSize, &lResident ) != 2 )
+            {
+                lResident = 0;
+            }
+
+            fclose( lStatm );
+        }
+
+        return static_cast<double>( lResident ) * static_cast<double>( sysconf( _SC_PAGESIZE ) ) / ( 1024.0 * 1024.0 );
+#else
+        return 0;
+#endif
+    }
+
+    struct LdBenchLoad
+    {
+        double mNs       = 0;
+        double mResident = 0;
+        size_t mBytes    = 0;
+    };
+
+    void ReportLoad( const std::string &aName, const LdBenchLoad &aLoad )
+    {
+        LeddarBench::Report( aName, aLoad.mNs / gIterations / 1000.0, "us/load" );
+        LeddarBench::Report( aName + "/resident", aLoad.mResident / gIterations, "MiB" );
+    }
+} // namespace
+
+void LeddarBench::BenchFileView( void )
+{
+    const std::string lLtbFile = LeddarBench::TemporaryFile( "LeddarBench-file-view.ltb" );
+    const std::string lHexFile = LeddarBench::TemporaryFile( "LeddarBench-file-view.hex" );
+    WriteLtb( lLtbFile );
+    WriteHex( lHexFile );
+
+#ifdef __linux__
+    // Fixed threshold: the firmware vectors are always mapped and returned on free, so the resident memory follows them
+    mallopt( M_MMAP_THRESHOLD, 256 * 1024 );
+#endif
+
+    LdBenchLoad lOpen, lOne, lAll, lStream;
+
+    for( uint32_t lIteration = 0; lIteration < gIterations; ++lIteration )
+    {
+        {
+            double lResident = ResidentMiB();
+            LdBenchTimer lTimer;
+            LtLtbReader lReader( lLtbFile );
+
+            if( !lReader.HasFirmware( LtLtbReader::ID_LTB_FPGA_DATA ) || lReader.GetSections().size() != 3 )
+            {
+                throw std::runtime_error( "file-view: invalid ltb sections" );
+            }
+
+            lOpen.mNs += lTimer.ElapsedNs();
+            lOpen.mResident += ResidentMiB() - lResident;
+
+            std::vector<uint8_t> lFirmware = lReader.GetFirmware( LtLtbReader::ID_LTB_FPGA_DATA );
+            lOne.mNs += lTimer.ElapsedNs();
+            lOne.mResident += ResidentMiB() - lResident;
+            lOne.mBytes += lFirmware.size();
+        }
+
+        {
+            double lResident = ResidentMiB();
+            LdBenchTimer lTimer;
+            LtLtbReader lReader( lLtbFile );
+            std::list<std::pair<uint32_t, std::vector<uint8_t>>> lFirmwares = lReader.GetFirmwares();
+            lAll.mNs += lTimer.ElapsedNs();
+            lAll.mResident += ResidentMiB() - lResident;
+            lAll.mBytes += lFirmwares.back().second.size();
+        }
+
+        {
+            double lResident = ResidentMiB();
+            LdBenchTimer lTimer;
+            std::list<std::pair<uint32_t, std::vector<uint8_t>>> lFirmwares = ReadLtbStream( lLtbFile );
+            lStream.mNs += lTimer.ElapsedNs();
+            lStream.mResident += ResidentMiB() - lResident;
+            lStream.mBytes += lFirmwares.back().second.size();
+        }
+    }
+
+    if( lAll.mBytes != lStream.mBytes || lOne.mBytes != gFpgaDataSize * gIterations )
+    {
+        throw std::runtime_error( "file-view: firmware sizes differ" );
+    }
+
+    ReportLoad( "file-view/ltb/open", lOpen );
+    ReportLoad( "file-view/ltb/one-firmware", lOne );
+    ReportLoad( "file-view/ltb/all", lAll );
+    ReportLoad( "file-view/ltb/stream", lStream );
+
+    // Intel HEX
+    double lHexNs = 0, lHexStreamNs = 0;
+
+    for( uint32_t lIteration = 0; lIteration < gIterations; ++lIteration )
+    {
+        LdBenchTimer lTimer;
+        std::unique_ptr<IntelHEX::IntelHexMem> lMem( LeddarUtils::LtFileUtils::LoadHex( lHexFile ) );
+        lHexNs += lTimer.ElapsedNs();
+
+        std::unique_ptr<IntelHEX::IntelHexMem> lStreamMem( new IntelHEX::IntelHexMem );
+        lTimer.Restart();
+        std::ifstream lFile( lHexFile.c_str(), std::ifstream::in );
+        IntelHEX::IHEX_Load( lFile, *lStreamMem );
+        lHexStreamNs += lTimer.ElapsedNs();
+
+        if( lMem->nByte != lStreamMem->nByte || memcmp( lMem->mem, lStreamMem->mem, sizeof( lMem->mem ) ) != 0 )
+        {
+            throw std::runtime_error( "file-view: hex loads differ" );
+        }
+    }
+
+    Report( "file-view/hex/load", lHexNs / gIterations / 1000.0, "us/load" );
+    Report( "file-view/hex/stream", lHexStreamNs / gIterations / 1000.0, "us/load" );
+
+    remove( lLtbFile.c_str() );
+    remove( lHexFile.c_str() );
+}
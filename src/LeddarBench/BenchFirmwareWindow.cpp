@@ -0,0 +1,148 @@
+// *****************************************************************************
+// Module..: LeddarBench
+//
+/// \file    BenchFirmwareWindow.cpp
+///
+/// \brief   Firmware upload time against in-process fake devices.
+///          "firmware-window/window-N" sends a 256 KiB image through LdLeddarTechUpdateTransport to a fake
+///          LeddarTech protocol device (1 ms link latency each direction, 300 us to write a 1 KiB block).
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LeddarBench.h"
+
+#include "LdFirmwareUploader.h"
+#include "LdProtocolLeddarTech.h"
+
+#include "LtExceptions.h"
+
+#include "comm/LtComLeddarTechPublic.h"
+
+#include <deque>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+    const uint32_t gImageSize  = 256 * 1024;
+    const uint32_t gBlockSize  = 1024;
+    const auto gLinkLatency    = std::chrono::microseconds( 1000 );
+    const auto gBlockWriteTime = std::chrono::microseconds( 300 );
+
+    std::vector<uint8_t> MakeImage( void )
+    {
+        std::vector<uint8_t> lImage( gImageSize );
+
+        for( uint32_t i = 0; i < gImageSize; ++i )
+        {
+            lImage[i] = static_cast<uint8_t>( ( i * 31 ) ^ ( i >> 9 ) );
+        }
+
+        return lImage;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief  Fake LeddarTech protocol device: the update blocks are processed in order and each answer
+    ///         is available after the link latency, the block write time and the answer latency.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdBenchUpdateDevice : public LeddarConnection::LdProtocolLeddarTech
+    {
+      public:
+        LdBenchUpdateDevice( void ) : LdProtocolLeddarTech( nullptr, this ), mDeviceFree( std::chrono::steady_clock::now() ) { SetConnected( true ); }
+
+        void Connect( void ) override { SetConnected( true ); }
+        void Disconnect( void ) override { SetConnected( false ); }
+
+        void ReadAnswer( void ) override
+        {
+            if( mAnswers.empty() )
+            {
+                throw LeddarException::LtComException( "No request sent." );
+            }
+
+            std::this_thread::sleep_until( mAnswers.front() );
+            mAnswers.pop_front();
+
+            mAnswerCode    = LtComLeddarTechPublic::LT_COMM_ANSWER_OK;
+            mMessageSize   = 0;
+            mElementOffset = 0;
+        }
+
+        const std::vector<uint8_t> &GetImage( void ) const { return mImage; }
+
+      protected:
+        void Write( uint32_t aSize ) override
+        {
+            const LtComLeddarTechPublic::sLtCommRequestHeader *lHeader = reinterpret_cast<const LtComLeddarTechPublic::sLtCommRequestHeader *>( mTransferInputBuffer );
+
+            if( lHeader->mRequestCode != LtComLeddarTechPublic::LT_COMM_CFGSRV_REQUEST_UPDATE || lHeader->mRequestTotalSize != aSize )
+            {
+                throw std::runtime_error( "firmware-window: unexpected request" );
+            }
+
+            uint32_t lOffset = sizeof( LtComLeddarTechPublic::sLtCommRequestHeader );
+
+            while( lOffset < aSize )
+            {
+                const LtComLeddarTechPublic::sLtCommElementHeader *lElement =
+                    reinterpret_cast<const LtComLeddarTechPublic::sLtCommElementHeader *>( mTransferInputBuffer + lOffset );
+                lOffset += sizeof( LtComLeddarTechPublic::sLtCommElementHeader );
+
+                if( lElement->mElementId == LtComLeddarTechPublic::LT_COMM_ID_RAW_DATA )
+                {
+                    mImage.insert( mImage.end(), mTransferInputBuffer + lOffset, mTransferInputBuffer + lOffset + lElement->mElementCount * lElement->mElementSize );
+                }
+
+                lOffset += lElement->mElementCount * lElement->mElementSize;
+            }
+
+            mDeviceFree = std::max( std::chrono::steady_clock::now() + gLinkLatency, mDeviceFree ) + gBlockWriteTime;
+            mAnswers.push_back( mDeviceFree + gLinkLatency );
+        }
+
+        uint32_t Read( uint32_t aSize ) override { return aSize; }
+
+      private:
+        std::vector<uint8_t> mImage;
+        std::chrono::steady_clock::time_point mDeviceFree;
+        std::deque<std::chrono::steady_clock::time_point> mAnswers;
+    };
+
+    void RunWindow( const std::vector<uint8_t> &aImage, uint8_t aWindow )
+    {
+        const std::string lName = "firmware-window/window-" + std::to_string( aWindow );
+        LdBenchUpdateDevice lDevice;
+        LeddarDevice::LdLeddarTechUpdateTransport lTransport( &lDevice, LtComLeddarTechPublic::LT_COMM_SOFTWARE_TYPE_MAIN );
+        LeddarDevice::LdFirmwareUploader lUploader( &aImage[0], gImageSize, gBlockSize, aWindow );
+
+        uint64_t lStageUs[2] = { 0, 0 };
+        lUploader.SetStageCallback( [&lStageUs]( LeddarDevice::LdFirmwareUploader::eStage aStage, const LeddarDevice::LdFirmwareUploader::sChunk &, uint32_t aDurationUs )
+        {
+            lStageUs[aStage] += aDurationUs;
+        } );
+
+        LeddarBench::LdBenchTimer lTimer;
+
+        if( !lUploader.Upload( lTransport ) || lDevice.GetImage() != aImage )
+        {
+            throw std::runtime_error( lName + ": wrong image on the device" );
+        }
+
+        double lMs = lTimer.ElapsedNs() / 1e6;
+        LeddarBench::Report( lName, lMs, "ms/image" );
+        LeddarBench::Report( lName + "/throughput", gImageSize / 1024.0 / ( lMs / 1000.0 ), "KiB/s" );
+        LeddarBench::Report( lName + "/ack-wait", lStageUs[LeddarDevice::LdFirmwareUploader::US_ACK] / 1000.0, "ms" );
+    }
+} // namespace
+
+void LeddarBench::BenchFirmwareWindow( void )
+{
+    const std::vector<uint8_t> lImage = MakeImage();
+
+    RunWindow( lImage, 1 );
+    RunWindow( lImage, 4 );
+    RunWindow( lImage, 16 );
+}
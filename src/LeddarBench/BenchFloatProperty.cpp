@@ -0,0 +1,210 @@
+// *****************************************************************************
+// Module..: LeddarBench
+//
+/// \file    BenchFloatProperty.cpp
+///
+/// \brief   Reads and writes of a 512 elements fixed point LdFloatProperty (i.e. per channel offsets).
+///          "/per-value" is a Value( i ) loop, "/bulk" is Values(), both after a write;
+///          "/bulk-cached" is Values() without write in between.
+///          "float-property/string" formats all the values with GetStringValue, "/stringstream" is the
+///          previous formatting (std::fixed, std::setprecision).
+///          "float-property/raw-storage" is SetRawStorage of int16 values, "/per-element" is the previous
+///          conversion (switch on the sizes for each element).
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LeddarBench.h"
+
+#include "LdFloatProperty.h"
+
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+    const uint32_t gCount      = 512;
+    const uint32_t gIterations = 2000;
+    const uint32_t gScale      = 65536;
+
+    // Previous LdFloatProperty::PerformSetRawStorage loop
+    void SetRawPerElement( const uint8_t *aBuffer, size_t aCount, uint32_t aSize, uint8_t *aStorage, size_t aStride )
+    {
+        for( uint32_t i = 0; i < aCount; i++ )
+        {
+            int64_t lValue( 0 );
+
+            if( aSize == sizeof( int8_t ) )
+            {
+                lValue = reinterpret_cast<const int8_t *>( aBuffer )[i];
+            }
+            else if( aSize == sizeof( int16_t ) )
+            {
+                lValue = reinterpret_cast<const int16_t *>( aBuffer )[i];
+            }
+            else if( aSize == sizeof( int64_t ) )
+            {
+                lValue = reinterpret_cast<const int64_t *>( aBuffer )[i];
+            }
+
+            if( aStride == sizeof( int8_t ) )
+            {
+                reinterpret_cast<int8_t *>( aStorage )[i] = static_cast<int8_t>( lValue );
+            }
+            else if( aStride == sizeof( int16_t ) )
+            {
+                reinterpret_cast<int16_t *>( aStorage )[i] = static_cast<int16_t>( lValue );
+            }
+            else if( aStride == sizeof( int32_t ) )
+            {
+                reinterpret_cast<int32_t *>( aStorage )[i] = static_cast<int32_t>( lValue );
+            }
+            else if( aStride == sizeof( int64_t ) )
+            {
+                reinterpret_cast<int64_t *>( aStorage )[i] = static_cast<int64_t>( lValue );
+            }
+        }
+    }
+
+    void ReportNs( const std::string &aName, double aNs, uint32_t aIterations )
+    {
+        LeddarBench::Report( aName, aNs / aIterations / 1000.0, "us/property" );
+    }
+} // namespace
+
+void LeddarBench::BenchFloatProperty( void )
+{
+    LeddarCore::LdFloatProperty lProperty( LeddarCore::LdProperty::CAT_CALIBRATION, LeddarCore::LdProperty::F_EDITABLE | LeddarCore::LdProperty::F_SAVE, 0x1000, 0, 4, gScale, 3 );
+    std::vector<int32_t> lRaw( gCount );
+
+    for( uint32_t i = 0; i < gCount; ++i )
+    {
+        lRaw[i] = static_cast<int32_t>( i * 977 ) - 250000;
+    }
+
+    lProperty.ForceRawStorage( reinterpret_cast<uint8_t *>( lRaw.data() ), gCount, sizeof( int32_t ) );
+
+    // Reads
+    double lChecksum = 0;
+    double lPerValueNs = 0, lBulkNs = 0, lCachedNs = 0;
+
+    for( uint32_t lIteration = 0; lIteration < gIterations; ++lIteration )
+    {
+        lProperty.ForceRawValue( 0, static_cast<int32_t>( lIteration ) );
+        LdBenchTimer lTimer;
+
+        for( uint32_t i = 0; i < gCount; ++i )
+        {
+            lChecksum += lProperty.Value( i );
+        }
+
+        lPerValueNs += lTimer.ElapsedNs();
+
+        lProperty.ForceRawValue( 0, static_cast<int32_t>( lIteration + 1 ) );
+        lTimer.Restart();
+        std::vector<float> lValues = lProperty.Values();
+        lBulkNs += lTimer.ElapsedNs();
+        lChecksum += lValues[gCount - 1];
+
+        lTimer.Restart();
+        lValues = lProperty.Values();
+        lCachedNs += lTimer.ElapsedNs();
+        lChecksum += lValues[0];
+    }
+
+    ReportNs( "float-property/per-value", lPerValueNs, gIterations );
+    ReportNs( "float-property/bulk", lBulkNs, gIterations );
+    ReportNs( "float-property/bulk-cached", lCachedNs, gIterations );
+
+    // Bulk and per value reads give the same values
+    const std::vector<float> lValues = lProperty.Values();
+    lProperty.ForceRawValue( 1, lRaw[1] + 1 );
+    lProperty.ForceRawValue( 1, lRaw[1] );
+
+    for( uint32_t i = 0; i < gCount; ++i )
+    {
+        if( lValues[i] != lProperty.Value( i ) )
+        {
+            throw std::runtime_error( "float-property: bulk values differ" );
+        }
+    }
+
+    // Strings
+    const uint32_t lStringIterations = gIterations / 10;
+    double lStringNs = 0, lStreamNs = 0;
+
+    for( uint32_t lIteration = 0; lIteration < lStringIterations; ++lIteration )
+    {
+        LdBenchTimer lTimer;
+
+        for( uint32_t i = 0; i < gCount; ++i )
+        {
+            lChecksum += static_cast<double>( lProperty.GetStringValue( i ).size() );
+        }
+
+        lStringNs += lTimer.ElapsedNs();
+        lTimer.Restart();
+
+        for( uint32_t i = 0; i < gCount; ++i )
+        {
+            std::stringstream lResult;
+            lResult << std::fixed << std::setprecision( 3 ) << lProperty.Value( i );
+            lChecksum += static_cast<double>( lResult.str().size() );
+        }
+
+        lStreamNs += lTimer.ElapsedNs();
+    }
+
+    for( uint32_t i = 0; i < gCount; ++i )
+    {
+        std::stringstream lResult;
+        lResult << std::fixed << std::setprecision( 3 ) << lProperty.Value( i );
+
+        if( lResult.str() != lProperty.GetStringValue( i ) )
+        {
+            throw std::runtime_error( "float-property: string differs, " + lResult.str() + " " + lProperty.GetStringValue( i ) );
+        }
+    }
+
+    ReportNs( "float-property/string", lStringNs, lStringIterations );
+    ReportNs( "float-property/string/stringstream", lStreamNs, lStringIterations );
+
+    // Raw storage from int16 values
+    std::vector<int16_t> lRaw16( gCount );
+    std::vector<int32_t> lStorage( gCount );
+
+    for( uint32_t i = 0; i < gCount; ++i )
+    {
+        lRaw16[i] = static_cast<int16_t>( i * 37 - 9000 );
+    }
+
+    double lRawNs = 0, lPerElementNs = 0;
+
+    for( uint32_t lIteration = 0; lIteration < gIterations; ++lIteration )
+    {
+        lRaw16[lIteration % gCount] ^= 1;
+        LdBenchTimer lTimer;
+        lProperty.ForceRawStorage( reinterpret_cast<uint8_t *>( lRaw16.data() ), gCount, sizeof( int16_t ) );
+        lRawNs += lTimer.ElapsedNs();
+
+        lTimer.Restart();
+        SetRawPerElement( reinterpret_cast<const uint8_t *>( lRaw16.data() ), gCount, sizeof( int16_t ), reinterpret_cast<uint8_t *>( lStorage.data() ), sizeof( int32_t ) );
+        lPerElementNs += lTimer.ElapsedNs();
+        lChecksum += lStorage[lIteration % gCount];
+    }
+
+    if( lProperty.RawValue( 5 ) != lRaw16[5] )
+    {
+        throw std::runtime_error( "float-property: raw storage differs" );
+    }
+
+    ReportNs( "float-property/raw-storage", lRawNs, gIterations );
+    ReportNs( "float-property/raw-storage/per-element", lPerElementNs, gIterations );
+
+    // Keep the reads alive without reporting a value that is not a measure
+    volatile double lSink = lChecksum;
+    ( void )lSink;
+}
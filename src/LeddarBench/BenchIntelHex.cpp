@@ -0,0 +1,121 @@
+// *****************************************************************************
+// Module..: LeddarBench
+//
+/// \file    BenchIntelHex.cpp
+///
+/// \brief   Intel HEX parsing throughput on a generated 8 MiB firmware image (32 bytes per record,
+///          extended linear address records). "intelhex/stream" is IHEX_Stream with a sink that only
+///          counts the bytes, "intelhex/load-buffer" is IHEX_LoadFromBuffer into an IntelHexMem.
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LeddarBench.h"
+
+#include "LtIntelHex.h"
+
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+
+namespace
+{
+    const uint32_t gImageSize  = 8 * 1024 * 1024;
+    const uint32_t gRecordSize = 32;
+    const uint32_t gIterations = 5;
+
+    class LdBenchHexSink : public IntelHEX::IHexSink
+    {
+      public:
+        LdBenchHexSink( void ) : mSize( 0 ) {}
+
+        bool Write( uint32_t, const uint8_t *, uint32_t aSize ) override
+        {
+            mSize += aSize;
+            return true;
+        }
+
+        uint32_t mSize;
+    };
+
+    void AppendRecord( std::string &aText, uint8_t aType, uint16_t aAddress, const uint8_t *aData, uint8_t aCount )
+    {
+        char lRecord[16 + 2 * 255];
+        uint32_t lSum = aCount + ( aAddress >> 8 ) + ( aAddress & 0xFF ) + aType;
+        int lLength   = snprintf( lRecord, sizeof( lRecord ), ":%02X%04X%02X", aCount, aAddress, aType );
+
+        for( uint8_t i = 0; i < aCount; ++i )
+        {
+            lLength += snprintf( lRecord + lLength, sizeof( lRecord ) - lLength, "%02X", aData[i] );
+            lSum += aData[i];
+        }
+
+        snprintf( lRecord + lLength, sizeof( lRecord ) - lLength, "%02X\r\n", static_cast<uint8_t>( -static_cast<int32_t>( lSum ) ) );
+        aText += lRecord;
+    }
+
+    std::string MakeImage( void )
+    {
+        std::string lText;
+        lText.reserve( gImageSize / gRecordSize * ( 13 + 2 * gRecordSize ) + 4096 );
+        uint8_t lData[gRecordSize];
+
+        for( uint32_t lAddress = 0; lAddress < gImageSize; lAddress += gRecordSize )
+        {
+            if( ( lAddress & 0xFFFF ) == 0 )
+            {
+                uint8_t lUpper[2] = { static_cast<uint8_t>( lAddress >> 24 ), static_cast<uint8_t>( lAddress >> 16 ) };
+                AppendRecord( lText, IntelHEX::IHEX_ELA, 0, lUpper, 2 );
+            }
+
+            for( uint32_t i = 0; i < gRecordSize; ++i )
+            {
+                lData[i] = static_cast<uint8_t>( ( lAddress + i ) * 13 );
+            }
+
+            AppendRecord( lText, IntelHEX::IHEX_DATA, static_cast<uint16_t>( lAddress ), lData, gRecordSize );
+        }
+
+        AppendRecord( lText, IntelHEX::IHEX_EOF, 0, nullptr, 0 );
+        return lText;
+    }
+} // namespace
+
+void LeddarBench::BenchIntelHex( void )
+{
+    const std::string lText = MakeImage();
+    const uint8_t *lBuffer  = reinterpret_cast<const uint8_t *>( lText.data() );
+    const double lTextMiB   = lText.size() / ( 1024.0 * 1024.0 );
+
+    LdBenchTimer lStreamTimer;
+
+    for( uint32_t i = 0; i < gIterations; ++i )
+    {
+        LdBenchHexSink lSink;
+        uint32_t lCrc = 0;
+
+        if( IntelHEX::IHEX_Stream( lBuffer, lText.size(), lSink, &lCrc ) != 0 || lSink.mSize != gImageSize )
+        {
+            throw std::runtime_error( "intelhex/stream: parsing error" );
+        }
+    }
+
+    double lStreamMs = lStreamTimer.ElapsedNs() / 1e6 / gIterations;
+    Report( "intelhex/stream", lStreamMs, "ms/image" );
+    Report( "intelhex/stream-throughput", lTextMiB / ( lStreamMs / 1000.0 ), "MiB/s" );
+
+    std::unique_ptr<IntelHEX::IntelHexMem> lMem( new IntelHEX::IntelHexMem );
+    LdBenchTimer lLoadTimer;
+
+    for( uint32_t i = 0; i < gIterations; ++i )
+    {
+        if( IntelHEX::IHEX_LoadFromBuffer( lBuffer, static_cast<uint32_t>( lText.size() ), *lMem ) != 0 )
+        {
+            throw std::runtime_error( "intelhex/load-buffer: parsing error" );
+        }
+    }
+
+    Report( "intelhex/load-buffer", lLoadTimer.ElapsedNs() / 1e6 / gIterations, "ms/image" );
+}
@@ -0,0 +1,157 @@
+// *****************************************************************************
+// Module..: LeddarBench
+//
+/// \file    BenchJitter.cpp
+///
+/// \brief   Frame delivery latency from the frame deadline to a consumer thread.
+///          A producer thread publishes a frame every millisecond in a LdResultEchoes (like a sensor data thread)
+///          and a consumer thread waits for NEW_DATA (like a user polling loop).
+///          "jitter-rt" applies the real-time acquisition policy (CPU pinning, SCHED_FIFO, mlockall) to both threads.
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LeddarBench.h"
+
+#include "LdResultEchoes.h"
+#include "LtSystemUtils.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+    const uint32_t gFrameCount    = 5000;
+    const uint32_t gMaxDetections = 512;
+    const auto gFramePeriod       = std::chrono::microseconds( 1000 );
+
+    class LdBenchConsumer : public LeddarCore::LdObject
+    {
+      public:
+        LdBenchConsumer( void ) : mSequence( 0 ) {}
+
+        void Callback( LdObject *, const SIGNALS aSignal, void * ) override
+        {
+            if( aSignal == NEW_DATA )
+            {
+                std::lock_guard<std::mutex> lLock( mMutex );
+                ++mSequence;
+                mCondition.notify_one();
+            }
+        }
+
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        uint64_t mSequence;
+    };
+
+    void RunJitter( const std::string &aName )
+    {
+        LeddarConnection::LdResultEchoes lEchoes;
+        lEchoes.Init( 1000, 1000, gMaxDetections );
+        lEchoes.PrefaultBuffers();
+
+        LdBenchConsumer lConsumer;
+        lEchoes.ConnectSignal( &lConsumer, LeddarCore::LdObject::NEW_DATA );
+
+        std::vector<std::chrono::steady_clock::time_point> lDeadlines( gFrameCount );
+        std::vector<double> lWakeUp, lDelivery;
+        lWakeUp.reserve( gFrameCount );
+        lDelivery.reserve( gFrameCount );
+        std::atomic<bool> lDone( false );
+
+        std::thread lConsumerThread( [&]() {
+            LeddarUtils::LtSystemUtils::ApplyAcquisitionThreadPolicy();
+            uint64_t lSeen = 0;
+
+            while( true )
+            {
+                std::unique_lock<std::mutex> lLock( lConsumer.mMutex );
+                lConsumer.mCondition.wait( lLock, [&]() { return lConsumer.mSequence != lSeen || lDone.load(); } );
+
+                if( lConsumer.mSequence == lSeen )
+                {
+                    break;
+                }
+
+                lSeen = lConsumer.mSequence;
+                lLock.unlock();
+
+                auto lNow = std::chrono::steady_clock::now();
+                lDelivery.push_back( static_cast<double>( std::chrono::duration_cast<std::chrono::nanoseconds>( lNow - lDeadlines[lSeen - 1] ).count() ) / 1000.0 );
+            }
+        } );
+
+        std::thread lProducerThread( [&]() {
+            LeddarUtils::LtSystemUtils::ApplyAcquisitionThreadPolicy();
+            auto lStart = std::chrono::steady_clock::now() + gFramePeriod;
+
+            for( uint32_t i = 0; i < gFrameCount; ++i )
+            {
+                lDeadlines[i] = lStart + gFramePeriod * i;
+                std::this_thread::sleep_until( lDeadlines[i] );
+                lWakeUp.push_back( static_cast<double>( std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - lDeadlines[i] ).count() ) / 1000.0 );
+
+                {
+                    auto lLock = lEchoes.GetUniqueLock( LeddarConnection::B_SET );
+                    std::vector<LeddarConnection::LdEcho> &lBuffer = *lEchoes.GetEchoes( LeddarConnection::B_SET );
+
+                    for( uint32_t j = 0; j < gMaxDetections; ++j )
+                    {
+                        lBuffer[j].mDistance = static_cast<int32_t>( i + j );
+                    }
+
+                    lEchoes.SetEchoCount( gMaxDetections );
+                    lEchoes.SetTimestamp( i );
+                }
+
+                lEchoes.Swap();
+                lEchoes.UpdateFinished();
+            }
+
+            std::lock_guard<std::mutex> lLock( lConsumer.mMutex );
+            lDone = true;
+            lConsumer.mCondition.notify_one();
+        } );
+
+        lProducerThread.join();
+        lConsumerThread.join();
+
+        LeddarBench::ReportPercentiles( aName + "/wakeup", lWakeUp, "us" );
+        LeddarBench::ReportPercentiles( aName + "/delivery", lDelivery, "us" );
+        LeddarBench::Report( aName + "/delivered", static_cast<double>( lDelivery.size() ), "frames" );
+    }
+} // namespace
+
+void LeddarBench::BenchJitter( void )
+{
+    LeddarUtils::LtSystemUtils::SetAcquisitionThreadPolicy( LeddarUtils::LtSystemUtils::LtThreadPolicy() );
+    RunJitter( "jitter" );
+}
+
+void LeddarBench::BenchJitterRealTime( void )
+{
+    LeddarUtils::LtSystemUtils::LtThreadPolicy lPolicy;
+    lPolicy.mCpu      = static_cast<int32_t>( std::thread::hardware_concurrency() > 1 ? 1 : 0 );
+    lPolicy.mPriority = 80;
+
+    try
+    {
+        lPolicy.mLockMemory = true;
+        LeddarUtils::LtSystemUtils::SetAcquisitionThreadPolicy( lPolicy );
+    }
+    catch( std::exception &e )
+    {
+        std::cerr << "jitter-rt: " << e.what() << ", memory not locked" << std::endl;
+        lPolicy.mLockMemory = false;
+        LeddarUtils::LtSystemUtils::SetAcquisitionThreadPolicy( lPolicy );
+    }
+
+    RunJitter( "jitter-rt" );
+    LeddarUtils::LtSystemUtils::SetAcquisitionThreadPolicy( LeddarUtils::LtSystemUtils::LtThreadPolicy() );
+}
@@ -0,0 +1,430 @@
+// *****************************************************************************
+// Module..: LeddarBench
+//
+/// \file    BenchModbusFraming.cpp
+///
+/// \brief   Modbus RTU transaction latency, end of frame detection of the raw confirmations.
+///          A stand-in device answers on the master side of a pseudo terminal, LdLibModbusSerial is
+///          connected to the slave side (115200 bauds, no parity). For each transaction:
+///          "/timeout" is the previous reception (modbus_receive_raw_confirmation_timeoutEnd when the
+///          size is unknown, modbus_receive_raw_confirmation_sizeEnd else), "/predicted" is
+///          LdLibModbusSerial::ReceiveRawConfirmation (length from the header, else the inter-frame gap).
+///
+///          "modbus-program": M16 polling rate (echoes 0x6A then states), the stand-in delays its answers
+///          by the transmission time of the request and of the answer at 115200 bauds. "/fixed-wait" is the
+///          previous sequence (M16_WAIT_AFTER_REQUEST after each answer), "/program" is LdModbusProgram
+///          (guard time of the bus). "/line-capacity" is the rate of a line without idle time other than the guards.
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LeddarBench.h"
+
+#include "LtDefines.h"
+
+#if defined( BUILD_MODBUS ) && !defined( _WIN32 )
+
+#include "LdConnectionInfoModbus.h"
+#include "LdLibModbusSerial.h"
+#include "LdModbusProgram.h"
+#include "LtExceptions.h"
+#include "LtTimeUtils.h"
+
+#include "comm/LtComLeddarTechPublic.h"
+#include "comm/Modbus/LtComLeddarM16Modbus.h"
+#include "comm/Modbus/LtComLeddarVu8Modbus.h"
+
+extern "C"
+{
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+#include "modbus.h"
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+#include "modbus-LT.h"
+}
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdexcept>
+#include <termios.h>
+#include <thread>
+#include <unistd.h>
+
+namespace
+{
+    const uint32_t gTransactionCount = 10;
+    const uint8_t gAddress           = 1;
+    const uint8_t gReadSize          = 32;
+    const uint32_t gPollCount        = 50;
+    const uint8_t gM16Detections     = 16;
+    const uint32_t gBaud             = 115200;
+    const double gCharTimeUs         = 10 * 1e6 / gBaud; // 8N1
+
+    uint16_t Crc16( const uint8_t *aData, size_t aSize )
+    {
+        uint16_t lCrc = 0xFFFF;
+
+        for( size_t i = 0; i < aSize; ++i )
+        {
+            lCrc ^= aData[i];
+
+            for( int j = 0; j < 8; ++j )
+            {
+                lCrc = ( lCrc & 1 ) ? static_cast<uint16_t>( ( lCrc >> 1 ) ^ 0xA001 ) : static_cast<uint16_t>( lCrc >> 1 );
+            }
+        }
+
+        return lCrc;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief  LeddarVu 8 or M16 stand-in on the pty master: answers 0x11 (server id), 0x45 (serial port settings),
+    ///         0x42 (universal read), 0x6A (M16 detections), 0x04 (input registers), and the others (i.e. 0x44,
+    ///         universal op code) with an illegal function exception.
+    ///         With aPaced, an answer is sent after the transmission time of the request and of the answer.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdBenchModbusDevice
+    {
+      public:
+        explicit LdBenchModbusDevice( uint16_t aDeviceType = LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_VU8, bool aPaced = false ) :
+            mMaster( -1 ),
+            mDeviceType( aDeviceType ),
+            mPaced( aPaced ),
+            mTimestamp( 0 ),
+            mStop( false )
+        {
+            mMaster = posix_openpt( O_RDWR | O_NOCTTY );
+
+            if( mMaster < 0 || grantpt( mMaster ) != 0 || unlockpt( mMaster ) != 0 || ptsname( mMaster ) == nullptr )
+            {
+                throw std::runtime_error( "modbus-framing: pseudo terminal unavailable" );
+            }
+
+            mSlaveName = ptsname( mMaster );
+
+            termios lTermios;
+            tcgetattr( mMaster, &lTermios );
+            cfmakeraw( &lTermios );
+            tcsetattr( mMaster, TCSANOW, &lTermios );
+
+            mThread = std::thread( &LdBenchModbusDevice::Run, this );
+        }
+
+        ~LdBenchModbusDevice()
+        {
+            mStop = true;
+            mThread.join();
+            close( mMaster );
+        }
+
+        const std::string &GetSlaveName( void ) const { return mSlaveName; }
+
+      private:
+        void Run( void )
+        {
+            uint8_t lRequest[MODBUS_RTU_MAX_ADU_LENGTH];
+            size_t lSize = 0;
+
+            while( !mStop )
+            {
+                pollfd lPoll = { mMaster, POLLIN, 0 };
+
+                if( poll( &lPoll, 1, 10 ) <= 0 || ( lPoll.revents & POLLIN ) == 0 )
+                {
+                    continue;
+                }
+
+                ssize_t lRead = read( mMaster, lRequest + lSize, sizeof( lRequest ) - lSize );
+
+                if( lRead <= 0 )
+                {
+                    continue;
+                }
+
+                lSize += static_cast<size_t>( lRead );
+                uint16_t lCrc = ( lSize > 2 ) ? Crc16( lRequest, lSize - 2 ) : 0;
+
+                if( lSize > 2 && lRequest[lSize - 2] == ( lCrc & 0xFF ) && lRequest[lSize - 1] == ( lCrc >> 8 ) )
+                {
+                    Answer( lRequest, lSize );
+                    lSize = 0;
+                }
+                else if( lSize == sizeof( lRequest ) )
+                {
+                    lSize = 0;
+                }
+            }
+        }
+
+        void Answer( const uint8_t *aRequest, size_t aRequestSize )
+        {
+            uint8_t lAnswer[MODBUS_RTU_MAX_ADU_LENGTH] = { gAddress, aRequest[1] };
+            size_t lSize                               = 2;
+
+            switch( aRequest[1] )
+            {
+                case 0x11:
+                    if( mDeviceType == LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_M16 )
+                    {
+                        LtComLeddarM16Modbus::sLeddarM16ServerId lServerId;
+                        memset( &lServerId, 0, sizeof( lServerId ) );
+                        lServerId.mSize     = sizeof( lServerId ) - 1;
+                        lServerId.mDeviceId = mDeviceType;
+                        memcpy( lAnswer + lSize, &lServerId, sizeof( lServerId ) );
+                        lSize += sizeof( lServerId );
+                    }
+                    else
+                    {
+                        LtComLeddarVu8Modbus::sLeddarVu8ModbusServerId lServerId;
+                        memset( &lServerId, 0, sizeof( lServerId ) );
+                        lServerId.mNbBytes  = sizeof( lServerId ) - 1;
+                        lServerId.mDeviceId = mDeviceType;
+                        memcpy( lAnswer + lSize, &lServerId, sizeof( lServerId ) );
+                        lSize += sizeof( lServerId );
+                    }
+                    break;
+
+                case 0x6A:
+                    lAnswer[lSize++] = gM16Detections;
+                    memset( lAnswer + lSize, 0x11, gM16Detections * sizeof( LtComLeddarM16Modbus::sLeddarM16Detections0x6A ) );
+                    lSize += gM16Detections * sizeof( LtComLeddarM16Modbus::sLeddarM16Detections0x6A );
+                    ++mTimestamp;
+                    memcpy( lAnswer + lSize, &mTimestamp, sizeof( mTimestamp ) );
+                    lSize += sizeof( mTimestamp );
+                    lAnswer[lSize++] = 100; // Led power
+                    lAnswer[lSize++] = 0;
+                    break;
+
+                case 0x04:
+                    lAnswer[lSize++] = static_cast<uint8_t>( 2 * aRequest[5] );
+                    memset( lAnswer + lSize, 0x20, 2 * aRequest[5] );
+                    lSize += 2 * aRequest[5];
+                    break;
+
+                case 0x45:
+                    lAnswer[lSize++] = aRequest[2]; // Sub function
+                    lAnswer[lSize++] = 1;           // Number of serial ports
+                    lAnswer[lSize++] = 0;           // Current port
+                    memset( lAnswer + lSize, 0, sizeof( LtComLeddarVu8Modbus::sLeddarVu8ModbusSerialPortSettings ) );
+                    lSize += sizeof( LtComLeddarVu8Modbus::sLeddarVu8ModbusSerialPortSettings );
+                    break;
+
+                case 0x42:
+                    memcpy( lAnswer + lSize, aRequest + 2, 4 ); // Base address
+                    lSize += 4;
+                    lAnswer[lSize++] = aRequest[6];
+                    memset( lAnswer + lSize, 0x5A, aRequest[6] );
+                    lSize += aRequest[6];
+                    break;
+
+                default:
+                    lAnswer[1] |= 0x80;
+                    lAnswer[lSize++] = MODBUS_EXCEPTION_ILLEGAL_FUNCTION;
+                    break;
+            }
+
+            uint16_t lCrc    = Crc16( lAnswer, lSize );
+            lAnswer[lSize++] = static_cast<uint8_t>( lCrc & 0xFF );
+            lAnswer[lSize++] = static_cast<uint8_t>( lCrc >> 8 );
+
+            if( mPaced )
+            {
+                LeddarUtils::LtTimeUtils::WaitBlockingMicro( static_cast<uint32_t>( ( aRequestSize + lSize ) * gCharTimeUs ) );
+            }
+
+            if( write( mMaster, lAnswer, lSize ) != static_cast<ssize_t>( lSize ) )
+            {
+                mStop = true;
+            }
+        }
+
+        int mMaster;
+        uint16_t mDeviceType;
+        bool mPaced;
+        uint32_t mTimestamp;
+        std::string mSlaveName;
+        std::atomic<bool> mStop;
+        std::thread mThread;
+    };
+
+    struct sBenchTransaction
+    {
+        const char *mName;
+        uint8_t mRequest[8];
+        uint32_t mRequestSize;
+        uint32_t mAnswerSize; // As LdConnectionUniversalModbus computes it, 0 if the caller does not know it
+    };
+
+    const sBenchTransaction gTransactions[] = {
+        { "server-id", { gAddress, 0x11 }, 2, 0 },
+        { "serial-settings", { gAddress, 0x45, 0 }, 3, 0 },
+        { "universal-read", { gAddress, 0x42, 0, 0, 0, 0, gReadSize }, 7, 2 + 5 + gReadSize + 2 },
+        { "universal-exception", { gAddress, 0x44, 0x05, 0 }, 4, 2 + 2 + 2 },
+    };
+
+    double Transaction( LeddarConnection::LdLibModbusSerial &aInterface, const sBenchTransaction &aTransaction, bool aPredicted )
+    {
+        uint8_t lRequest[MODBUS_RTU_MAX_ADU_LENGTH];
+        uint8_t lAnswer[MODBUS_RTU_MAX_ADU_LENGTH];
+        memcpy( lRequest, aTransaction.mRequest, aTransaction.mRequestSize );
+
+        LeddarBench::LdBenchTimer lTimer;
+        aInterface.SendRawRequest( lRequest, aTransaction.mRequestSize );
+
+        if( aPredicted )
+        {
+            try
+            {
+                aInterface.ReceiveRawConfirmation( lAnswer, aTransaction.mAnswerSize );
+            }
+            catch( LeddarException::LtComException & )
+            {
+                // Exception answer
+            }
+        }
+        else
+        {
+            modbus_t *lHandle = aInterface.GetHandle();
+            int lResult       = aTransaction.mAnswerSize != 0 ? modbus_receive_raw_confirmation_sizeEnd( lHandle, lAnswer, static_cast<int>( aTransaction.mAnswerSize ) )
+                                                              : modbus_receive_raw_confirmation_timeoutEnd( lHandle, lAnswer );
+
+            if( lResult < 0 )
+            {
+                modbus_flush( lHandle );
+            }
+        }
+
+        return lTimer.ElapsedNs();
+    }
+
+    // Previous M16 polling: echoes, M16_WAIT_AFTER_REQUEST, states, M16_WAIT_AFTER_REQUEST
+    void PollFixedWait( LeddarConnection::LdLibModbusSerial &aInterface )
+    {
+        uint8_t lRequest[2] = { gAddress, 0x6A };
+        uint8_t lAnswer[MODBUS_RTU_MAX_ADU_LENGTH];
+        uint16_t lRegisters[1];
+
+        aInterface.SendRawRequest( lRequest, sizeof( lRequest ) );
+        aInterface.ReceiveRawConfirmationLT( lAnswer, LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_M16 );
+        LeddarUtils::LtTimeUtils::WaitBlockingMicro( LtComLeddarM16Modbus::M16_WAIT_AFTER_REQUEST );
+        aInterface.ReadInputRegisters( 0, 1, lRegisters );
+        LeddarUtils::LtTimeUtils::WaitBlockingMicro( LtComLeddarM16Modbus::M16_WAIT_AFTER_REQUEST );
+    }
+
+    double PollRate( LeddarConnection::LdLibModbusSerial &aInterface, LeddarConnection::LdModbusProgram *aProgram )
+    {
+        uint8_t lAnswer[MODBUS_RTU_MAX_ADU_LENGTH];
+        LeddarBench::LdBenchTimer lTimer;
+
+        for( uint32_t i = 0; i < gPollCount; ++i )
+        {
+            if( aProgram == nullptr )
+            {
+                PollFixedWait( aInterface );
+            }
+            else
+            {
+                for( size_t j = 0; j < aProgram->GetSize(); ++j )
+                {
+                    aProgram->Run( j, lAnswer );
+                }
+            }
+        }
+
+        return gPollCount / ( lTimer.ElapsedNs() / 1e9 );
+    }
+} // namespace
+
+void LeddarBench::BenchModbusFraming( void )
+{
+    LdBenchModbusDevice lDevice;
+    LeddarConnection::LdConnectionInfoModbus lInfo( lDevice.GetSlaveName(), lDevice.GetSlaveName(), 115200, LeddarConnection::LdConnectionInfoModbus::MB_PARITY_NONE, 8, 1,
+                                                   gAddress );
+    LeddarConnection::LdLibModbusSerial lInterface( &lInfo );
+    lInterface.SetGuardTime( 0 ); // End of frame detection only, the stand-in needs no line silence
+
+    LdBenchTimer lTimer;
+    lInterface.Connect();
+    Report( "modbus-framing/connect", lTimer.ElapsedNs() / 1e6, "ms" );
+    Report( "modbus-framing/frame-gap", lInterface.GetFrameGap() / 1000.0, "ms" );
+
+    if( lInterface.GetDeviceType() != LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_VU8 )
+    {
+        throw std::runtime_error( "modbus-framing: wrong device type" );
+    }
+
+    for( const sBenchTransaction &lTransaction : gTransactions )
+    {
+        for( int lPredicted = 0; lPredicted < 2; ++lPredicted )
+        {
+            std::vector<double> lSamples;
+
+            for( uint32_t i = 0; i < gTransactionCount; ++i )
+            {
+                lSamples.push_back( Transaction( lInterface, lTransaction, lPredicted != 0 ) / 1e6 );
+            }
+
+            ReportPercentiles( std::string( "modbus-framing/" ) + lTransaction.mName + ( lPredicted ? "/predicted" : "/timeout" ), lSamples, "ms" );
+        }
+    }
+}
+
+void LeddarBench::BenchModbusProgram( void )
+{
+    LdBenchModbusDevice lDevice( LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_M16, true );
+    LeddarConnection::LdConnectionInfoModbus lInfo( lDevice.GetSlaveName(), lDevice.GetSlaveName(), gBaud, LeddarConnection::LdConnectionInfoModbus::MB_PARITY_NONE, 8, 1,
+                                                   gAddress );
+    LeddarConnection::LdLibModbusSerial lInterface( &lInfo );
+    lInterface.Connect();
+
+    if( lInterface.GetDeviceType() != LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_M16 )
+    {
+        throw std::runtime_error( "modbus-program: wrong device type" );
+    }
+
+    // The M16 acquisition program of LdSensorM16Modbus
+    const uint8_t lEchoesPdu[] = { 0x6A };
+    const uint8_t lStatesPdu[] = { 0x04, 0, 0, 0, 1 };
+    LeddarConnection::LdModbusProgram lProgram( &lInterface );
+    lProgram.Add( gAddress, lEchoesPdu, sizeof( lEchoesPdu ) );
+    lProgram.Add( gAddress, lStatesPdu, sizeof( lStatesPdu ), 2 + 1 + 2 + 2 );
+
+    const uint32_t lEchoesBytes = static_cast<uint32_t>( lProgram.GetRequest( 0 ).size() ) + 2 + 1 + gM16Detections * sizeof( LtComLeddarM16Modbus::sLeddarM16Detections0x6A ) + 4 + 2 + 2;
+    const uint32_t lStatesBytes = static_cast<uint32_t>( lProgram.GetRequest( 1 ).size() ) + 2 + 1 + 2 + 2;
+    const double lLineTimeUs    = ( lEchoesBytes + lStatesBytes ) * gCharTimeUs + lProgram.GetSize() * lInterface.GetGuardTime();
+    const double lCapacity      = 1e6 / lLineTimeUs;
+
+    Report( "modbus-program/guard", lInterface.GetGuardTime() / 1000.0, "ms" );
+    Report( "modbus-program/line-capacity", lCapacity, "frames/s" );
+
+    PollRate( lInterface, &lProgram ); // Warm up
+
+    const double lFixed = PollRate( lInterface, nullptr );
+    Report( "modbus-program/fixed-wait", lFixed, "frames/s" );
+    Report( "modbus-program/fixed-wait/efficiency", 100.0 * lFixed / lCapacity, "%" );
+
+    const double lProgramRate = PollRate( lInterface, &lProgram );
+    Report( "modbus-program/program", lProgramRate, "frames/s" );
+    Report( "modbus-program/program/efficiency", 100.0 * lProgramRate / lCapacity, "%" );
+}
+
+#else
+
+void LeddarBench::BenchModbusFraming( void )
+{
+}
+
+void LeddarBench::BenchModbusProgram( void )
+{
+}
+
+#endif
@@ -0,0 +1,219 @@
+// *****************************************************************************
+// Module..: LeddarBench
+//
+/// \file    BenchPointCloud.cpp
+///
+/// \brief   PointCloud2 buffer build time.
+///          "point-cloud/native" fills the buffer with LdPointCloudBuilder in a single pass.
+///          "point-cloud/staged" does the steps of Leddar_ROS/scripts/device.py in C++ (structured copy of the
+///          echoes, valid mask, per field copy, packing), it is a lower bound of the Python path.
+///          The frames come from the LJR record named by the LEDDAR_BENCH_LJR environment variable,
+///          or from a synthetic 96 x 8 channels, 6 echoes per channel frame.
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LeddarBench.h"
+
+#include "LdLjrRecordReader.h"
+#include "LdPointCloudBuilder.h"
+#include "LdResultEchoes.h"
+#include "LdSensor.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+namespace
+{
+    const uint32_t gSyntheticEchoes = 96 * 8 * 6;
+    const uint32_t gSyntheticFrames = 200;
+
+#pragma pack( push, 1 )
+    struct LdBenchPyEcho // LeddarPyEcho, the get_echoes() layout
+    {
+        uint32_t index;
+        float distance;
+        float amplitude;
+        uint64_t timestamp;
+        uint16_t flag;
+        float x, y, z;
+    };
+#pragma pack( pop )
+
+    struct LdBenchStats
+    {
+        double mNs     = 0;
+        uint64_t mPoints = 0;
+        uint32_t mFrames = 0;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief  The Python path: get_echoes() array, boolean mask, one pass per field, msgify packing.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdBenchStagedPath
+    {
+      public:
+        uint32_t Build( LeddarConnection::LdResultEchoes &aEchoes )
+        {
+            auto lLock = aEchoes.GetUniqueLock( LeddarConnection::B_GET );
+            const std::vector<LeddarConnection::LdEcho> &lEchoes = *aEchoes.GetEchoes( LeddarConnection::B_GET );
+            const uint32_t lCount = aEchoes.GetEchoCount( LeddarConnection::B_GET );
+
+            mEchoes.resize( lCount );
+
+            for( uint32_t i = 0; i < lCount; ++i )
+            {
+                mEchoes[i].index     = lEchoes[i].mChannelIndex;
+                mEchoes[i].distance  = float( lEchoes[i].mDistance ) / aEchoes.GetDistanceScale();
+                mEchoes[i].amplitude = float( lEchoes[i].mAmplitude ) / aEchoes.GetAmplitudeScale();
+                mEchoes[i].timestamp = lEchoes[i].mTimestamp;
+                mEchoes[i].flag      = lEchoes[i].mFlag;
+                mEchoes[i].x         = lEchoes[i].mX;
+                mEchoes[i].y         = lEchoes[i].mY;
+                mEchoes[i].z         = lEchoes[i].mZ;
+            }
+
+            lLock.unlock();
+
+            mMask.resize( lCount );
+
+            for( uint32_t i = 0; i < lCount; ++i )
+            {
+                mMask[i] = ( mEchoes[i].flag & 0x01 ) != 0;
+            }
+
+            mValid.clear();
+
+            for( uint32_t i = 0; i < lCount; ++i )
+            {
+                if( mMask[i] )
+                {
+                    mValid.push_back( mEchoes[i] );
+                }
+            }
+
+            const size_t lWidth = mValid.size();
+            mCloud.resize( lWidth * 4 );
+
+            for( size_t i = 0; i < lWidth; ++i ) mCloud[i * 4]     = mValid[i].x;
+            for( size_t i = 0; i < lWidth; ++i ) mCloud[i * 4 + 1] = mValid[i].y;
+            for( size_t i = 0; i < lWidth; ++i ) mCloud[i * 4 + 2] = mValid[i].z;
+            for( size_t i = 0; i < lWidth; ++i ) mCloud[i * 4 + 3] = mValid[i].amplitude;
+
+            mMessage.resize( lWidth * 4 * sizeof( float ) );
+
+            if( lWidth != 0 )
+            {
+                memcpy( &mMessage[0], &mCloud[0], mMessage.size() );
+            }
+
+            return static_cast<uint32_t>( lWidth );
+        }
+
+      private:
+        std::vector<LdBenchPyEcho> mEchoes;
+        std::vector<bool> mMask;
+        std::vector<LdBenchPyEcho> mValid;
+        std::vector<float> mCloud;
+        std::vector<uint8_t> mMessage;
+    };
+
+    void MeasureFrame( LeddarConnection::LdResultEchoes &aEchoes, LeddarConnection::LdPointCloudBuilder &aBuilder, LdBenchStagedPath &aStaged,
+                       LdBenchStats &aNative, LdBenchStats &aStagedStats )
+    {
+        LeddarBench::LdBenchTimer lTimer;
+        aNative.mPoints += aBuilder.Fill( &aEchoes );
+        aNative.mNs += lTimer.ElapsedNs();
+        ++aNative.mFrames;
+
+        lTimer.Restart();
+        aStagedStats.mPoints += aStaged.Build( aEchoes );
+        aStagedStats.mNs += lTimer.ElapsedNs();
+        ++aStagedStats.mFrames;
+    }
+
+    void ReportStats( const std::string &aName, const LdBenchStats &aStats )
+    {
+        if( aStats.mFrames == 0 || aStats.mNs == 0 )
+        {
+            throw std::runtime_error( aName + ": no frame" );
+        }
+
+        LeddarBench::Report( aName, aStats.mNs / 1000.0 / aStats.mFrames, "us/frame" );
+        LeddarBench::Report( aName + "/throughput", aStats.mPoints / ( aStats.mNs / 1e9 ) / 1e6, "Mpoints/s" );
+    }
+
+    void RunRecord( const char *aFile, LdBenchStats &aNative, LdBenchStats &aStaged )
+    {
+        LeddarRecord::LdLjrRecordReader lReader( aFile );
+        LeddarDevice::LdSensor *lSensor = lReader.CreateSensor(); // Owned by the reader
+        LeddarConnection::LdPointCloudBuilder lBuilder;
+        LdBenchStagedPath lStaged;
+
+        for( uint32_t i = 0; i < lReader.GetRecordSize(); ++i )
+        {
+            MeasureFrame( *lSensor->GetResultEchoes(), lBuilder, lStaged, aNative, aStaged );
+
+            if( i + 1 < lReader.GetRecordSize() )
+            {
+                lReader.ReadNext();
+            }
+        }
+    }
+
+    void RunSynthetic( LdBenchStats &aNative, LdBenchStats &aStaged )
+    {
+        LeddarConnection::LdResultEchoes lEchoes;
+        lEchoes.Init( 65536, 64, gSyntheticEchoes );
+        LeddarConnection::LdPointCloudBuilder lBuilder;
+        LdBenchStagedPath lStaged;
+
+        for( uint32_t lFrame = 0; lFrame < gSyntheticFrames; ++lFrame )
+        {
+            {
+                auto lLock = lEchoes.GetUniqueLock( LeddarConnection::B_SET );
+                std::vector<LeddarConnection::LdEcho> &lBuffer = *lEchoes.GetEchoes( LeddarConnection::B_SET );
+
+                for( uint32_t i = 0; i < gSyntheticEchoes; ++i )
+                {
+                    LeddarConnection::LdEcho &lEcho = lBuffer[i];
+                    lEcho.mChannelIndex = static_cast<uint16_t>( i / 6 );
+                    lEcho.mDistance     = static_cast<int32_t>( ( i * 37 + lFrame ) % ( 100 * 65536 ) );
+                    lEcho.mAmplitude    = ( i * 11 ) % 4096;
+                    lEcho.mFlag         = ( i % 3 == 0 ) ? 0 : 1; // Two thirds are valid
+                    lEcho.mTimestamp    = lFrame;
+                    lEcho.mX            = i * 0.01f;
+                    lEcho.mY            = i * 0.02f;
+                    lEcho.mZ            = i * 0.03f;
+                }
+
+                lEchoes.SetEchoCount( gSyntheticEchoes );
+            }
+
+            lEchoes.Swap();
+            MeasureFrame( lEchoes, lBuilder, lStaged, aNative, aStaged );
+        }
+    }
+} // namespace
+
+void LeddarBench::BenchPointCloud( void )
+{
+    LdBenchStats lNative, lStaged;
+    const char *lRecord = getenv( "LEDDAR_BENCH_LJR" );
+
+    if( lRecord != nullptr && lRecord[0] != '\0' )
+    {
+        RunRecord( lRecord, lNative, lStaged );
+    }
+    else
+    {
+        RunSynthetic( lNative, lStaged );
+    }
+
+    ReportStats( "point-cloud/native", lNative );
+    ReportStats( "point-cloud/staged", lStaged );
+}
@@ -0,0 +1,150 @@
+// *****************************************************************************
+// Module..: LeddarBench
+//
+/// \file    BenchPolling.cpp
+///
+/// \brief   Register write latency of LdConnectionUniversal against a simulated device.
+///          The device is busy for a fixed time after each op code (write enable, write, write disable)
+///          and each bus transaction costs a few microseconds. "polling/fixed" is the previous status
+///          polling (fixed 10 ms sleeps), "polling/adaptive" is LdConnectionUniversal::IsDeviceReady.
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LeddarBench.h"
+
+#include "LdConnectionUniversal.h"
+#include "LdConnectionUniversalDefines.h"
+#include "LtTimeUtils.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+    const uint32_t gWriteCount       = 100;
+    const auto gTransactionDuration  = std::chrono::microseconds( 20 );
+
+    class LdBenchDevice : public LeddarConnection::LdConnectionUniversal
+    {
+      public:
+        explicit LdBenchDevice( bool aFixedPolling ) :
+            LdConnectionUniversal( nullptr, nullptr ),
+            mFixedPolling( aFixedPolling ),
+            mWriteEnabled( false ),
+            mBusyUntil( std::chrono::steady_clock::now() )
+        {
+            mTransferBufferSize   = 256;
+            mTransferInputBuffer  = new uint8_t[mTransferBufferSize];
+            mTransferOutputBuffer = new uint8_t[mTransferBufferSize];
+        }
+
+        void Connect( void ) override {}
+        void Disconnect( void ) override {}
+        void RawConnect( void ) override {}
+        void Reset( LeddarDefines::eResetType, bool ) override {}
+
+        uint16_t InternalBuffers( uint8_t *( &aInputBuffer ), uint8_t *( &aOutputBuffer ) ) override
+        {
+            aInputBuffer  = mTransferInputBuffer;
+            aOutputBuffer = mTransferOutputBuffer;
+            return static_cast<uint16_t>( mTransferBufferSize );
+        }
+
+        void Read( uint8_t aOpCode, uint32_t, const uint32_t &aDataSize, int16_t, const int16_t & ) override
+        {
+            Transaction();
+
+            if( aOpCode == REGMAP_RDSR )
+            {
+                mTransferOutputBuffer[0] = ( std::chrono::steady_clock::now() < mBusyUntil ? 0x01 : 0x00 ) | ( mWriteEnabled ? 0x02 : 0x00 );
+            }
+            else
+            {
+                memset( mTransferOutputBuffer, 0, aDataSize );
+            }
+        }
+
+        void Write( uint8_t aOpCode, uint32_t, const uint32_t &, int16_t, const int16_t &aPostIsReadyTimeout, const int16_t &, const uint16_t & ) override
+        {
+            Transaction();
+
+            if( aOpCode == REGMAP_WREN || aOpCode == REGMAP_WRDIS )
+            {
+                mWriteEnabled = ( aOpCode == REGMAP_WREN );
+            }
+
+            mBusyUntil = std::chrono::steady_clock::now() + ( aOpCode == REGMAP_WRITE ? std::chrono::microseconds( 400 ) : std::chrono::microseconds( 50 ) );
+
+            if( aPostIsReadyTimeout > 0 && !IsDeviceReady( aPostIsReadyTimeout, 0, aOpCode ) )
+            {
+                throw std::runtime_error( "Simulated device not ready" );
+            }
+        }
+
+        bool IsDeviceReady( int32_t aTimeout, int16_t aCRCTry, uint8_t aOpCode ) override
+        {
+            if( !mFixedPolling )
+            {
+                return LdConnectionUniversal::IsDeviceReady( aTimeout, aCRCTry, aOpCode );
+            }
+
+            while( aTimeout > 0 )
+            {
+                if( ( GetStatusRegister( aCRCTry ) & 0x01 ) == 0 )
+                {
+                    return true;
+                }
+
+                LeddarUtils::LtTimeUtils::Wait( 10 );
+                aTimeout -= 10;
+            }
+
+            return false;
+        }
+
+      private:
+        void Transaction( void )
+        {
+            auto lEnd = std::chrono::steady_clock::now() + gTransactionDuration;
+
+            while( std::chrono::steady_clock::now() < lEnd )
+            {
+            }
+        }
+
+        bool mFixedPolling;
+        bool mWriteEnabled;
+        std::chrono::steady_clock::time_point mBusyUntil;
+    };
+
+    void RunPolling( const std::string &aName, bool aFixedPolling )
+    {
+        LdBenchDevice lDevice( aFixedPolling );
+        uint32_t lValue = 0;
+        std::vector<double> lSamples;
+        lSamples.reserve( gWriteCount );
+
+        for( uint32_t i = 0; i < gWriteCount; ++i )
+        {
+            LeddarBench::LdBenchTimer lTimer;
+            lDevice.WriteRegister( 0x100, reinterpret_cast<uint8_t *>( &lValue ), sizeof( lValue ) );
+            lSamples.push_back( lTimer.ElapsedNs() / 1000.0 );
+        }
+
+        LeddarBench::ReportPercentiles( aName, lSamples, "us/register" );
+
+        if( !aFixedPolling )
+        {
+            LeddarBench::Report( aName + "/learned-write", lDevice.GetTypicalReadyLatency( REGMAP_WRITE ), "us" );
+        }
+    }
+} // namespace
+
+void LeddarBench::BenchPolling( void )
+{
+    RunPolling( "polling/fixed", true );
+    RunPolling( "polling/adaptive", false );
+}
@@ -0,0 +1,152 @@
+// *****************************************************************************
+// Module..: LeddarBench
+//
+/// \file    BenchPropertySnapshot.cpp
+///
+/// \brief   Capture and apply of a sensor configuration: 160 integer properties and 16 float properties of
+///          64 values (per channel calibration).
+///          "property-snapshot/capture" is LdPropertiesContainer::Snapshot(), "/capture/string" is a
+///          GetStringValue of each value (LJR recorder, LeddarPy get_properties_snapshot).
+///          "property-snapshot/restore" applies a snapshot with 4 changed properties, "/restore/string" sets
+///          each value with SetStringValue.
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LeddarBench.h"
+
+#include "LdPropertiesContainer.h"
+
+#include <stdexcept>
+
+namespace
+{
+    const uint32_t gIntegerCount = 160;
+    const uint32_t gFloatCount   = 16;
+    const uint32_t gChannels     = 64;
+    const uint32_t gIterations   = 500;
+    const uint32_t gChanged      = 4;
+
+    void Fill( LeddarCore::LdPropertiesContainer &aContainer )
+    {
+        const uint32_t lFeatures = LeddarCore::LdProperty::F_EDITABLE | LeddarCore::LdProperty::F_SAVE;
+
+        for( uint32_t i = 0; i < gIntegerCount; ++i )
+        {
+            LeddarCore::LdIntegerProperty *lProperty =
+                new LeddarCore::LdIntegerProperty( LeddarCore::LdProperty::CAT_CONFIGURATION, lFeatures, 0x1000 + i, static_cast<uint16_t>( i ), 4 );
+            lProperty->SetLimits( 0, 1000000 );
+            lProperty->ForceValue( 0, i * 13 );
+            lProperty->SetClean();
+            aContainer.AddProperty( lProperty );
+        }
+
+        for( uint32_t i = 0; i < gFloatCount; ++i )
+        {
+            LeddarCore::LdFloatProperty *lProperty =
+                new LeddarCore::LdFloatProperty( LeddarCore::LdProperty::CAT_CALIBRATION, lFeatures, 0x2000 + i, static_cast<uint16_t>( 0x100 + i ), 4, 65536, 3 );
+            lProperty->SetCount( gChannels );
+
+            for( uint32_t j = 0; j < gChannels; ++j )
+            {
+                lProperty->ForceRawValue( j, static_cast<int32_t>( ( i * gChannels + j ) * 977 ) - 250000 );
+            }
+
+            lProperty->SetClean();
+            aContainer.AddProperty( lProperty );
+        }
+    }
+
+    // Changes gChanged properties of the container
+    void Change( LeddarCore::LdPropertiesContainer &aContainer, uint32_t aIteration )
+    {
+        for( uint32_t i = 0; i < gChanged; ++i )
+        {
+            aContainer.GetIntegerProperty( 0x1000 + ( aIteration + i * 37 ) % gIntegerCount )->ForceValue( 0, 500000 + aIteration );
+        }
+    }
+
+    void ReportNs( const std::string &aName, double aNs, uint32_t aIterations )
+    {
+        LeddarBench::Report( aName, aNs / aIterations / 1000.0, "us/configuration" );
+    }
+} // namespace
+
+void LeddarBench::BenchPropertySnapshot( void )
+{
+    LeddarCore::LdPropertiesContainer lContainer;
+    Fill( lContainer );
+
+    const std::map<uint32_t, LeddarCore::LdProperty *> *lContent = lContainer.GetContent();
+    std::vector<std::vector<std::string>> lStrings( lContent->size() );
+    std::vector<uint8_t> lSnapshot;
+    double lCaptureNs = 0, lCaptureStringNs = 0;
+    size_t lChecksum = 0;
+
+    for( uint32_t lIteration = 0; lIteration < gIterations; ++lIteration )
+    {
+        LdBenchTimer lTimer;
+        lSnapshot = lContainer.Snapshot();
+        lCaptureNs += lTimer.ElapsedNs();
+        lChecksum += lSnapshot.size();
+
+        lTimer.Restart();
+        size_t lIndex = 0;
+
+        for( std::map<uint32_t, LeddarCore::LdProperty *>::const_iterator lIter = lContent->cbegin(); lIter != lContent->cend(); ++lIter, ++lIndex )
+        {
+            lStrings[lIndex].resize( lIter->second->Count() );
+
+            for( size_t i = 0; i < lIter->second->Count(); ++i )
+            {
+                lStrings[lIndex][i] = lIter->second->GetStringValue( i );
+            }
+        }
+
+        lCaptureStringNs += lTimer.ElapsedNs();
+    }
+
+    ReportNs( "property-snapshot/capture", lCaptureNs, gIterations );
+    ReportNs( "property-snapshot/capture/string", lCaptureStringNs, gIterations );
+    Report( "property-snapshot/size", static_cast<double>( lSnapshot.size() ), "bytes" );
+
+    double lRestoreNs = 0, lRestoreStringNs = 0;
+
+    for( uint32_t lIteration = 0; lIteration < gIterations; ++lIteration )
+    {
+        Change( lContainer, lIteration );
+        LdBenchTimer lTimer;
+        size_t lWritten = lContainer.Restore( lSnapshot );
+        lRestoreNs += lTimer.ElapsedNs();
+
+        if( lWritten != gChanged || !lContainer.Diff( lSnapshot ).empty() || lContainer.IsModified( LeddarCore::LdProperty::CAT_CONFIGURATION ) )
+        {
+            throw std::runtime_error( "property-snapshot: restore did not write only the changed properties" );
+        }
+
+        Change( lContainer, lIteration );
+        lTimer.Restart();
+        size_t lIndex = 0;
+
+        for( std::map<uint32_t, LeddarCore::LdProperty *>::const_iterator lIter = lContent->cbegin(); lIter != lContent->cend(); ++lIter, ++lIndex )
+        {
+            for( size_t i = 0; i < lStrings[lIndex].size(); ++i )
+            {
+                lIter->second->SetStringValue( i, lStrings[lIndex][i] );
+            }
+        }
+
+        lRestoreStringNs += lTimer.ElapsedNs();
+        lChecksum += lContainer.Diff( lSnapshot ).size();
+    }
+
+    ReportNs( "property-snapshot/restore", lRestoreNs, gIterations );
+    ReportNs( "property-snapshot/restore/string", lRestoreStringNs, gIterations );
+
+    if( lChecksum == 0 )
+    {
+        throw std::runtime_error( "property-snapshot: no snapshot" );
+    }
+}
@@ -0,0 +1,264 @@
+// *****************************************************************************
+// Module..: LeddarBench
+//
+/// \file    BenchRangeImage.cpp
+///
+/// \brief   Dense range image of synthetic Pixell frames (96 x 8 channels, 0 to 6 echoes per channel, K = 6).
+///          "range-image/fill" is LdRangeImage::Fill, "/swap" is LdResultEchoes::Swap with the range image
+///          ("/swap/sparse" without it), "/sparse-to-dense" is the application side path: copy of the echoes to
+///          a new array, new zeroed images, and a scatter with the pixel of each echo computed from the
+///          channel properties ("/sparse-to-dense/lut" with the pixel of each echo computed once per frame).
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LeddarBench.h"
+
+#include "LdIntegerProperty.h"
+#include "LdPropertiesContainer.h"
+#include "LdPropertyIds.h"
+#include "LdRangeImage.h"
+#include "LdResultEchoes.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+    const uint16_t gWidth          = 96;
+    const uint16_t gHeight         = 8;
+    const uint32_t gChannels       = gWidth * gHeight;
+    const uint32_t gEchoesPerPixel = 6;
+    const uint32_t gCapacity       = gChannels * gEchoesPerPixel;
+    const uint32_t gFrames         = 200;
+    const uint32_t gDistanceScale  = 65536;
+    const uint32_t gAmplitudeScale = 64;
+
+    // Echo as copied by LeddarPy get_echoes
+    struct LdBenchPyEcho
+    {
+        uint32_t mIndex;
+        float mDistance;
+        float mAmplitude;
+        uint64_t mTimestamp;
+        uint16_t mFlag;
+        float mX, mY, mZ;
+    };
+
+    struct LdBenchFrames
+    {
+        LdBenchFrames( void ) : mFrames( gFrames )
+        {
+            uint64_t lState = 0x2545F4914F6CDD1Dull;
+            auto lRandom    = [&lState]() {
+                lState = lState * 6364136223846793005ull + 1442695040888963407ull;
+                return static_cast<uint32_t>( lState >> 33 );
+            };
+
+            for( uint32_t lFrame = 0; lFrame < gFrames; ++lFrame )
+            {
+                for( uint32_t lChannel = 0; lChannel < gChannels; ++lChannel )
+                {
+                    const uint32_t lCount = lRandom() % ( gEchoesPerPixel + 1 );
+
+                    for( uint32_t i = 0; i < lCount; ++i )
+                    {
+                        LeddarConnection::LdEcho lEcho;
+                        lEcho.mChannelIndex = static_cast<uint16_t>( lChannel );
+                        lEcho.mDistance     = static_cast<int32_t>( ( 1 + i * 10 ) * gDistanceScale + lRandom() % gDistanceScale );
+                        lEcho.mAmplitude    = lRandom() % ( 1000 * gAmplitudeScale );
+                        lEcho.mBase         = 0;
+                        lEcho.mFlag         = 1;
+                        lEcho.mTimestamp    = lFrame;
+                        lEcho.mX            = 0;
+                        lEcho.mY            = 0;
+                        lEcho.mZ            = 0;
+                        mFrames[lFrame].push_back( lEcho );
+                    }
+                }
+
+                mEchoes += mFrames[lFrame].size();
+            }
+        }
+
+        std::vector<std::vector<LeddarConnection::LdEcho>> mFrames;
+        uint64_t mEchoes = 0;
+    };
+
+    struct LdBenchImage
+    {
+        std::vector<float> mDistances;
+        std::vector<float> mAmplitudes;
+        std::vector<uint8_t> mCounts;
+    };
+
+    void Report( const std::string &aName, double aNs, uint64_t aAllocations, uint64_t aEchoes )
+    {
+        LeddarBench::Report( aName, aNs / gFrames / 1000.0, "us/frame" );
+        LeddarBench::Report( aName + "/throughput", static_cast<double>( aEchoes ) / ( aNs / 1e9 ) / 1e6, "Mechoes/s" );
+        LeddarBench::Report( aName + "/allocations", static_cast<double>( aAllocations ) / gFrames, "allocations/frame" );
+    }
+
+    void Check( const std::string &aName, const LdBenchImage &aImage, const LeddarConnection::LdRangeImage &aRangeImage )
+    {
+        if( aImage.mDistances != aRangeImage.GetDistances() || aImage.mAmplitudes != aRangeImage.GetAmplitudes() || aImage.mCounts != aRangeImage.GetCounts() )
+        {
+            throw std::runtime_error( aName + ": range image mismatch" );
+        }
+    }
+
+    void RunFill( const LdBenchFrames &aFrames, std::vector<LdBenchImage> &aImages )
+    {
+        LeddarConnection::LdRangeImage lRangeImage;
+        lRangeImage.Init( gWidth, gHeight, gEchoesPerPixel );
+        double lNs            = 0;
+        uint64_t lAllocations = 0;
+
+        for( uint32_t i = 0; i < gFrames; ++i )
+        {
+            const uint64_t lAllocationStart = LeddarBench::GetAllocationCount();
+            LeddarBench::LdBenchTimer lTimer;
+            lRangeImage.Fill( aFrames.mFrames[i].data(), static_cast<uint32_t>( aFrames.mFrames[i].size() ), gDistanceScale, gAmplitudeScale );
+            lNs += lTimer.ElapsedNs();
+            lAllocations += LeddarBench::GetAllocationCount() - lAllocationStart;
+
+            aImages[i].mDistances  = lRangeImage.GetDistances();
+            aImages[i].mAmplitudes = lRangeImage.GetAmplitudes();
+            aImages[i].mCounts     = lRangeImage.GetCounts();
+        }
+
+        Report( "range-image/fill", lNs, lAllocations, aFrames.mEchoes );
+    }
+
+    void RunSwap( const std::string &aName, const LdBenchFrames &aFrames, const std::vector<LdBenchImage> &aImages, bool aRangeImage )
+    {
+        LeddarConnection::LdResultEchoes lResult;
+        lResult.Init( gDistanceScale, gAmplitudeScale, gCapacity );
+
+        if( aRangeImage )
+            lResult.SetRangeImage( gWidth, gHeight, gEchoesPerPixel );
+
+        double lNs            = 0;
+        uint64_t lAllocations = 0;
+
+        for( uint32_t i = 0; i < gFrames; ++i )
+        {
+            {
+                auto lLock = lResult.GetUniqueLock( LeddarConnection::B_SET );
+                memcpy( lResult.GetEchoes( LeddarConnection::B_SET )->data(), aFrames.mFrames[i].data(), aFrames.mFrames[i].size() * sizeof( LeddarConnection::LdEcho ) );
+                lResult.SetEchoCount( static_cast<uint32_t>( aFrames.mFrames[i].size() ) );
+            }
+
+            const uint64_t lAllocationStart = LeddarBench::GetAllocationCount();
+            LeddarBench::LdBenchTimer lTimer;
+            lResult.Swap();
+            lNs += lTimer.ElapsedNs();
+            lAllocations += LeddarBench::GetAllocationCount() - lAllocationStart;
+
+            if( aRangeImage )
+            {
+                auto lLock = lResult.GetUniqueLock( LeddarConnection::B_GET );
+                Check( aName, aImages[i], lResult.GetRangeImage( LeddarConnection::B_GET ) );
+            }
+        }
+
+        Report( aName, lNs, lAllocations, aFrames.mEchoes );
+    }
+
+    // Pixel of an echo from the sensor channel properties, like LdSensorPixell::EchoChannelIndexToSensorChannelIndex
+    uint32_t GetPixel( const LeddarCore::LdPropertiesContainer &aProperties, uint32_t aChannelIndex )
+    {
+        const uint32_t lHChannelCount = aProperties.GetIntegerProperty( LeddarCore::LdPropertyIds::ID_HSEGMENT )->ValueT<uint32_t>( 0 );
+        const uint32_t lVChannelCount = aProperties.GetIntegerProperty( LeddarCore::LdPropertyIds::ID_VSEGMENT )->ValueT<uint32_t>( 0 );
+        const uint32_t lChannelIndex  = aChannelIndex % ( lHChannelCount * lVChannelCount );
+        return ( lChannelIndex / lHChannelCount ) * lHChannelCount + lChannelIndex % lHChannelCount;
+    }
+
+    void RunSparseToDense( const std::string &aName, const LdBenchFrames &aFrames, const std::vector<LdBenchImage> &aImages, bool aLut )
+    {
+        LeddarCore::LdPropertiesContainer lProperties;
+        lProperties.AddProperty( new LeddarCore::LdIntegerProperty( LeddarCore::LdProperty::CAT_INFO, LeddarCore::LdProperty::F_NONE, LeddarCore::LdPropertyIds::ID_HSEGMENT, 0, 2 ) );
+        lProperties.AddProperty( new LeddarCore::LdIntegerProperty( LeddarCore::LdProperty::CAT_INFO, LeddarCore::LdProperty::F_NONE, LeddarCore::LdPropertyIds::ID_VSEGMENT, 0, 2 ) );
+        lProperties.GetIntegerProperty( LeddarCore::LdPropertyIds::ID_HSEGMENT )->ForceValue( 0, gWidth );
+        lProperties.GetIntegerProperty( LeddarCore::LdPropertyIds::ID_VSEGMENT )->ForceValue( 0, gHeight );
+
+        const float lDistanceFactor  = 1.0f / gDistanceScale;
+        const float lAmplitudeFactor = 1.0f / gAmplitudeScale;
+        double lNs                   = 0;
+        uint64_t lAllocations        = 0;
+
+        for( uint32_t i = 0; i < gFrames; ++i )
+        {
+            const std::vector<LeddarConnection::LdEcho> &lFrame = aFrames.mFrames[i];
+            const uint64_t lAllocationStart                     = LeddarBench::GetAllocationCount();
+            LeddarBench::LdBenchTimer lTimer;
+
+            // get_echoes
+            std::vector<LdBenchPyEcho> lEchoes( lFrame.size() );
+
+            for( size_t j = 0; j < lFrame.size(); ++j )
+            {
+                lEchoes[j].mIndex     = lFrame[j].mChannelIndex;
+                lEchoes[j].mDistance  = static_cast<float>( lFrame[j].mDistance ) * lDistanceFactor;
+                lEchoes[j].mAmplitude = static_cast<float>( lFrame[j].mAmplitude ) * lAmplitudeFactor;
+                lEchoes[j].mTimestamp = lFrame[j].mTimestamp;
+                lEchoes[j].mFlag      = lFrame[j].mFlag;
+                lEchoes[j].mX         = lFrame[j].mX;
+                lEchoes[j].mY         = lFrame[j].mY;
+                lEchoes[j].mZ         = lFrame[j].mZ;
+            }
+
+            // numpy.zeros and scatter
+            LdBenchImage lImage;
+            lImage.mDistances.assign( gCapacity, 0 );
+            lImage.mAmplitudes.assign( gCapacity, 0 );
+            lImage.mCounts.assign( gChannels, 0 );
+            std::vector<uint32_t> lPixels;
+
+            if( aLut )
+            {
+                lPixels.resize( lEchoes.size() );
+
+                for( size_t j = 0; j < lEchoes.size(); ++j )
+                    lPixels[j] = lEchoes[j].mIndex % gChannels;
+            }
+
+            for( size_t j = 0; j < lEchoes.size(); ++j )
+            {
+                const uint32_t lPixel = aLut ? lPixels[j] : GetPixel( lProperties, lEchoes[j].mIndex );
+
+                if( lImage.mCounts[lPixel] >= gEchoesPerPixel )
+                    continue;
+
+                const size_t lSlot        = lPixel * gEchoesPerPixel + lImage.mCounts[lPixel]++;
+                lImage.mDistances[lSlot]  = lEchoes[j].mDistance;
+                lImage.mAmplitudes[lSlot] = lEchoes[j].mAmplitude;
+            }
+
+            lNs += lTimer.ElapsedNs();
+            lAllocations += LeddarBench::GetAllocationCount() - lAllocationStart;
+
+            if( lImage.mDistances != aImages[i].mDistances || lImage.mAmplitudes != aImages[i].mAmplitudes || lImage.mCounts != aImages[i].mCounts )
+            {
+                throw std::runtime_error( aName + ": range image mismatch" );
+            }
+        }
+
+        Report( aName, lNs, lAllocations, aFrames.mEchoes );
+    }
+} // namespace
+
+void LeddarBench::BenchRangeImage( void )
+{
+    const LdBenchFrames lFrames;
+    std::vector<LdBenchImage> lImages( gFrames );
+
+    LeddarBench::Report( "range-image/echoes", static_cast<double>( lFrames.mEchoes ) / gFrames, "echoes/frame" );
+    RunFill( lFrames, lImages );
+    RunSwap( "range-image/swap/sparse", lFrames, lImages, false );
+    RunSwap( "range-image/swap", lFrames, lImages, true );
+    RunSparseToDense( "range-image/sparse-to-dense", lFrames, lImages, false );
+    RunSparseToDense( "range-image/sparse-to-dense/lut", lFrames, lImages, true );
+}
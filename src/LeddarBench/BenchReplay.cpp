@@ -0,0 +1,673 @@
+// *****************************************************************************
+// Module..: LeddarBench
+//
+/// \file    BenchReplay.cpp
+///
+/// \brief   Data path of the ethernet sensors, from the socket read to the NEW_DATA signal.
+///          Captured traffic is replayed through an in-memory LdInterfaceEthernet into the real protocol
+///          (LdProtocolLeddartechEthernet, LdProtocolLeddartechEthernetUDP, LdProtocolLeddartechEthernetPixell)
+///          and sensor (LdSensorLeddarAuto, LdSensorPixell) classes. Each capture is played once.
+///          "replay/auto-tcp", "replay/auto-udp" and "replay/pixell-rtp" are generated synthetically,
+///          "replay/capture" is the file named by the LEDDAR_BENCH_CAPTURE environment variable:
+///            sCaptureHeader, then for each datagram (UDP, RTP) or stream chunk (TCP): uint32_t size, data.
+///          The SDK does not write captures of a sensor: they are produced externally, from a packet capture of
+///          the data server port (payload of each datagram, or the TCP stream) and the sensor constants.
+///          LEDDAR_BENCH_SAVE_CAPTURES=<directory> writes the synthetic captures in this format.
+///          Reported per capture: frames/s, ns/echo, allocations/frame, the mean time per frame of each
+///          pipeline stage (BUILD_PIPELINE_STATS) and the allocations of the cartesian stage.
+///          "<capture>/ljr-recorder" replays the capture again with a LdLjrRecorder writing a temporary file:
+///          frames/s, the recorder cost (ns/frame) and the record size (bytes/frame).
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LeddarBench.h"
+
+#include "LtDefines.h"
+
+#if defined( BUILD_ETHERNET ) && defined( BUILD_AUTO )
+
+#include "LdConnectionInfoEthernet.h"
+#include "LdInterfaceEthernet.h"
+#include "LdLjrRecorder.h"
+#include "LdPipelineStats.h"
+#include "LdPropertyIds.h"
+#include "LdProtocolLeddartechEthernet.h"
+#include "LdProtocolLeddartechEthernetPixell.h"
+#include "LdProtocolLeddartechEthernetUDP.h"
+#include "LdResultEchoes.h"
+#include "LdSensorLeddarAuto.h"
+#include "LdSensorPixell.h"
+
+#include "comm/LtComLeddarTechPublic.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+    const uint32_t gSyntheticFrames   = 200;
+    const uint32_t gWarmupFrames      = 5;     // Buffers are sized on the first frames, they are not measured
+    const uint32_t gFragmentEchoes    = 512;   // Echoes per UDP datagram, fits in the default protocol buffer
+    const uint32_t gRtpPayloadSize    = 1400;
+    const uint8_t gRtpPayloadPixell   = 0x40;
+
+    enum eTransport
+    {
+        TR_TCP = 0, ///< Stream of answers (TCP data server)
+        TR_UDP = 1, ///< One datagram per answer fragment (UDP data server)
+        TR_RTP = 2  ///< RTP packets of the Pixell UDP data server
+    };
+
+    enum eSensor
+    {
+        SE_LEDDARAUTO = 0,
+        SE_PIXELL     = 1
+    };
+
+#pragma pack( push, 1 )
+    struct sCaptureHeader
+    {
+        char mMagic[4];                 ///< "LDRP"
+        uint8_t mTransport;             ///< eTransport
+        uint8_t mSensor;                ///< eSensor
+        uint8_t mMaxEchoesPerChannel;
+        uint8_t mReserved;
+        uint16_t mHSegment;
+        uint16_t mVSegment;
+        uint16_t mSubHSegment;          ///< Pixell only
+        uint16_t mReserved2;
+        uint32_t mDistanceScale;
+        uint32_t mAmplitudeScale;
+        float mHFov;
+        float mVFov;
+    };
+#pragma pack( pop )
+
+    struct LdCapture
+    {
+        sCaptureHeader mHeader;
+        std::vector<std::vector<uint8_t>> mRecords; ///< Datagrams (UDP, RTP) or chunks of the stream (TCP)
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief  Serves the records of a capture as a TCP stream or as UDP datagrams. Sends are discarded.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdReplayEthernet : public LeddarConnection::LdInterfaceEthernet
+    {
+      public:
+        LdReplayEthernet( const LeddarConnection::LdConnectionInfoEthernet *aConnectionInfo, const std::vector<std::vector<uint8_t>> &aRecords ) :
+            LdInterfaceEthernet( aConnectionInfo ),
+            mRecords( aRecords ),
+            mRecord( 0 ),
+            mOffset( 0 ),
+            mIsConnected( false ),
+            mTruncated( 0 )
+        {
+        }
+
+        bool AtEnd( void ) const { return mRecord >= mRecords.size(); }
+        bool IsConnected( void ) const override { return mIsConnected; }
+
+        void Connect( void ) override { mIsConnected = true; }
+        void Disconnect( void ) override { mIsConnected = false; }
+        void Send( uint8_t *, uint32_t ) override {}
+        void FlushBuffer( void ) override {}
+        uint32_t GetTCPRxIpAddress() override { return 0; }
+
+        size_t Receive( uint8_t *aBuffer, uint32_t aSize ) override
+        {
+            uint32_t lRead = 0;
+
+            while( lRead < aSize )
+            {
+                if( AtEnd() )
+                {
+                    throw std::runtime_error( "Replay: end of the capture in the middle of an answer" );
+                }
+
+                const std::vector<uint8_t> &lRecord = mRecords[mRecord];
+                size_t lCount                       = std::min<size_t>( aSize - lRead, lRecord.size() - mOffset );
+                memcpy( aBuffer + lRead, lRecord.data() + mOffset, lCount );
+                lRead += static_cast<uint32_t>( lCount );
+                mOffset += lCount;
+
+                if( mOffset == lRecord.size() )
+                {
+                    ++mRecord;
+                    mOffset = 0;
+                }
+            }
+
+            return lRead;
+        }
+
+        void SendTo( const std::string &, uint16_t, const uint8_t *, uint32_t ) override {}
+
+        uint32_t ReceiveFrom( std::string &, uint16_t &, uint8_t *aData, uint32_t aSize ) override
+        {
+            sScatterBuffer lBuffer = { aData, aSize };
+            return ReceiveFromScatter( &lBuffer, 1 );
+        }
+
+        void OpenUDPSocket( uint32_t, uint32_t, bool ) override { mIsConnected = true; }
+        void CloseUDPSocket( void ) override { mIsConnected = false; }
+        uint32_t GetUDPPort() override { return 0; }
+        int SelectUDP( uint32_t ) override { return AtEnd() ? 0 : 1; }
+
+        uint32_t ReceiveFromScatter( const sScatterBuffer *aBuffers, uint32_t aCount ) override
+        {
+            if( AtEnd() )
+            {
+                throw std::runtime_error( "Replay: end of the capture" );
+            }
+
+            const std::vector<uint8_t> &lRecord = mRecords[mRecord++];
+            uint32_t lRead                      = 0;
+
+            for( uint32_t i = 0; i < aCount && lRead < lRecord.size(); ++i )
+            {
+                uint32_t lCount = std::min<uint32_t>( aBuffers[i].mSize, static_cast<uint32_t>( lRecord.size() ) - lRead );
+                memcpy( aBuffers[i].mData, lRecord.data() + lRead, lCount );
+                lRead += lCount;
+            }
+
+            if( lRead < lRecord.size() )
+            {
+                ++mTruncated; // As the socket: a truncated datagram is dropped
+                return 0;
+            }
+
+            return lRead;
+        }
+
+        uint64_t GetUDPTruncatedCount( void ) const override { return mTruncated; }
+
+      private:
+        const std::vector<std::vector<uint8_t>> &mRecords;
+        size_t mRecord;
+        size_t mOffset;
+        bool mIsConnected;
+        uint64_t mTruncated;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief  Sensor without configuration server: the constants come from the capture header and the data
+    ///         protocol is attached directly. Counts the allocations of ComputeCartesianCoordinates.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class T> class LdReplaySensor : public T
+    {
+      public:
+        LdReplaySensor( void );
+
+        void Attach( LeddarConnection::LdProtocolLeddarTech *aProtocol, bool aTCP )
+        {
+            this->mProtocolData    = aProtocol;
+            this->mIsTCPDataServer = aTCP;
+            this->mDataMask        = LeddarDevice::LdSensor::DM_ECHOES; // SetDataMask would need the configuration server
+            aProtocol->SetDataServer( true );
+            aProtocol->Connect();
+        }
+
+        void SetConstants( const sCaptureHeader &aHeader )
+        {
+            using namespace LeddarCore;
+
+            LdPropertiesContainer *lProperties = this->GetProperties();
+            lProperties->GetIntegerProperty( LdPropertyIds::ID_HSEGMENT )->ForceValue( 0, aHeader.mHSegment );
+            lProperties->GetIntegerProperty( LdPropertyIds::ID_VSEGMENT )->ForceValue( 0, aHeader.mVSegment );
+            lProperties->GetIntegerProperty( LdPropertyIds::ID_MAX_ECHOES_PER_CHANNEL )->ForceValue( 0, aHeader.mMaxEchoesPerChannel );
+            lProperties->GetIntegerProperty( LdPropertyIds::ID_DISTANCE_SCALE )->ForceValue( 0, aHeader.mDistanceScale );
+            lProperties->GetIntegerProperty( LdPropertyIds::ID_RAW_AMP_SCALE )->ForceValue( 0, aHeader.mAmplitudeScale );
+            lProperties->GetFloatProperty( LdPropertyIds::ID_HFOV )->ForceValue( 0, aHeader.mHFov );
+            lProperties->GetFloatProperty( LdPropertyIds::ID_VFOV )->ForceValue( 0, aHeader.mVFov );
+
+            if( aHeader.mSensor == SE_PIXELL )
+            {
+                lProperties->GetIntegerProperty( LdPropertyIds::ID_SUB_HSEGMENT )->ForceValue( 0, aHeader.mSubHSegment );
+            }
+
+            // Same as LdSensorLeddarAuto::GetConstants
+            LeddarConnection::LdResultEchoes *lEchoes = this->GetResultEchoes();
+            lEchoes->Init( aHeader.mDistanceScale, aHeader.mAmplitudeScale, static_cast<uint32_t>( aHeader.mHSegment ) * aHeader.mVSegment * aHeader.mMaxEchoesPerChannel );
+            lEchoes->SetVChan( aHeader.mVSegment );
+            lEchoes->SetHChan( aHeader.mHSegment );
+            lEchoes->SetVFOV( aHeader.mVFov );
+            lEchoes->SetHFOV( aHeader.mHFov );
+            lEchoes->Swap();
+        }
+
+        // The data protocol is the only connection (the recorder reads the device type from it)
+        LeddarConnection::LdConnection *GetConnection( void ) override { return this->mProtocolData; }
+
+        uint64_t GetCartesianAllocations( void ) const { return mCartesianAllocations; }
+        void ResetCartesianAllocations( void ) { mCartesianAllocations = 0; }
+
+      protected:
+        void ComputeCartesianCoordinates() override
+        {
+            uint64_t lStart = LeddarBench::GetAllocationCount();
+            T::ComputeCartesianCoordinates();
+            mCartesianAllocations += LeddarBench::GetAllocationCount() - lStart;
+        }
+
+      private:
+        uint64_t mCartesianAllocations = 0;
+    };
+
+    template <> LdReplaySensor<LeddarDevice::LdSensorLeddarAuto>::LdReplaySensor( void ) : LeddarDevice::LdSensorLeddarAuto( nullptr ) {}
+    template <> LdReplaySensor<LeddarDevice::LdSensorPixell>::LdReplaySensor( void ) : LeddarDevice::LdSensorLeddarAuto( nullptr ), LeddarDevice::LdSensorPixell( nullptr ) {}
+
+    class LdFrameCounter : public LeddarCore::LdObject
+    {
+      public:
+        explicit LdFrameCounter( LeddarConnection::LdResultEchoes *aEchoes ) :
+            mEchoes( aEchoes ),
+            mFrames( 0 ),
+            mEchoCount( 0 )
+        {
+            mEchoes->ConnectSignal( this, NEW_DATA );
+        }
+
+        ~LdFrameCounter() { mEchoes->DisconnectSignal( this, NEW_DATA ); }
+
+        void Callback( LdObject *, const SIGNALS, void * ) override
+        {
+            auto lLock = mEchoes->GetUniqueLock( LeddarConnection::B_GET );
+            mEchoCount += mEchoes->GetEchoCount( LeddarConnection::B_GET );
+            ++mFrames;
+        }
+
+        LeddarConnection::LdResultEchoes *mEchoes;
+        uint64_t mFrames;
+        uint64_t mEchoCount;
+    };
+
+    // Synthetic captures
+
+    size_t BeginAnswer( std::vector<uint8_t> &aBuffer )
+    {
+        size_t lStart = aBuffer.size();
+        aBuffer.resize( lStart + sizeof( LtComLeddarTechPublic::sLtCommAnswerHeader ) );
+        return lStart;
+    }
+
+    void EndAnswer( std::vector<uint8_t> &aBuffer, size_t aStart )
+    {
+        LtComLeddarTechPublic::sLtCommAnswerHeader lHeader = {};
+        lHeader.mAnswerCode                                = LtComLeddarTechPublic::LT_COMM_ANSWER_OK;
+        lHeader.mAnswerSize                                = static_cast<uint32_t>( aBuffer.size() - aStart );
+        lHeader.mRequestCode                               = LtComLeddarTechPublic::LT_COMM_DATASRV_REQUEST_SEND_ECHOES;
+        memcpy( &aBuffer[aStart], &lHeader, sizeof( lHeader ) );
+    }
+
+    void AddElement( std::vector<uint8_t> &aBuffer, uint16_t aId, uint32_t aCount, uint32_t aSize, const void *aData )
+    {
+        LtComLeddarTechPublic::sLtCommElementHeader lHeader = { aId, static_cast<uint16_t>( aCount ), aSize };
+        const uint8_t *lHeaderBytes                        = reinterpret_cast<const uint8_t *>( &lHeader );
+        const uint8_t *lData                               = static_cast<const uint8_t *>( aData );
+        aBuffer.insert( aBuffer.end(), lHeaderBytes, lHeaderBytes + sizeof( lHeader ) );
+        aBuffer.insert( aBuffer.end(), lData, lData + aCount * aSize );
+    }
+
+    struct LdSyntheticFrame
+    {
+        uint32_t mTimestamp;
+        uint64_t mTimestamp64;
+        std::vector<uint32_t> mAmplitudes;
+        std::vector<int32_t> mDistances;
+        std::vector<uint16_t> mChannels;
+        std::vector<uint16_t> mFlags;
+    };
+
+    // One to three echoes per channel, as a sensor facing a scene
+    void GenerateFrame( const sCaptureHeader &aHeader, uint32_t aFrame, LdSyntheticFrame &aData )
+    {
+        const uint32_t lChannels = static_cast<uint32_t>( aHeader.mHSegment ) * aHeader.mVSegment;
+        aData.mTimestamp         = 1000 + aFrame * 40;
+        aData.mTimestamp64       = 1700000000000000ULL + aFrame * 40000ULL;
+        aData.mAmplitudes.clear();
+        aData.mDistances.clear();
+        aData.mChannels.clear();
+        aData.mFlags.clear();
+
+        for( uint32_t lChannel = 0; lChannel < lChannels; ++lChannel )
+        {
+            for( uint32_t lEcho = 0; lEcho <= ( lChannel + aFrame ) % 3 && lEcho < aHeader.mMaxEchoesPerChannel; ++lEcho )
+            {
+                aData.mAmplitudes.push_back( ( lChannel * 13 + lEcho * 101 ) % ( 64 * aHeader.mAmplitudeScale ) );
+                aData.mDistances.push_back( static_cast<int32_t>( ( ( lChannel * 7 + aFrame ) % 50 + lEcho * 20 + 1 ) * aHeader.mDistanceScale ) );
+                aData.mChannels.push_back( static_cast<uint16_t>( lChannel ) );
+                aData.mFlags.push_back( 1 );
+            }
+        }
+    }
+
+    void AddEchoes( std::vector<uint8_t> &aBuffer, const LdSyntheticFrame &aData, uint32_t aStart, uint32_t aCount, bool aLast )
+    {
+        using namespace LtComLeddarTechPublic;
+
+        const uint32_t lStartAndCount[2] = { aStart, aCount };
+        const uint8_t lStatus            = aLast ? 1 : 0;
+
+        AddElement( aBuffer, LT_COMM_ID_TIMESTAMP, 1, sizeof( aData.mTimestamp ), &aData.mTimestamp );
+        AddElement( aBuffer, LT_COMM_ID_AUTO_TIMESTAMP64, 1, sizeof( aData.mTimestamp64 ), &aData.mTimestamp64 );
+        AddElement( aBuffer, LT_COMM_ID_AUTO_NUMBER_DATA_SENT, 2, sizeof( uint32_t ), lStartAndCount );
+        AddElement( aBuffer, LT_COMM_ID_AUTO_ECHOES_AMPLITUDE, aCount, sizeof( uint32_t ), &aData.mAmplitudes[aStart] );
+        AddElement( aBuffer, LT_COMM_ID_AUTO_ECHOES_DISTANCE, aCount, sizeof( int32_t ), &aData.mDistances[aStart] );
+        AddElement( aBuffer, LT_COMM_ID_AUTO_ECHOES_CHANNEL_INDEX, aCount, sizeof( uint16_t ), &aData.mChannels[aStart] );
+        AddElement( aBuffer, LT_COMM_ID_AUTO_ECHOES_VALID, aCount, sizeof( uint16_t ), &aData.mFlags[aStart] );
+        AddElement( aBuffer, LT_COMM_ID_STATUS, 1, sizeof( lStatus ), &lStatus );
+    }
+
+    void AddRtpPacket( LdCapture &aCapture, uint16_t aSequence, uint32_t aTimestamp, bool aMarker, const uint8_t *aPayload, size_t aSize )
+    {
+        const uint8_t lHeader[12] = { 0x80,
+                                      static_cast<uint8_t>( ( aMarker ? 0x80 : 0x00 ) | gRtpPayloadPixell ),
+                                      static_cast<uint8_t>( aSequence >> 8 ),
+                                      static_cast<uint8_t>( aSequence ),
+                                      static_cast<uint8_t>( aTimestamp >> 24 ),
+                                      static_cast<uint8_t>( aTimestamp >> 16 ),
+                                      static_cast<uint8_t>( aTimestamp >> 8 ),
+                                      static_cast<uint8_t>( aTimestamp ),
+                                      0, 0, 0, 1 };
+
+        std::vector<uint8_t> lPacket( lHeader, lHeader + sizeof( lHeader ) );
+        lPacket.insert( lPacket.end(), aPayload, aPayload + aSize );
+        aCapture.mRecords.push_back( std::move( lPacket ) );
+    }
+
+    LdCapture GenerateCapture( eTransport aTransport, eSensor aSensor )
+    {
+        LdCapture lCapture;
+        sCaptureHeader &lHeader = lCapture.mHeader;
+        memset( &lHeader, 0, sizeof( lHeader ) );
+        memcpy( lHeader.mMagic, "LDRP", 4 );
+        lHeader.mTransport           = static_cast<uint8_t>( aTransport );
+        lHeader.mSensor              = static_cast<uint8_t>( aSensor );
+        lHeader.mMaxEchoesPerChannel = 6;
+        lHeader.mHSegment            = ( aSensor == SE_PIXELL ? 96 : 64 );
+        lHeader.mVSegment            = 8;
+        lHeader.mSubHSegment         = 32;
+        lHeader.mDistanceScale       = 65536;
+        lHeader.mAmplitudeScale      = 64;
+        lHeader.mHFov                = ( aSensor == SE_PIXELL ? 177.5f : 30.0f );
+        lHeader.mVFov                = ( aSensor == SE_PIXELL ? 16.0f : 3.0f );
+
+        LdSyntheticFrame lData;
+        std::vector<uint8_t> lAnswer;
+        uint16_t lSequence = 0;
+
+        if( aTransport == TR_RTP )
+        {
+            // End of a frame of the stream we join, the jitter buffer synchronizes on it
+            const uint8_t lByte = 0;
+            AddRtpPacket( lCapture, lSequence++, 0, true, &lByte, 1 );
+        }
+
+        for( uint32_t lFrame = 0; lFrame < gSyntheticFrames; ++lFrame )
+        {
+            GenerateFrame( lHeader, lFrame, lData );
+            const uint32_t lCount = static_cast<uint32_t>( lData.mChannels.size() );
+
+            if( aTransport == TR_UDP )
+            {
+                for( uint32_t lStart = 0; lStart < lCount; lStart += gFragmentEchoes )
+                {
+                    const uint32_t lFragmentCount = std::min( gFragmentEchoes, lCount - lStart );
+                    std::vector<uint8_t> lDatagram;
+                    size_t lAnswerStart = BeginAnswer( lDatagram );
+                    AddEchoes( lDatagram, lData, lStart, lFragmentCount, lStart + lFragmentCount == lCount );
+                    EndAnswer( lDatagram, lAnswerStart );
+                    lCapture.mRecords.push_back( std::move( lDatagram ) );
+                }
+
+                continue;
+            }
+
+            lAnswer.clear();
+            size_t lAnswerStart = BeginAnswer( lAnswer );
+            AddEchoes( lAnswer, lData, 0, lCount, true );
+            EndAnswer( lAnswer, lAnswerStart );
+
+            if( aTransport == TR_TCP )
+            {
+                lCapture.mRecords.push_back( lAnswer );
+                continue;
+            }
+
+            for( size_t lOffset = 0; lOffset < lAnswer.size(); lOffset += gRtpPayloadSize )
+            {
+                const size_t lSize = std::min<size_t>( gRtpPayloadSize, lAnswer.size() - lOffset );
+                AddRtpPacket( lCapture, lSequence++, lFrame + 1, lOffset + lSize == lAnswer.size(), &lAnswer[lOffset], lSize );
+            }
+        }
+
+        return lCapture;
+    }
+
+    LdCapture LoadCapture( const char *aFile )
+    {
+        std::ifstream lFile( aFile, std::ios::binary );
+        LdCapture lCapture;
+
+        if( !lFile.read( reinterpret_cast<char *>( &lCapture.mHeader ), sizeof( lCapture.mHeader ) ) || memcmp( lCapture.mHeader.mMagic, "LDRP", 4 ) != 0 )
+        {
+            throw std::runtime_error( std::string( "Not a replay capture: " ) + aFile );
+        }
+
+        if( lCapture.mHeader.mTransport > TR_RTP || lCapture.mHeader.mSensor > SE_PIXELL || lCapture.mHeader.mHSegment == 0 || lCapture.mHeader.mVSegment == 0 )
+        {
+            throw std::runtime_error( std::string( "Invalid replay capture header: " ) + aFile );
+        }
+
+        uint32_t lSize = 0;
+
+        while( lFile.read( reinterpret_cast<char *>( &lSize ), sizeof( lSize ) ) )
+        {
+            std::vector<uint8_t> lRecord( lSize );
+
+            if( lSize != 0 && !lFile.read( reinterpret_cast<char *>( lRecord.data() ), lSize ) )
+            {
+                throw std::runtime_error( std::string( "Truncated replay capture: " ) + aFile );
+            }
+
+            lCapture.mRecords.push_back( std::move( lRecord ) );
+        }
+
+        return lCapture;
+    }
+
+    void SaveCapture( const std::string &aFile, const LdCapture &aCapture )
+    {
+        std::ofstream lFile( aFile, std::ios::binary );
+        lFile.write( reinterpret_cast<const char *>( &aCapture.mHeader ), sizeof( aCapture.mHeader ) );
+
+        for( const std::vector<uint8_t> &lRecord : aCapture.mRecords )
+        {
+            const uint32_t lSize = static_cast<uint32_t>( lRecord.size() );
+            lFile.write( reinterpret_cast<const char *>( &lSize ), sizeof( lSize ) );
+            lFile.write( reinterpret_cast<const char *>( lRecord.data() ), lSize );
+        }
+
+        if( !lFile )
+        {
+            throw std::runtime_error( "Cannot write the replay capture: " + aFile );
+        }
+    }
+
+    // Without aRecordBaseNs, the data path is measured. With it, the capture is replayed again with a LdLjrRecorder
+    // and the recorder cost is the time above aRecordBaseNs, the time of the first replay.
+    template <class T> double RunCapture( const std::string &aName, const LdCapture &aCapture, double aRecordBaseNs = 0 )
+    {
+        using namespace LeddarConnection;
+
+        const bool lTCP       = ( aCapture.mHeader.mTransport == TR_TCP );
+        auto *lConnectionInfo = new LdConnectionInfoEthernet( "127.0.0.1", 48630, "Replay", LdConnectionInfo::CT_ETHERNET_LEDDARTECH,
+                                                              lTCP ? LdConnectionInfoEthernet::PT_TCP : LdConnectionInfoEthernet::PT_UDP );
+        auto *lInterface      = new LdReplayEthernet( lConnectionInfo, aCapture.mRecords );
+        LdProtocolLeddarTech *lProtocol = nullptr;
+
+        if( lTCP )
+        {
+            lProtocol = new LdProtocolLeddartechEthernet( lConnectionInfo, lInterface );
+        }
+        else if( aCapture.mHeader.mTransport == TR_UDP )
+        {
+            lProtocol = new LdProtocolLeddartechEthernetUDP( lConnectionInfo, lInterface );
+        }
+        else
+        {
+            lProtocol = new LdProtocolLeddartechEthernetPixell( lConnectionInfo, lInterface );
+        }
+
+        lProtocol->TakeOwnerShip( true ); // The sensor deletes the protocol, that deletes the interface and the connection info
+
+        LdReplaySensor<T> lSensor;
+        lSensor.SetConstants( aCapture.mHeader );
+        lSensor.Attach( lProtocol, lTCP );
+        LdFrameCounter lCounter( lSensor.GetResultEchoes() );
+
+        while( !lInterface->AtEnd() && lCounter.mFrames < gWarmupFrames )
+        {
+            lSensor.GetData();
+        }
+
+        std::unique_ptr<LeddarRecord::LdLjrRecorder> lRecorder;
+        std::string lRecordFile;
+
+        if( aRecordBaseNs != 0 )
+        {
+            lRecorder.reset( new LeddarRecord::LdLjrRecorder( &lSensor ) );
+            lRecordFile = LeddarBench::TemporaryFile( "LeddarBench-replay.ljr" );
+            remove( lRecordFile.c_str() );
+            lRecordFile = lRecorder->StartRecording( lRecordFile );
+        }
+
+        const uint64_t lRecordStart = lRecorder ? lRecorder->GetCurrentRecordingSize() : 0;
+        lCounter.mFrames            = 0;
+        lCounter.mEchoCount         = 0;
+        lSensor.ResetPipelineStats();
+        lSensor.ResetCartesianAllocations();
+        const uint64_t lAllocations = LeddarBench::GetAllocationCount();
+        LeddarBench::LdBenchTimer lTimer;
+
+        while( !lInterface->AtEnd() )
+        {
+            lSensor.GetData();
+        }
+
+        const double lNs          = lTimer.ElapsedNs();
+        const double lFrameAllocs = static_cast<double>( LeddarBench::GetAllocationCount() - lAllocations );
+
+        if( lCounter.mFrames == 0 || lCounter.mEchoCount == 0 )
+        {
+            throw std::runtime_error( aName + ": no frame decoded" );
+        }
+
+        const double lFrames = static_cast<double>( lCounter.mFrames );
+        LeddarBench::Report( aName, lFrames / ( lNs / 1e9 ), "frames/s" );
+
+        if( lRecorder )
+        {
+            const uint64_t lRecordSize = lRecorder->GetCurrentRecordingSize() - lRecordStart;
+            lRecorder->StopRecording();
+            lRecorder.reset();
+            remove( lRecordFile.c_str() );
+
+            LeddarBench::Report( aName + "/cost", ( lNs - aRecordBaseNs ) / lFrames, "ns/frame" );
+            LeddarBench::Report( aName + "/size", lRecordSize / lFrames, "bytes/frame" );
+            return lNs;
+        }
+
+        LeddarBench::Report( aName + "/echo", lNs / lCounter.mEchoCount, "ns/echo" );
+        LeddarBench::Report( aName + "/allocations", lFrameAllocs / lFrames, "allocations/frame" );
+        LeddarBench::Report( aName + "/cartesian/allocations", lSensor.GetCartesianAllocations() / lFrames, "allocations/frame" );
+
+        const LeddarCore::LdPipelineStats &lStats = lSensor.GetPipelineStats();
+
+        if( LeddarCore::LdPipelineStats::IsEnabled() )
+        {
+            for( int i = 0; i < LeddarCore::LdPipelineStats::STAGE_COUNT; ++i )
+            {
+                auto lStage                                    = static_cast<LeddarCore::LdPipelineStats::eStage>( i );
+                const LeddarCore::LdLatencyHistogram &lStageNs = lStats.GetHistogram( lStage );
+
+                if( lStageNs.GetCount() != 0 )
+                {
+                    LeddarBench::Report( aName + "/" + LeddarCore::LdPipelineStats::GetStageName( lStage ), lStageNs.GetMean() * lStageNs.GetCount() / lFrames, "ns/frame" );
+                }
+            }
+
+            LeddarBench::Report( aName + "/dropped", static_cast<double>( lStats.GetCounter( LeddarCore::LdPipelineStats::COUNTER_FRAMES_DROPPED ) ), "frames" );
+        }
+
+        return lNs;
+    }
+
+    template <class T> void RunCaptureAndRecorder( const std::string &aName, const LdCapture &aCapture )
+    {
+        const double lNs = RunCapture<T>( aName, aCapture );
+        RunCapture<T>( aName + "/ljr-recorder", aCapture, lNs );
+    }
+
+    void Run( const std::string &aName, const LdCapture &aCapture )
+    {
+        if( aCapture.mHeader.mSensor == SE_PIXELL )
+        {
+            RunCaptureAndRecorder<LeddarDevice::LdSensorPixell>( aName, aCapture );
+        }
+        else
+        {
+            RunCaptureAndRecorder<LeddarDevice::LdSensorLeddarAuto>( aName, aCapture );
+        }
+    }
+} // namespace
+
+void LeddarBench::BenchReplay( void )
+{
+    const char *lCapture = getenv( "LEDDAR_BENCH_CAPTURE" );
+
+    if( lCapture != nullptr && lCapture[0] != '\0' )
+    {
+        Run( "replay/capture", LoadCapture( lCapture ) );
+        return;
+    }
+
+    const struct
+    {
+        const char *mName;
+        eTransport mTransport;
+        eSensor mSensor;
+    } lCaptures[] = { { "auto-tcp", TR_TCP, SE_LEDDARAUTO }, { "auto-udp", TR_UDP, SE_LEDDARAUTO }, { "pixell-rtp", TR_RTP, SE_PIXELL } };
+
+    const char *lSaveDirectory = getenv( "LEDDAR_BENCH_SAVE_CAPTURES" );
+
+    for( const auto &lCapture : lCaptures )
+    {
+        const LdCapture lData = GenerateCapture( lCapture.mTransport, lCapture.mSensor );
+
+        if( lSaveDirectory != nullptr && lSaveDirectory[0] != '\0' )
+        {
+            SaveCapture( std::string( lSaveDirectory ) + "/" + lCapture.mName + ".ldrp", lData );
+        }
+
+        Run( std::string( "replay/" ) + lCapture.mName, lData );
+    }
+}
+
+#else
+
+void LeddarBench::BenchReplay( void )
+{
+}
+
+#endif
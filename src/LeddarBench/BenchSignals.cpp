@@ -0,0 +1,81 @@
+// *****************************************************************************
+// Module..: LeddarBench
+//
+/// \file    BenchSignals.cpp
+///
+/// \brief   Cost of LdObject::EmitSignal with many subscribers.
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LeddarBench.h"
+
+#include "LdObject.h"
+#include "LdSignalDispatcher.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    class LdBenchEmitter : public LeddarCore::LdObject
+    {
+      public:
+        void Emit( const SIGNALS aSignal ) { EmitSignal( aSignal ); }
+    };
+
+    class LdBenchReceiver : public LeddarCore::LdObject
+    {
+      public:
+        LdBenchReceiver( void ) : mCount( 0 ) {}
+        void Callback( LdObject *, const SIGNALS, void * ) override { ++mCount; }
+        uint64_t mCount;
+    };
+} // namespace
+
+void LeddarBench::BenchSignals( void )
+{
+    const uint32_t lEmitCount      = 20000;
+    const size_t lReceiverCounts[] = { 1, 10, 100, 1000 };
+
+    for( size_t lReceiverCount : lReceiverCounts )
+    {
+        LdBenchEmitter lEmitter;
+        std::vector<std::unique_ptr<LdBenchReceiver>> lReceivers;
+
+        // Interested receivers on NEW_DATA, and as many on VALUE_CHANGED that must not be visited
+        for( size_t i = 0; i < lReceiverCount; ++i )
+        {
+            lReceivers.emplace_back( new LdBenchReceiver() );
+            lEmitter.ConnectSignal( lReceivers.back().get(), LeddarCore::LdObject::NEW_DATA );
+            lReceivers.emplace_back( new LdBenchReceiver() );
+            lEmitter.ConnectSignal( lReceivers.back().get(), LeddarCore::LdObject::VALUE_CHANGED );
+        }
+
+        LdBenchTimer lTimer;
+
+        for( uint32_t i = 0; i < lEmitCount; ++i )
+        {
+            lEmitter.Emit( LeddarCore::LdObject::NEW_DATA );
+        }
+
+        Report( "signals/direct/" + std::to_string( lReceiverCount ) + "_receivers", lTimer.ElapsedNs() / lEmitCount, "ns/emit" );
+    }
+
+    // Queued connection: cost seen by the emitting thread
+    LdBenchEmitter lEmitter;
+    LdBenchReceiver lReceiver;
+    lEmitter.ConnectSignal( &lReceiver, LeddarCore::LdObject::NEW_DATA, LeddarCore::LdObject::CONNECTION_QUEUED );
+    LdBenchTimer lTimer;
+
+    for( uint32_t i = 0; i < lEmitCount; ++i )
+    {
+        lEmitter.Emit( LeddarCore::LdObject::NEW_DATA );
+    }
+
+    Report( "signals/queued/1_receiver", lTimer.ElapsedNs() / lEmitCount, "ns/emit" );
+    lEmitter.DisconnectSignal( &lReceiver, LeddarCore::LdObject::NEW_DATA );
+}
@@ -0,0 +1,256 @@
+// *****************************************************************************
+// Module..: LeddarBench
+//
+/// \file    BenchTemporalFilter.cpp
+///
+/// \brief   Temporal filter of synthetic Pixell frames (96 x 8 channels, 3 echoes per channel, 2304 echoes):
+///          targets moving 1 cm per frame, 2 cm distance noise and 1% outliers.
+///          "temporal-filter/<mode>" is LdTemporalFilter::Apply, "/error" is the root mean square distance of the
+///          kept echoes to the target of their own channel and rank ("/raw" without filter),
+///          "/unordered-map" is an application side moving average keyed by channel and rank, on a copy of each frame,
+///          "/swap" is the Kalman filter with outlier gate done by LdResultEchoes::FilterEchoes and Swap.
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LeddarBench.h"
+
+#include "LdResultEchoes.h"
+#include "LdTemporalFilter.h"
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace
+{
+    const uint32_t gChannels      = 96 * 8;
+    const uint32_t gEchoesPerChan = 3;
+    const uint32_t gEchoes        = gChannels * gEchoesPerChan;
+    const uint32_t gFrames        = 300;
+    const uint32_t gDistanceScale = 65536;
+    const double gRankSpacing     = 20.0;
+
+    double GetTarget( uint32_t aChannel, uint32_t aRank, uint32_t aFrame ) { return 5.0 + aRank * gRankSpacing + ( aChannel % 17 ) * 0.5 + aFrame * 0.01; }
+
+    struct LdBenchFrames
+    {
+        LdBenchFrames( void )
+            : mFrames( gFrames, std::vector<LeddarConnection::LdEcho>( gEchoes ) )
+            , mTargets( gFrames, std::vector<double>( gEchoes ) )
+        {
+            uint64_t lState = 0x2545F4914F6CDD1Dull;
+            auto lRandom    = [&lState]() {
+                lState = lState * 6364136223846793005ull + 1442695040888963407ull;
+                return static_cast<double>( lState >> 11 ) / 9007199254740992.0;
+            };
+
+            for( uint32_t lFrame = 0; lFrame < gFrames; ++lFrame )
+            {
+                for( uint32_t i = 0; i < gEchoes; ++i )
+                {
+                    const uint32_t lChannel = i / gEchoesPerChan;
+                    mTargets[lFrame][i]     = GetTarget( lChannel, i % gEchoesPerChan, lFrame );
+                    // Box-Muller, 2 cm noise
+                    double lDistance = mTargets[lFrame][i] +
+                                       0.02 * std::sqrt( -2.0 * std::log( 1.0 - lRandom() ) ) * std::cos( 6.283185307179586 * lRandom() );
+
+                    if( lRandom() < 0.01 )
+                        lDistance = 1.0 + 60.0 * lRandom();
+
+                    LeddarConnection::LdEcho &lOutput = mFrames[lFrame][i];
+                    lOutput.mChannelIndex             = static_cast<uint16_t>( lChannel );
+                    lOutput.mDistance                 = static_cast<int32_t>( lDistance * gDistanceScale );
+                    lOutput.mAmplitude                = 1000;
+                    lOutput.mBase                     = i; // Not used by the filters, identifies the target of the echo
+                    lOutput.mFlag                     = 1;
+                    lOutput.mTimestamp                = lFrame;
+                    lOutput.mX                        = static_cast<float>( lDistance );
+                    lOutput.mY                        = 0;
+                    lOutput.mZ                        = 0;
+                }
+            }
+        }
+
+        std::vector<std::vector<LeddarConnection::LdEcho>> mFrames;
+        std::vector<std::vector<double>> mTargets; // Generated target (m) of each echo, indexed by LdEcho::mBase
+    };
+
+    // Squared distance (m^2) of the echoes to the target of their own channel and rank
+    double GetSquaredError( const LeddarConnection::LdEcho *aEchoes, uint32_t aCount, const std::vector<double> &aTargets )
+    {
+        double lSum = 0;
+
+        for( uint32_t i = 0; i < aCount; ++i )
+        {
+            const double lError = static_cast<double>( aEchoes[i].mDistance ) / gDistanceScale - aTargets[aEchoes[i].mBase];
+            lSum += lError * lError;
+        }
+
+        return lSum;
+    }
+
+    struct LdBenchRun
+    {
+        double mNs             = 0;
+        uint64_t mKept         = 0;
+        uint64_t mAllocations  = 0;
+        double mSquaredError   = 0;
+        uint64_t mErrorSamples = 0;
+
+        void Report( const std::string &aName ) const
+        {
+            LeddarBench::Report( aName, mNs / gFrames / 1000.0, "us/frame" );
+            LeddarBench::Report( aName + "/throughput", static_cast<double>( gEchoes ) * gFrames / ( mNs / 1e9 ) / 1e6, "Mechoes/s" );
+            LeddarBench::Report( aName + "/rejected", static_cast<double>( static_cast<uint64_t>( gEchoes ) * gFrames - mKept ) / gFrames, "echoes/frame" );
+            LeddarBench::Report( aName + "/allocations", static_cast<double>( mAllocations ) / gFrames, "allocations/frame" );
+            LeddarBench::Report( aName + "/error", std::sqrt( mSquaredError / mErrorSamples ) * 1000, "mm" );
+        }
+    };
+
+    // The error is measured after the first frames, once the filters settled
+    const uint32_t gSettleFrames = 20;
+
+    void RunTemporalFilter( const std::string &aName, const LdBenchFrames &aFrames, LeddarConnection::LdTemporalFilter &aTemporalFilter )
+    {
+        std::vector<LeddarConnection::LdEcho> lEchoes( gEchoes );
+        LdBenchRun lRun;
+
+        for( uint32_t i = 0; i < gFrames; ++i )
+        {
+            memcpy( lEchoes.data(), aFrames.mFrames[i].data(), gEchoes * sizeof( LeddarConnection::LdEcho ) );
+            const uint64_t lAllocationStart = LeddarBench::GetAllocationCount();
+            LeddarBench::LdBenchTimer lTimer;
+            const uint32_t lKept = aTemporalFilter.Apply( lEchoes.data(), gEchoes, gDistanceScale );
+            lRun.mNs += lTimer.ElapsedNs();
+            lRun.mAllocations += LeddarBench::GetAllocationCount() - lAllocationStart;
+            lRun.mKept += lKept;
+
+            if( i >= gSettleFrames )
+            {
+                lRun.mSquaredError += GetSquaredError( lEchoes.data(), lKept, aFrames.mTargets[i] );
+                lRun.mErrorSamples += lKept;
+            }
+        }
+
+        lRun.Report( aName );
+    }
+
+    // Moving average with a standard container on a copy of the frame, the usual application side implementation
+    void RunUnorderedMap( const LdBenchFrames &aFrames )
+    {
+        std::unordered_map<uint32_t, float> lStates;
+        std::vector<LeddarConnection::LdEcho> lCopy;
+        LdBenchRun lRun;
+
+        for( uint32_t i = 0; i < gFrames; ++i )
+        {
+            const uint64_t lAllocationStart = LeddarBench::GetAllocationCount();
+            LeddarBench::LdBenchTimer lTimer;
+            lCopy = std::vector<LeddarConnection::LdEcho>( aFrames.mFrames[i] );
+            uint32_t lPrevious = UINT32_MAX, lRank = 0;
+
+            for( LeddarConnection::LdEcho &lEcho : lCopy )
+            {
+                lRank     = lEcho.mChannelIndex == lPrevious ? lRank + 1 : 0;
+                lPrevious = lEcho.mChannelIndex;
+                const float lDistance = static_cast<float>( lEcho.mDistance ) / gDistanceScale;
+                auto lState           = lStates.try_emplace( lEcho.mChannelIndex * 256u + lRank, lDistance );
+
+                if( !lState.second )
+                    lState.first->second += 0.3f * ( lDistance - lState.first->second );
+
+                lEcho.mDistance = static_cast<int32_t>( std::lround( lState.first->second * gDistanceScale ) );
+            }
+
+            lRun.mNs += lTimer.ElapsedNs();
+            lRun.mAllocations += LeddarBench::GetAllocationCount() - lAllocationStart;
+            lRun.mKept += gEchoes;
+
+            if( i >= gSettleFrames )
+            {
+                lRun.mSquaredError += GetSquaredError( lCopy.data(), gEchoes, aFrames.mTargets[i] );
+                lRun.mErrorSamples += gEchoes;
+            }
+        }
+
+        lRun.Report( "temporal-filter/unordered-map" );
+    }
+
+    void RunSwap( const LdBenchFrames &aFrames, const LeddarConnection::LdTemporalFilter &aTemporalFilter )
+    {
+        LeddarConnection::LdResultEchoes lResult;
+        lResult.Init( gDistanceScale, 1, gEchoes );
+        lResult.SetTemporalFilter( aTemporalFilter );
+        LdBenchRun lRun;
+
+        for( uint32_t i = 0; i < gFrames; ++i )
+        {
+            {
+                auto lLock = lResult.GetUniqueLock( LeddarConnection::B_SET );
+                memcpy( lResult.GetEchoes( LeddarConnection::B_SET )->data(), aFrames.mFrames[i].data(), gEchoes * sizeof( LeddarConnection::LdEcho ) );
+                lResult.SetEchoCount( gEchoes );
+            }
+
+            const uint64_t lAllocationStart = LeddarBench::GetAllocationCount();
+            LeddarBench::LdBenchTimer lTimer;
+            lResult.Swap();
+            lRun.mNs += lTimer.ElapsedNs();
+            lRun.mAllocations += LeddarBench::GetAllocationCount() - lAllocationStart;
+
+            auto lLock           = lResult.GetUniqueLock( LeddarConnection::B_GET );
+            const uint32_t lKept = lResult.GetEchoCount( LeddarConnection::B_GET );
+            lRun.mKept += lKept;
+
+            if( i >= gSettleFrames )
+            {
+                lRun.mSquaredError += GetSquaredError( lResult.GetEchoes( LeddarConnection::B_GET )->data(), lKept, aFrames.mTargets[i] );
+                lRun.mErrorSamples += lKept;
+            }
+        }
+
+        lRun.Report( "temporal-filter/swap" );
+    }
+} // namespace
+
+void LeddarBench::BenchTemporalFilter( void )
+{
+    const LdBenchFrames lFrames;
+
+    double lRawError = 0;
+
+    for( uint32_t i = gSettleFrames; i < gFrames; ++i )
+    {
+        lRawError += GetSquaredError( lFrames.mFrames[i].data(), gEchoes, lFrames.mTargets[i] );
+    }
+
+    lRawError = std::sqrt( lRawError / ( static_cast<double>( gEchoes ) * ( gFrames - gSettleFrames ) ) ) * 1000;
+    LeddarBench::Report( "temporal-filter/raw/error", lRawError, "mm" );
+
+    LeddarConnection::LdTemporalFilter lEma;
+    lEma.SetChannels( gChannels, gEchoesPerChan );
+    lEma.SetEma( 0.3f );
+    RunTemporalFilter( "temporal-filter/ema", lFrames, lEma );
+
+    LeddarConnection::LdTemporalFilter lMedian;
+    lMedian.SetChannels( gChannels, gEchoesPerChan );
+    lMedian.SetMedian( 5 );
+    RunTemporalFilter( "temporal-filter/median", lFrames, lMedian );
+
+    LeddarConnection::LdTemporalFilter lKalman;
+    lKalman.SetChannels( gChannels, gEchoesPerChan );
+    lKalman.SetKalman( 0.002f, 0.02f );
+    RunTemporalFilter( "temporal-filter/kalman", lFrames, lKalman );
+
+    LeddarConnection::LdTemporalFilter lGated;
+    lGated.SetChannels( gChannels, gEchoesPerChan );
+    lGated.SetKalman( 0.002f, 0.02f );
+    lGated.SetOutlierGate( 0.5f, 3 );
+    RunTemporalFilter( "temporal-filter/kalman-gate", lFrames, lGated );
+
+    RunUnorderedMap( lFrames );
+    RunSwap( lFrames, lGated );
+}
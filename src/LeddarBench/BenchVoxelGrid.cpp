@@ -0,0 +1,227 @@
+// *****************************************************************************
+// Module..: LeddarBench
+//
+/// \file    BenchVoxelGrid.cpp
+///
+/// \brief   Voxel grid downsampling of synthetic 20480 echoes frames (160 x 32 channels, 4 echoes per channel,
+///          120 x 30 degrees field of view, surfaces from 5 to 60 m), 0.5 m voxels.
+///          "voxel-grid/<policy>" is LdVoxelGrid::Reduce, "/roi" is the region of interest alone,
+///          "/unordered-map" is a centroid reduction with a std::unordered_map cleared each frame,
+///          "/swap" is the reduction done by LdResultEchoes::Swap (centroid).
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LeddarBench.h"
+
+#include "LdResultEchoes.h"
+#include "LdVoxelGrid.h"
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace
+{
+    const uint32_t gHChan         = 160;
+    const uint32_t gVChan         = 32;
+    const uint32_t gEchoesPerChan = 4;
+    const uint32_t gEchoes        = gHChan * gVChan * gEchoesPerChan;
+    const uint32_t gFrames        = 200;
+    const float gVoxelSize        = 0.5f;
+
+    void FillFrame( LeddarConnection::LdEcho *aEchoes, uint32_t aFrame )
+    {
+        const double lDegree = 3.14159265358979 / 180.0;
+
+        for( uint32_t i = 0; i < gEchoes; ++i )
+        {
+            const uint32_t lChannel = i / gEchoesPerChan;
+            const uint32_t lEcho    = i % gEchoesPerChan;
+            const double lAzimut    = ( ( lChannel % gHChan ) * 120.0 / gHChan - 60.0 ) * lDegree;
+            const double lElevation = ( ( lChannel / gHChan ) * 30.0 / gVChan - 15.0 ) * lDegree;
+            // A smooth surface per echo rank, moving a little from one frame to the next
+            const double lDistance = 5.0 + lEcho * 15.0 + 8.0 * ( 1.0 + std::sin( lAzimut * 3.0 + aFrame * 0.01 ) ) + 4.0 * std::cos( lElevation * 5.0 );
+
+            LeddarConnection::LdEcho &lOutput = aEchoes[i];
+            lOutput.mChannelIndex             = static_cast<uint16_t>( lChannel );
+            lOutput.mDistance                 = static_cast<int32_t>( lDistance * 65536 );
+            lOutput.mAmplitude                = ( i * 2654435761u ) % 4096;
+            lOutput.mBase                     = 0;
+            lOutput.mFlag                     = 1;
+            lOutput.mTimestamp                = aFrame;
+            lOutput.mX                        = static_cast<float>( lDistance * std::cos( lElevation ) * std::cos( lAzimut ) );
+            lOutput.mY                        = static_cast<float>( lDistance * std::cos( lElevation ) * std::sin( lAzimut ) );
+            lOutput.mZ                        = static_cast<float>( lDistance * std::sin( lElevation ) );
+        }
+    }
+
+    struct LdBenchFrames
+    {
+        LdBenchFrames( void ) : mFrames( gFrames, std::vector<LeddarConnection::LdEcho>( gEchoes ) )
+        {
+            for( uint32_t i = 0; i < gFrames; ++i )
+            {
+                FillFrame( mFrames[i].data(), i );
+            }
+        }
+
+        std::vector<std::vector<LeddarConnection::LdEcho>> mFrames;
+    };
+
+    void ReportRun( const std::string &aName, double aNs, uint64_t aKept, uint64_t aAllocations )
+    {
+        LeddarBench::Report( aName, aNs / gFrames / 1000.0, "us/frame" );
+        LeddarBench::Report( aName + "/throughput", static_cast<double>( gEchoes ) * gFrames / ( aNs / 1e9 ) / 1e6, "Mechoes/s" );
+        LeddarBench::Report( aName + "/kept", static_cast<double>( aKept ) / gFrames, "echoes/frame" );
+        LeddarBench::Report( aName + "/allocations", static_cast<double>( aAllocations ) / gFrames, "allocations/frame" );
+    }
+
+    void RunVoxelGrid( const std::string &aName, const LdBenchFrames &aFrames, LeddarConnection::LdVoxelGrid &aVoxelGrid )
+    {
+        std::vector<LeddarConnection::LdEcho> lEchoes( gEchoes );
+        double lNs     = 0;
+        uint64_t lKept = 0, lAllocations = 0;
+
+        // First frame sizes the table
+        memcpy( lEchoes.data(), aFrames.mFrames[0].data(), gEchoes * sizeof( LeddarConnection::LdEcho ) );
+        aVoxelGrid.Reduce( lEchoes.data(), gEchoes );
+
+        for( uint32_t i = 0; i < gFrames; ++i )
+        {
+            memcpy( lEchoes.data(), aFrames.mFrames[i].data(), gEchoes * sizeof( LeddarConnection::LdEcho ) );
+            const uint64_t lAllocationStart = LeddarBench::GetAllocationCount();
+            LeddarBench::LdBenchTimer lTimer;
+            lKept += aVoxelGrid.Reduce( lEchoes.data(), gEchoes );
+            lNs += lTimer.ElapsedNs();
+            lAllocations += LeddarBench::GetAllocationCount() - lAllocationStart;
+        }
+
+        ReportRun( aName, lNs, lKept, lAllocations );
+    }
+
+    // Centroid with a standard container, the usual consumer side implementation
+    void RunUnorderedMap( const LdBenchFrames &aFrames )
+    {
+        struct sVoxel
+        {
+            double mX, mY, mZ;
+            uint32_t mCount;
+        };
+
+        std::unordered_map<uint64_t, sVoxel> lVoxels;
+        std::vector<float> lPoints;
+        double lNs     = 0;
+        uint64_t lKept = 0, lAllocations = 0;
+
+        for( uint32_t i = 0; i < gFrames; ++i )
+        {
+            const std::vector<LeddarConnection::LdEcho> &lEchoes = aFrames.mFrames[i];
+            const uint64_t lAllocationStart                      = LeddarBench::GetAllocationCount();
+            LeddarBench::LdBenchTimer lTimer;
+            lVoxels.clear();
+
+            for( const LeddarConnection::LdEcho &lEcho : lEchoes )
+            {
+                const uint64_t lKey = ( static_cast<uint64_t>( std::floor( lEcho.mX / gVoxelSize ) + 1048576 ) ) |
+                                      ( static_cast<uint64_t>( std::floor( lEcho.mY / gVoxelSize ) + 1048576 ) << 21 ) |
+                                      ( static_cast<uint64_t>( std::floor( lEcho.mZ / gVoxelSize ) + 1048576 ) << 42 );
+                sVoxel &lVoxel = lVoxels[lKey];
+                lVoxel.mX += lEcho.mX;
+                lVoxel.mY += lEcho.mY;
+                lVoxel.mZ += lEcho.mZ;
+                ++lVoxel.mCount;
+            }
+
+            lPoints.clear();
+
+            for( const auto &lVoxel : lVoxels )
+            {
+                lPoints.push_back( static_cast<float>( lVoxel.second.mX / lVoxel.second.mCount ) );
+                lPoints.push_back( static_cast<float>( lVoxel.second.mY / lVoxel.second.mCount ) );
+                lPoints.push_back( static_cast<float>( lVoxel.second.mZ / lVoxel.second.mCount ) );
+            }
+
+            lNs += lTimer.ElapsedNs();
+            lAllocations += LeddarBench::GetAllocationCount() - lAllocationStart;
+            lKept += lVoxels.size();
+        }
+
+        ReportRun( "voxel-grid/unordered-map", lNs, lKept, lAllocations );
+    }
+
+    void RunSwap( const LdBenchFrames &aFrames, const LeddarConnection::LdVoxelGrid &aVoxelGrid )
+    {
+        LeddarConnection::LdResultEchoes lResult;
+        lResult.Init( 65536, 1, gEchoes );
+        lResult.SetVoxelGrid( aVoxelGrid );
+        double lNs     = 0;
+        uint64_t lKept = 0, lAllocations = 0;
+
+        for( uint32_t i = 0; i <= gFrames; ++i )
+        {
+            {
+                auto lLock = lResult.GetUniqueLock( LeddarConnection::B_SET );
+                memcpy( lResult.GetEchoes( LeddarConnection::B_SET )->data(), aFrames.mFrames[i % gFrames].data(), gEchoes * sizeof( LeddarConnection::LdEcho ) );
+                lResult.SetEchoCount( gEchoes );
+            }
+
+            const uint64_t lAllocationStart = LeddarBench::GetAllocationCount();
+            LeddarBench::LdBenchTimer lTimer;
+            lResult.Swap();
+            const double lFrameNs = lTimer.ElapsedNs();
+
+            if( i != 0 ) // The first frame sizes the table
+            {
+                lNs += lFrameNs;
+                lAllocations += LeddarBench::GetAllocationCount() - lAllocationStart;
+                auto lLock = lResult.GetUniqueLock( LeddarConnection::B_GET );
+                lKept += lResult.GetEchoCount( LeddarConnection::B_GET );
+            }
+        }
+
+        ReportRun( "voxel-grid/swap", lNs, lKept, lAllocations );
+    }
+} // namespace
+
+void LeddarBench::BenchVoxelGrid( void )
+{
+    const LdBenchFrames lFrames;
+
+    const LeddarConnection::LdVoxelGrid::ePolicy lPolicies[]   = { LeddarConnection::LdVoxelGrid::VP_CENTROID, LeddarConnection::LdVoxelGrid::VP_MAX_AMPLITUDE,
+                                                                   LeddarConnection::LdVoxelGrid::VP_NEAREST };
+    const char *lPolicyNames[] = { "centroid", "max-amplitude", "nearest" };
+    uint64_t lCentroidKept     = 0;
+
+    for( size_t i = 0; i < 3; ++i )
+    {
+        LeddarConnection::LdVoxelGrid lVoxelGrid;
+        lVoxelGrid.SetVoxelSize( gVoxelSize );
+        lVoxelGrid.SetPolicy( lPolicies[i] );
+        RunVoxelGrid( std::string( "voxel-grid/" ) + lPolicyNames[i], lFrames, lVoxelGrid );
+
+        if( i == 0 )
+        {
+            std::vector<LeddarConnection::LdEcho> lEchoes( lFrames.mFrames[0] );
+            lCentroidKept = lVoxelGrid.Reduce( lEchoes.data(), gEchoes );
+        }
+    }
+
+    if( lCentroidKept == 0 || lCentroidKept >= gEchoes )
+    {
+        throw std::runtime_error( "voxel-grid: no reduction" );
+    }
+
+    LeddarConnection::LdVoxelGrid lRoi;
+    lRoi.SetRoi( 0, 30, -10, 10, -2, 5 );
+    RunVoxelGrid( "voxel-grid/roi", lFrames, lRoi );
+
+    RunUnorderedMap( lFrames );
+
+    LeddarConnection::LdVoxelGrid lVoxelGrid;
+    lVoxelGrid.SetVoxelSize( gVoxelSize );
+    RunSwap( lFrames, lVoxelGrid );
+}
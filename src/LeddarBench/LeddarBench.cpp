@@ -0,0 +1,154 @@
+// *****************************************************************************
+// LeddarBench.cpp
+// Micro benchmarks of the SDK hot paths. No sensor is required.
+//
+// Usage: LeddarBench [benchmark name ...]
+// Without argument, all benchmarks are run.
+// Each result is printed on one line: <benchmark>\t<value>\t<unit>
+// *****************************************************************************
+
+#include "LeddarBench.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+
+namespace
+{
+    std::atomic<uint64_t> gAllocationCount( 0 );
+
+    struct LdBenchEntry
+    {
+        const char *mName;
+        void ( *mFunction )( void );
+    };
+
+    const LdBenchEntry gBenchmarks[] = {
+        { "signals", LeddarBench::BenchSignals },
+        { "jitter", LeddarBench::BenchJitter },
+        { "jitter-rt", LeddarBench::BenchJitterRealTime },
+        { "polling", LeddarBench::BenchPolling },
+        { "can-burst", LeddarBench::BenchCanBurst },
+        { "intelhex", LeddarBench::BenchIntelHex },
+        { "firmware-window", LeddarBench::BenchFirmwareWindow },
+        { "point-cloud", LeddarBench::BenchPointCloud },
+        { "replay", LeddarBench::BenchReplay },
+        { "modbus-framing", LeddarBench::BenchModbusFraming },
+        { "modbus-program", LeddarBench::BenchModbusProgram },
+        { "float-property", LeddarBench::BenchFloatProperty },
+        { "property-snapshot", LeddarBench::BenchPropertySnapshot },
+        { "file-view", LeddarBench::BenchFileView },
+        { "echo-filter", LeddarBench::BenchEchoFilter },
+        { "voxel-grid", LeddarBench::BenchVoxelGrid },
+        { "temporal-filter", LeddarBench::BenchTemporalFilter },
+        { "range-image", LeddarBench::BenchRangeImage },
+    };
+} // namespace
+
+// Counting allocator, the whole process (SDK included) allocates through it
+void *operator new( size_t aSize )
+{
+    gAllocationCount.fetch_add( 1, std::memory_order_relaxed );
+    void *lPointer = malloc( aSize == 0 ? 1 : aSize );
+
+    if( lPointer == nullptr )
+    {
+        throw std::bad_alloc();
+    }
+
+    return lPointer;
+}
+
+void operator delete( void *aPointer ) noexcept { free( aPointer ); }
+void operator delete( void *aPointer, size_t ) noexcept { free( aPointer ); }
+
+uint64_t LeddarBench::GetAllocationCount( void ) { return gAllocationCount.load( std::memory_order_relaxed ); }
+
+void LeddarBench::Report( const std::string &aBenchmark, double aValue, const std::string &aUnit )
+{
+    std::cout << aBenchmark << "\t" << aValue << "\t" << aUnit << std::endl;
+}
+
+void LeddarBench::ReportPercentiles( const std::string &aBenchmark, std::vector<double> aSamples, const std::string &aUnit )
+{
+    if( aSamples.empty() )
+    {
+        return;
+    }
+
+    std::sort( aSamples.begin(), aSamples.end() );
+
+    const struct
+    {
+        const char *mName;
+        double mRank;
+    } lPercentiles[] = { { "p50", 0.5 }, { "p99", 0.99 }, { "p99.9", 0.999 }, { "max", 1.0 } };
+
+    for( const auto &lPercentile : lPercentiles )
+    {
+        size_t lIndex = std::min( aSamples.size() - 1, static_cast<size_t>( lPercentile.mRank * static_cast<double>( aSamples.size() ) ) );
+        Report( aBenchmark + "/" + lPercentile.mName, aSamples[lIndex], aUnit );
+    }
+}
+
+std::string LeddarBench::TemporaryFile( const std::string &aName )
+{
+#ifdef _WIN32
+    const char *lDirectory = getenv( "TEMP" );
+#else
+    const char *lDirectory = getenv( "TMPDIR" );
+
+    if( lDirectory == nullptr || lDirectory[0] == '\0' )
+    {
+        lDirectory = "/tmp";
+    }
+#endif
+    return std::string( lDirectory != nullptr ? lDirectory : "." ) + "/" + aName;
+}
+
+int main( int argc, char *argv[] )
+{
+    int lRun = 0;
+
+    for( size_t i = 0; i < sizeof( gBenchmarks ) / sizeof( gBenchmarks[0] ); ++i )
+    {
+        bool lSelected = ( argc < 2 );
+
+        for( int j = 1; j < argc && !lSelected; ++j )
+        {
+            lSelected = ( strcmp( argv[j], gBenchmarks[i].mName ) == 0 );
+        }
+
+        if( lSelected )
+        {
+            try
+            {
+                gBenchmarks[i].mFunction();
+                ++lRun;
+            }
+            catch( std::exception &e )
+            {
+                std::cerr << gBenchmarks[i].mName << " failed: " << e.what() << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    if( lRun == 0 )
+    {
+        std::cerr << "Unknown benchmark. Available:";
+
+        for( size_t i = 0; i < sizeof( gBenchmarks ) / sizeof( gBenchmarks[0] ); ++i )
+        {
+            std::cerr << " " << gBenchmarks[i].mName;
+        }
+
+        std::cerr << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+// *****************************************************************************
+// Module..: LeddarBench
+//
+/// \file    LeddarBench.h
+///
+/// \brief   Helpers shared by the SDK micro benchmarks.
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace LeddarBench
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdBenchTimer
+    ///
+    /// \brief  Monotonic stopwatch.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdBenchTimer
+    {
+      public:
+        LdBenchTimer( void ) : mStart( std::chrono::steady_clock::now() ) {}
+        void Restart( void ) { mStart = std::chrono::steady_clock::now(); }
+        double ElapsedNs( void ) const { return static_cast<double>( std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - mStart ).count() ); }
+
+      private:
+        std::chrono::steady_clock::time_point mStart;
+    };
+
+    void Report( const std::string &aBenchmark, double aValue, const std::string &aUnit );
+    void ReportPercentiles( const std::string &aBenchmark, std::vector<double> aSamples, const std::string &aUnit );
+    uint64_t GetAllocationCount( void ); ///< Number of operator new calls since the start of the process
+    std::string TemporaryFile( const std::string &aName ); ///< Path of aName in the temporary directory
+
+    // Benchmarks
+    void BenchSignals( void );
+    void BenchJitter( void );
+    void BenchJitterRealTime( void );
+    void BenchPolling( void );
+    void BenchCanBurst( void );
+    void BenchIntelHex( void );
+    void BenchFirmwareWindow( void );
+    void BenchPointCloud( void );
+    void BenchReplay( void );
+    void BenchModbusFraming( void );
+    void BenchModbusProgram( void );
+    void BenchFloatProperty( void );
+    void BenchPropertySnapshot( void );
+    void BenchFileView( void );
+    void BenchEchoFilter( void );
+    void BenchVoxelGrid( void );
+    void BenchTemporalFilter( void );
+    void BenchRangeImage( void );
+} // namespace LeddarBench
@@ -557,8 +557,16 @@ void connectedMenu( LeddarDevice::LdSensor *aSensor, LeddarDevice::LdSensor *aSe
                     lFilename.erase( lFilename.size() - 1, 1 );
                 }
 
+                int lWindow = 1;
+                std::cout << "Blocks sent before waiting for an answer (1-16): ";
+                std::cin >> lWindow;
+
+                if( !ValidInput() || lWindow < 1 || lWindow > 16 )
+                    lWindow = 1;
+
                 try
                 {
+                    aSensor->SetFirmwareUpdateWindow( static_cast<uint8_t>( lWindow ) );
                     std::cout << "Updating firmware...";
                     aSensor->UpdateFirmware( lFilename, nullptr, nullptr );
                     std::cout << "completed!" << std::endl;
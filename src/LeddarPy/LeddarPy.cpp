@@ -15,6 +15,7 @@
 
 #include "LeddarPy.h"
 #include "LeddarPyDevice.h"
+#include "LeddarPyFrame.h"
 #include "PythonHelper.h"
 #include "Connecters.h"
 #include "LdLibModbusSerial.h"
@@ -29,8 +30,12 @@
 #include "LtTimeUtils.h"
 #include "LtIntUtilities.h"
 #include "LtExceptions.h"
+#include "LtSystemUtils.h"
 
 #include "LdSensor.h"
+#include "LdPointCloudBuilder.h"
+#include "LdTemporalFilter.h"
+#include "LdVoxelGrid.h"
 
 #include <Python.h>
 #define NPY_NO_DEPRECATED_API NPY_1_7_API_VERSION
@@ -67,6 +72,40 @@ static PyObject *EnableDebugTrace( PyObject *self, PyObject *args )
 }
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn static PyObject *SetAcquisitionPolicy( PyObject *self, PyObject *args )
+///
+/// \brief  Set the scheduling policy applied by the data threads when they start
+///
+/// \param [in,out] self    The class instance that this method operates on.
+/// \param [in,out] args    The arguments: (int) cpu, -1 for any; (int) SCHED_FIFO priority, 0 for default scheduler; (bool) lock memory
+///
+/// \return True on success.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static PyObject *SetAcquisitionPolicy( PyObject *self, PyObject *args )
+{
+    LeddarUtils::LtSystemUtils::LtThreadPolicy lPolicy;
+    int lLockMemory = false;
+
+    if( !PyArg_ParseTuple( args, "|iii", &lPolicy.mCpu, &lPolicy.mPriority, &lLockMemory ) )
+        return nullptr;
+
+    lPolicy.mLockMemory = ( lLockMemory != 0 );
+
+    try
+    {
+        LeddarUtils::LtSystemUtils::SetAcquisitionThreadPolicy( lPolicy );
+    }
+    catch( const std::exception &e )
+    {
+        PyErr_SetString( PyExc_RuntimeError, e.what() );
+        return nullptr;
+    }
+
+    Py_RETURN_TRUE;
+}
 
 PyObject *GetDeviceTypeDict( PyObject *self, PyObject *args )
 {
@@ -202,6 +241,48 @@ PyObject *GetMaskDict( PyObject *self, PyObject *args )
 }
 
 
+PyObject *GetPointFieldDict( PyObject *self, PyObject *args )
+{
+    PyObject *lFields = PyDict_New();
+    if( !lFields )
+        return nullptr;
+
+    PyDict_SetItemString( lFields, "PF_XYZ", PyLong_FromLong( LeddarConnection::LdPointCloudBuilder::PF_XYZ ) );
+    PyDict_SetItemString( lFields, "PF_INTENSITY", PyLong_FromLong( LeddarConnection::LdPointCloudBuilder::PF_INTENSITY ) );
+    PyDict_SetItemString( lFields, "PF_DISTANCE", PyLong_FromLong( LeddarConnection::LdPointCloudBuilder::PF_DISTANCE ) );
+    PyDict_SetItemString( lFields, "PF_TIMESTAMP", PyLong_FromLong( LeddarConnection::LdPointCloudBuilder::PF_TIMESTAMP ) );
+    PyDict_SetItemString( lFields, "PF_CHANNEL", PyLong_FromLong( LeddarConnection::LdPointCloudBuilder::PF_CHANNEL ) );
+    PyDict_SetItemString( lFields, "PF_FLAGS", PyLong_FromLong( LeddarConnection::LdPointCloudBuilder::PF_FLAGS ) );
+    PyDict_SetItemString( lFields, "PF_DEFAULT", PyLong_FromLong( LeddarConnection::LdPointCloudBuilder::PF_DEFAULT ) );
+    PyDict_SetItemString( lFields, "PF_ALL", PyLong_FromLong( LeddarConnection::LdPointCloudBuilder::PF_ALL ) );
+    return lFields;
+}
+
+PyObject *GetVoxelPolicyDict( PyObject *self, PyObject *args )
+{
+    PyObject *lPolicies = PyDict_New();
+    if( !lPolicies )
+        return nullptr;
+
+    PyDict_SetItemString( lPolicies, "VP_CENTROID", PyLong_FromLong( LeddarConnection::LdVoxelGrid::VP_CENTROID ) );
+    PyDict_SetItemString( lPolicies, "VP_MAX_AMPLITUDE", PyLong_FromLong( LeddarConnection::LdVoxelGrid::VP_MAX_AMPLITUDE ) );
+    PyDict_SetItemString( lPolicies, "VP_NEAREST", PyLong_FromLong( LeddarConnection::LdVoxelGrid::VP_NEAREST ) );
+    return lPolicies;
+}
+
+PyObject *GetTemporalModeDict( PyObject *self, PyObject *args )
+{
+    PyObject *lModes = PyDict_New();
+    if( !lModes )
+        return nullptr;
+
+    PyDict_SetItemString( lModes, "TF_NONE", PyLong_FromLong( LeddarConnection::LdTemporalFilter::TF_NONE ) );
+    PyDict_SetItemString( lModes, "TF_EMA", PyLong_FromLong( LeddarConnection::LdTemporalFilter::TF_EMA ) );
+    PyDict_SetItemString( lModes, "TF_MEDIAN", PyLong_FromLong( LeddarConnection::LdTemporalFilter::TF_MEDIAN ) );
+    PyDict_SetItemString( lModes, "TF_KALMAN", PyLong_FromLong( LeddarConnection::LdTemporalFilter::TF_KALMAN ) );
+    return lModes;
+}
+
 PyObject *GetCalibTypeDict( PyObject *self, PyObject *args )
 {
     PyObject *lCalib = PyDict_New();
@@ -327,6 +408,12 @@ static PyMethodDef leddar_Methods[] =
         "enable_debug_trace", EnableDebugTrace, METH_VARARGS, "Enable/disable debug traces\n"
         "param1: (bool) enable/disable"
     },
+    {
+        "set_acquisition_policy", SetAcquisitionPolicy, METH_VARARGS, "Set the scheduling policy of the data threads, applied when they start\n"
+        "param1: (int) cpu the thread is pinned to, -1 (default) for any\n"
+        "param2: (int) SCHED_FIFO priority (1-99), 0 (default) for the default scheduler\n"
+        "param3: (bool) lock the process memory in RAM (default False)"
+    },
     {
         "get_devices", GetDevices, METH_VARARGS, "Lists devices\n"
         "param1: (string) the device type (Serial, SpiFTDI, Ethernet or Usb) - Case sensitive"
@@ -383,10 +470,23 @@ PyMODINIT_FUNC initleddar( void )
     PyModule_AddObject( lModule, "property_ids", GetPropertyIdDict( lModule, nullptr ) );
     PyModule_AddObject( lModule, "data_masks", GetMaskDict( lModule, nullptr ) );
     PyModule_AddObject( lModule, "calib_types", GetCalibTypeDict( lModule, nullptr ) );
+    PyModule_AddObject( lModule, "point_fields", GetPointFieldDict( lModule, nullptr ) );
+    PyModule_AddObject( lModule, "voxel_policies", GetVoxelPolicyDict( lModule, nullptr ) );
+    PyModule_AddObject( lModule, "temporal_modes", GetTemporalModeDict( lModule, nullptr ) );
     if( !PyType_HasFeature( deviceType, Py_TPFLAGS_HEAPTYPE ) )
         Py_INCREF( deviceType );
     PyModule_AddObject( lModule, "Device", ( PyObject * )deviceType );
 
+    PyTypeObject *frameType = InitFrameType();
+    if( !frameType )
+    {
+        Py_DECREF( lModule );
+        return RETURN_VALUE( nullptr );
+    }
+
+    Py_INCREF( frameType );
+    PyModule_AddObject( lModule, "Frame", ( PyObject * )frameType );
+
     return RETURN_VALUE( lModule );
 }
 
@@ -0,0 +1,82 @@
+import sys
+import threading
+import time
+
+import numpy as np
+
+import leddar
+
+# Compares the echoes ingest of get_echoes() (dict + new ndarray per frame, GIL held)
+# with get_frame() (pooled frame read through the buffer protocol, GIL released while waiting and copying),
+# and wait_for_echoes() (data thread, woken on new data, no polling sleep).
+# The cloud lines compare the PointCloud2 data built with numpy and with get_point_cloud() (bytes/s instead of echoes/s).
+# A python thread counts in the background: its progress shows how much the GIL was left to other threads.
+#
+# usage: python LeddarPyBenchmark.py [address] [device type] [frame count]
+
+address = sys.argv[1] if len(sys.argv) > 1 else "192.168.0.2"
+device_type = sys.argv[2] if len(sys.argv) > 2 else "Ethernet"
+frame_count = int(sys.argv[3]) if len(sys.argv) > 3 else 500
+
+dev = leddar.Device()
+dev.connect(address, leddar.device_types[device_type])
+dev.set_data_mask(leddar.data_masks["DM_ECHOES"])
+
+
+class Counter(threading.Thread):
+    def __init__(self):
+        threading.Thread.__init__(self)
+        self.count = 0
+        self.stop = False
+
+    def run(self):
+        while not self.stop:
+            self.count += 1
+
+
+def run(name, get_distances):
+    counter = Counter()
+    counter.start()
+    echoes = 0
+    start = time.perf_counter()
+    cpu_start = time.process_time()
+
+    for _ in range(frame_count):
+        echoes += len(get_distances())
+
+    elapsed = time.perf_counter() - start
+    cpu = time.process_time() - cpu_start
+    counter.stop = True
+    counter.join()
+
+    print("{: <12} {: >10.1f} frames/s {: >12.0f} echoes/s {: >8.1f} us cpu/frame {: >12.0f} background loops/s".format(
+        name, frame_count / elapsed, echoes / elapsed, cpu * 1e6 / frame_count, counter.count / elapsed))
+
+
+run("get_echoes", lambda: dev.get_echoes()["data"]["distances"])
+run("get_frame", lambda: np.asarray(dev.get_frame())["distances"])
+
+
+# PointCloud2 data: the numpy path of Leddar_ROS before the C++ builder, and get_point_cloud()
+def numpy_cloud():
+    data = dev.get_echoes()["data"]
+    data = data[np.bitwise_and(data["flags"], 0x01).astype(bool)]
+    cloud = np.empty(data.size, dtype=[("x", np.float32), ("y", np.float32), ("z", np.float32), ("intensity", np.float32)])
+    cloud["x"] = data["x"]
+    cloud["y"] = data["y"]
+    cloud["z"] = data["z"]
+    cloud["intensity"] = data["amplitudes"]
+    return cloud.tobytes()
+
+
+run("cloud/numpy", numpy_cloud)
+run("cloud/native", lambda: dev.get_point_cloud(leddar.point_fields["PF_DEFAULT"], True, 1.0)["data"])
+
+# Frames received by the data thread, the caller is woken by the new data signal
+dev.start_data_thread()
+run("wait_for", lambda: np.asarray(dev.wait_for_echoes(1.0))["distances"])
+
+dev.stop_data_thread()
+
+dev.disconnect()
+del dev
@@ -13,6 +13,7 @@
 // *****************************************************************************
 
 #include "LeddarPyDevice.h"
+#include "LeddarPyFrame.h"
 #include "LeddarPy.h"
 #include "PythonHelper.h"
 #include "Connecters.h"
@@ -24,6 +25,7 @@
 #include "LtIntUtilities.h"
 #include "LtMathUtils.h"
 #include "LtExceptions.h"
+#include "LtSystemUtils.h"
 
 #include "LdLibModbusSerial.h"
 #include "LdSpiFTDI.h"
@@ -37,6 +39,11 @@
 #include "LdSensorPixell.h"
 
 #include "LdLjrRecorder.h"
+#include "LdEchoFilter.h"
+#include "LdPointCloudBuilder.h"
+#include "LdRangeImage.h"
+#include "LdTemporalFilter.h"
+#include "LdVoxelGrid.h"
 
 #define NPY_NO_DEPRECATED_API NPY_1_7_API_VERSION
 #define NO_IMPORT_ARRAY
@@ -45,6 +52,10 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <limits>
 
 
 #ifdef _WIN32
@@ -98,6 +109,22 @@ PyMethodDef Device_methods[] =
         "Returns  dict with property ids for keys and all property values for values. \n"
         "If a property has multiple values, it will be a list"
     },
+    {
+        "get_properties_binary_snapshot", ( PyCFunction )GetPropertiesBinarySnapshot, METH_VARARGS, "Capture the raw value of the properties in one consistent binary snapshot.\n"
+        "param1: Property categories bit mask (optional, default configuration and calibration: 12)\n"
+        "Returns: (bytes) The snapshot"
+    },
+    {
+        "diff_properties_snapshot", ( PyCFunction )DiffPropertiesSnapshot, METH_VARARGS, "Compare the properties with a binary snapshot.\n"
+        "param1: (bytes) Snapshot from get_properties_binary_snapshot\n"
+        "Returns: (list) Ids of the properties that differ"
+    },
+    {
+        "restore_properties_snapshot", ( PyCFunction )RestorePropertiesSnapshot, METH_VARARGS, "Apply a binary snapshot, only the properties that differ are written to the sensor.\n"
+        "param1: (bytes) Snapshot from get_properties_binary_snapshot\n"
+        "param2: (bool) Also write the non editable properties (optional, default False)\n"
+        "Returns: (int) The number of written properties"
+    },
     {
         "set_property_value", ( PyCFunction )SetPropertyValue, METH_VARARGS, "Set the value of the property.\n"
         "param1: Property id (from leddar.property_ids)\n"
@@ -139,6 +166,17 @@ PyMethodDef Device_methods[] =
         "param1: (int) number of retries (optional, default to 5)\n"
         "Returns: False if there is no new states. Else return a dict with keys 'timestamp', 'cpu_load' and  'system_temp' and possibly 'apd_temps' (a list of 3 elements)"
     },
+    {
+        "get_states_record", ( PyCFunction )GetStatesRecord, METH_VARARGS, "Get the last states from sensor as a numpy record, without going through the properties.\n"
+        "param1: (int) number of retries (optional, default to 5)\n"
+        "Returns: Exception if there is no new states, else a structured ndarray of shape (1, ) with fields:\n"
+        "'fields' : (uint32) bit mask of the fields provided by the sensor (1: timestamp, 2: system_temp, 4: predict_temp, 8: cpu_load, 16: backup)\n"
+        "'timestamp' : (uint32) timestamp in ms\n"
+        "'system_temp', 'predict_temp' : (int32) raw temperatures, divide by 'temperature_scale'\n"
+        "'cpu_load' : (uint32) raw cpu load, divide by 'cpu_load_scale'\n"
+        "'backup' : (uint32) calibration backup flag\n"
+        "'temperature_scale', 'cpu_load_scale' : (uint32) scales of the raw values"
+    },
     {
         "get_echoes", ( PyCFunction )GetEchoes, METH_VARARGS, "Get last echoes from sensor.\n"
         "param1: (int) number of retries (optional, default to 5)\n"
@@ -159,6 +197,94 @@ PyMethodDef Device_methods[] =
         "'timestamps' : (ndarray with shape (n_echoes, ) and dtype 'uint16') the timestamp offset for each echo\n"
         "'flags' : (ndarray with shape (n_echoes, ) and dtype 'uint16') the flag for each echo\n"
     },
+    {
+        "get_frame", ( PyCFunction )GetFrame, METH_VARARGS, "Get last echoes from sensor as a leddar.Frame, the GIL is released while waiting and copying.\n"
+        "param1: (int) number of retries (optional, default to 5)\n"
+        "param2: (int) ms between retries (optional, default to 15)\n"
+        "Returns: Exception if there is no new data, else a leddar.Frame. numpy.asarray(frame) is a structured ndarray\n"
+        "with the fields of get_echoes()['data'] that shares the frame memory. The frame attributes are the other keys of get_echoes()\n"
+        "(led_power is -1 when not available). The frame memory is reused once the frame and its arrays are released.\n"
+    },
+    {
+        "wait_for_echoes", ( PyCFunction )WaitForEchoes, METH_VARARGS, "Wait for the next echoes, the GIL is released while waiting and copying.\n"
+        "Woken by the sensor new data signal: with the data thread started, no request is sent and no polling delay is added.\n"
+        "A frame is returned once, the next call waits for a newer one.\n"
+        "param1: (float) timeout in seconds (optional, default to 1.0)\n"
+        "Returns: a leddar.Frame (see get_frame), None on timeout\n"
+    },
+    {
+        "get_echoes_batch", ( PyCFunction )GetEchoesBatch, METH_VARARGS, "Wait for the next n echoes frames and stack them in a single array, the GIL is released while waiting and copying.\n"
+        "param1: (int) number of frames\n"
+        "param2: (float) timeout in seconds for the whole batch (optional, default to 1.0)\n"
+        "Returns: a dict with keys\n"
+        "data: a structured ndarray with the fields of get_echoes()['data'], the echoes of all the frames\n"
+        "frame_offsets: (ndarray with shape (n_frames + 1, ) and dtype 'int64') the echoes of frame i are data[frame_offsets[i]:frame_offsets[i + 1]]\n"
+        "timestamps: (ndarray with shape (n_frames, ) and dtype 'uint64') the timestamp of each frame\n"
+        "n_frames is lower than n if the timeout expired.\n"
+    },
+    {
+        "get_point_cloud", ( PyCFunction )GetPointCloud, METH_VARARGS, "Build the data of a sensor_msgs/PointCloud2 message in C++, the GIL is released while waiting and building.\n"
+        "param1: (int) fields, combination of leddar.point_fields (optional, default to PF_DEFAULT: x, y, z, intensity)\n"
+        "param2: (bool) keep only the valid echoes (optional, default to True)\n"
+        "param3: (float) timeout in seconds to wait for the next frame like wait_for_echoes, None to use the last frame (optional, default to 1.0)\n"
+        "Returns: None on timeout, else a dict with keys\n"
+        "data: (bytes) the points, little endian, without padding between the rows (height is 1)\n"
+        "width: the number of points\n"
+        "point_step: the size of a point\n"
+        "fields: list of (name, offset, datatype, count) tuples, datatype is the sensor_msgs/PointField value\n"
+        "timestamp: the frame timestamp (see leddar.Frame)\n"
+    },
+    {
+        "set_echo_filter", ( PyCFunction )SetEchoFilter, METH_VARARGS, "Set the filter applied to the echoes before the cartesian coordinates and the swap, "
+        "the removed echoes are not returned by get_echoes, get_frame or get_point_cloud, nor recorded. Without argument, the filter is removed.\n"
+        "param1: (int) flags that must be set, 1 to keep only the valid echoes (optional, default to 0)\n"
+        "param2: (int) flags that must be cleared (optional, default to 0)\n"
+        "param3: (float) minimum distance (optional, default to -inf)\n"
+        "param4: (float) maximum distance (optional, default to inf)\n"
+        "param5: (float) minimum amplitude (optional, default to 0)\n"
+        "param6: (tuple) channels region of interest (first column, last column, first row, last row), None for all the channels (optional, default to None)\n"
+        "Returns: True"
+    },
+    {
+        "set_temporal_filter", ( PyCFunction )SetTemporalFilter, METH_VARARGS, "Set the frame to frame smoothing of the distances, per channel and echo rank, applied after the echo filter. "
+        "With an outlier gate, the echoes too far from the prediction are removed. Without argument, the smoothing is removed.\n"
+        "param1: (int) mode, see leddar.temporal_modes (optional, default to TF_NONE)\n"
+        "param2: (float) TF_EMA: weight of the new distance in ]0, 1], TF_MEDIAN: window (frames), TF_KALMAN: acceleration noise (m / frame^2) (optional, default to 0.5)\n"
+        "param3: (float) TF_KALMAN: measurement noise (m) (optional, default to 0.05)\n"
+        "param4: (float) outlier gate (m), 0 to keep all the echoes (optional, default to 0)\n"
+        "param5: (int) consecutive outliers removed before the filter restarts on the new distance (optional, default to 3)\n"
+        "param6: (int) filtered echoes per channel (optional, default to 1)\n"
+        "Returns: True"
+    },
+    {
+        "set_voxel_grid", ( PyCFunction )SetVoxelGrid, METH_VARARGS, "Set the spatial downsampling applied to the echoes after the cartesian coordinates, before the swap: "
+        "the echoes out of the region of interest are removed, then one echo is kept per voxel. Without argument, the downsampling is removed.\n"
+        "param1: (float or tuple) voxel size in meters, or (x, y, z) sizes, 0 to only apply the region of interest (optional, default to 0)\n"
+        "param2: (int) policy, see leddar.voxel_policies (optional, default to VP_CENTROID)\n"
+        "param3: (tuple) region of interest (min x, max x, min y, max y, min z, max z), None for no region of interest (optional, default to None)\n"
+        "Returns: True"
+    },
+    {
+        "set_range_image", ( PyCFunction )SetRangeImage, METH_VARARGS, "Set the dense range image filled with the echoes before the swap, after the echo and temporal filters: "
+        "height x width pixels from the sensor vertical and horizontal channels, with up to K echoes per pixel. Without argument, the range image is removed.\n"
+        "param1: (int) echoes per pixel K, 0 to remove the range image (optional, default to 0)\n"
+        "param2: (int) number of channel indexes, the indexes after height x width fold on the same pixels, 0 for height x width (optional, default to 0)\n"
+        "Returns: True"
+    },
+    {
+        "get_range_image", ( PyCFunction )GetRangeImage, METH_VARARGS, "Get the dense range image of a frame, the GIL is released while waiting and copying.\n"
+        "param1: (float) timeout in seconds to wait for the next frame like wait_for_echoes, None to use the last frame (optional, default to 1.0)\n"
+        "Returns: None on timeout, else a dict with keys\n"
+        "distance: (ndarray with shape (height, width, K) and dtype 'float32') the distances, 0 after the echoes of a pixel\n"
+        "amplitude: (ndarray with shape (height, width, K) and dtype 'float32') the amplitudes, 0 after the echoes of a pixel\n"
+        "count: (ndarray with shape (height, width) and dtype 'uint8') the number of echoes of each pixel\n"
+        "timestamp: the frame timestamp (see leddar.Frame)\n"
+    },
+    {
+        "fileno", ( PyCFunction )GetFileNo, METH_NOARGS, "File descriptor readable when new echoes are received (Linux only), for select / selectors / asyncio.\n"
+        "The new echoes are received by the data thread (start_data_thread), wait_for_echoes with a zero timeout returns them and resets the descriptor.\n"
+        "Returns: (int) the file descriptor, raises NotImplementedError on other platforms\n"
+    },
     {
         "get_calib_values", ( PyCFunction )GetCalibValues, METH_VARARGS, "returns the calibration values"
         "param1: (int) the type of calibration (see leddar.calib_types) \n"
@@ -191,6 +317,14 @@ PyMethodDef Device_methods[] =
         "param1: (string)(optional) Path to the file. If empty, will generate a ltl record with device name and date - time\n"
         "Returns: True"
     },
+    {
+        "get_pipeline_stats", ( PyCFunction )GetPipelineStats, METH_VARARGS, "Get the data path latency histograms and counters.\n"
+        "param1: (bool)(optional) return a json string instead of a dict (default False)\n"
+        "Returns: dict with 'enabled', 'counters' (bytes_received, frames_decoded, frames_dropped, lock_contention, echoes_filtered, echoes_reduced, echoes_rejected) and 'stages' "
+        "(receive, decode, cartesian, swap, notify, reduce, smooth, range_image: dict of count, mean_ns, p50_ns, p99_ns, p999_ns, max_ns). The request / answer sensors (Modbus, CAN, SPI) "
+        "time their whole read in the receive stage"
+    },
+    { "reset_pipeline_stats", ( PyCFunction )ResetPipelineStats, METH_NOARGS, "Clear the data path latency histograms and counters.\nReturns: True" },
 
     { NULL }  //Sentinel
 };
@@ -330,6 +464,60 @@ private:
     uint32_t mOldDataMask;
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  ScopedSensorUser
+///
+/// \brief  Registers a call that uses mSensor and mNotifier without the GIL, Disconnect waits for the
+///         registered calls before deleting them. Construct it with the GIL held, before the sensor is used.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class ScopedSensorUser
+{
+public:
+    explicit ScopedSensorUser( sLeddarDevice *aDevice ) : mDevice( aDevice ), mRegistered( false ) {
+        std::lock_guard<std::mutex> lock( mDevice->mUsersMutex );
+
+        if( mDevice->mSensor != nullptr && !mDevice->mClosing )
+        {
+            ++mDevice->mUsers;
+            mRegistered = true;
+        }
+    }
+    ~ScopedSensorUser() {
+        if( mRegistered )
+        {
+            std::lock_guard<std::mutex> lock( mDevice->mUsersMutex );
+
+            if( --mDevice->mUsers == 0 )
+                mDevice->mUsersCondition.notify_all();
+        }
+    }
+
+    // False with a Python exception set if the sensor is not connected or being disconnected
+    bool Check( void ) {
+        if( !mRegistered )
+            PyErr_SetString( PyExc_RuntimeError, mDevice->mSensor == nullptr ? "Not connected to a sensor." : "The sensor is being disconnected." );
+
+        return mRegistered;
+    }
+private:
+    sLeddarDevice *mDevice;
+    bool mRegistered;
+};
+
+static bool IsClosing( sLeddarDevice *self )
+{
+    std::lock_guard<std::mutex> lock( self->mUsersMutex );
+    return self->mClosing;
+}
+
+static PyObject *RaiseDisconnected( void )
+{
+    PyErr_SetString( PyExc_RuntimeError, "The sensor was disconnected during the wait." );
+    return nullptr;
+}
+
 class CallBackManger : public LeddarCore::LdObject
 {
 public:
@@ -352,9 +540,9 @@ private:
 
     virtual void Callback( LdObject *aSender, const SIGNALS aSignal, void * ) override {
 
-        // if we got a callback, it is necessarily after a call to GetData() from DataThread(),
+        // if we got a callback, it is necessarily after a call to GetData() from DataThread() or LockedGetData(),
         // so it both is safe and necessary to remove the lock, or we could deadlock GIL
-        if( mSelf->mDataThreadSharedData.mGetDataLocked ) { //additional safety, it is illegal to unlock a mutex twice, do not use this field outside of DataThread()
+        if( mSelf->mDataThreadSharedData.mGetDataLocked ) { //additional safety, it is illegal to unlock a mutex twice, do not use this field outside of DataThread() and LockedGetData()
             mSelf->mDataThreadSharedData.mMutex.unlock();
             mSelf->mDataThreadSharedData.mGetDataLocked = false;
         }
@@ -704,11 +892,13 @@ PyObject *Connect( sLeddarDevice *self, PyObject *args )
 /// \fn PyObject *Disconnect( sLeddarDevice *self, PyObject *args )
 ///
 /// \brief  Disconnect from sensor
+///         The waits of other threads are woken, and the calls using the sensor without the GIL are
+///         waited for before the sensor is deleted.
 ///
 /// \param [in,out] self    If non-null, the class instance that this method operates on.
 /// \param [in,out] args    No argument.
 ///
-/// \return True on success.
+/// \return True on success, nullptr if another thread is disconnecting the sensor.
 ///
 /// \author David Levy
 /// \date   December 2017
@@ -717,15 +907,53 @@ PyObject *Disconnect( sLeddarDevice *self, PyObject *args )
 {
     if( self->mSensor != nullptr )
     {
+        {
+            std::lock_guard<std::mutex> lock( self->mUsersMutex );
+
+            if( self->mClosing )
+            {
+                PyErr_SetString( PyExc_RuntimeError, "The sensor is being disconnected by another thread." );
+                return nullptr;
+            }
+
+            self->mClosing = true;
+        }
+
+        // Wake the waits and wait for the calls running without the GIL
+        if( self->mNotifier != nullptr )
+            self->mNotifier->Wake();
+
+        Py_BEGIN_ALLOW_THREADS
+
+        {
+            std::unique_lock<std::mutex> lock( self->mUsersMutex );
+            self->mUsersCondition.wait( lock, [self]() { return self->mUsers == 0; } );
+        }
+
+        Py_END_ALLOW_THREADS
+
         if( self->mDataThreadSharedData.mThread.joinable() )
         {
             StopDataThread( self, nullptr );
         }
 
+        if( self->mNotifier != nullptr )
+        {
+            delete self->mNotifier;
+            self->mNotifier = nullptr;
+
+            std::lock_guard<std::mutex> lock( self->mConsumedMutex );
+            self->mConsumedSequence = 0;
+            self->mConsumedTimestamp = 0;
+        }
+
         self->mSensor->Disconnect();
         delete self->mSensor;
         self->mSensor = nullptr;
         DebugTrace( "Disconnected" );
+
+        std::lock_guard<std::mutex> lock( self->mUsersMutex );
+        self->mClosing = false;
     }
 
     Py_RETURN_TRUE;
@@ -776,8 +1004,8 @@ PyObject *GetCalibValues( sLeddarDevice *self, PyObject *args )
                     if( !lPyArray )
                         throw std::logic_error( "Unable to allocate memory for Numpy Array" );
 
-                    for( npy_intp i = 0; i < dims; i++ )
-                        ( static_cast<float *>PyArray_GETPTR1( ( PyArrayObject * )lPyArray, i ) )[0] = lFloatprop->Value( i );
+                    if( dims != 0 )
+                        lFloatprop->GetValues( static_cast<float *>( PyArray_DATA( ( PyArrayObject * )lPyArray ) ), dims );
 
                     return lPyArray;
                 }
@@ -875,6 +1103,147 @@ PyObject *GetPropertiesSnapshot( sLeddarDevice *self )
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *GetPropertiesBinarySnapshot( sLeddarDevice *self, PyObject *args )
+///
+/// \brief  Binary snapshot of the properties (LdPropertiesContainer::Snapshot)
+///
+/// \param [in,out] self    If non-null, the class instance that this method operates on.
+/// \param [in,out] args    If non-null, the arguments.
+///                 int: (optional) categories bit mask
+///
+/// \return Null if it fails, else the snapshot (bytes).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *GetPropertiesBinarySnapshot( sLeddarDevice *self, PyObject *args )
+{
+    if( !CheckSensor( self ) )
+        return nullptr;
+
+    unsigned int lCategories = LeddarCore::LdProperty::CAT_CONFIGURATION | LeddarCore::LdProperty::CAT_CALIBRATION;
+
+    if( !PyArg_ParseTuple( args, "|I", &lCategories ) )
+        return nullptr;
+
+    try
+    {
+        std::vector<uint8_t> lSnapshot;
+        {
+            std::lock_guard<std::mutex> lock( self->mDataThreadSharedData.mMutex );
+            lSnapshot = self->mSensor->GetProperties()->Snapshot( lCategories );
+        }
+
+        return PyBytes_FromStringAndSize( reinterpret_cast<const char *>( lSnapshot.data() ), static_cast<Py_ssize_t>( lSnapshot.size() ) );
+    }
+    catch( std::exception &e )
+    {
+        PyErr_SetString( PyExc_RuntimeError, e.what() );
+        return nullptr;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *DiffPropertiesSnapshot( sLeddarDevice *self, PyObject *args )
+///
+/// \brief  Ids of the properties that differ from a binary snapshot (LdPropertiesContainer::Diff)
+///
+/// \param [in,out] self    If non-null, the class instance that this method operates on.
+/// \param [in,out] args    If non-null, the arguments.
+///                 bytes: the snapshot
+///
+/// \return Null if it fails, else the list of ids.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *DiffPropertiesSnapshot( sLeddarDevice *self, PyObject *args )
+{
+    if( !CheckSensor( self ) )
+        return nullptr;
+
+    Py_buffer lSnapshot;
+
+    if( !PyArg_ParseTuple( args, "y*", &lSnapshot ) )
+        return nullptr;
+
+    std::vector<uint8_t> lData( static_cast<const uint8_t *>( lSnapshot.buf ), static_cast<const uint8_t *>( lSnapshot.buf ) + lSnapshot.len );
+    PyBuffer_Release( &lSnapshot );
+
+    try
+    {
+        std::vector<uint32_t> lIds;
+        {
+            std::lock_guard<std::mutex> lock( self->mDataThreadSharedData.mMutex );
+            lIds = self->mSensor->GetProperties()->Diff( lData );
+        }
+
+        PyObject *lList = PyList_New( lIds.size() );
+
+        if( lList == nullptr )
+            return nullptr;
+
+        for( size_t i = 0; i < lIds.size(); ++i )
+        {
+            PyList_SetItem( lList, i, PyLong_FromUnsignedLong( lIds[i] ) );
+        }
+
+        return lList;
+    }
+    catch( std::exception &e )
+    {
+        PyErr_SetString( PyExc_RuntimeError, e.what() );
+        return nullptr;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *RestorePropertiesSnapshot( sLeddarDevice *self, PyObject *args )
+///
+/// \brief  Apply a binary snapshot (LdPropertiesContainer::Restore) and write the changed properties to the sensor
+///
+/// \param [in,out] self    If non-null, the class instance that this method operates on.
+/// \param [in,out] args    If non-null, the arguments.
+///                 bytes: the snapshot
+///                 bool: (optional) force the non editable properties
+///
+/// \return Null if it fails, else the number of written properties.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *RestorePropertiesSnapshot( sLeddarDevice *self, PyObject *args )
+{
+    if( !CheckSensor( self ) )
+        return nullptr;
+
+    Py_buffer lSnapshot;
+    int lForce = 0;
+
+    if( !PyArg_ParseTuple( args, "y*|p", &lSnapshot, &lForce ) )
+        return nullptr;
+
+    std::vector<uint8_t> lData( static_cast<const uint8_t *>( lSnapshot.buf ), static_cast<const uint8_t *>( lSnapshot.buf ) + lSnapshot.len );
+    PyBuffer_Release( &lSnapshot );
+
+    try
+    {
+        std::lock_guard<std::mutex> lock( self->mDataThreadSharedData.mMutex );
+        size_t lWritten = self->mSensor->GetProperties()->Restore( lData, lForce != 0 );
+
+        if( lWritten != 0 )
+        {
+            self->mSensor->SetConfig();
+            self->mSensor->WriteConfig();
+        }
+
+        return PyLong_FromSize_t( lWritten );
+    }
+    catch( std::exception &e )
+    {
+        PyErr_SetString( PyExc_RuntimeError, e.what() );
+        return nullptr;
+    }
+}
+
 int GetPropertyId( char *key )
 {
     static PyObject *dict = nullptr;
@@ -1450,6 +1819,80 @@ PyObject *GetStates( sLeddarDevice *self, PyObject *args )
     }, lNRetries );
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *GetStatesRecord( sLeddarDevice *self, PyObject *args )
+///
+/// \brief  Get the last states from sensor as a numpy record (see PackageStatesRecord)
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *GetStatesRecord( sLeddarDevice *self, PyObject *args )
+{
+    if( !CheckSensor( self ) )
+        return nullptr;
+
+    size_t lNRetries = 5;
+
+    if( !PyArg_ParseTuple( args, "|n", &lNRetries ) )
+        return nullptr;
+
+    return RetryNTimes( [&]()
+    {
+        ScopedDataMask sdm( self, LeddarDevice::LdSensor::DM_STATES );
+        std::lock_guard<std::mutex> lock( self->mDataThreadSharedData.mMutex );
+
+        if( !self->mSensor->GetData() )
+            throw std::runtime_error( "No new states available!" );
+
+        return PackageStatesRecord( self->mSensor->GetResultStates()->GetRecord() );
+    }, lNRetries );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *PackageStatesRecord( const LeddarConnection::LdStatesRecord &aRecord )
+///
+/// \brief  Copy a states record in a numpy structured array with the same layout
+///
+/// \param  aRecord The states record.
+///
+/// \return  A structured ndarray of shape (1, ), nullptr on error
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *PackageStatesRecord( const LeddarConnection::LdStatesRecord &aRecord )
+{
+    static_assert( sizeof( LeddarConnection::LdStatesRecord ) == 8 * sizeof( uint32_t ), "The numpy description must match LdStatesRecord" );
+
+    npy_intp dims[1] = { 1 };
+
+    PyObject *op = Py_BuildValue( "[(s, s), (s, s), (s, s), (s, s), (s, s), (s, s), (s, s), (s, s)]"
+                                  , "fields", "u4"
+                                  , "timestamp", "u4"
+                                  , "system_temp", "i4"
+                                  , "predict_temp", "i4"
+                                  , "cpu_load", "u4"
+                                  , "backup", "u4"
+                                  , "temperature_scale", "u4"
+                                  , "cpu_load_scale", "u4" );
+    PyArray_Descr *descr;
+
+    if( !PyArray_DescrConverter( op, &descr ) )
+    {
+        Py_DECREF( op );
+        return nullptr;
+    }
+
+    Py_DECREF( op );
+    PyObject *lRecordArray = PyArray_SimpleNewFromDescr( 1, dims, descr );
+
+    if( lRecordArray != nullptr )
+    {
+        memcpy( PyArray_DATA( ( PyArrayObject * )lRecordArray ), &aRecord, sizeof( aRecord ) );
+    }
+
+    return lRecordArray;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn PyObject *PackageStates( LeddarConnection::LdResultStates *aResultStates )
 ///
@@ -1581,21 +2024,6 @@ PyObject *GetEchoes( sLeddarDevice *self, PyObject *args )
 /// \author David Levy, Maxime Lemonnier
 /// \date   November 2017
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-#pragma pack(push,1)
-
-struct LeddarPyEcho
-{
-    uint32_t index;
-    float distance;
-    float amplitude;
-    uint64_t timestamp;
-    uint16_t flag;
-    float x;
-    float y;
-    float z;
-};
-#pragma pack(pop)
-
 PyObject *PackageEchoes( LeddarDevice::LdSensor *aSensor )
 {
     std::vector<LeddarConnection::LdEcho> &lEchoes = *( aSensor->GetResultEchoes()->GetEchoes() );
@@ -1605,13 +2033,32 @@ PyObject *PackageEchoes( LeddarDevice::LdSensor *aSensor )
     if( !lEchoesDict )
         throw std::logic_error( "Unable to allocate memory for Python list" );
 
-    auto *lTS64 = dynamic_cast<const LeddarCore::LdIntegerProperty*>(aSensor->GetResultEchoes()->GetProperties()->FindProperty(LeddarCore::LdPropertyIds::ID_RS_TIMESTAMP64));
-    auto *lCurrentLedPower = dynamic_cast<const LeddarCore::LdIntegerProperty*>(aSensor->GetResultEchoes()->GetProperties()->FindProperty(LeddarCore::LdPropertyIds::ID_CURRENT_LED_INTENSITY));
-    PyDict_SetItemString( lEchoesDict, "timestamp", PyLong_FromUnsignedLongLong( lTS64 != nullptr && lTS64->ValueT<uint64_t>() != 0 ? lTS64->ValueT<uint64_t>() :
-                          aSensor->GetResultEchoes()->GetTimestamp() ) );
+    // Typed metadata is used when the sensor provides it, properties otherwise (i.e. record replay)
+    const LeddarConnection::LdFrameMetadata &lMetadata = aSensor->GetResultEchoes()->GetFrameMetadata();
+    uint64_t lTimestamp64 = 0;
+    const LeddarCore::LdIntegerProperty *lCurrentLedPower = nullptr;
+
+    if( ( lMetadata.mFields & LeddarConnection::LdFrameMetadata::MF_TIMESTAMP64 ) != 0 )
+    {
+        lTimestamp64 = lMetadata.mTimestamp64;
+    }
+    else
+    {
+        auto *lTS64 = dynamic_cast<const LeddarCore::LdIntegerProperty*>(aSensor->GetResultEchoes()->GetProperties()->FindProperty(LeddarCore::LdPropertyIds::ID_RS_TIMESTAMP64));
+        lTimestamp64 = lTS64 != nullptr ? lTS64->ValueT<uint64_t>() : 0;
+    }
+
+    if( ( lMetadata.mFields & LeddarConnection::LdFrameMetadata::MF_LED_POWER ) == 0 )
+    {
+        lCurrentLedPower = dynamic_cast<const LeddarCore::LdIntegerProperty*>(aSensor->GetResultEchoes()->GetProperties()->FindProperty(LeddarCore::LdPropertyIds::ID_CURRENT_LED_INTENSITY));
+    }
+
+    PyDict_SetItemString( lEchoesDict, "timestamp", PyLong_FromUnsignedLongLong( lTimestamp64 != 0 ? lTimestamp64 : aSensor->GetResultEchoes()->GetTimestamp() ) );
     PyDict_SetItemString( lEchoesDict, "distance_scale", PyLong_FromUnsignedLong( aSensor->GetResultEchoes()->GetDistanceScale() ) );
     PyDict_SetItemString( lEchoesDict, "amplitude_scale", PyLong_FromUnsignedLong( aSensor->GetResultEchoes()->GetAmplitudeScale() ) );
-    if( lCurrentLedPower )
+    if( ( lMetadata.mFields & LeddarConnection::LdFrameMetadata::MF_LED_POWER ) != 0 )
+        PyDict_SetItemString( lEchoesDict, "led_power", PyLong_FromUnsignedLong( lMetadata.mLedPower ) );
+    else if( lCurrentLedPower )
         PyDict_SetItemString( lEchoesDict, "led_power", PyLong_FromUnsignedLong( lCurrentLedPower->Value() ) );
     PyDict_SetItemString( lEchoesDict, "v_fov", PyFloat_FromDouble( aSensor->GetResultEchoes()->GetVFOV() ) );
     PyDict_SetItemString( lEchoesDict, "h_fov", PyFloat_FromDouble( aSensor->GetResultEchoes()->GetHFOV() ) );
@@ -1655,15 +2102,994 @@ PyObject *PackageEchoes( LeddarDevice::LdSensor *aSensor )
 }
 
 
-bool DataThreadIsStopped( sSharedDataBase &shared )
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn static bool LockedGetData( sLeddarDevice *self )
+///
+/// \brief  GetData under the data thread mutex, called without the GIL. As in DataThread(), the mutex is
+///         released by CallBackManger before a Python callback takes the GIL.
+///
+/// \param [in,out] self    The class instance.
+///
+/// \return True if there is new data.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static bool LockedGetData( sLeddarDevice *self )
 {
-    std::lock_guard<std::mutex> lock( shared.mMutex );
+    bool lNewData = false;
+    self->mDataThreadSharedData.mMutex.lock(); //we can't use a std::lock_guard here, since we have to free the lock BEFORE acquiring GIL
+    self->mDataThreadSharedData.mGetDataLocked = true;
 
-    if( !shared.mStop )
+    try
     {
-        PyErr_SetString( PyExc_RuntimeError, "Operation refused, DataThread is running." );
+        lNewData = self->mSensor->GetData();
     }
-
+    catch( ... )
+    {
+        if( self->mDataThreadSharedData.mGetDataLocked )
+        {
+            self->mDataThreadSharedData.mGetDataLocked = false;
+            self->mDataThreadSharedData.mMutex.unlock();
+        }
+
+        throw;
+    }
+
+    if( self->mDataThreadSharedData.mGetDataLocked )
+    {
+        self->mDataThreadSharedData.mGetDataLocked = false;
+        self->mDataThreadSharedData.mMutex.unlock();
+    }
+
+    return lNewData;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *GetFrame( sLeddarDevice *self, PyObject *args )
+///
+/// \brief  Get the last echoes from sensor in a pooled frame (see LeddarPyFrame.h).
+///         Unlike get_echoes, the GIL is released while waiting for the data and copying the echoes.
+///
+/// \param [in,out] self    If non-null, the class instance that this method operates on.
+/// \param [in,out] args    If non-null, the arguments.
+///                 int/size_t: (optional) number of retry
+///                 int: (optional) time between retry (ms)
+///
+/// \return A leddar.Frame, nullptr if there is no new data
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *GetFrame( sLeddarDevice *self, PyObject *args )
+{
+    ScopedSensorUser lUser( self );
+
+    if( !lUser.Check() )
+        return nullptr;
+
+    size_t lNRetries = 5;
+    int lMsBetweenRetries = 15;
+
+    if( !PyArg_ParseTuple( args, "|ni", &lNRetries, &lMsBetweenRetries ) )
+        return nullptr;
+
+    std::vector<LeddarPyEcho> *lBuffer = AcquireFrameBuffer();
+    sLeddarFrameInfo lInfo;
+    std::string lLastException = "No new echoes available!";
+    bool lReceived = false;
+
+    // No Python API until Py_END_ALLOW_THREADS
+    Py_BEGIN_ALLOW_THREADS
+
+    for( size_t i = 0; i < lNRetries && !lReceived; i++ )
+    {
+        if( IsClosing( self ) )
+        {
+            lLastException = "The sensor was disconnected.";
+            break;
+        }
+
+        try
+        {
+            ScopedDataMask sdm( self, LeddarDevice::LdSensor::DM_ECHOES );
+
+            if( LockedGetData( self ) )
+            {
+                std::lock_guard<std::mutex> lock( self->mDataThreadSharedData.mMutex );
+                FillFrameBuffer( self->mSensor, *lBuffer, lInfo );
+                lReceived = true;
+            }
+            else
+            {
+                LeddarUtils::LtTimeUtils::Wait( lMsBetweenRetries );
+            }
+        }
+        catch( const std::exception &e )
+        {
+            DebugTrace( e.what() );
+            lLastException = e.what();
+        }
+    }
+
+    Py_END_ALLOW_THREADS
+
+    if( !lReceived )
+    {
+        ReleaseFrameBuffer( lBuffer );
+        PyErr_SetString( PyExc_RuntimeError, lLastException.c_str() );
+        return nullptr;
+    }
+
+    return NewFrame( lBuffer, lInfo );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarPyEchoesNotifier *GetNotifier( sLeddarDevice *self )
+///
+/// \brief  Get the NEW_DATA notifier of the echoes, created on first use.
+///
+/// \param [in,out] self    The class instance.
+///
+/// \return The notifier, nullptr with a Python exception set if it fails.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static LeddarPyEchoesNotifier *GetNotifier( sLeddarDevice *self )
+{
+    if( self->mNotifier == nullptr )
+    {
+        try
+        {
+            self->mNotifier = new LeddarPyEchoesNotifier( self->mSensor->GetResultEchoes() );
+
+            std::lock_guard<std::mutex> lock( self->mConsumedMutex );
+            self->mConsumedSequence = 0;
+            self->mConsumedTimestamp = 0;
+        }
+        catch( const std::exception &e )
+        {
+            PyErr_SetString( PyExc_RuntimeError, e.what() );
+            return nullptr;
+        }
+    }
+
+    return self->mNotifier;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn static bool WaitNextFrame( sLeddarDevice *self, const std::function<unsigned long long( void )> &aCopy,
+///     std::chrono::steady_clock::time_point aDeadline, std::string &aError )
+///
+/// \brief  Wait for echoes not returned yet and copy them. Called without the GIL.
+///         When the data thread runs, waits for its NEW_DATA signal. Otherwise requests the data, the wait
+///         between two requests is cut short by the signal. The state of the data thread is checked on
+///         each loop, so the wait switches to requests when the thread is stopped.
+///         The wait ends when Disconnect is called (see IsClosing).
+///
+/// \param [in,out] self            The class instance, GetNotifier was called, a ScopedSensorUser is registered.
+/// \param          aCopy           Copies the B_GET echoes, returns the frame timestamp.
+/// \param          aDeadline       Wait limit.
+/// \param [out]    aError          Last exception message.
+///
+/// \return False on timeout.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static bool WaitNextFrame( sLeddarDevice *self, const std::function<unsigned long long( void )> &aCopy,
+                           std::chrono::steady_clock::time_point aDeadline, std::string &aError )
+{
+    const auto lRetryDelay = std::chrono::milliseconds( 1 );
+    const auto lStopCheckDelay = std::chrono::milliseconds( 50 );
+    LeddarPyEchoesNotifier *lNotifier = self->mNotifier;
+
+    while( true )
+    {
+        if( IsClosing( self ) )
+        {
+            aError = "The sensor was disconnected.";
+            return false;
+        }
+
+        uint64_t lSequence = lNotifier->GetSequence();
+
+        {
+            std::lock_guard<std::mutex> lock( self->mConsumedMutex );
+
+            if( lSequence > self->mConsumedSequence )
+            {
+                unsigned long long lTimestamp = aCopy();
+                self->mConsumedSequence = lSequence;
+
+                // The frame signaled after lSequence may have been copied already
+                if( lTimestamp == 0 || lTimestamp != self->mConsumedTimestamp )
+                {
+                    self->mConsumedTimestamp = lTimestamp;
+                    return true;
+                }
+
+                continue;
+            }
+        }
+
+        bool lThreadRunning;
+
+        {
+            std::lock_guard<std::mutex> lock( self->mDataThreadSharedData.mMutex );
+            lThreadRunning = !self->mDataThreadSharedData.mStop;
+        }
+
+        if( lThreadRunning )
+        {
+            auto lNow = std::chrono::steady_clock::now();
+
+            if( lNow >= aDeadline )
+                return false;
+
+            lNotifier->WaitNewer( lSequence, std::min( aDeadline, lNow + lStopCheckDelay ) );
+            continue;
+        }
+
+        try
+        {
+            ScopedDataMask sdm( self, LeddarDevice::LdSensor::DM_ECHOES );
+
+            if( LockedGetData( self ) )
+                continue;
+        }
+        catch( const std::exception &e )
+        {
+            DebugTrace( e.what() );
+            aError = e.what();
+        }
+
+        auto lNow = std::chrono::steady_clock::now();
+
+        if( lNow >= aDeadline )
+            return false;
+
+        lNotifier->WaitNewer( lSequence, std::min( aDeadline, lNow + lRetryDelay ) );
+    }
+}
+
+static std::chrono::steady_clock::time_point DeadlineFromSeconds( double aTimeout )
+{
+    return std::chrono::steady_clock::now() + std::chrono::microseconds( static_cast<int64_t>( std::max( aTimeout, 0.0 ) * 1e6 ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *WaitForEchoes( sLeddarDevice *self, PyObject *args )
+///
+/// \brief  Wait for the next echoes (see WaitNextFrame), without polling sleep from Python.
+///
+/// \param [in,out] self    If non-null, the class instance that this method operates on.
+/// \param [in,out] args    If non-null, the arguments.
+///                 double: (optional) timeout in seconds
+///
+/// \return A leddar.Frame, None on timeout
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *WaitForEchoes( sLeddarDevice *self, PyObject *args )
+{
+    ScopedSensorUser lUser( self );
+
+    if( !lUser.Check() )
+        return nullptr;
+
+    double lTimeout = 1.0;
+
+    if( !PyArg_ParseTuple( args, "|d", &lTimeout ) )
+        return nullptr;
+
+    if( GetNotifier( self ) == nullptr )
+        return nullptr;
+
+    size_t lCapacity = GetFrameCapacity( self->mSensor );
+    std::vector<LeddarPyEcho> *lBuffer = AcquireFrameBuffer();
+    lBuffer->resize( lCapacity );
+    sLeddarFrameInfo lInfo;
+    std::string lError;
+    bool lReceived = false;
+
+    Py_BEGIN_ALLOW_THREADS
+    auto lCopy = [&]()
+    {
+        CopyFrame( self->mSensor, lBuffer->data(), lCapacity, lInfo );
+        return lInfo.mTimestamp;
+    };
+    lReceived = WaitNextFrame( self, lCopy, DeadlineFromSeconds( lTimeout ), lError );
+    self->mNotifier->ClearEvent();
+    Py_END_ALLOW_THREADS
+
+    if( !lReceived )
+    {
+        ReleaseFrameBuffer( lBuffer );
+
+        if( IsClosing( self ) )
+            return RaiseDisconnected();
+
+        Py_RETURN_NONE;
+    }
+
+    lBuffer->resize( static_cast<size_t>( lInfo.mCount ) );
+    return NewFrame( lBuffer, lInfo );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *GetEchoesBatch( sLeddarDevice *self, PyObject *args )
+///
+/// \brief  Wait for the next N frames and copy them in a single preallocated array.
+///         The GIL is taken once to allocate the arrays and once to build the result.
+///
+/// \param [in,out] self    If non-null, the class instance that this method operates on.
+/// \param [in,out] args    If non-null, the arguments.
+///                 int/size_t: number of frames
+///                 double: (optional) timeout in seconds for the batch
+///
+/// \return A dict with the keys data, frame_offsets and timestamps
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *GetEchoesBatch( sLeddarDevice *self, PyObject *args )
+{
+    ScopedSensorUser lUser( self );
+
+    if( !lUser.Check() )
+        return nullptr;
+
+    Py_ssize_t lFrameCount = 0;
+    double lTimeout = 1.0;
+
+    if( !PyArg_ParseTuple( args, "n|d", &lFrameCount, &lTimeout ) )
+        return nullptr;
+
+    if( lFrameCount <= 0 )
+    {
+        PyErr_SetString( PyExc_ValueError, "The number of frames must be positive." );
+        return nullptr;
+    }
+
+    if( GetNotifier( self ) == nullptr )
+        return nullptr;
+
+    size_t lCapacity = GetFrameCapacity( self->mSensor );
+    npy_intp lDims[1] = { static_cast<npy_intp>( lCapacity * lFrameCount ) };
+    PyObject *op = Py_BuildValue( "[(s, s), (s, s), (s, s), (s, s), (s, s), (s, s), (s, s), (s, s)]"
+                                  , "indices", "u4"
+                                  , "distances", "f4"
+                                  , "amplitudes", "f4"
+                                  , "timestamps", "u8"
+                                  , "flags", "u2"
+                                  , "x", "f4"
+                                  , "y", "f4"
+                                  , "z", "f4" );
+    PyArray_Descr *descr;
+
+    if( !PyArray_DescrConverter( op, &descr ) )
+    {
+        Py_DECREF( op );
+        return nullptr;
+    }
+
+    Py_DECREF( op );
+    PyObject *lEchoesArray = PyArray_SimpleNewFromDescr( 1, lDims, descr );
+
+    if( lEchoesArray == nullptr )
+        return nullptr;
+
+    LeddarPyEcho *lEchoes = static_cast<LeddarPyEcho *>( PyArray_DATA( ( PyArrayObject * )lEchoesArray ) );
+    std::vector<int64_t> lOffsets( 1, 0 );
+    std::vector<uint64_t> lTimestamps;
+    lOffsets.reserve( lFrameCount + 1 );
+    lTimestamps.reserve( lFrameCount );
+    std::string lError;
+
+    Py_BEGIN_ALLOW_THREADS
+    auto lDeadline = DeadlineFromSeconds( lTimeout );
+
+    for( Py_ssize_t i = 0; i < lFrameCount; ++i )
+    {
+        sLeddarFrameInfo lInfo;
+
+        auto lCopy = [&]()
+        {
+            CopyFrame( self->mSensor, lEchoes + lOffsets.back(), lCapacity, lInfo );
+            return lInfo.mTimestamp;
+        };
+
+        if( !WaitNextFrame( self, lCopy, lDeadline, lError ) )
+            break;
+
+        lOffsets.push_back( lOffsets.back() + lInfo.mCount );
+        lTimestamps.push_back( lInfo.mTimestamp );
+    }
+
+    self->mNotifier->ClearEvent();
+    Py_END_ALLOW_THREADS
+
+    if( IsClosing( self ) )
+    {
+        Py_DECREF( lEchoesArray );
+        return RaiseDisconnected();
+    }
+
+    // The returned data is a view of the preallocated array, no copy
+    PyObject *lData = PySequence_GetSlice( lEchoesArray, 0, static_cast<Py_ssize_t>( lOffsets.back() ) );
+    Py_DECREF( lEchoesArray );
+
+    if( lData == nullptr )
+        return nullptr;
+
+    npy_intp lOffsetsDims[1] = { static_cast<npy_intp>( lOffsets.size() ) };
+    npy_intp lTimestampsDims[1] = { static_cast<npy_intp>( lTimestamps.size() ) };
+    PyObject *lOffsetsArray = PyArray_SimpleNew( 1, lOffsetsDims, NPY_INT64 );
+    PyObject *lTimestampsArray = PyArray_SimpleNew( 1, lTimestampsDims, NPY_UINT64 );
+    PyObject *lBatchDict = PyDict_New();
+
+    if( lOffsetsArray == nullptr || lTimestampsArray == nullptr || lBatchDict == nullptr )
+    {
+        Py_DECREF( lData );
+        Py_XDECREF( lOffsetsArray );
+        Py_XDECREF( lTimestampsArray );
+        Py_XDECREF( lBatchDict );
+        return nullptr;
+    }
+
+    memcpy( PyArray_DATA( ( PyArrayObject * )lOffsetsArray ), lOffsets.data(), lOffsets.size() * sizeof( int64_t ) );
+
+    if( !lTimestamps.empty() )
+        memcpy( PyArray_DATA( ( PyArrayObject * )lTimestampsArray ), lTimestamps.data(), lTimestamps.size() * sizeof( uint64_t ) );
+
+    PyDict_SetItemString( lBatchDict, "data", lData );
+    PyDict_SetItemString( lBatchDict, "frame_offsets", lOffsetsArray );
+    PyDict_SetItemString( lBatchDict, "timestamps", lTimestampsArray );
+    Py_DECREF( lData );
+    Py_DECREF( lOffsetsArray );
+    Py_DECREF( lTimestampsArray );
+
+    return lBatchDict;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *GetPointCloud( sLeddarDevice *self, PyObject *args )
+///
+/// \brief  Build the data of a sensor_msgs/PointCloud2 message from the echoes (see LdPointCloudBuilder),
+///         the GIL is released while waiting and building. There is no per point work in Python.
+///
+/// \param [in,out] self    If non-null, the class instance that this method operates on.
+/// \param [in,out] args    If non-null, the arguments.
+///                 unsigned int: (optional) fields (leddar.point_fields)
+///                 int: (optional) keep only the valid echoes
+///                 double / None: (optional) timeout in seconds to wait for the next frame (see WaitForEchoes),
+///                                None to use the last frame received
+///
+/// \return A dict with the message data and layout, None on timeout
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *GetPointCloud( sLeddarDevice *self, PyObject *args )
+{
+    ScopedSensorUser lUser( self );
+
+    if( !lUser.Check() )
+        return nullptr;
+
+    unsigned int lFields = LeddarConnection::LdPointCloudBuilder::PF_DEFAULT;
+    int lValidOnly = 1;
+    PyObject *lTimeoutObject = nullptr;
+
+    if( !PyArg_ParseTuple( args, "|IiO", &lFields, &lValidOnly, &lTimeoutObject ) )
+        return nullptr;
+
+    bool lWait = ( lTimeoutObject != Py_None );
+    double lTimeout = 1.0;
+
+    if( lTimeoutObject != nullptr && lWait )
+    {
+        lTimeout = PyFloat_AsDouble( lTimeoutObject );
+
+        if( PyErr_Occurred() )
+            return nullptr;
+    }
+
+    if( lWait && GetNotifier( self ) == nullptr )
+        return nullptr;
+
+    LeddarConnection::LdResultEchoes *lResultEchoes = self->mSensor->GetResultEchoes();
+    LeddarConnection::LdPointCloudBuilder lBuilder( lFields, lValidOnly != 0 );
+    size_t lCapacity = LeddarConnection::LdPointCloudBuilder::GetCapacity( lResultEchoes );
+    PyObject *lData = PyBytes_FromStringAndSize( nullptr, static_cast<Py_ssize_t>( lCapacity * lBuilder.GetPointStep() ) );
+
+    if( lData == nullptr )
+        return nullptr;
+
+    uint8_t *lDestination = reinterpret_cast<uint8_t *>( PyBytes_AS_STRING( lData ) );
+    std::string lError;
+    bool lReceived = true;
+
+    Py_BEGIN_ALLOW_THREADS
+
+    if( lWait )
+    {
+        auto lBuild = [&]()
+        {
+            lBuilder.Fill( lResultEchoes, lDestination, lCapacity );
+            return static_cast<unsigned long long>( lBuilder.GetTimestamp() );
+        };
+        lReceived = WaitNextFrame( self, lBuild, DeadlineFromSeconds( lTimeout ), lError );
+        self->mNotifier->ClearEvent();
+    }
+    else
+    {
+        lBuilder.Fill( lResultEchoes, lDestination, lCapacity );
+    }
+
+    Py_END_ALLOW_THREADS
+
+    if( !lReceived )
+    {
+        Py_DECREF( lData );
+
+        if( IsClosing( self ) )
+            return RaiseDisconnected();
+
+        Py_RETURN_NONE;
+    }
+
+    if( _PyBytes_Resize( &lData, static_cast<Py_ssize_t>( lBuilder.GetWidth() ) * lBuilder.GetPointStep() ) != 0 )
+        return nullptr;
+
+    const std::vector<LeddarConnection::LdPointCloudBuilder::sPointField> &lPointFields = lBuilder.GetFields();
+    PyObject *lFieldList = PyList_New( static_cast<Py_ssize_t>( lPointFields.size() ) );
+
+    for( size_t i = 0; lFieldList != nullptr && i < lPointFields.size(); ++i )
+    {
+        PyList_SET_ITEM( lFieldList, i, Py_BuildValue( "(sIII)", lPointFields[i].mName, lPointFields[i].mOffset,
+                                                       static_cast<unsigned int>( lPointFields[i].mDatatype ), lPointFields[i].mCount ) );
+    }
+
+    PyObject *lCloudDict = PyDict_New();
+
+    if( lFieldList == nullptr || lCloudDict == nullptr )
+    {
+        Py_DECREF( lData );
+        Py_XDECREF( lFieldList );
+        Py_XDECREF( lCloudDict );
+        return nullptr;
+    }
+
+    PyDict_SetItemString( lCloudDict, "data", lData );
+    PyDict_SetItemString( lCloudDict, "fields", lFieldList );
+    Py_DECREF( lData );
+    Py_DECREF( lFieldList );
+    PyObject *lValue = PyLong_FromUnsignedLong( lBuilder.GetWidth() );
+    PyDict_SetItemString( lCloudDict, "width", lValue );
+    Py_DECREF( lValue );
+    lValue = PyLong_FromUnsignedLong( lBuilder.GetPointStep() );
+    PyDict_SetItemString( lCloudDict, "point_step", lValue );
+    Py_DECREF( lValue );
+    lValue = PyLong_FromUnsignedLongLong( lBuilder.GetTimestamp() );
+    PyDict_SetItemString( lCloudDict, "timestamp", lValue );
+    Py_DECREF( lValue );
+
+    return lCloudDict;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *SetEchoFilter( sLeddarDevice *self, PyObject *args )
+///
+/// \brief  Set the echo filter of the sensor results.
+///
+/// \param [in,out] self    If non-null, the class instance that this method operates on.
+/// \param [in,out] args    (int) required flags, (int) rejected flags, (float) minimum distance, (float) maximum distance,
+///                         (float) minimum amplitude, (tuple) channels region of interest. All optional.
+///
+/// \return Null if it fails, else True.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *SetEchoFilter( sLeddarDevice *self, PyObject *args )
+{
+    if( !CheckSensor( self ) )
+        return nullptr;
+
+    unsigned short lRequired = 0, lRejected = 0;
+    float lMinDistance = -std::numeric_limits<float>::infinity(), lMaxDistance = std::numeric_limits<float>::infinity(), lMinAmplitude = 0;
+    PyObject *lRoi = Py_None;
+
+    if( !PyArg_ParseTuple( args, "|HHfffO", &lRequired, &lRejected, &lMinDistance, &lMaxDistance, &lMinAmplitude, &lRoi ) )
+        return nullptr;
+
+    unsigned short lFirstColumn = 0, lLastColumn = 0, lFirstRow = 0, lLastRow = 0;
+
+    if( lRoi != Py_None && !PyArg_ParseTuple( lRoi, "HHHH", &lFirstColumn, &lLastColumn, &lFirstRow, &lLastRow ) )
+        return nullptr;
+
+    try
+    {
+        LeddarConnection::LdEchoFilter lFilter;
+        lFilter.SetFlags( lRequired, lRejected );
+        lFilter.SetDistanceRange( lMinDistance, lMaxDistance );
+        lFilter.SetMinAmplitude( lMinAmplitude );
+
+        if( lRoi != Py_None )
+        {
+            uint16_t lHChan = self->mSensor->GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_HSEGMENT )->ValueT<uint16_t>();
+            lFilter.SetChannelRoi( lHChan, lFirstColumn, lLastColumn, lFirstRow, lLastRow );
+        }
+
+        self->mSensor->GetResultEchoes()->SetFilter( lFilter );
+    }
+    catch( std::exception &e )
+    {
+        PyErr_SetString( PyExc_ValueError, e.what() );
+        return nullptr;
+    }
+
+    Py_RETURN_TRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *SetTemporalFilter( sLeddarDevice *self, PyObject *args )
+///
+/// \brief  Set the temporal filter of the sensor results, sized from the sensor channels.
+///
+/// \param [in,out] self    If non-null, the class instance that this method operates on.
+/// \param [in,out] args    (int) mode, (float) parameters, (float) outlier gate, (int) max rejects, (int) echoes per channel. All optional.
+///
+/// \return Null if it fails, else True.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *SetTemporalFilter( sLeddarDevice *self, PyObject *args )
+{
+    if( !CheckSensor( self ) )
+        return nullptr;
+
+    int lMode                = LeddarConnection::LdTemporalFilter::TF_NONE;
+    float lParameter         = 0.5f, lMeasurementNoise = 0.05f, lGate = 0;
+    unsigned int lMaxRejects = 3, lEchoesPerChannel = 1;
+
+    if( !PyArg_ParseTuple( args, "|ifffII", &lMode, &lParameter, &lMeasurementNoise, &lGate, &lMaxRejects, &lEchoesPerChannel ) )
+        return nullptr;
+
+    try
+    {
+        LeddarConnection::LdTemporalFilter lTemporalFilter;
+
+        if( lMode != LeddarConnection::LdTemporalFilter::TF_NONE )
+        {
+            uint32_t lHChan = self->mSensor->GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_HSEGMENT )->ValueT<uint16_t>();
+            uint32_t lVChan = self->mSensor->GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_VSEGMENT )->ValueT<uint16_t>();
+            lTemporalFilter.SetChannels( lHChan * std::max( lVChan, 1u ), lEchoesPerChannel );
+            lTemporalFilter.SetOutlierGate( lGate, lMaxRejects );
+        }
+
+        if( lMode == LeddarConnection::LdTemporalFilter::TF_EMA )
+            lTemporalFilter.SetEma( lParameter );
+        else if( lMode == LeddarConnection::LdTemporalFilter::TF_MEDIAN )
+        {
+            if( lParameter != std::floor( lParameter ) )
+                throw std::invalid_argument( "Invalid median window." );
+
+            lTemporalFilter.SetMedian( static_cast<uint32_t>( lParameter ) );
+        }
+        else if( lMode == LeddarConnection::LdTemporalFilter::TF_KALMAN )
+            lTemporalFilter.SetKalman( lParameter, lMeasurementNoise );
+        else if( lMode != LeddarConnection::LdTemporalFilter::TF_NONE )
+            throw std::invalid_argument( "Invalid temporal filter mode." );
+
+        self->mSensor->GetResultEchoes()->SetTemporalFilter( lTemporalFilter );
+    }
+    catch( std::exception &e )
+    {
+        PyErr_SetString( PyExc_ValueError, e.what() );
+        return nullptr;
+    }
+
+    Py_RETURN_TRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *SetVoxelGrid( sLeddarDevice *self, PyObject *args )
+///
+/// \brief  Set the voxel grid downsampling of the sensor results.
+///
+/// \param [in,out] self    If non-null, the class instance that this method operates on.
+/// \param [in,out] args    (float or tuple) voxel size, (int) policy, (tuple) region of interest. All optional.
+///
+/// \return Null if it fails, else True.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *SetVoxelGrid( sLeddarDevice *self, PyObject *args )
+{
+    if( !CheckSensor( self ) )
+        return nullptr;
+
+    PyObject *lSize = nullptr, *lRoi = Py_None;
+    int lPolicy     = LeddarConnection::LdVoxelGrid::VP_CENTROID;
+
+    if( !PyArg_ParseTuple( args, "|OiO", &lSize, &lPolicy, &lRoi ) )
+        return nullptr;
+
+    float lSizes[3] = { 0, 0, 0 };
+
+    if( lSize != nullptr && PyTuple_Check( lSize ) )
+    {
+        if( !PyArg_ParseTuple( lSize, "fff", &lSizes[0], &lSizes[1], &lSizes[2] ) )
+            return nullptr;
+    }
+    else if( lSize != nullptr )
+    {
+        lSizes[0] = lSizes[1] = lSizes[2] = static_cast<float>( PyFloat_AsDouble( lSize ) );
+
+        if( PyErr_Occurred() )
+            return nullptr;
+    }
+
+    float lBox[6] = { 0, 0, 0, 0, 0, 0 };
+
+    if( lRoi != Py_None && !PyArg_ParseTuple( lRoi, "ffffff", &lBox[0], &lBox[1], &lBox[2], &lBox[3], &lBox[4], &lBox[5] ) )
+        return nullptr;
+
+    try
+    {
+        LeddarConnection::LdVoxelGrid lVoxelGrid;
+        lVoxelGrid.SetVoxelSize( lSizes[0], lSizes[1], lSizes[2] );
+        lVoxelGrid.SetPolicy( static_cast<LeddarConnection::LdVoxelGrid::ePolicy>( lPolicy ) );
+
+        if( lRoi != Py_None )
+            lVoxelGrid.SetRoi( lBox[0], lBox[1], lBox[2], lBox[3], lBox[4], lBox[5] );
+
+        self->mSensor->GetResultEchoes()->SetVoxelGrid( lVoxelGrid );
+    }
+    catch( std::exception &e )
+    {
+        PyErr_SetString( PyExc_ValueError, e.what() );
+        return nullptr;
+    }
+
+    Py_RETURN_TRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *SetRangeImage( sLeddarDevice *self, PyObject *args )
+///
+/// \brief  Set the dense range image of the sensor results, sized from the sensor channels.
+///
+/// \param [in,out] self    If non-null, the class instance that this method operates on.
+/// \param [in,out] args    (int) echoes per pixel, (int) channel count. All optional.
+///
+/// \return Null if it fails, else True.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *SetRangeImage( sLeddarDevice *self, PyObject *args )
+{
+    if( !CheckSensor( self ) )
+        return nullptr;
+
+    unsigned int lEchoesPerPixel = 0, lChannelCount = 0;
+
+    if( !PyArg_ParseTuple( args, "|II", &lEchoesPerPixel, &lChannelCount ) )
+        return nullptr;
+
+    try
+    {
+        uint16_t lHChan = 0, lVChan = 0;
+
+        if( lEchoesPerPixel != 0 )
+        {
+            lHChan = self->mSensor->GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_HSEGMENT )->ValueT<uint16_t>();
+            lVChan = std::max<uint16_t>( self->mSensor->GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_VSEGMENT )->ValueT<uint16_t>(), 1 );
+        }
+
+        self->mSensor->GetResultEchoes()->SetRangeImage( lHChan, lVChan, lEchoesPerPixel, lChannelCount );
+    }
+    catch( std::exception &e )
+    {
+        PyErr_SetString( PyExc_ValueError, e.what() );
+        return nullptr;
+    }
+
+    Py_RETURN_TRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *GetRangeImage( sLeddarDevice *self, PyObject *args )
+///
+/// \brief  Get the dense range image filled by the swap (see LdRangeImage). The arrays are copied from the B_GET buffer
+///         with one memcpy each, the GIL is released while waiting and copying. There is no per echo work in Python.
+///
+/// \param [in,out] self    If non-null, the class instance that this method operates on.
+/// \param [in,out] args    If non-null, the arguments.
+///                 double / None: (optional) timeout in seconds to wait for the next frame (see WaitForEchoes),
+///                                None to use the last frame received
+///
+/// \return A dict with the image arrays, None on timeout
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *GetRangeImage( sLeddarDevice *self, PyObject *args )
+{
+    ScopedSensorUser lUser( self );
+
+    if( !lUser.Check() )
+        return nullptr;
+
+    PyObject *lTimeoutObject = nullptr;
+
+    if( !PyArg_ParseTuple( args, "|O", &lTimeoutObject ) )
+        return nullptr;
+
+    bool lWait = ( lTimeoutObject != Py_None );
+    double lTimeout = 1.0;
+
+    if( lTimeoutObject != nullptr && lWait )
+    {
+        lTimeout = PyFloat_AsDouble( lTimeoutObject );
+
+        if( PyErr_Occurred() )
+            return nullptr;
+    }
+
+    LeddarConnection::LdResultEchoes *lResultEchoes = self->mSensor->GetResultEchoes();
+
+    if( !lResultEchoes->IsRangeImageEnabled() )
+    {
+        PyErr_SetString( PyExc_RuntimeError, "The range image is not enabled, see set_range_image." );
+        return nullptr;
+    }
+
+    if( lWait && GetNotifier( self ) == nullptr )
+        return nullptr;
+
+    npy_intp lDims[3];
+
+    {
+        auto lLock = lResultEchoes->GetUniqueLock( LeddarConnection::B_GET );
+        const LeddarConnection::LdRangeImage &lRangeImage = lResultEchoes->GetRangeImage( LeddarConnection::B_GET );
+        lDims[0] = lRangeImage.GetHeight();
+        lDims[1] = lRangeImage.GetWidth();
+        lDims[2] = lRangeImage.GetEchoesPerPixel();
+    }
+
+    PyObject *lDistances  = PyArray_SimpleNew( 3, lDims, NPY_FLOAT32 );
+    PyObject *lAmplitudes = PyArray_SimpleNew( 3, lDims, NPY_FLOAT32 );
+    PyObject *lCounts     = PyArray_SimpleNew( 2, lDims, NPY_UBYTE );
+
+    if( lDistances == nullptr || lAmplitudes == nullptr || lCounts == nullptr )
+    {
+        Py_XDECREF( lDistances );
+        Py_XDECREF( lAmplitudes );
+        Py_XDECREF( lCounts );
+        return nullptr;
+    }
+
+    float *lDistanceData   = static_cast<float *>( PyArray_DATA( reinterpret_cast<PyArrayObject *>( lDistances ) ) );
+    float *lAmplitudeData  = static_cast<float *>( PyArray_DATA( reinterpret_cast<PyArrayObject *>( lAmplitudes ) ) );
+    uint8_t *lCountData    = static_cast<uint8_t *>( PyArray_DATA( reinterpret_cast<PyArrayObject *>( lCounts ) ) );
+    const size_t lPixels   = static_cast<size_t>( lDims[0] ) * lDims[1];
+    const size_t lSlots    = lPixels * lDims[2];
+    unsigned long long lTimestamp = 0;
+    bool lResized  = false;
+    bool lReceived = true;
+    std::string lError;
+
+    Py_BEGIN_ALLOW_THREADS
+    auto lCopy = [&]()
+    {
+        auto lLock = lResultEchoes->GetUniqueLock( LeddarConnection::B_GET );
+        const LeddarConnection::LdRangeImage &lRangeImage = lResultEchoes->GetRangeImage( LeddarConnection::B_GET );
+        const LeddarConnection::LdFrameMetadata &lMetadata = lResultEchoes->GetFrameMetadata( LeddarConnection::B_GET );
+        lTimestamp = ( lMetadata.mFields & LeddarConnection::LdFrameMetadata::MF_TIMESTAMP64 ) != 0 ? lMetadata.mTimestamp64
+                                                                                                    : lResultEchoes->GetTimestamp( LeddarConnection::B_GET );
+        // Changed by set_range_image since the arrays were allocated
+        lResized = lRangeImage.GetCounts().size() != lPixels || lRangeImage.GetDistances().size() != lSlots;
+
+        if( !lResized )
+        {
+            memcpy( lDistanceData, lRangeImage.GetDistances().data(), lSlots * sizeof( float ) );
+            memcpy( lAmplitudeData, lRangeImage.GetAmplitudes().data(), lSlots * sizeof( float ) );
+            memcpy( lCountData, lRangeImage.GetCounts().data(), lPixels );
+        }
+
+        return lTimestamp;
+    };
+
+    if( lWait )
+    {
+        lReceived = WaitNextFrame( self, lCopy, DeadlineFromSeconds( lTimeout ), lError );
+        self->mNotifier->ClearEvent();
+    }
+    else
+    {
+        lCopy();
+    }
+
+    Py_END_ALLOW_THREADS
+
+    if( !lReceived || lResized )
+    {
+        Py_DECREF( lDistances );
+        Py_DECREF( lAmplitudes );
+        Py_DECREF( lCounts );
+
+        if( lResized )
+        {
+            PyErr_SetString( PyExc_RuntimeError, "The range image size changed." );
+            return nullptr;
+        }
+
+        if( IsClosing( self ) )
+            return RaiseDisconnected();
+
+        Py_RETURN_NONE;
+    }
+
+    PyObject *lImageDict = PyDict_New();
+
+    if( lImageDict == nullptr )
+    {
+        Py_DECREF( lDistances );
+        Py_DECREF( lAmplitudes );
+        Py_DECREF( lCounts );
+        return nullptr;
+    }
+
+    PyDict_SetItemString( lImageDict, "distance", lDistances );
+    Py_DECREF( lDistances );
+    PyDict_SetItemString( lImageDict, "amplitude", lAmplitudes );
+    Py_DECREF( lAmplitudes );
+    PyDict_SetItemString( lImageDict, "count", lCounts );
+    Py_DECREF( lCounts );
+    PyObject *lValue = PyLong_FromUnsignedLongLong( lTimestamp );
+    PyDict_SetItemString( lImageDict, "timestamp", lValue );
+    Py_DECREF( lValue );
+
+    return lImageDict;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *GetFileNo( sLeddarDevice *self, PyObject *args )
+///
+/// \brief  File descriptor signaled on new echoes (eventfd), so the device can be used with select and asyncio.
+///
+/// \param [in,out] self    If non-null, the class instance that this method operates on.
+/// \param [in,out] args    No argument.
+///
+/// \return The file descriptor, nullptr (NotImplementedError) if the platform does not provide it.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *GetFileNo( sLeddarDevice *self, PyObject *args )
+{
+    if( !CheckSensor( self ) )
+        return nullptr;
+
+    LeddarPyEchoesNotifier *lNotifier = GetNotifier( self );
+
+    if( lNotifier == nullptr )
+        return nullptr;
+
+    if( lNotifier->GetFileNo() < 0 )
+    {
+        PyErr_SetString( PyExc_NotImplementedError, "No file descriptor for the echoes on this platform." );
+        return nullptr;
+    }
+
+    return PyLong_FromLong( lNotifier->GetFileNo() );
+}
+
+bool DataThreadIsStopped( sSharedDataBase &shared )
+{
+    std::lock_guard<std::mutex> lock( shared.mMutex );
+
+    if( !shared.mStop )
+    {
+        PyErr_SetString( PyExc_RuntimeError, "Operation refused, DataThread is running." );
+    }
+
     return shared.mStop;
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1778,6 +3204,11 @@ PyObject *SetCallBackException( sLeddarDevice *self, PyObject *args )
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void DataThread( sLeddarDevice *self )
 {
+    if( !LeddarUtils::LtSystemUtils::ApplyAcquisitionThreadPolicy() )
+    {
+        DebugTrace( "Acquisition thread policy could not be fully applied" );
+    }
+
     CallBackManger lCallBackManager( self );
 
     auto lLastPing = std::chrono::system_clock::now();
@@ -1875,7 +3306,11 @@ void DataThread( sLeddarDevice *self )
             }
 
 
-            LeddarUtils::LtTimeUtils::WaitBlockingMicro( lDelay );
+            // Only wait when the sensor had nothing new, the next frame is requested without delay
+            if( !lNewData )
+            {
+                LeddarUtils::LtTimeUtils::WaitBlockingMicro( lDelay );
+            }
 
             if( LeddarDevice::LdSensorLeddarAuto *lAutoSensor = dynamic_cast<LeddarDevice::LdSensorLeddarAuto *>( self->mSensor ) )
             {
@@ -1931,7 +3366,9 @@ void DataThread( sLeddarDevice *self )
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 PyObject *StartDataThread( sLeddarDevice *self, PyObject *args )
 {
-    if( !CheckSensor( self ) )
+    ScopedSensorUser lUser( self );
+
+    if( !lUser.Check() )
         return nullptr;
 
     Py_BEGIN_ALLOW_THREADS;
@@ -1943,6 +3380,7 @@ PyObject *StartDataThread( sLeddarDevice *self, PyObject *args )
         {
             self->mDataThreadSharedData.mStop = false;
             DebugTrace( "Starting DataThread" );
+            self->mSensor->PrepareAcquisition();
             self->mDataThreadSharedData.mThread = std::thread( DataThread, self );
         }
         else
@@ -2068,3 +3506,90 @@ PyObject *StartStopRecording( sLeddarDevice *self, PyObject *args )
     self->mRecorder->StartRecording( lPath );
     Py_RETURN_TRUE;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *GetPipelineStats( sLeddarDevice *self, PyObject *args )
+///
+/// \brief  Gets the data path latency histograms and counters of the sensor
+///
+/// \param [in,out] self    The class instance that this method operates on.
+/// \param [in,out] args    (bool)(optional) Return the json dump instead of a dict.
+///
+/// \return Null if it fails, else a dict (or a json string).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *GetPipelineStats( sLeddarDevice *self, PyObject *args )
+{
+    if( !CheckSensor( self ) )
+        return nullptr;
+
+    int lJson = false;
+
+    if( !PyArg_ParseTuple( args, "|i", &lJson ) )
+        return nullptr;
+
+    const LeddarCore::LdPipelineStats &lStats = self->mSensor->GetPipelineStats();
+
+    if( lJson )
+        return PyUnicode_FromString( lStats.ToJson().c_str() );
+
+    PyObject *lResult   = PyDict_New();
+    PyObject *lCounters = PyDict_New();
+    PyObject *lStages   = PyDict_New();
+
+    if( !lResult || !lCounters || !lStages )
+    {
+        Py_XDECREF( lResult );
+        Py_XDECREF( lCounters );
+        Py_XDECREF( lStages );
+        return nullptr;
+    }
+
+    for( int i = 0; i < LeddarCore::LdPipelineStats::COUNTER_COUNT; ++i )
+    {
+        auto lCounter = static_cast<LeddarCore::LdPipelineStats::eCounter>( i );
+        PyObject *lValue = PyLong_FromUnsignedLongLong( lStats.GetCounter( lCounter ) );
+        PyDict_SetItemString( lCounters, LeddarCore::LdPipelineStats::GetCounterName( lCounter ), lValue );
+        Py_XDECREF( lValue );
+    }
+
+    for( int i = 0; i < LeddarCore::LdPipelineStats::STAGE_COUNT; ++i )
+    {
+        auto lStage                                  = static_cast<LeddarCore::LdPipelineStats::eStage>( i );
+        const LeddarCore::LdLatencyHistogram &lHisto = lStats.GetHistogram( lStage );
+        PyObject *lStageDict                        = Py_BuildValue( "{s:K,s:d,s:K,s:K,s:K,s:K}", "count", lHisto.GetCount(), "mean_ns", lHisto.GetMean(), "p50_ns",
+                                                   lHisto.GetPercentile( 50 ), "p99_ns", lHisto.GetPercentile( 99 ), "p999_ns", lHisto.GetPercentile( 99.9 ), "max_ns",
+                                                   lHisto.GetMax() );
+        PyDict_SetItemString( lStages, LeddarCore::LdPipelineStats::GetStageName( lStage ), lStageDict );
+        Py_XDECREF( lStageDict );
+    }
+
+    PyDict_SetItemString( lResult, "enabled", LeddarCore::LdPipelineStats::IsEnabled() ? Py_True : Py_False );
+    PyDict_SetItemString( lResult, "counters", lCounters );
+    PyDict_SetItemString( lResult, "stages", lStages );
+    Py_DECREF( lCounters );
+    Py_DECREF( lStages );
+    return lResult;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *ResetPipelineStats( sLeddarDevice *self, PyObject *args )
+///
+/// \brief  Clear the data path latency histograms and counters of the sensor
+///
+/// \param [in,out] self    The class instance that this method operates on.
+/// \param [in,out] args    No argument.
+///
+/// \return Null if it fails, else True.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *ResetPipelineStats( sLeddarDevice *self, PyObject *args )
+{
+    if( !CheckSensor( self ) )
+        return nullptr;
+
+    self->mSensor->ResetPipelineStats();
+    Py_RETURN_TRUE;
+}
@@ -20,6 +20,7 @@
 #include <stdint.h>
 #include <thread>
 #include <mutex>
+#include <condition_variable>
 
 //Forward declaration
 namespace LeddarDevice
@@ -31,6 +32,7 @@ namespace LeddarConnection
 {
     class LdResultEchoes;
     class LdResultStates;
+    struct LdStatesRecord;
 }
 
 namespace LeddarRecord
@@ -38,6 +40,8 @@ namespace LeddarRecord
     class LdRecorder;
 }
 
+class LeddarPyEchoesNotifier;
+
 struct sSharedDataBase
 {
     std::mutex mMutex;
@@ -50,7 +54,7 @@ struct sSharedData : public sSharedDataBase
     PyObject *mCallBackState = nullptr;
     PyObject *mCallBackEcho = nullptr;
     PyObject *mCallBackException = nullptr;
-    bool mGetDataLocked = false;                //reserved for use of DataThread()
+    bool mGetDataLocked = false;                //reserved for use of DataThread() and LockedGetData()
 };
 
 
@@ -64,6 +68,16 @@ typedef struct sLeddarDevice
     uint32_t mDataMask = 0;                 //Current Datamask requested by user
 
     sSharedData mDataThreadSharedData;  //Data shared between thread. Need to use mutex to read / write
+
+    LeddarPyEchoesNotifier *mNotifier = nullptr; //Created by the first wait_for_echoes, get_echoes_batch or fileno
+    std::mutex mConsumedMutex;                  //Guards mConsumedSequence and mConsumedTimestamp, the waits run without the GIL
+    uint64_t mConsumedSequence = 0;             //Last notifier sequence returned by wait_for_echoes / get_echoes_batch
+    unsigned long long mConsumedTimestamp = 0;  //Timestamp of that frame
+
+    std::mutex mUsersMutex;                     //Guards mUsers and mClosing
+    std::condition_variable mUsersCondition;    //Signaled when mUsers drops to 0
+    int mUsers = 0;                             //Calls using mSensor and mNotifier without the GIL (ScopedSensorUser)
+    bool mClosing = false;                      //Disconnect waits for mUsers, no new user is accepted
 } sLeddarDevice;
 
 
@@ -76,6 +90,9 @@ PyObject *Connect( sLeddarDevice *self, PyObject *args );
 PyObject *Disconnect( sLeddarDevice *self, PyObject *args );
 
 PyObject *GetPropertiesSnapshot( sLeddarDevice *self );
+PyObject *GetPropertiesBinarySnapshot( sLeddarDevice *self, PyObject *args );
+PyObject *DiffPropertiesSnapshot( sLeddarDevice *self, PyObject *args );
+PyObject *RestorePropertiesSnapshot( sLeddarDevice *self, PyObject *args );
 PyObject *GetPropertyValue( sLeddarDevice *self, PyObject *args );
 PyObject *GetPropertyCount( sLeddarDevice *self, PyObject *args );
 PyObject *GetPropertyAvailableValues( sLeddarDevice *self, PyObject *args );
@@ -87,7 +104,18 @@ PyObject *GetIPConfig( sLeddarDevice *self, PyObject *args );
 PyObject *GetDataMask( sLeddarDevice *self, PyObject *args );
 PyObject *SetDataMask( sLeddarDevice *self, PyObject *args );
 PyObject *GetStates( sLeddarDevice *self, PyObject *args );
+PyObject *GetStatesRecord( sLeddarDevice *self, PyObject *args );
 PyObject *GetEchoes( sLeddarDevice *self, PyObject *args );
+PyObject *GetFrame( sLeddarDevice *self, PyObject *args );
+PyObject *WaitForEchoes( sLeddarDevice *self, PyObject *args );
+PyObject *GetEchoesBatch( sLeddarDevice *self, PyObject *args );
+PyObject *GetPointCloud( sLeddarDevice *self, PyObject *args );
+PyObject *SetEchoFilter( sLeddarDevice *self, PyObject *args );
+PyObject *SetTemporalFilter( sLeddarDevice *self, PyObject *args );
+PyObject *SetVoxelGrid( sLeddarDevice *self, PyObject *args );
+PyObject *SetRangeImage( sLeddarDevice *self, PyObject *args );
+PyObject *GetRangeImage( sLeddarDevice *self, PyObject *args );
+PyObject *GetFileNo( sLeddarDevice *self, PyObject *args );
 PyObject *GetCalibValues( sLeddarDevice *self, PyObject *args );
 
 PyObject *SetCallBackState( sLeddarDevice *self, PyObject *args );
@@ -99,6 +127,9 @@ PyObject *SetDataThreadDelay( sLeddarDevice *self, PyObject *args );
 
 PyObject *PackageEchoes( LeddarDevice::LdSensor *aResultEchoes );
 PyObject *PackageStates( LeddarConnection::LdResultStates *aResultStatess );
+PyObject *PackageStatesRecord( const LeddarConnection::LdStatesRecord &aRecord );
 PyObject *StartStopRecording( sLeddarDevice *self, PyObject *args );
+PyObject *GetPipelineStats( sLeddarDevice *self, PyObject *args );
+PyObject *ResetPipelineStats( sLeddarDevice *self, PyObject *args );
 
 PyTypeObject *InitDeviceType();
@@ -0,0 +1,519 @@
+// *****************************************************************************
+// Module..: LeddarPy
+//
+/// \file    LeddarPyFrame.cpp
+///
+/// \brief   Implementations of the Frame object used in LeddarPy module
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LeddarPyFrame.h"
+#include "structmember.h"
+
+#include "LdIntegerProperty.h"
+#include "LdPropertyIds.h"
+#include "LdResultEchoes.h"
+#include "LdSensor.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+//The buffer slots can be set from a type spec since python 3.9
+#if PY_VERSION_HEX >= 0x03090000
+#define HAVE_FRAME_HEAP_TYPE
+#endif
+
+namespace
+{
+    const size_t MAX_POOLED_BUFFERS = 8;
+
+    // Same fields as the "data" array of get_echoes(), no alignment
+    const char *FRAME_FORMAT = "T{=I:indices:=f:distances:=f:amplitudes:=Q:timestamps:=H:flags:=f:x:=f:y:=f:z:}";
+
+    std::mutex gPoolMutex;
+    std::vector<std::vector<LeddarPyEcho> *> gPool;
+
+    LeddarPyEcho gEmptyFrame;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn std::vector<LeddarPyEcho> *AcquireFrameBuffer( void )
+///
+/// \brief  Get a frame buffer from the pool, or a new one if the pool is empty
+///
+/// \return The buffer, to give to NewFrame or ReleaseFrameBuffer.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::vector<LeddarPyEcho> *AcquireFrameBuffer( void )
+{
+    {
+        std::lock_guard<std::mutex> lock( gPoolMutex );
+
+        if( !gPool.empty() )
+        {
+            std::vector<LeddarPyEcho> *lBuffer = gPool.back();
+            gPool.pop_back();
+            return lBuffer;
+        }
+    }
+
+    return new std::vector<LeddarPyEcho>();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void ReleaseFrameBuffer( std::vector<LeddarPyEcho> *aBuffer )
+///
+/// \brief  Give a frame buffer back to the pool. Its capacity is kept for the next frames.
+///
+/// \param [in] aBuffer The buffer, from AcquireFrameBuffer.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ReleaseFrameBuffer( std::vector<LeddarPyEcho> *aBuffer )
+{
+    if( aBuffer == nullptr )
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock( gPoolMutex );
+
+        if( gPool.size() < MAX_POOLED_BUFFERS )
+        {
+            gPool.push_back( aBuffer );
+            return;
+        }
+    }
+
+    delete aBuffer;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t GetFrameCapacity( LeddarDevice::LdSensor *aSensor )
+///
+/// \brief  Maximum number of echoes of a frame
+///
+/// \param [in] aSensor Pointer to the sensor.
+///
+/// \return The maximum number of echoes.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t GetFrameCapacity( LeddarDevice::LdSensor *aSensor )
+{
+    LeddarConnection::LdResultEchoes *lResultEchoes = aSensor->GetResultEchoes();
+    auto lLock = lResultEchoes->GetUniqueLock( LeddarConnection::B_GET );
+    return lResultEchoes->GetEchoes( LeddarConnection::B_GET )->size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t CopyFrame( LeddarDevice::LdSensor *aSensor, LeddarPyEcho *aDestination, size_t aCapacity, sLeddarFrameInfo &aInfo )
+///
+/// \brief  Copy the last echoes of the sensor. Does not use the Python API, so it is called without the GIL.
+///         The scales are applied in a single pass over the echoes.
+///
+/// \param [in]     aSensor         Pointer to the sensor.
+/// \param [out]    aDestination    The echoes destination.
+/// \param          aCapacity       Size of aDestination, the echoes that do not fit are dropped.
+/// \param [out]    aInfo           The frame information.
+///
+/// \return The number of echoes copied.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t CopyFrame( LeddarDevice::LdSensor *aSensor, LeddarPyEcho *aDestination, size_t aCapacity, sLeddarFrameInfo &aInfo )
+{
+    LeddarConnection::LdResultEchoes *lResultEchoes = aSensor->GetResultEchoes();
+
+    aInfo.mDistanceScale  = lResultEchoes->GetDistanceScale();
+    aInfo.mAmplitudeScale = lResultEchoes->GetAmplitudeScale();
+    aInfo.mVFov           = lResultEchoes->GetVFOV();
+    aInfo.mHFov           = lResultEchoes->GetHFOV();
+    aInfo.mV              = lResultEchoes->GetVChan();
+    aInfo.mH              = lResultEchoes->GetHChan();
+
+    // Typed metadata is used when the sensor provides it, properties otherwise (i.e. record replay)
+    auto lLock = lResultEchoes->GetUniqueLock( LeddarConnection::B_GET );
+    const LeddarCore::LdPropertiesContainer *lProperties = lResultEchoes->GetProperties();
+    const LeddarConnection::LdFrameMetadata &lMetadata = lResultEchoes->GetFrameMetadata();
+    uint64_t lTimestamp64 = 0;
+
+    if( ( lMetadata.mFields & LeddarConnection::LdFrameMetadata::MF_TIMESTAMP64 ) != 0 )
+    {
+        lTimestamp64 = lMetadata.mTimestamp64;
+    }
+    else if( auto *lTS64 = dynamic_cast<const LeddarCore::LdIntegerProperty *>( lProperties->FindProperty( LeddarCore::LdPropertyIds::ID_RS_TIMESTAMP64 ) ) )
+    {
+        lTimestamp64 = lTS64->ValueT<uint64_t>();
+    }
+
+    aInfo.mTimestamp = lTimestamp64 != 0 ? lTimestamp64 : lResultEchoes->GetTimestamp();
+    aInfo.mIncomplete = lMetadata.mIncomplete ? 1 : 0;
+
+    if( ( lMetadata.mFields & LeddarConnection::LdFrameMetadata::MF_LED_POWER ) != 0 )
+    {
+        aInfo.mLedPower = lMetadata.mLedPower;
+    }
+    else if( auto *lLedPower = dynamic_cast<const LeddarCore::LdIntegerProperty *>( lProperties->FindProperty( LeddarCore::LdPropertyIds::ID_CURRENT_LED_INTENSITY ) ) )
+    {
+        aInfo.mLedPower = static_cast<int>( lLedPower->Value() );
+    }
+
+    const std::vector<LeddarConnection::LdEcho> &lEchoes = *lResultEchoes->GetEchoes( LeddarConnection::B_GET );
+    size_t lCount = std::min<size_t>( lResultEchoes->GetEchoCount( LeddarConnection::B_GET ), aCapacity );
+    const float lDistanceFactor  = 1.0f / aInfo.mDistanceScale;
+    const float lAmplitudeFactor = 1.0f / aInfo.mAmplitudeScale;
+
+    aInfo.mCount = static_cast<Py_ssize_t>( lCount );
+
+    for( size_t i = 0; i < lCount; ++i )
+    {
+        const LeddarConnection::LdEcho &lEcho = lEchoes[i];
+        LeddarPyEcho &lPyEcho = aDestination[i];
+
+        lPyEcho.index     = lEcho.mChannelIndex;
+        lPyEcho.distance  = static_cast<float>( lEcho.mDistance ) * lDistanceFactor;
+        lPyEcho.amplitude = static_cast<float>( lEcho.mAmplitude ) * lAmplitudeFactor;
+        lPyEcho.timestamp = lEcho.mTimestamp;
+        lPyEcho.flag      = lEcho.mFlag;
+        lPyEcho.x         = lEcho.mX;
+        lPyEcho.y         = lEcho.mY;
+        lPyEcho.z         = lEcho.mZ;
+    }
+
+    return lCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void FillFrameBuffer( LeddarDevice::LdSensor *aSensor, std::vector<LeddarPyEcho> &aBuffer, sLeddarFrameInfo &aInfo )
+///
+/// \brief  Copy the last echoes of the sensor in a frame buffer (see CopyFrame).
+///
+/// \param [in]     aSensor Pointer to the sensor.
+/// \param [out]    aBuffer The frame buffer.
+/// \param [out]    aInfo   The frame information.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void FillFrameBuffer( LeddarDevice::LdSensor *aSensor, std::vector<LeddarPyEcho> &aBuffer, sLeddarFrameInfo &aInfo )
+{
+    aBuffer.resize( GetFrameCapacity( aSensor ) );
+    aBuffer.resize( CopyFrame( aSensor, aBuffer.data(), aBuffer.size(), aInfo ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarPyEchoesNotifier::LeddarPyEchoesNotifier( LeddarConnection::LdResultEchoes *aEchoes )
+///
+/// \brief  Constructor, connects to the NEW_DATA signal of the echoes
+///
+/// \param [in] aEchoes The echoes of the sensor, must outlive the notifier.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarPyEchoesNotifier::LeddarPyEchoesNotifier( LeddarConnection::LdResultEchoes *aEchoes ) :
+    mEchoes( aEchoes ),
+    mSequence( 0 ),
+    mWoken( false ),
+    mEventFd( -1 )
+{
+#ifdef __linux__
+    mEventFd = eventfd( 0, EFD_NONBLOCK | EFD_CLOEXEC );
+#endif
+    mEchoes->ConnectSignal( this, LeddarCore::LdObject::NEW_DATA );
+}
+
+LeddarPyEchoesNotifier::~LeddarPyEchoesNotifier()
+{
+    mEchoes->DisconnectSignal( this, LeddarCore::LdObject::NEW_DATA );
+#ifdef __linux__
+    if( mEventFd >= 0 )
+        close( mEventFd );
+#endif
+}
+
+uint64_t LeddarPyEchoesNotifier::GetSequence( void )
+{
+    std::lock_guard<std::mutex> lock( mMutex );
+    return mSequence;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarPyEchoesNotifier::WaitNewer( uint64_t aSequence, std::chrono::steady_clock::time_point aDeadline )
+///
+/// \brief  Wait until a frame newer than aSequence is signaled, or Wake is called
+///
+/// \param  aSequence   Last sequence seen (GetSequence).
+/// \param  aDeadline   Wait limit.
+///
+/// \return False on timeout.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarPyEchoesNotifier::WaitNewer( uint64_t aSequence, std::chrono::steady_clock::time_point aDeadline )
+{
+    std::unique_lock<std::mutex> lock( mMutex );
+    return mCondition.wait_until( lock, aDeadline, [&]() { return mSequence > aSequence || mWoken; } );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarPyEchoesNotifier::Wake( void )
+///
+/// \brief  Wake the waits before the notifier is deleted: WaitNewer returns at once from now on,
+///         and the eventfd becomes readable.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarPyEchoesNotifier::Wake( void )
+{
+    {
+        std::lock_guard<std::mutex> lock( mMutex );
+        mWoken = true;
+    }
+
+    mCondition.notify_all();
+
+#ifdef __linux__
+    if( mEventFd >= 0 )
+        eventfd_write( mEventFd, 1 );
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarPyEchoesNotifier::ClearEvent( void )
+///
+/// \brief  Reset the eventfd, it becomes readable again on the next frame
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarPyEchoesNotifier::ClearEvent( void )
+{
+#ifdef __linux__
+    eventfd_t lValue;
+
+    if( mEventFd >= 0 )
+        eventfd_read( mEventFd, &lValue );
+#endif
+}
+
+void LeddarPyEchoesNotifier::Callback( LdObject *aSender, const SIGNALS aSignal, void * )
+{
+    if( aSender != mEchoes || aSignal != LeddarCore::LdObject::NEW_DATA )
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock( mMutex );
+        ++mSequence;
+    }
+
+    mCondition.notify_all();
+
+#ifdef __linux__
+    if( mEventFd >= 0 )
+        eventfd_write( mEventFd, 1 );
+#endif
+}
+
+static void Frame_dealloc( sLeddarFrame *self )
+{
+    PyTypeObject *lType = Py_TYPE( self );
+
+    ReleaseFrameBuffer( self->mEchoes );
+    lType->tp_free( ( PyObject * )self );
+#ifdef HAVE_FRAME_HEAP_TYPE
+    Py_DECREF( lType ); //Instances of heap types own a reference to their type
+#endif
+}
+
+static Py_ssize_t Frame_length( sLeddarFrame *self )
+{
+    return self->mInfo.mCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn static int Frame_getbuffer( sLeddarFrame *self, Py_buffer *aView, int aFlags )
+///
+/// \brief  Buffer protocol: read only, one dimension of LeddarPyEcho (FRAME_FORMAT)
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static int Frame_getbuffer( sLeddarFrame *self, Py_buffer *aView, int aFlags )
+{
+    if( ( aFlags & PyBUF_WRITABLE ) == PyBUF_WRITABLE )
+    {
+        PyErr_SetString( PyExc_BufferError, "Frame is read only." );
+        aView->obj = nullptr;
+        return -1;
+    }
+
+    aView->buf        = self->mInfo.mCount != 0 ? self->mEchoes->data() : &gEmptyFrame;
+    aView->obj        = ( PyObject * )self;
+    aView->len        = self->mInfo.mCount * static_cast<Py_ssize_t>( sizeof( LeddarPyEcho ) );
+    aView->readonly   = 1;
+    aView->itemsize   = sizeof( LeddarPyEcho );
+    aView->format     = ( aFlags & PyBUF_FORMAT ) == PyBUF_FORMAT ? const_cast<char *>( FRAME_FORMAT ) : nullptr;
+    aView->ndim       = 1;
+    aView->shape      = ( aFlags & PyBUF_ND ) == PyBUF_ND ? self->mShape : nullptr;
+    aView->strides    = ( aFlags & PyBUF_STRIDES ) == PyBUF_STRIDES ? self->mStrides : nullptr;
+    aView->suboffsets = nullptr;
+    aView->internal   = nullptr;
+    Py_INCREF( self );
+    return 0;
+}
+
+static PyMemberDef Frame_members[] =
+{
+    { ( char * )"timestamp", T_ULONGLONG, offsetof( sLeddarFrame, mInfo ) + offsetof( sLeddarFrameInfo, mTimestamp ), READONLY, ( char * )"64-bit timestamp if available, else the 32-bit base timestamp" },
+    { ( char * )"distance_scale", T_UINT, offsetof( sLeddarFrame, mInfo ) + offsetof( sLeddarFrameInfo, mDistanceScale ), READONLY, ( char * )"the scale that was applied to distances" },
+    { ( char * )"amplitude_scale", T_UINT, offsetof( sLeddarFrame, mInfo ) + offsetof( sLeddarFrameInfo, mAmplitudeScale ), READONLY, ( char * )"the scale that was applied to amplitudes" },
+    { ( char * )"led_power", T_INT, offsetof( sLeddarFrame, mInfo ) + offsetof( sLeddarFrameInfo, mLedPower ), READONLY, ( char * )"the led power used, -1 if not available" },
+    { ( char * )"v_fov", T_DOUBLE, offsetof( sLeddarFrame, mInfo ) + offsetof( sLeddarFrameInfo, mVFov ), READONLY, ( char * )"the vertical field of view" },
+    { ( char * )"h_fov", T_DOUBLE, offsetof( sLeddarFrame, mInfo ) + offsetof( sLeddarFrameInfo, mHFov ), READONLY, ( char * )"the horizontal field of view" },
+    { ( char * )"v", T_UINT, offsetof( sLeddarFrame, mInfo ) + offsetof( sLeddarFrameInfo, mV ), READONLY, ( char * )"the vertical resolution" },
+    { ( char * )"h", T_UINT, offsetof( sLeddarFrame, mInfo ) + offsetof( sLeddarFrameInfo, mH ), READONLY, ( char * )"the horizontal resolution" },
+    { ( char * )"incomplete", T_BOOL, offsetof( sLeddarFrame, mInfo ) + offsetof( sLeddarFrameInfo, mIncomplete ), READONLY, ( char * )"True if some echoes of the frame were not received" },
+    { nullptr, 0, 0, 0, nullptr }  //Sentinel
+};
+
+#define LEDDAR_FRAME_DOC "Echoes of one frame, exposed through the buffer protocol.\n" \
+    "numpy.asarray(frame) gives a structured ndarray (no copy) with the fields of get_echoes()['data'].\n" \
+    "Attributes: timestamp, distance_scale, amplitude_scale, led_power, v_fov, h_fov, v, h, incomplete"
+
+//Object type definition for python
+#define LEDDAR_FRAME_TYPE_NAME "leddar.Frame"
+#ifdef HAVE_FRAME_HEAP_TYPE
+static PyType_Slot Frame_slots[] =
+{
+    {Py_tp_dealloc,     (void *)Frame_dealloc},
+    {Py_tp_members,     (void *)Frame_members},
+    {Py_tp_doc,         (void *)LEDDAR_FRAME_DOC},
+    {Py_sq_length,      (void *)Frame_length},
+    {Py_bf_getbuffer,   (void *)Frame_getbuffer},
+    {0, NULL},  //Sentinel
+};
+
+static PyType_Spec LeddarFrameTypeSpec =
+{
+    LEDDAR_FRAME_TYPE_NAME,                     //name
+    sizeof( sLeddarFrame ),                     //basicsize
+    0,                                          //itemsize
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HEAPTYPE,   //flags
+    Frame_slots,                                //slots
+};
+
+static PyTypeObject *LeddarFrameType = nullptr;
+#else  //Use static type
+static PySequenceMethods Frame_sequence =
+{
+    ( lenfunc )Frame_length,        //sq_length
+    0,                              //sq_concat
+    0,                              //sq_repeat
+    0,                              //sq_item
+    0,                              //was_sq_slice
+    0,                              //sq_ass_item
+    0,                              //was_sq_ass_slice
+    0,                              //sq_contains
+    0,                              //sq_inplace_concat
+    0,                              //sq_inplace_repeat
+};
+
+static PyBufferProcs Frame_buffer =
+{
+    ( getbufferproc )Frame_getbuffer,   //bf_getbuffer
+    0,                                  //bf_releasebuffer
+};
+
+static PyTypeObject LeddarFrameTypeObject =
+{
+    PyVarObject_HEAD_INIT( NULL, 0 )
+    LEDDAR_FRAME_TYPE_NAME,         //tp_name
+    sizeof( sLeddarFrame ),         //tp_basicsize
+    0,                              //tp_itemsize
+    ( destructor )Frame_dealloc,    //tp_dealloc
+    0,                              //tp_print
+    0,                              //tp_getattr
+    0,                              //tp_setattr
+    0,                              //tp_as_async
+    0,                              //tp_repr
+    0,                              //tp_as_number
+    &Frame_sequence,                //tp_as_sequence
+    0,                              //tp_as_mapping
+    0,                              //tp_hash
+    0,                              //tp_call
+    0,                              //tp_str
+    0,                              //tp_getattro
+    0,                              //tp_setattro
+    &Frame_buffer,                  //tp_as_buffer
+    Py_TPFLAGS_DEFAULT,             //tp_flags
+    LEDDAR_FRAME_DOC,               //tp_doc
+    0,                              //tp_traverse
+    0,                              //tp_clear
+    0,                              //tp_richcompare
+    0,                              //tp_weaklistoffset
+    0,                              //tp_iter
+    0,                              //tp_iternext
+    0,                              //tp_methods
+    Frame_members,                  //tp_members
+    0,                              //tp_getset
+    0,                              //tp_base
+    0,                              //tp_dict
+    0,                              //tp_descr_get
+    0,                              //tp_descr_set
+    0,                              //tp_dictoffset
+    0,                              //tp_init
+    0,                              //tp_alloc
+    0,                              //tp_new
+};
+
+static PyTypeObject *LeddarFrameType = &LeddarFrameTypeObject;
+#endif
+
+PyTypeObject *InitFrameType()
+{
+#ifdef HAVE_FRAME_HEAP_TYPE
+    LeddarFrameType = ( PyTypeObject * )PyType_FromSpec( &LeddarFrameTypeSpec );
+    return LeddarFrameType;
+#else  //Use static type
+    if( PyType_Ready( LeddarFrameType ) < 0 ) //Initialize the type
+        return nullptr;
+    else
+        return LeddarFrameType;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *NewFrame( std::vector<LeddarPyEcho> *aBuffer, const sLeddarFrameInfo &aInfo )
+///
+/// \brief  Create a frame object, it takes the ownership of the buffer
+///
+/// \param [in] aBuffer The frame buffer, from AcquireFrameBuffer.
+/// \param      aInfo   The frame information.
+///
+/// \return The frame, nullptr on error (the buffer is released).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *NewFrame( std::vector<LeddarPyEcho> *aBuffer, const sLeddarFrameInfo &aInfo )
+{
+    sLeddarFrame *lFrame = PyObject_New( sLeddarFrame, LeddarFrameType );
+
+    if( lFrame == nullptr )
+    {
+        ReleaseFrameBuffer( aBuffer );
+        return nullptr;
+    }
+
+    lFrame->mInfo = aInfo;
+    lFrame->mEchoes = aBuffer;
+    lFrame->mShape[0] = aInfo.mCount;
+    lFrame->mStrides[0] = sizeof( LeddarPyEcho );
+    return ( PyObject * )lFrame;
+}
@@ -0,0 +1,113 @@
+// *****************************************************************************
+// Module..: LeddarPy
+//
+/// \file    LeddarPyFrame.h
+///
+/// \brief   Definitions of the Frame object used in LeddarPy module.
+///          A frame exposes the echoes through the buffer protocol (numpy.asarray(frame) does not copy),
+///          its storage comes from a pool and goes back to it when the last reference is released.
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#pragma once
+
+#include <Python.h>
+
+#include "LdObject.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdint.h>
+#include <vector>
+
+namespace LeddarDevice
+{
+    class LdSensor;
+}
+
+namespace LeddarConnection
+{
+    class LdResultEchoes;
+}
+
+#pragma pack(push,1)
+struct LeddarPyEcho
+{
+    uint32_t index;
+    float distance;
+    float amplitude;
+    uint64_t timestamp;
+    uint16_t flag;
+    float x;
+    float y;
+    float z;
+};
+#pragma pack(pop)
+
+struct sLeddarFrameInfo
+{
+    unsigned long long mTimestamp = 0;  // 64 bits timestamp if the sensor provides it, else the 32 bits timestamp
+    unsigned int mDistanceScale = 1;
+    unsigned int mAmplitudeScale = 1;
+    int mLedPower = -1;                 // -1 if the sensor does not provide it
+    double mVFov = 0;
+    double mHFov = 0;
+    unsigned int mV = 0;
+    unsigned int mH = 0;
+    Py_ssize_t mCount = 0;
+    char mIncomplete = 0;               // Some echoes of the frame were not received
+};
+
+typedef struct sLeddarFrame
+{
+    PyObject_HEAD
+
+    sLeddarFrameInfo mInfo;
+    std::vector<LeddarPyEcho> *mEchoes; // From the frame pool
+    Py_ssize_t mShape[1];
+    Py_ssize_t mStrides[1];
+} sLeddarFrame;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  LeddarPyEchoesNotifier
+///
+/// \brief  Counts the NEW_DATA signals of the echoes, so a thread can wait for the next frame without polling.
+///         On Linux the count is also written to an eventfd, that event loops can poll (Device.fileno()).
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class LeddarPyEchoesNotifier : public LeddarCore::LdObject
+{
+public:
+    explicit LeddarPyEchoesNotifier( LeddarConnection::LdResultEchoes *aEchoes );
+    ~LeddarPyEchoesNotifier();
+
+    uint64_t GetSequence( void );
+    bool WaitNewer( uint64_t aSequence, std::chrono::steady_clock::time_point aDeadline );
+    int GetFileNo( void ) const { return mEventFd; }
+    void ClearEvent( void );
+    void Wake( void );
+
+private:
+    void Callback( LdObject *aSender, const SIGNALS aSignal, void *aExtraData ) override;
+
+    LeddarConnection::LdResultEchoes *mEchoes;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    uint64_t mSequence;
+    bool mWoken;    // Set by Wake, the waits return at once
+    int mEventFd;   // -1 if not available
+};
+
+std::vector<LeddarPyEcho> *AcquireFrameBuffer( void );
+void ReleaseFrameBuffer( std::vector<LeddarPyEcho> *aBuffer );
+size_t GetFrameCapacity( LeddarDevice::LdSensor *aSensor );
+size_t CopyFrame( LeddarDevice::LdSensor *aSensor, LeddarPyEcho *aDestination, size_t aCapacity, sLeddarFrameInfo &aInfo );
+void FillFrameBuffer( LeddarDevice::LdSensor *aSensor, std::vector<LeddarPyEcho> &aBuffer, sLeddarFrameInfo &aInfo );
+
+PyObject *NewFrame( std::vector<LeddarPyEcho> *aBuffer, const sLeddarFrameInfo &aInfo );
+PyTypeObject *InitFrameType();
@@ -70,7 +70,7 @@ module1 = Extension(
     include_dirs=include_dirs,
     libraries=libraries,
     library_dirs=library_dirs,
-    sources=["./LeddarPy.cpp", "./LeddarPyDevice.cpp", "./Connecters.cpp"],
+    sources=["./LeddarPy.cpp", "./LeddarPyDevice.cpp", "./LeddarPyFrame.cpp", "./Connecters.cpp"],
     extra_compile_args=extra_compile_args + debug,
 )
 
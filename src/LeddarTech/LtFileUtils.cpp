@@ -18,6 +18,16 @@
 
 #include <fstream>
 #include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 /// *****************************************************************************
 /// Function: ReadFileToBuffer
@@ -35,39 +45,8 @@
 std::vector<uint8_t>
 LeddarUtils::LtFileUtils::ReadFileToBuffer( const std::string &aFilename )
 {
-    std::ifstream lFile;
-    lFile.exceptions( std::ios_base::failbit );
-
-    try
-    {
-        lFile.open( aFilename.c_str(), std::ios::binary | std::ios::ate );
-    }
-    catch( ... )
-    {
-        throw LeddarException::LtException( "File " + aFilename + " not found." );
-    }
-
-    if( lFile.is_open() )
-    {
-        std::streamsize lSize = lFile.tellg();
-
-        if( lSize < 0 )
-        {
-            throw LeddarException::LtException( "Unable to read file " + aFilename );
-        }
-
-        lFile.seekg( 0, std::ios::beg );
-        std::vector<uint8_t> lResultBuffer( static_cast<uint32_t>( lSize ) );
-
-        if( !lFile.read( ( char * )&lResultBuffer[ 0 ], lSize ) )
-        {
-            throw LeddarException::LtException( "Unable to read file " + aFilename );
-        }
-
-        return lResultBuffer;
-    }
-
-    return std::vector<uint8_t>();
+    LtFileView lView( aFilename );
+    return std::vector<uint8_t>( lView.Data(), lView.Data() + lView.Size() );
 }
 
 /// *****************************************************************************
@@ -111,11 +90,12 @@ LeddarUtils::LtFileUtils::FileExtension( const std::string &aFilename )
 IntelHEX::IntelHexMem *
 LeddarUtils::LtFileUtils::LoadHex( const std::string &aFilename )
 {
-    // Open intel hex file
+    // Open intel hex file, parsed from the file view
     IntelHEX::IntelHexMem *lMem = new IntelHEX::IntelHexMem;
 
     if( IHEX_Load( aFilename.c_str(), *lMem ) < 0 )
     {
+        delete lMem;
         throw std::ios_base::failure( "File " + aFilename + " not found." );
     }
 
@@ -154,44 +134,149 @@ LeddarUtils::LtFileUtils::LoadHexFromBuffer( const uint8_t *aBuffer, uint32_t aS
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// \fn LeddarUtils::LtFileUtils::LtLtbReader::LtLtbReader( const std::string& aFileName )
+/// \fn LeddarUtils::LtFileUtils::LtFileView::LtFileView( const std::string &aFilename )
 ///
-/// \brief  Constructor. Open the file and check that it has the right signature
+/// \brief  Constructor. Map the whole file, read-only.
 ///
-/// \param  aFileName   Filename of the file.
+/// \exception  LeddarException::LtException   Raised when the file cannot be opened or mapped.
 ///
-/// \author David Levy
-/// \date   July 2019
+/// \param  aFilename   Filename of the file.
+///
+/// \date   October 2026
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-LeddarUtils::LtFileUtils::LtLtbReader::LtLtbReader( const std::string &aFileName ) :
-    mFile(),
-    mDeviceType( 0 )
+LeddarUtils::LtFileUtils::LtFileView::LtFileView( const std::string &aFilename ) :
+    mData( nullptr ),
+    mSize( 0 )
+#ifdef _WIN32
+    , mFile( INVALID_HANDLE_VALUE ),
+    mMapping( nullptr )
+#endif
 {
-    std::string lExtension = LeddarUtils::LtStringUtils::ToLower( LeddarUtils::LtFileUtils::FileExtension( aFileName ) );
+#ifdef _WIN32
+    mFile = CreateFileA( aFilename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
 
-    if( lExtension != "ltb" )
+    if( mFile == INVALID_HANDLE_VALUE )
     {
-        throw std::logic_error( "Firmware upgrade file must be a LeddarTech Binary file (ltb)" );
+        throw LeddarException::LtException( "File " + aFilename + " not found." );
+    }
+
+    LARGE_INTEGER lSize;
+
+    if( !GetFileSizeEx( mFile, &lSize ) )
+    {
+        CloseHandle( mFile );
+        throw LeddarException::LtException( "Unable to read file " + aFilename );
+    }
+
+    mSize = static_cast<size_t>( lSize.QuadPart );
+
+    if( mSize != 0 )
+    {
+        mMapping = CreateFileMappingA( mFile, nullptr, PAGE_READONLY, 0, 0, nullptr );
+        mData    = ( mMapping != nullptr ? static_cast<const uint8_t *>( MapViewOfFile( mMapping, FILE_MAP_READ, 0, 0, 0 ) ) : nullptr );
+
+        if( mData == nullptr )
+        {
+            if( mMapping != nullptr )
+            {
+                CloseHandle( mMapping );
+            }
+
+            CloseHandle( mFile );
+            throw LeddarException::LtException( "Unable to read file " + aFilename );
+        }
+    }
+
+#else
+    int lFile = open( aFilename.c_str(), O_RDONLY );
+
+    if( lFile < 0 )
+    {
+        throw LeddarException::LtException( "File " + aFilename + " not found." );
+    }
+
+    struct stat lStat;
+
+    if( fstat( lFile, &lStat ) != 0 )
+    {
+        close( lFile );
+        throw LeddarException::LtException( "Unable to read file " + aFilename );
+    }
+
+    mSize = static_cast<size_t>( lStat.st_size );
+
+    if( mSize != 0 )
+    {
+        void *lData = mmap( nullptr, mSize, PROT_READ, MAP_PRIVATE, lFile, 0 );
+
+        if( lData == MAP_FAILED )
+        {
+            close( lFile );
+            throw LeddarException::LtException( "Unable to read file " + aFilename + " - Error code: " + LeddarUtils::LtStringUtils::IntToString( errno ) );
+        }
+
+        mData = static_cast<const uint8_t *>( lData );
     }
 
-    mFile.exceptions( mFile.failbit );
-    mFile.open( aFileName.c_str(), std::ios_base::in | std::ios_base::binary );
+    // The mapping stays valid once the file is closed
+    close( lFile );
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarUtils::LtFileUtils::LtFileView::~LtFileView()
+///
+/// \brief  Destructor. Unmap the file.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarUtils::LtFileUtils::LtFileView::~LtFileView()
+{
+#ifdef _WIN32
+
+    if( mData != nullptr )
+    {
+        UnmapViewOfFile( mData );
+        CloseHandle( mMapping );
+    }
+
+    CloseHandle( mFile );
+#else
 
-    if( !mFile.is_open() )
+    if( mData != nullptr )
     {
-        throw std::logic_error( "Could not open file - Error code: " + LeddarUtils::LtStringUtils::IntToString( errno ) );
+        munmap( const_cast<uint8_t *>( mData ), mSize );
     }
 
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarUtils::LtFileUtils::LtLtbReader::LtLtbReader( const std::string& aFileName )
+///
+/// \brief  Constructor. Open the file and check that it has the right signature.
+///         Only the headers are read, the firmwares stay in the file view until requested.
+///
+/// \param  aFileName   Filename of the file.
+///
+/// \author David Levy
+/// \date   July 2019
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarUtils::LtFileUtils::LtLtbReader::LtLtbReader( const std::string &aFileName ) :
+    mFile( ( CheckLtbExtension( aFileName ), aFileName ) ),
+    mOffset( 0 ),
+    mDeviceType( 0 )
+{
     //File headers
     uint32_t lValue;
-    mFile.read( reinterpret_cast<char *>( &lValue ), sizeof( lValue ) );
+    Read( &lValue, sizeof( lValue ) );
 
     if( lValue != LTB_SIGNATURE )
     {
         throw std::logic_error( "Wrong signature file." );
     }
 
-    mFile.read( reinterpret_cast<char *>( &lValue ), sizeof( lValue ) );
+    Read( &lValue, sizeof( lValue ) );
 
     if( lValue != LT_DOCUMENT_VERSION && lValue != LT_DOCUMENT_VERSION_SDK && lValue != LT_DOCUMENT_VERSION_SDK_POST_DOUBLE_BUFFER_REWORK )
     {
@@ -200,7 +285,7 @@ LeddarUtils::LtFileUtils::LtLtbReader::LtLtbReader( const std::string &aFileName
 
     //First section
     LtElementHeader lHeader;
-    mFile.read( reinterpret_cast<char *>( &lHeader ), sizeof( lHeader ) );
+    Read( &lHeader, sizeof( lHeader ) );
 
     // The header just read must be that of a section.
     if( ( ( lHeader.mFlags & LTDF_SECTION ) == 0 ) || ( lHeader.mCount != 1 ) )
@@ -215,21 +300,22 @@ LeddarUtils::LtFileUtils::LtLtbReader::LtLtbReader( const std::string &aFileName
 
     int64_t lSizeToRead = lHeader.mUnitSize;
 
-    lSizeToRead -= Read( reinterpret_cast<char *>( &lHeader ), sizeof( lHeader ) );
+    lSizeToRead -= Read( &lHeader, sizeof( lHeader ) );
 
     if( lHeader.mId != ID_LTB_DEVICE_TYPE || sizeof( mDeviceType ) != lHeader.mUnitSize )
     {
         throw std::logic_error( "File does not contain firmware data." );
     }
 
-    lSizeToRead -= Read( reinterpret_cast<char *>( &mDeviceType ), sizeof( mDeviceType ) );
+    lSizeToRead -= Read( &mDeviceType, sizeof( mDeviceType ) );
 
-    //Loop through all the firmware data
+    //Index all the firmware data
     while( lSizeToRead > 0 )
     {
-        lSizeToRead -= Read( reinterpret_cast<char *>( &lHeader ), sizeof( lHeader ) );
-        mFirmwares.push_back( std::make_pair( lHeader.mId, std::vector<uint8_t>( lHeader.mCount ) ) );
-        lSizeToRead -= Read( reinterpret_cast<char *>( mFirmwares.back().second.data() ), lHeader.mCount );
+        lSizeToRead -= Read( &lHeader, sizeof( lHeader ) );
+        sSection lSection = { lHeader.mId, Skip( lHeader.mCount ), lHeader.mCount };
+        mSections.push_back( lSection );
+        lSizeToRead -= lHeader.mCount;
     }
 }
 
@@ -243,5 +329,140 @@ LeddarUtils::LtFileUtils::LtLtbReader::LtLtbReader( const std::string &aFileName
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 LeddarUtils::LtFileUtils::LtLtbReader::~LtLtbReader()
 {
-    //mFile.close();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarUtils::LtFileUtils::LtLtbReader::CheckLtbExtension( const std::string &aFileName )
+///
+/// \brief  Check that the file is a ltb file, before it is opened.
+///
+/// \exception  std::logic_error    Raised when the extension is not ltb.
+///
+/// \param  aFileName   Filename of the file.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarUtils::LtFileUtils::LtLtbReader::CheckLtbExtension( const std::string &aFileName )
+{
+    std::string lExtension = LeddarUtils::LtStringUtils::ToLower( LeddarUtils::LtFileUtils::FileExtension( aFileName ) );
+
+    if( lExtension != "ltb" )
+    {
+        throw std::logic_error( "Firmware upgrade file must be a LeddarTech Binary file (ltb)" );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LeddarUtils::LtFileUtils::LtLtbReader::Read( void *aBuffer, size_t aSizeToRead )
+///
+/// \brief  Copy the next bytes of the file.
+///
+/// \exception  std::logic_error    Raised when the file is too short.
+///
+/// \param [out]    aBuffer     Destination.
+/// \param          aSizeToRead Number of bytes.
+///
+/// \returns    aSizeToRead.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t LeddarUtils::LtFileUtils::LtLtbReader::Read( void *aBuffer, size_t aSizeToRead )
+{
+    memcpy( aBuffer, Skip( aSizeToRead ), aSizeToRead );
+    return aSizeToRead;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn const uint8_t *LeddarUtils::LtFileUtils::LtLtbReader::Skip( size_t aSizeToSkip )
+///
+/// \brief  Move the read position after the next bytes of the file, without reading them.
+///
+/// \exception  std::logic_error    Raised when the file is too short.
+///
+/// \param  aSizeToSkip Number of bytes.
+///
+/// \returns    Pointer to the skipped bytes in the file view.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const uint8_t *LeddarUtils::LtFileUtils::LtLtbReader::Skip( size_t aSizeToSkip )
+{
+    if( mFile.Size() - mOffset < aSizeToSkip )
+    {
+        throw std::logic_error( "Truncated ltb file." );
+    }
+
+    const uint8_t *lData = mFile.Data() + mOffset;
+    mOffset += aSizeToSkip;
+    return lData;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn const LeddarUtils::LtFileUtils::LtLtbReader::sSection *LeddarUtils::LtFileUtils::LtLtbReader::FindSection( uint32_t aId ) const
+///
+/// \brief  Find a firmware of the file.
+///
+/// \param  aId Identifier of the firmware (eLTB).
+///
+/// \returns    nullptr if the file does not have this firmware.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const LeddarUtils::LtFileUtils::LtLtbReader::sSection *LeddarUtils::LtFileUtils::LtLtbReader::FindSection( uint32_t aId ) const
+{
+    for( size_t i = 0; i < mSections.size(); ++i )
+    {
+        if( mSections[i].mId == aId )
+        {
+            return &mSections[i];
+        }
+    }
+
+    return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn std::vector<uint8_t> LeddarUtils::LtFileUtils::LtLtbReader::GetFirmware( uint32_t aId ) const
+///
+/// \brief  Copy of a firmware, only the pages of this firmware are read from the file.
+///
+/// \exception  std::logic_error    Raised when the file does not have this firmware.
+///
+/// \param  aId Identifier of the firmware (eLTB).
+///
+/// \returns    The firmware.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::vector<uint8_t> LeddarUtils::LtFileUtils::LtLtbReader::GetFirmware( uint32_t aId ) const
+{
+    const sSection *lSection = FindSection( aId );
+
+    if( lSection == nullptr )
+    {
+        throw std::logic_error( "Missing firmware in ltb file, id: " + LeddarUtils::LtStringUtils::IntToString( aId, 16 ) );
+    }
+
+    return std::vector<uint8_t>( lSection->mData, lSection->mData + lSection->mSize );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn std::list< std::pair <uint32_t, std::vector<uint8_t> > > LeddarUtils::LtFileUtils::LtLtbReader::GetFirmwares( void ) const
+///
+/// \brief  Copy of all the firmwares, in file order.
+///
+/// \returns    Pairs of firmware identifier (eLTB) and data.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::list< std::pair <uint32_t, std::vector<uint8_t> > > LeddarUtils::LtFileUtils::LtLtbReader::GetFirmwares( void ) const
+{
+    std::list< std::pair <uint32_t, std::vector<uint8_t> > > lFirmwares;
+
+    for( size_t i = 0; i < mSections.size(); ++i )
+    {
+        lFirmwares.push_back( std::make_pair( mSections[i].mId, std::vector<uint8_t>( mSections[i].mData, mSections[i].mData + mSections[i].mSize ) ) );
+    }
+
+    return lFirmwares;
 }
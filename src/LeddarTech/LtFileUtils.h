@@ -32,6 +32,36 @@ namespace LeddarUtils
         IntelHEX::IntelHexMem *LoadHex( const std::string &aFilename );
         IntelHEX::IntelHexMem *LoadHexFromBuffer( const uint8_t *aBuffer, uint32_t aSize );
 
+        ////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \class  LtFileView.
+        ///
+        /// \brief  Read-only view of a whole file, memory mapped so only the pages that are read are loaded.
+        ///         The data is valid for the life of the view.
+        ///
+        /// \date   October 2026
+        ////////////////////////////////////////////////////////////////////////////////////////////////////
+        class LtFileView
+        {
+        public:
+            explicit LtFileView( const std::string &aFilename );
+            ~LtFileView();
+
+            const uint8_t *Data( void ) const { return mData; }
+            size_t Size( void ) const { return mSize; }
+
+        private:
+            //Disable copy constructor and assignment, the view owns the mapping
+            LtFileView( const LtFileView & );
+            LtFileView &operator=( const LtFileView & );
+
+            const uint8_t *mData;   ///< Mapped data, nullptr for an empty file
+            size_t mSize;           ///< Size of the file
+#ifdef _WIN32
+            void *mFile;            ///< File handle
+            void *mMapping;         ///< File mapping handle
+#endif
+        };
+
         ////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \class  LtLtbReader.
         ///
@@ -48,8 +78,20 @@ namespace LeddarUtils
 
             uint16_t GetDeviceType() const { return mDeviceType; }
 
+            /// \brief  A firmware of the file, the data points in the file view
+            struct sSection
+            {
+                uint32_t mId;
+                const uint8_t *mData;
+                uint32_t mSize;
+            };
+
             // Access the Firmwares
-            std::list< std::pair <uint32_t, std::vector<uint8_t> > > GetFirmwares( void ) const { return mFirmwares; }
+            const std::vector<sSection> &GetSections( void ) const { return mSections; }
+            const sSection *FindSection( uint32_t aId ) const;
+            bool HasFirmware( uint32_t aId ) const { return FindSection( aId ) != nullptr; }
+            std::vector<uint8_t> GetFirmware( uint32_t aId ) const;
+            std::list< std::pair <uint32_t, std::vector<uint8_t> > > GetFirmwares( void ) const;
 
             //Enum and struct used in ltb files
             enum eLTB
@@ -79,18 +121,17 @@ namespace LeddarUtils
             };
 
         private:
-            //Disable copy constructor. ifstream shouldnt be copied anyway
+            //Disable copy constructor. The sections point in the file view
             LtLtbReader( const LtLtbReader & );
 
-            size_t Read( char *aBuffer, size_t aSizeToRead ) {
-                mFile.read( aBuffer, aSizeToRead ); //throw an exception on fail
-                return aSizeToRead;
-            }
-
+            static void CheckLtbExtension( const std::string &aFileName );
+            size_t Read( void *aBuffer, size_t aSizeToRead );
+            const uint8_t *Skip( size_t aSizeToSkip );
 
-            std::ifstream mFile;    ///< File handle
+            LtFileView mFile;       ///< File view
+            size_t mOffset;         ///< Read position in the file view
             uint16_t mDeviceType;   ///< Device type associated with the ltb
-            std::list< std::pair <uint32_t, std::vector<uint8_t> > > mFirmwares;
+            std::vector<sSection> mSections;
 
 #pragma pack(push,1)
             typedef struct LtElementHeader
@@ -1,41 +1,155 @@
 #include "LtIntelHex.h"
+#include "LtCRCUtils.h"
 #include "LtDefines.h"
+#include "LtFileUtils.h"
 
-#include <errno.h>
-#include <stdio.h>
+#include <algorithm>
 #include <fstream>
-#include <sstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
 
-#ifndef _MSC_VER
-// Fix for portable scanf_s on Linux
-#define sscanf_s sscanf
-const char *scanf_validate( const char *fmt, const char *file, long line )
+//*****************************************************************************
+//*************** Data Type Definitions ***************************************
+//*****************************************************************************
+
+namespace
 {
-    const char *p = fmt;
+    /// Value of each ASCII character as an hexadecimal digit, 0xFF if it is not one.
+    const uint8_t gHexDigits[256] =
+    {
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+    };
+
+    inline bool DecodeByte( const char *aText, uint8_t &aValue )
+    {
+        uint8_t lHigh = gHexDigits[static_cast<uint8_t>( aText[0] )];
+        uint8_t lLow  = gHexDigits[static_cast<uint8_t>( aText[1] )];
+
+        if( ( lHigh | lLow ) & 0xF0 )
+        {
+            return false;
+        }
 
-    while( 1 )
+        aValue = static_cast<uint8_t>( ( lHigh << 4 ) | lLow );
+        return true;
+    }
+
+    /// ****************************************************************************
+    /// \fn     DecodeRecord
+    ///
+    /// \brief  Decodes a record and validates its checksum in the same pass.
+    ///         The data bytes are written to aData (up to 255 bytes).
+    ///
+    /// \param[in]  aLine: Record text, not null terminated
+    /// \param[in]  aLength: Length of the text. Extra characters after the checksum are ignored.
+    /// \param[out] aHex: Record fields, the data field is not used
+    /// \param[out] aData: Data bytes
+    ///
+    /// \return     true if the record is valid.
+    ///
+    /// \since      October 2026
+    /// ****************************************************************************
+    bool DecodeRecord( const char *aLine, size_t aLength, IntelHEX::IntelHex &aHex, uint8_t *aData )
     {
-        p = strstr( p, "%s" );
+        // Minimum record length is 11 if no data is present
+        if( aLength < 11 || aLine[0] != ':' )
+        {
+            return false;
+        }
 
-        if( p == nullptr )
-            break;
+        uint8_t lHeader[4];
+
+        for( uint8_t i = 0; i < 4; ++i )
+        {
+            if( !DecodeByte( aLine + 1 + i * 2, lHeader[i] ) )
+            {
+                return false;
+            }
+        }
+
+        aHex.count = lHeader[0];
+        aHex.addr  = static_cast<uint16_t>( ( lHeader[1] << 8 ) | lHeader[2] );
+        aHex.type  = lHeader[3];
 
-        if( ( p == fmt ) || ( *( p - 1 ) != '%' ) )
+        // We accept longer lines. Extra characters can be commments.
+        if( aLength < 11 + static_cast<size_t>( aHex.count ) * 2 )
         {
-            fprintf( stderr, "Hey, you used \"%%s\" in %s: line %ld!\n", file, line );
-            return fmt;
+            return false;
         }
+
+        uint32_t lSum    = lHeader[0] + lHeader[1] + lHeader[2] + lHeader[3];
+        const char *lPos = aLine + 9;
+
+        for( uint32_t i = 0; i < aHex.count; ++i, lPos += 2 )
+        {
+            if( !DecodeByte( lPos, aData[i] ) )
+            {
+                return false;
+            }
+
+            lSum += aData[i];
+        }
+
+        if( !DecodeByte( lPos, aHex.cksum ) )
+        {
+            return false;
+        }
+
+        // Validate checksum. Sum of the 2 must be zero,
+        // because cksum is the 2-complement of the byte sum.
+        return ( ( lSum + aHex.cksum ) & 0xFF ) == 0;
     }
 
-    return fmt;
-}
+    /// \class  IntelHexMemSink
+    /// \brief  Stores the segments in an IntelHexMem. Only the 16 lower bits of the addresses are used.
+    class IntelHexMemSink : public IntelHEX::IHexSink
+    {
+    public:
+        explicit IntelHexMemSink( IntelHEX::IntelHexMem &aMem ) : mMem( aMem ), mTotal( 0 )
+        {
+            mMem.start = 0xFFFF;
+            mMem.end   = 0x0000;
+        }
 
-#endif
+        bool Write( uint32_t aAddress, const uint8_t *aData, uint32_t aSize ) override
+        {
+            for( uint32_t i = 0; i < aSize; ++i )
+            {
+                uint16_t lAddress = static_cast<uint16_t>( aAddress + i );
+                mMem.mem[lAddress] = aData[i];
+                ++mMem.cnt[lAddress];
+                mMem.start = std::min( mMem.start, lAddress );
+                mMem.end   = std::max( mMem.end, lAddress );
+            }
+
+            mTotal += aSize;
+            return true;
+        }
 
-//*****************************************************************************
-//*************** Data Type Definitions ***************************************
-//*****************************************************************************
+        uint32_t GetTotal( void ) const { return mTotal; }
 
+    private:
+        IntelHEX::IntelHexMem &mMem;
+        uint32_t mTotal;
+    };
+}
 
 
 /// ****************************************************************************
@@ -83,105 +197,8 @@ int IntelHEX::IHEX_Swap( IntelHEX::IntelHexMem &mem )
 /// ****************************************************************************
 int IntelHEX::IHEX_Parse( const char *line, IntelHex &hex )
 {
-    uint32_t sum;
-    uint32_t tmp;
-    size_t len;
-    uint32_t n = 0;
-    int err;
     memset( hex.data, 0, sizeof( hex.data ) );
-
-    if( line[ 0 ] != ':' )
-    {
-        return -1;
-    }
-
-    len = strlen( line );
-
-    // Minimum record length is 11 if no data is present
-    if( len < 11 )
-    {
-        return -1;
-    }
-
-    ++line;
-
-    err = sscanf_s( line, "%02x", &tmp );
-
-    //err = sscanf( line, "%02x", &tmp );
-    if( err == 0 || err == EOF )
-    {
-        return -1;
-    }
-
-    hex.count = tmp;
-    line += 2;
-
-    // We accept longer lines. Extra characters can be commments.
-    if( ( int )len < ( 11 + hex.count * 2 ) )
-    {
-        return -1;
-    }
-
-    err = sscanf_s( line, "%04x", &tmp );
-
-    //err = sscanf( line, "%04x", &tmp );
-    if( err == 0 || err == EOF )
-    {
-        return -1;
-    }
-
-    hex.addr = tmp;
-    line += 4;
-
-    err = sscanf_s( line, "%02x", &tmp );
-
-    //err = sscanf( line, "%02x", &tmp );
-    if( err == 0 || err == EOF )
-    {
-        return -1;
-    }
-
-    hex.type = tmp;
-    line += 2;
-
-    // Start computation of the checksum. Add all bytes together.
-    sum = hex.count + ( ( hex.addr >> 8 ) & 0xFF ) + ( hex.addr & 0xFF ) + hex.type;
-
-    while( n < hex.count )
-    {
-        err = sscanf_s( line, "%02x", &tmp );
-
-        //err = sscanf( line, "%02x", &tmp );
-        if( err == 0 || err == EOF )
-        {
-            return -1;
-        }
-
-        hex.data[ n ] = tmp;
-        line += 2;
-        sum += hex.data[ n ];
-
-        ++n;
-    }
-
-    err = sscanf_s( line, "%02x", &tmp );
-
-    //err = sscanf( line, "%02x", &tmp );
-    if( err == 0 || err == EOF )
-    {
-        return -1;
-    }
-
-    hex.cksum = tmp;
-
-    // Validate checksum. Sum of the 2 must be zero,
-    // because cksum is the 2-complement of the byte sum.
-    if( ( ( sum & 0xFF ) + hex.cksum ) & 0xFF )
-    {
-        return -1;
-    }
-
-    return 0;
+    return DecodeRecord( line, strlen( line ), hex, hex.data ) ? 0 : -1;
 }
 
 
@@ -206,11 +223,24 @@ int IntelHEX::IHEX_Parse( const char *line, IntelHex &hex )
 /// ****************************************************************************
 int IntelHEX::IHEX_Load( const char *aPath, IntelHEX::IntelHexMem &aMem )
 {
-    std::ifstream lFileStream;
-    lFileStream.exceptions( std::ios_base::failbit );
-    lFileStream.open( aPath, std::ifstream::in );
+    // Parsed in place from the file view, the text is not copied
+    std::unique_ptr<LeddarUtils::LtFileUtils::LtFileView> lView;
 
-    return IHEX_Load( lFileStream, aMem );
+    try
+    {
+        lView.reset( new LeddarUtils::LtFileUtils::LtFileView( aPath ) );
+    }
+    catch( std::exception & )
+    {
+        return -1;
+    }
+
+    if( lView->Size() > UINT32_MAX )
+    {
+        return -2;
+    }
+
+    return IHEX_LoadFromBuffer( lView->Data(), static_cast<uint32_t>( lView->Size() ), aMem );
 }
 
 /// ****************************************************************************
@@ -234,9 +264,10 @@ int IntelHEX::IHEX_Load( const char *aPath, IntelHEX::IntelHexMem &aMem )
 /// ****************************************************************************
 int IntelHEX::IHEX_LoadFromBuffer( const uint8_t *aBuffer, uint32_t aSize, IntelHEX::IntelHexMem &aMem )
 {
-    std::string lBuffer( ( const char * )aBuffer, aSize );
-    std::istringstream lStringStream( lBuffer );
-    return IHEX_Load( lStringStream, aMem );
+    IntelHexMemSink lSink( aMem );
+    int lResult = IHEX_Stream( aBuffer, aSize, lSink );
+    aMem.nByte  = static_cast<uint16_t>( lSink.GetTotal() );
+    return lResult;
 }
 
 /// ****************************************************************************
@@ -261,76 +292,161 @@ int IntelHEX::IHEX_LoadFromBuffer( const uint8_t *aBuffer, uint32_t aSize, Intel
 
 int IntelHEX::IHEX_Load( std::istream &aStream, IntelHEX::IntelHexMem &aMem )
 {
-    const int MAXLINE = 1024;
-    char line[ MAXLINE ];
+    std::string lText( ( std::istreambuf_iterator<char>( aStream ) ), std::istreambuf_iterator<char>() );
+    return IHEX_LoadFromBuffer( reinterpret_cast<const uint8_t *>( lText.data() ), static_cast<uint32_t>( lText.size() ), aMem );
+}
 
-    IntelHex hex;
-    uint32_t lineIdx = 1;     // Line index
-    uint32_t total = 0;       // Nb of data bytes loaded
-    int res = -1;
-    int a;
+/// ****************************************************************************
+/// \fn     IHEX_Stream
+///
+/// \brief  Parses an Intel HEX buffer in a single pass, without copy of the text.
+///         The hexadecimal decoding, the record checksum validation and the CRC
+///         of the data are done in the same pass. Consecutive records are
+///         merged and sent to the sink as soon as the address is not contiguous
+///         or aChunkSize bytes are available (a record crossing the limit is
+///         split, the segments never exceed aChunkSize), so the sink can transfer a segment
+///         while the rest of the file is parsed. The extended segment and linear
+///         address records are supported (32 bits addresses).
+///
+/// \param[in]   *aBuffer: Text of the file (memory mapped file, firmware data...)
+/// \param[in]   aSize: Size of the text
+/// \param[in]   aSink: Receives the segments
+/// \param[out]  *aCrc32: If not null, CRC-32 (LtCRCUtils::Crc32) of the data bytes in file order
+/// \param[in]   aChunkSize: Maximum size of the segments sent to the sink (0: one segment per record)
+///
+/// \return     Error code.
+/// \retval     0 on success, file contained an EOF record
+/// \retval     1 on success, file didn't contained an EOF record
+/// \retval     -2 on file parsing error
+/// \retval     -3 if the sink aborted
+///
+/// \since      October 2026
+/// ****************************************************************************
+int IntelHEX::IHEX_Stream( const uint8_t *aBuffer, size_t aSize, IHexSink &aSink, uint32_t *aCrc32, uint32_t aChunkSize )
+{
+    // A record holds up to 255 bytes, it is always decoded in the segment buffer
+    std::vector<uint8_t> lSegment( static_cast<size_t>( aChunkSize ) + 255 );
+    uint32_t lSegmentAddress = 0;
+    uint32_t lSegmentSize    = 0;
+    uint32_t lBaseAddress    = 0;
+    uint32_t lCrc            = CRCUTILS_CRC32_INIT_VALUE;
+    IntelHex lHex;
+
+    const char *lPos = reinterpret_cast<const char *>( aBuffer );
+    const char *lEnd = lPos + aSize;
+    int lResult      = 1;
+
+    auto lFlush = [&]() -> bool
+    {
+        if( lSegmentSize == 0 )
+        {
+            return true;
+        }
 
-    aMem.start = 0xFFFF;
-    aMem.end = 0x0000;
+        lCrc = LeddarUtils::LtCRCUtils::Crc32( lCrc, &lSegment[0], lSegmentSize );
+        bool lAccepted = aSink.Write( lSegmentAddress, &lSegment[0], lSegmentSize );
+        lSegmentSize = 0;
+        return lAccepted;
+    };
 
-    while( true )
+    while( lPos < lEnd )
     {
-        line[ 0 ] = '\0';
-        aStream.getline( line, MAXLINE );
+        const char *lLineEnd = static_cast<const char *>( memchr( lPos, '\n', lEnd - lPos ) );
+        const char *lNext    = ( lLineEnd == nullptr ) ? lEnd : lLineEnd + 1;
 
-        if( aStream.eof() )
+        if( lLineEnd == nullptr )
         {
-            res = 1;
-            goto END;
+            lLineEnd = lEnd;
         }
 
-        //strlen( line );
+        size_t lLength = lLineEnd - lPos;
 
-        if( IHEX_Parse( line, hex ) < 0 )
+        if( lLength > 0 && lPos[lLength - 1] == '\r' )
         {
-            res = -2;
-            goto END;
+            --lLength;
         }
 
-        ++lineIdx;
+        if( lLength == 0 )
+        {
+            lPos = lNext;
+            continue;
+        }
 
-        switch( hex.type )
+        // The data is decoded after the current segment (the segment is flushed when it reaches aChunkSize)
+        if( !DecodeRecord( lPos, lLength, lHex, &lSegment[lSegmentSize] ) )
         {
-            case IHEX_DATA:
-                for( a = 0; a < hex.count; ++a )
-                {
-                    aMem.mem[ hex.addr ] = hex.data[ a ];
-                    ++aMem.cnt[ hex.addr ];
+            lResult = -2;
+            break;
+        }
+
+        lPos = lNext;
 
-                    if( hex.addr < aMem.start )
-                    {
-                        aMem.start = hex.addr;
-                    }
+        if( lHex.type == IHEX_DATA )
+        {
+            uint32_t lAddress = lBaseAddress + lHex.addr;
 
-                    if( hex.addr > aMem.end )
-                    {
-                        aMem.end = hex.addr;
-                    }
+            if( lSegmentSize != 0 && lAddress != lSegmentAddress + lSegmentSize )
+            {
+                // Not contiguous: move the record to a new segment
+                uint32_t lRecordOffset = lSegmentSize;
 
-                    ++hex.addr;
-                    ++total;
+                if( !lFlush() )
+                {
+                    return -3;
                 }
 
-                break;
+                memmove( &lSegment[0], &lSegment[lRecordOffset], lHex.count );
+            }
 
-            case IHEX_EOF:
-                res = 0;
-                goto END;
-                break;
+            if( lSegmentSize == 0 )
+            {
+                lSegmentAddress = lAddress;
+            }
 
-            default:
-                break;
+            lSegmentSize += lHex.count;
+
+            while( aChunkSize != 0 && lSegmentSize >= aChunkSize )
+            {
+                // Send aChunkSize bytes, the rest of the record starts the next segment
+                uint32_t lRemaining = lSegmentSize - aChunkSize;
+                lSegmentSize        = aChunkSize;
+
+                if( !lFlush() )
+                {
+                    return -3;
+                }
+
+                memmove( &lSegment[0], &lSegment[aChunkSize], lRemaining );
+                lSegmentAddress += aChunkSize;
+                lSegmentSize = lRemaining;
+            }
+
+            if( aChunkSize == 0 && !lFlush() )
+            {
+                return -3;
+            }
+        }
+        else if( lHex.type == IHEX_EOF )
+        {
+            lResult = 0;
+            break;
         }
+        else if( ( lHex.type == IHEX_ESA || lHex.type == IHEX_ELA ) && lHex.count == 2 )
+        {
+            uint32_t lValue = ( static_cast<uint32_t>( lSegment[lSegmentSize] ) << 8 ) | lSegment[lSegmentSize + 1];
+            lBaseAddress    = ( lHex.type == IHEX_ESA ) ? ( lValue << 4 ) : ( lValue << 16 );
+        }
+    }
+
+    if( !lFlush() )
+    {
+        return -3;
     }
 
-END:
+    if( aCrc32 != nullptr )
+    {
+        *aCrc32 = lCrc;
+    }
 
-    aMem.nByte = total;
-    return res;
+    return lResult;
 }
-
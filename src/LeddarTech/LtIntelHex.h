@@ -18,6 +18,7 @@ Platform:   Win32 - Win64
 #include <stdint.h>
 #include <string.h>
 #include <istream>
+#include <stddef.h>
 
 //*****************************************************************************
 //*************** Data Type Definitions ***************************************
@@ -69,6 +70,17 @@ namespace IntelHEX
         IHEX_SLA        // Start linear address
     };
 
+    /// \class  IHexSink
+    /// \brief  Receives the contiguous memory segments decoded by IHEX_Stream.
+    class IHexSink
+    {
+    public:
+        virtual ~IHexSink() {}
+
+        /// \brief  Called for each segment, in file order. Return false to abort the parsing.
+        virtual bool Write( uint32_t aAddress, const uint8_t *aData, uint32_t aSize ) = 0;
+    };
+
 
     //*****************************************************************************
     //*************** Public Functions ********************************************
@@ -79,5 +91,6 @@ namespace IntelHEX
     int IHEX_Load( std::istream& aStream, IntelHexMem &aMem );
     int IHEX_LoadFromBuffer( const uint8_t *aBuffer, uint32_t aSize, IntelHEX::IntelHexMem &aMem );
     int IHEX_Parse(const char *line, IntelHEX::IntelHex &hex);
+    int IHEX_Stream( const uint8_t *aBuffer, size_t aSize, IHexSink &aSink, uint32_t *aCrc32 = nullptr, uint32_t aChunkSize = 4096 );
 
 }
\ No newline at end of file
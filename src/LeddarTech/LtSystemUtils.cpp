@@ -14,16 +14,23 @@
 
 #include "LtSystemUtils.h"
 
+#include "LtExceptions.h"
 #include "LtStringUtils.h"
 
+#include <cerrno>
 #include <cstdlib>
+#include <mutex>
 #include <string.h>
 
 #ifdef _WIN32
 #include <Windows.h>
 #else
 #include <dirent.h>
+#include <pthread.h>
+#include <sched.h>
 #include <string>
+#include <sys/mman.h>
+#include <unistd.h>
 #include <vector>
 #endif
 
@@ -279,4 +286,244 @@ std::string LeddarUtils::LtSystemUtils::ErrnoToString( int aErrno )
 #endif // _WIN32
 
     return LeddarUtils::LtStringUtils::IntToString( aErrno ) + lError;
-}
\ No newline at end of file
+}
+
+namespace
+{
+    std::mutex gAcquisitionPolicyMutex;
+    LeddarUtils::LtSystemUtils::LtThreadPolicy gAcquisitionPolicy;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarUtils::LtSystemUtils::SetCurrentThreadAffinity( int32_t aCpu )
+///
+/// \brief  Pin the calling thread to a CPU
+///
+/// \param  aCpu    The CPU index, -1 to allow all CPUs.
+///
+/// \exception  LeddarException::LtException   Thrown if the CPU does not exist or the affinity cannot be set.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarUtils::LtSystemUtils::SetCurrentThreadAffinity( int32_t aCpu )
+{
+#ifdef _WIN32
+    SYSTEM_INFO lSystemInfo;
+    GetSystemInfo( &lSystemInfo );
+
+    if( aCpu >= static_cast<int32_t>( lSystemInfo.dwNumberOfProcessors ) || aCpu >= static_cast<int32_t>( sizeof( DWORD_PTR ) * 8 ) )
+    {
+        throw LeddarException::LtException( "Invalid CPU index for the thread affinity: " + LeddarUtils::LtStringUtils::IntToString( aCpu ) );
+    }
+
+    DWORD_PTR lMask = ( aCpu < 0 ? static_cast<DWORD_PTR>( -1 ) : ( static_cast<DWORD_PTR>( 1 ) << aCpu ) );
+
+    if( SetThreadAffinityMask( GetCurrentThread(), lMask ) == 0 )
+    {
+        throw LeddarException::LtException( "Unable to set thread affinity: " + ErrnoToString( GetLastError() ) );
+    }
+
+#else
+    long lCpuCount = sysconf( _SC_NPROCESSORS_CONF );
+
+    if( aCpu >= CPU_SETSIZE || ( lCpuCount > 0 && aCpu >= lCpuCount ) )
+    {
+        throw LeddarException::LtException( "Invalid CPU index for the thread affinity: " + LeddarUtils::LtStringUtils::IntToString( aCpu ) );
+    }
+
+    cpu_set_t lCpuSet;
+    CPU_ZERO( &lCpuSet );
+
+    if( aCpu < 0 )
+    {
+        for( long i = 0; i < lCpuCount && i < CPU_SETSIZE; ++i )
+        {
+            CPU_SET( i, &lCpuSet );
+        }
+    }
+    else
+    {
+        CPU_SET( aCpu, &lCpuSet );
+    }
+
+    int lResult = pthread_setaffinity_np( pthread_self(), sizeof( lCpuSet ), &lCpuSet );
+
+    if( lResult != 0 )
+    {
+        throw LeddarException::LtException( "Unable to set thread affinity: " + ErrnoToString( lResult ) );
+    }
+
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarUtils::LtSystemUtils::SetCurrentThreadRealTimePriority( int32_t aPriority )
+///
+/// \brief  Set the calling thread in the SCHED_FIFO real-time class (time critical priority on Windows).
+///         Usually requires CAP_SYS_NICE or a rtprio limit on Linux.
+///
+/// \param  aPriority   The priority (1-99), 0 to go back to the default scheduler.
+///
+/// \exception  LeddarException::LtException   Thrown if the priority cannot be set.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarUtils::LtSystemUtils::SetCurrentThreadRealTimePriority( int32_t aPriority )
+{
+#ifdef _WIN32
+
+    if( !SetThreadPriority( GetCurrentThread(), aPriority > 0 ? THREAD_PRIORITY_TIME_CRITICAL : THREAD_PRIORITY_NORMAL ) )
+    {
+        throw LeddarException::LtException( "Unable to set thread priority: " + ErrnoToString( GetLastError() ) );
+    }
+
+#else
+    sched_param lParam = {};
+    lParam.sched_priority = ( aPriority > 0 ? aPriority : 0 );
+
+    int lResult = pthread_setschedparam( pthread_self(), aPriority > 0 ? SCHED_FIFO : SCHED_OTHER, &lParam );
+
+    if( lResult != 0 )
+    {
+        throw LeddarException::LtException( "Unable to set thread priority: " + ErrnoToString( lResult ) );
+    }
+
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarUtils::LtSystemUtils::LockProcessMemory( void )
+///
+/// \brief  Lock the current and future memory pages of the process in RAM, so no page fault happens during acquisition.
+///         Not available on Windows.
+///
+/// \exception  LeddarException::LtException   Thrown if the memory cannot be locked.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarUtils::LtSystemUtils::LockProcessMemory( void )
+{
+#ifdef _WIN32
+    throw LeddarException::LtException( "Memory locking is not supported on Windows" );
+#else
+
+    if( mlockall( MCL_CURRENT | MCL_FUTURE ) != 0 )
+    {
+        throw LeddarException::LtException( "Unable to lock memory: " + ErrnoToString( errno ) );
+    }
+
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarUtils::LtSystemUtils::PrefaultMemory( void *aBuffer, size_t aSize )
+///
+/// \brief  Touch every page of a buffer so it is mapped before it is used. The content is not modified.
+///
+/// \param [in,out] aBuffer The buffer.
+/// \param          aSize   Size of the buffer in bytes.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarUtils::LtSystemUtils::PrefaultMemory( void *aBuffer, size_t aSize )
+{
+    if( aBuffer == nullptr || aSize == 0 )
+    {
+        return;
+    }
+
+#ifdef _WIN32
+    SYSTEM_INFO lInfo;
+    GetSystemInfo( &lInfo );
+    const size_t lPageSize = lInfo.dwPageSize;
+#else
+    const size_t lPageSize = static_cast<size_t>( sysconf( _SC_PAGESIZE ) );
+#endif
+
+    volatile uint8_t *lBuffer = static_cast<volatile uint8_t *>( aBuffer );
+
+    // Write access to get a private page (not the shared zero page)
+    for( size_t i = 0; i < aSize; i += lPageSize )
+    {
+        lBuffer[i] = lBuffer[i];
+    }
+
+    lBuffer[aSize - 1] = lBuffer[aSize - 1];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarUtils::LtSystemUtils::SetAcquisitionThreadPolicy( const LtThreadPolicy &aPolicy )
+///
+/// \brief  Set the policy applied by the acquisition threads when they start.
+///         Memory is locked immediately if requested.
+///
+/// \param  aPolicy The policy.
+///
+/// \exception  LeddarException::LtException   Thrown if the memory cannot be locked.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarUtils::LtSystemUtils::SetAcquisitionThreadPolicy( const LtThreadPolicy &aPolicy )
+{
+    if( aPolicy.mLockMemory )
+    {
+        LockProcessMemory();
+    }
+
+    std::lock_guard<std::mutex> lLock( gAcquisitionPolicyMutex );
+    gAcquisitionPolicy = aPolicy;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarUtils::LtSystemUtils::LtThreadPolicy LeddarUtils::LtSystemUtils::GetAcquisitionThreadPolicy( void )
+///
+/// \brief  Get the policy of the acquisition threads
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarUtils::LtSystemUtils::LtThreadPolicy LeddarUtils::LtSystemUtils::GetAcquisitionThreadPolicy( void )
+{
+    std::lock_guard<std::mutex> lLock( gAcquisitionPolicyMutex );
+    return gAcquisitionPolicy;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarUtils::LtSystemUtils::ApplyAcquisitionThreadPolicy( void )
+///
+/// \brief  Apply the acquisition policy to the calling thread. Called by the acquisition threads when they start.
+///
+/// \returns    False if a part of the policy could not be applied (missing privileges), the thread keeps running anyway.
+///
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarUtils::LtSystemUtils::ApplyAcquisitionThreadPolicy( void )
+{
+    LtThreadPolicy lPolicy = GetAcquisitionThreadPolicy();
+    bool lResult           = true;
+
+    try
+    {
+        if( lPolicy.mCpu >= 0 )
+        {
+            SetCurrentThreadAffinity( lPolicy.mCpu );
+        }
+    }
+    catch( LeddarException::LtException & )
+    {
+        lResult = false;
+    }
+
+    try
+    {
+        if( lPolicy.mPriority > 0 )
+        {
+            SetCurrentThreadRealTimePriority( lPolicy.mPriority );
+        }
+    }
+    catch( LeddarException::LtException & )
+    {
+        lResult = false;
+    }
+
+    return lResult;
+}
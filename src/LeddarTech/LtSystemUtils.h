@@ -16,6 +16,8 @@
 
 #include "LtDefines.h"
 
+#include <stddef.h>
+#include <stdint.h>
 #include <string>
 #include <vector>
 
@@ -28,5 +30,23 @@ namespace LeddarUtils
         std::vector<std::string> GetSerialPorts( void );
         bool DirectoryExists( const std::string &aPath );
         std::string ErrnoToString( int aErrno );
+
+        /// \brief  Scheduling policy of the acquisition threads (SDK data threads and LeddarPy data thread)
+        struct LtThreadPolicy
+        {
+            LtThreadPolicy( void ) : mCpu( -1 ), mPriority( 0 ), mLockMemory( false ) {}
+            int32_t mCpu;      ///< CPU the thread is pinned to, -1 to let the OS choose
+            int32_t mPriority; ///< SCHED_FIFO priority (1-99), 0 to keep the default scheduler
+            bool mLockMemory;  ///< Lock the process memory (current and future) in RAM
+        };
+
+        void SetCurrentThreadAffinity( int32_t aCpu );
+        void SetCurrentThreadRealTimePriority( int32_t aPriority );
+        void LockProcessMemory( void );
+        void PrefaultMemory( void *aBuffer, size_t aSize );
+
+        void SetAcquisitionThreadPolicy( const LtThreadPolicy &aPolicy );
+        LtThreadPolicy GetAcquisitionThreadPolicy( void );
+        bool ApplyAcquisitionThreadPolicy( void );
     }
 }
\ No newline at end of file
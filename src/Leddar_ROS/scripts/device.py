@@ -11,11 +11,10 @@ import sys
 from sensor_msgs.msg import Image
 from sensor_msgs.point_cloud2 import create_cloud
 from std_msgs.msg import Header, ColorRGBA
-from sensor_msgs.msg import PointCloud2, Temperature
+from sensor_msgs.msg import PointCloud2, PointField, Temperature
 from visualization_msgs.msg import Marker
 from geometry_msgs.msg import Point, Vector3
 from leddar_ros.msg import Specs
-import ros_numpy
 
 TIMESTAMPS, DISTANCE, AMPLITUDE = range(3)
 
@@ -54,30 +53,57 @@ if __name__ == '__main__':
     pub_cloud = rospy.Publisher('scan_cloud', PointCloud2, queue_size=100)
     pub_raw = rospy.Publisher('scan_raw', PointCloud2, queue_size=100)
     frame_id = rospy.get_param('~frame_id', 'map')
-    def echoes_callback(echo):
-        echo['data'] = echo['data'][np.bitwise_and(echo['data']['flags'], 0x01).astype(np.bool)] #keep valid echoes only
-        indices, flags, distances, amplitudes, x, y, z = [echo['data'][x] for x in ['indices', 'flags', 'distances', 'amplitudes', 'x', 'y', 'z']]
-        stamp = rospy.Time.now()
-        if pub_raw.get_num_connections() > 0:
-            pub_raw.publish(ros_numpy.msgify(PointCloud2, echo['data'], stamp, frame_id))
 
-        if pub_cloud.get_num_connections() > 0:
-            struct_cloud = np.empty(indices.size, dtype=[
-              ('x', np.float32),
-              ('y', np.float32),
-              ('z', np.float32),
-              ('intensity', np.float32)
-            ])
+    # The points are built in C++ (LdPointCloudBuilder), there is no per point work in Python
+    def cloud_to_msg(cloud, stamp):
+        msg = PointCloud2()
+        msg.header = Header(stamp=stamp, frame_id=frame_id)
+        msg.height = 1
+        msg.width = cloud['width']
+        msg.fields = [PointField(name=name, offset=offset, datatype=datatype, count=count) for name, offset, datatype, count in cloud['fields']]
+        msg.is_bigendian = False
+        msg.point_step = cloud['point_step']
+        msg.row_step = cloud['point_step'] * cloud['width']
+        msg.is_dense = True
+        msg.data = cloud['data']
+        return msg
+
+    # Cloud with only some of the fields of another cloud, both messages are then built from the same frame
+    POINT_FIELD_DTYPES = {PointField.UINT16: '<u2', PointField.FLOAT32: '<f4', PointField.FLOAT64: '<f8'}
+
+    def select_fields(cloud, names):
+        fields = cloud['fields']
+        points = np.frombuffer(cloud['data'], count=cloud['width'], dtype=np.dtype({
+            'names': [name for name, _, _, _ in fields],
+            'formats': [POINT_FIELD_DTYPES[datatype] for _, _, datatype, _ in fields],
+            'offsets': [offset for _, offset, _, _ in fields],
+            'itemsize': cloud['point_step']}))
+        kept = [(name, datatype) for name, _, datatype, _ in fields if name in names]
+        selected = np.empty(cloud['width'], dtype=[(name, POINT_FIELD_DTYPES[datatype]) for name, datatype in kept])
+        for name, _ in kept:
+            selected[name] = points[name]
+        return {'width': cloud['width'],
+                'point_step': selected.dtype.itemsize,
+                'fields': [(name, selected.dtype.fields[name][1], datatype, 1) for name, datatype in kept],
+                'data': selected.tobytes()}
 
-            struct_cloud['x'] = x
-            struct_cloud['y'] = y
-            struct_cloud['z'] = z
+    dev.set_data_thread_delay(1000)
+    dev.start_data_thread()
 
-            struct_cloud['intensity'] = amplitudes
-            pub_cloud.publish(ros_numpy.msgify(PointCloud2, struct_cloud, stamp, frame_id))
+    while not rospy.is_shutdown():
+        # Valid echoes only, x y z intensity, with all the echo fields when scan_raw is subscribed
+        raw_requested = pub_raw.get_num_connections() > 0
+        fields = leddar.point_fields['PF_ALL'] if raw_requested else leddar.point_fields['PF_DEFAULT']
+        cloud = dev.get_point_cloud(fields, True, 1.0)
+        if cloud is None:
+            continue
 
+        stamp = rospy.Time.now()
+        if raw_requested:
+            pub_raw.publish(cloud_to_msg(cloud, stamp))
+            cloud = select_fields(cloud, ('x', 'y', 'z', 'intensity'))
 
-    dev.set_callback_echo(echoes_callback)
-    dev.set_data_thread_delay(1000)
-    dev.start_data_thread()
-    rospy.spin()
+        if pub_cloud.get_num_connections() > 0:
+            pub_cloud.publish(cloud_to_msg(cloud, stamp))
+
+    dev.stop_data_thread()